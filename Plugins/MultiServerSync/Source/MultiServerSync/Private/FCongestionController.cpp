@@ -0,0 +1,135 @@
+﻿// FCongestionController.cpp
+#include "FCongestionController.h"
+
+FCongestionController::FCongestionController()
+    : Rate(0.0)
+    , BytesInFlight(0)
+    , BaseRttMs(0.0)
+    , CurrentWindowMinRttMs(MAX_dbl)
+    , PreviousWindowMinRttMs(MAX_dbl)
+    , BaseWindowStartTime(0.0)
+    , RecentRttCount(0)
+    , QueuingDelayMs(0.0)
+    , bAboveTarget(false)
+    , SmoothedAckRtt(0.0)
+    , LastIncreaseTime(0.0)
+    , LastDecreaseTime(0.0)
+    , DelayBackoffCount(0)
+    , LossBackoffCount(0)
+{
+    FMemory::Memzero(RecentRttsMs);
+}
+
+void FCongestionController::OnClockRttSample(const FCongestionControlConfig& Config, double RttMs, double Now)
+{
+    if (!(RttMs >= 0.0))
+    {
+        return;
+    }
+
+    if (Rate <= 0.0)
+    {
+        Rate = Config.InitialRateBytesPerSecond;
+        LastIncreaseTime = Now;
+        BaseWindowStartTime = Now;
+    }
+
+    // 기준 RTT: 지난 구간과 이번 구간의 최솟값
+    if (Now - BaseWindowStartTime >= BASE_RTT_WINDOW_SECONDS)
+    {
+        PreviousWindowMinRttMs = CurrentWindowMinRttMs;
+        CurrentWindowMinRttMs = MAX_dbl;
+        BaseWindowStartTime = Now;
+    }
+    CurrentWindowMinRttMs = FMath::Min(CurrentWindowMinRttMs, RttMs);
+    BaseRttMs = FMath::Min(CurrentWindowMinRttMs, PreviousWindowMinRttMs);
+
+    // 현재 RTT: 최근 샘플의 최솟값
+    RecentRttsMs[RecentRttCount % RECENT_RTT_SAMPLES] = RttMs;
+    ++RecentRttCount;
+
+    double FilteredRttMs = MAX_dbl;
+    for (int32 Index = 0; Index < FMath::Min(RecentRttCount, RECENT_RTT_SAMPLES); ++Index)
+    {
+        FilteredRttMs = FMath::Min(FilteredRttMs, RecentRttsMs[Index]);
+    }
+
+    QueuingDelayMs = FilteredRttMs - BaseRttMs;
+    bAboveTarget = QueuingDelayMs > Config.TargetDelayMs;
+
+    if (bAboveTarget)
+    {
+        if (Decrease(Config, Config.DelayDecreaseFactor, Now))
+        {
+            ++DelayBackoffCount;
+        }
+    }
+    else
+    {
+        Increase(Config, Now);
+    }
+}
+
+void FCongestionController::OnAck(const FCongestionControlConfig& Config, int32 Bytes, double RttSeconds, double Now)
+{
+    BytesInFlight = FMath::Max<int64>(BytesInFlight - Bytes, 0);
+
+    if (RttSeconds >= 0.0)
+    {
+        SmoothedAckRtt = SmoothedAckRtt > 0.0 ? SmoothedAckRtt + (RttSeconds - SmoothedAckRtt) / 8.0 : RttSeconds;
+    }
+
+    if (!bAboveTarget)
+    {
+        Increase(Config, Now);
+    }
+}
+
+void FCongestionController::OnLoss(const FCongestionControlConfig& Config, double Now)
+{
+    if (Decrease(Config, Config.LossDecreaseFactor, Now))
+    {
+        ++LossBackoffCount;
+    }
+}
+
+int64 FCongestionController::GetWindowBytes(const FCongestionControlConfig& Config) const
+{
+    const double AckRtt = SmoothedAckRtt > 0.0 ? SmoothedAckRtt : INITIAL_ACK_RTT_SECONDS;
+    return FMath::Max(static_cast<int64>(GetRate(Config) * AckRtt), static_cast<int64>(Config.MinWindowBytes));
+}
+
+void FCongestionController::Increase(const FCongestionControlConfig& Config, double Now)
+{
+    if (Rate <= 0.0)
+    {
+        Rate = Config.InitialRateBytesPerSecond;
+        LastIncreaseTime = Now;
+        return;
+    }
+
+    // 샘플이 한동안 없다가 와도 한 번에 크게 늘지 않도록 경과 시간 제한
+    const double Elapsed = FMath::Clamp(Now - LastIncreaseTime, 0.0, 1.0);
+    Rate = FMath::Min(Rate + Config.AdditiveIncreaseBytesPerSecond * Elapsed, Config.MaxRateBytesPerSecond);
+    LastIncreaseTime = Now;
+}
+
+bool FCongestionController::Decrease(const FCongestionControlConfig& Config, double Factor, double Now)
+{
+    if (Rate <= 0.0)
+    {
+        Rate = Config.InitialRateBytesPerSecond;
+    }
+
+    // 감속 효과가 RTT 샘플에 나타나기 전에 다시 줄이지 않음
+    const double HoldSeconds = FMath::Max((BaseRttMs + QueuingDelayMs) / 1000.0, MIN_DECREASE_INTERVAL_SECONDS);
+    if (Now - LastDecreaseTime < HoldSeconds)
+    {
+        return false;
+    }
+
+    Rate = FMath::Max(Rate * Factor, Config.MinRateBytesPerSecond);
+    LastDecreaseTime = Now;
+    LastIncreaseTime = Now;
+    return true;
+}
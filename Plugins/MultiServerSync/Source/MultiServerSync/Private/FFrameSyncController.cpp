@@ -174,7 +174,7 @@ void FFrameSyncController::SendFrameSyncMessage()
     UE_LOG(LogMultiServerSync, Verbose, TEXT("Sent frame sync message: frame=%lld"), SyncedFrameNumber);
 }
 
-void FFrameSyncController::ProcessFrameSyncMessage(const TArray<uint8>& Message)
+void FFrameSyncController::ProcessFrameSyncMessage(TArrayView<const uint8> Message)
 {
     if (!bIsInitialized || bIsMaster) // 마스터는 동기화 메시지를 처리하지 않음
     {
@@ -0,0 +1,86 @@
+﻿// FLatencyHistogram.cpp
+#include "FLatencyHistogram.h"
+
+int32 FLatencyHistogram::GetBucketIndex(double Microseconds)
+{
+    if (!(Microseconds >= 1.0))
+    {
+        return 0;
+    }
+
+    const double Clamped = FMath::Min(Microseconds, static_cast<double>(MAX_uint32));
+    return FMath::Min(static_cast<int32>(FMath::FloorLog2(static_cast<uint32>(Clamped))) + 1, NUM_BUCKETS - 1);
+}
+
+double FLatencyHistogram::GetBucketUpperBound(int32 BucketIndex)
+{
+    return static_cast<double>(1ull << FMath::Clamp(BucketIndex, 0, NUM_BUCKETS - 1));
+}
+
+void FLatencyHistogram::Merge(const FLatencyHistogram& Other)
+{
+    for (int32 Index = 0; Index < NUM_BUCKETS; ++Index)
+    {
+        Buckets[Index] += Other.Buckets[Index];
+    }
+}
+
+uint64 FLatencyHistogram::GetCount() const
+{
+    uint64 Count = 0;
+    for (int32 Index = 0; Index < NUM_BUCKETS; ++Index)
+    {
+        Count += Buckets[Index];
+    }
+    return Count;
+}
+
+double FLatencyHistogram::GetPercentile(double Percentile) const
+{
+    const uint64 Count = GetCount();
+    if (Count == 0)
+    {
+        return 0.0;
+    }
+
+    const uint64 Target = FMath::Max<uint64>(static_cast<uint64>(FMath::CeilToDouble(FMath::Clamp(Percentile, 0.0, 1.0) * Count)), 1);
+    uint64 Cumulative = 0;
+    for (int32 Index = 0; Index < NUM_BUCKETS; ++Index)
+    {
+        Cumulative += Buckets[Index];
+        if (Cumulative >= Target)
+        {
+            return GetBucketUpperBound(Index);
+        }
+    }
+
+    return GetBucketUpperBound(NUM_BUCKETS - 1);
+}
+
+FString FLatencyHistogram::ToString() const
+{
+    FString Result;
+    for (int32 Index = 0; Index < NUM_BUCKETS; ++Index)
+    {
+        if (Buckets[Index] == 0)
+        {
+            continue;
+        }
+
+        if (!Result.IsEmpty())
+        {
+            Result += TEXT(" ");
+        }
+
+        if (Index == NUM_BUCKETS - 1)
+        {
+            Result += FString::Printf(TEXT(">=%.0fus:%llu"), GetBucketUpperBound(Index - 1), Buckets[Index]);
+        }
+        else
+        {
+            Result += FString::Printf(TEXT("<%.0fus:%llu"), GetBucketUpperBound(Index), Buckets[Index]);
+        }
+    }
+
+    return Result.IsEmpty() ? TEXT("(empty)") : Result;
+}
@@ -0,0 +1,175 @@
+﻿// FMessageCoalescer.cpp
+#include "FMessageCoalescer.h"
+#include "FNetworkManager.h"
+#include "FNetworkTransport.h"
+#include "FSyncLog.h"
+
+FMessageCoalescer::FMessageCoalescer()
+    : SessionToken(FNetworkMessage::MakeSessionToken(FGuid()))
+    , MaxDatagramSize(INetworkTransport::MAX_DATAGRAM_SIZE)
+    , FlushDeadlineSeconds(0.0)
+    , Scheduler(nullptr)
+{
+}
+
+void FMessageCoalescer::SetProjectId(const FGuid& InProjectId)
+{
+    ProjectId = InProjectId;
+    SessionToken = FNetworkMessage::MakeSessionToken(InProjectId);
+}
+
+bool FMessageCoalescer::Enqueue(INetworkTransport* Transport, const FIPv4Endpoint& Target, const uint8* Data, int32 Size, double Now, ETrafficClass Class)
+{
+    if (!Transport)
+    {
+        return false;
+    }
+
+    // 묶음 헤더를 붙이면 한 데이터그램에 담기지 않는 메시지는 바로 보냄
+    if (sizeof(FNetworkMessageHeader) + Size > MaxDatagramSize)
+    {
+        return SendImmediately(Transport, Data, Size, &Target, 1, Class) == 1;
+    }
+
+    FPendingDatagram& Pending = PendingDatagrams.FindOrAdd(Target);
+    const bool bCompact = Data[0] == FNetworkMessage::COMPACT_HEADER_MARKER;
+
+    // 전송 계층이나 헤더 형식이 다르거나 자리가 없으면 모아둔 묶음을 먼저 보냄
+    if (Pending.MessageCount > 0 &&
+        (Pending.Transport != Transport || Pending.bCompact != bCompact || Pending.Buffer.Num() + Size > MaxDatagramSize))
+    {
+        Flush(Target, Pending);
+    }
+
+    if (Pending.MessageCount == 0)
+    {
+        // 묶음 헤더 자리는 보낼 때 채움 (v1 헤더 크기만큼 비워두고 압축 헤더는 뒤쪽에 맞춰 기록)
+        Pending.Transport = Transport;
+        Pending.FirstEnqueueTime = Now;
+        Pending.bCompact = bCompact;
+        Pending.Class = Class;
+        Pending.Buffer.SetNumUninitialized(sizeof(FNetworkMessageHeader), EAllowShrinking::No);
+    }
+
+    Pending.Buffer.Append(Data, Size);
+    if (Class < Pending.Class)
+    {
+        Pending.Class = Class;
+    }
+    ++Pending.MessageCount;
+    ++Stats.CoalescedMessages;
+    return true;
+}
+
+int32 FMessageCoalescer::SendImmediately(INetworkTransport* Transport, const uint8* Data, int32 Size, const FIPv4Endpoint* Targets, int32 TargetCount, ETrafficClass Class)
+{
+    if (!Transport)
+    {
+        return 0;
+    }
+
+    for (int32 Index = 0; Index < TargetCount; ++Index)
+    {
+        FPendingDatagram* Pending = PendingDatagrams.Find(Targets[Index]);
+        if (Pending && Pending->MessageCount > 0 && Pending->Transport == Transport)
+        {
+            Flush(Targets[Index], *Pending);
+        }
+    }
+
+    Stats.BypassedMessages += TargetCount;
+    if (Scheduler)
+    {
+        return Scheduler->SendToMany(Class, Transport, Data, Size, Targets, TargetCount, FPlatformTime::Seconds());
+    }
+
+    return TargetCount == 1
+        ? (Transport->SendTo(Data, Size, Targets[0]) ? 1 : 0)
+        : Transport->SendToMany(Data, Size, Targets, TargetCount);
+}
+
+void FMessageCoalescer::Flush(const FIPv4Endpoint& Target)
+{
+    FPendingDatagram* Pending = PendingDatagrams.Find(Target);
+    if (Pending && Pending->MessageCount > 0)
+    {
+        Flush(Target, *Pending);
+    }
+}
+
+void FMessageCoalescer::Flush(const FIPv4Endpoint& Target, FPendingDatagram& Pending)
+{
+    const uint8* SendData;
+    int32 SendSize;
+
+    if (Pending.MessageCount == 1)
+    {
+        // 메시지가 하나뿐이면 묶음 헤더 없이 원래 메시지 그대로 보냄
+        SendData = Pending.Buffer.GetData() + sizeof(FNetworkMessageHeader);
+        SendSize = Pending.Buffer.Num() - sizeof(FNetworkMessageHeader);
+    }
+    else if (Pending.bCompact)
+    {
+        const int32 PayloadSize = Pending.Buffer.Num() - sizeof(FNetworkMessageHeader);
+        uint8 CompactHeader[FNetworkMessage::MAX_COMPACT_HEADER_SIZE];
+        const int32 HeaderSize = FNetworkMessage::WriteCompactHeader(CompactHeader, ENetworkMessageType::Batch, 0, 0, SessionToken, PayloadSize);
+
+        uint8* HeaderStart = Pending.Buffer.GetData() + sizeof(FNetworkMessageHeader) - HeaderSize;
+        FMemory::Memcpy(HeaderStart, CompactHeader, HeaderSize);
+        SendData = HeaderStart;
+        SendSize = HeaderSize + PayloadSize;
+    }
+    else
+    {
+        FNetworkMessageHeader BatchHeader = FNetworkMessage(ENetworkMessageType::Batch, TArray<uint8>()).GetHeader();
+        BatchHeader.ProjectId = ProjectId;
+        BatchHeader.Size = static_cast<uint16>(Pending.Buffer.Num());
+        FMemory::Memcpy(Pending.Buffer.GetData(), &BatchHeader, sizeof(FNetworkMessageHeader));
+        SendData = Pending.Buffer.GetData();
+        SendSize = Pending.Buffer.Num();
+    }
+
+    const bool bSent = Scheduler
+        ? Scheduler->Send(Pending.Class, Pending.Transport, SendData, SendSize, Target, FPlatformTime::Seconds())
+        : Pending.Transport->SendTo(SendData, SendSize, Target);
+
+    if (bSent)
+    {
+        ++Stats.SentDatagrams;
+    }
+    else
+    {
+        UE_LOG(LogMultiServerSync, Warning, TEXT("Failed to send %d coalesced messages to %s: %d bytes"),
+            Pending.MessageCount, *Target.ToString(), SendSize);
+    }
+
+    Pending.Buffer.Reset();
+    Pending.MessageCount = 0;
+}
+
+void FMessageCoalescer::FlushDue(double Now)
+{
+    for (TPair<FIPv4Endpoint, FPendingDatagram>& Pair : PendingDatagrams)
+    {
+        if (Pair.Value.MessageCount > 0 && Now - Pair.Value.FirstEnqueueTime >= FlushDeadlineSeconds)
+        {
+            Flush(Pair.Key, Pair.Value);
+        }
+    }
+}
+
+void FMessageCoalescer::FlushAll()
+{
+    for (TPair<FIPv4Endpoint, FPendingDatagram>& Pair : PendingDatagrams)
+    {
+        if (Pair.Value.MessageCount > 0)
+        {
+            Flush(Pair.Key, Pair.Value);
+        }
+    }
+}
+
+void FMessageCoalescer::Reset()
+{
+    PendingDatagrams.Reset();
+}
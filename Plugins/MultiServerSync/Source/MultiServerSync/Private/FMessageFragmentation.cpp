@@ -0,0 +1,300 @@
+﻿// FMessageFragmentation.cpp
+#include "FMessageFragmentation.h"
+#include "FSyncLog.h"
+
+// FFragmentNack 구현
+TArray<uint8> FFragmentNack::Serialize() const
+{
+    const uint16 Count = static_cast<uint16>(FMath::Min(MissingFragments.Num(), static_cast<int32>(MAX_uint16)));
+
+    TArray<uint8> Result;
+    Result.SetNumUninitialized(FIXED_SIZE + Count * sizeof(uint16));
+
+    uint8* Cursor = Result.GetData();
+    FMemory::Memcpy(Cursor, &MessageId, sizeof(uint32));
+    Cursor += sizeof(uint32);
+    FMemory::Memcpy(Cursor, &Count, sizeof(uint16));
+    Cursor += sizeof(uint16);
+    FMemory::Memcpy(Cursor, MissingFragments.GetData(), Count * sizeof(uint16));
+
+    return Result;
+}
+
+bool FFragmentNack::Deserialize(TArrayView<const uint8> Bytes)
+{
+    if (Bytes.Num() < FIXED_SIZE)
+    {
+        return false;
+    }
+
+    uint16 Count = 0;
+    FMemory::Memcpy(&MessageId, Bytes.GetData(), sizeof(uint32));
+    FMemory::Memcpy(&Count, Bytes.GetData() + sizeof(uint32), sizeof(uint16));
+
+    if (Bytes.Num() != FIXED_SIZE + Count * static_cast<int32>(sizeof(uint16)))
+    {
+        return false;
+    }
+
+    MissingFragments.SetNumUninitialized(Count);
+    FMemory::Memcpy(MissingFragments.GetData(), Bytes.GetData() + FIXED_SIZE, Count * sizeof(uint16));
+    return true;
+}
+
+// FFragmentReassembler 구현
+FFragmentReassembler::FFragmentReassembler(int64 InMaxBufferedBytes, double InTimeoutSeconds)
+    : RecentlyCompletedNext(0)
+    , MaxBufferedBytes(InMaxBufferedBytes)
+    , TimeoutSeconds(InTimeoutSeconds)
+    , BufferedBytes(0)
+{
+    RecentlyCompleted.Init(MAX_uint64, RECENTLY_COMPLETED_CAPACITY);
+}
+
+EFragmentResult FFragmentReassembler::AddFragment(uint32 SourceId, const FIPv4Endpoint& Sender, const FFragmentHeader& Header,
+    TArrayView<const uint8> Chunk, double Now, TArray<uint8>& OutPayload)
+{
+    // 헤더 검증 (잘못된 조각이 다른 조각의 영역이나 버퍼 밖을 덮어쓰지 않도록)
+    if (Header.FragmentCount == 0 || Header.FragmentIndex >= Header.FragmentCount ||
+        static_cast<uint64>(Header.Offset) + Chunk.Num() > Header.TotalSize ||
+        static_cast<int64>(Header.TotalSize) > MaxBufferedBytes)
+    {
+        Stats.RejectedFragments++;
+        return EFragmentResult::Rejected;
+    }
+
+    const uint64 Key = MakeKey(SourceId, Header.MessageId);
+    FPartialMessage* Partial = PartialMessages.Find(Key);
+
+    if (!Partial)
+    {
+        // 이미 완성한 메시지에 늦게 도착한 재전송 조각
+        if (WasRecentlyCompleted(Key))
+        {
+            Stats.DuplicateFragments++;
+            return EFragmentResult::Duplicate;
+        }
+
+        EvictFor(Header.TotalSize);
+
+        Partial = &PartialMessages.Add(Key);
+        Partial->Sender = Sender;
+        Partial->Payload.SetNumUninitialized(Header.TotalSize);
+        Partial->TotalSize = Header.TotalSize;
+        Partial->ReceivedFragments.Init(false, Header.FragmentCount);
+        Partial->ReceivedCount = 0;
+        Partial->FragmentCount = Header.FragmentCount;
+        Partial->OriginalType = Header.OriginalType;
+        Partial->FirstFragmentTime = Now;
+        Partial->LastNackTime = 0.0;
+        BufferedBytes += Header.TotalSize;
+    }
+    else if (Partial->FragmentCount != Header.FragmentCount || Partial->OriginalType != Header.OriginalType ||
+        Partial->TotalSize != Header.TotalSize)
+    {
+        // 같은 메시지 ID인데 모양이 다른 조각 (발신자 재시작 등)
+        Stats.RejectedFragments++;
+        return EFragmentResult::Rejected;
+    }
+
+    if (Partial->ReceivedFragments[Header.FragmentIndex])
+    {
+        Stats.DuplicateFragments++;
+        return EFragmentResult::Duplicate;
+    }
+
+    // 도착 순서와 무관하게 제자리에 복사
+    FMemory::Memcpy(Partial->Payload.GetData() + Header.Offset, Chunk.GetData(), Chunk.Num());
+    Partial->ReceivedFragments[Header.FragmentIndex] = true;
+    Partial->ReceivedCount++;
+    Partial->LastFragmentTime = Now;
+
+    if (Partial->ReceivedCount < Partial->FragmentCount)
+    {
+        return EFragmentResult::Incomplete;
+    }
+
+    // 완성 - 버퍼를 그대로 넘겨주고 상태 제거
+    OutPayload = MoveTemp(Partial->Payload);
+    RemovePartial(Key);
+
+    RecentlyCompleted[RecentlyCompletedNext] = Key;
+    RecentlyCompletedNext = (RecentlyCompletedNext + 1) % RECENTLY_COMPLETED_CAPACITY;
+
+    Stats.CompletedMessages++;
+    return EFragmentResult::Complete;
+}
+
+int32 FFragmentReassembler::ExpireStale(double Now)
+{
+    TArray<uint64, TInlineAllocator<8>> ExpiredKeys;
+    for (const TPair<uint64, FPartialMessage>& Pair : PartialMessages)
+    {
+        if (Now - Pair.Value.LastFragmentTime > TimeoutSeconds)
+        {
+            ExpiredKeys.Add(Pair.Key);
+        }
+    }
+
+    for (uint64 Key : ExpiredKeys)
+    {
+        const FPartialMessage& Partial = PartialMessages[Key];
+        UE_LOG(LogMultiServerSync, Warning, TEXT("Reassembly timed out for message %u from %s (%d of %d fragments)"),
+            static_cast<uint32>(Key), *Partial.Sender.ToString(), Partial.ReceivedCount, Partial.FragmentCount);
+
+        RemovePartial(Key);
+        Stats.ExpiredMessages++;
+    }
+
+    return ExpiredKeys.Num();
+}
+
+void FFragmentReassembler::CollectStalled(double Now, double NackDelay, int32 MaxMissingPerMessage, TArray<FStalledMessage>& OutStalled)
+{
+    for (TPair<uint64, FPartialMessage>& Pair : PartialMessages)
+    {
+        FPartialMessage& Partial = Pair.Value;
+        if (Now - Partial.LastFragmentTime < NackDelay || Now - Partial.LastNackTime < NackDelay)
+        {
+            continue;
+        }
+
+        FStalledMessage& Stalled = OutStalled.AddDefaulted_GetRef();
+        Stalled.Sender = Partial.Sender;
+        Stalled.Nack.MessageId = static_cast<uint32>(Pair.Key);
+
+        // 비트맵에서 누락 조각만 골라 요청
+        for (int32 Index = 0; Index < Partial.FragmentCount && Stalled.Nack.MissingFragments.Num() < MaxMissingPerMessage; ++Index)
+        {
+            if (!Partial.ReceivedFragments[Index])
+            {
+                Stalled.Nack.MissingFragments.Add(static_cast<uint16>(Index));
+            }
+        }
+
+        Partial.LastNackTime = Now;
+    }
+}
+
+void FFragmentReassembler::Reset()
+{
+    PartialMessages.Empty();
+    RecentlyCompleted.Init(MAX_uint64, RECENTLY_COMPLETED_CAPACITY);
+    RecentlyCompletedNext = 0;
+    BufferedBytes = 0;
+}
+
+FFragmentationStats FFragmentReassembler::GetStats() const
+{
+    FFragmentationStats Result = Stats;
+    Result.PendingMessages = PartialMessages.Num();
+    Result.BufferedBytes = BufferedBytes;
+    return Result;
+}
+
+void FFragmentReassembler::EvictFor(int64 Bytes)
+{
+    while (PartialMessages.Num() > 0 && BufferedBytes + Bytes > MaxBufferedBytes)
+    {
+        // 재조립 중인 메시지는 많지 않으므로 선형 탐색으로 가장 오래된 메시지를 찾음
+        uint64 OldestKey = 0;
+        double OldestTime = TNumericLimits<double>::Max();
+        for (const TPair<uint64, FPartialMessage>& Pair : PartialMessages)
+        {
+            if (Pair.Value.FirstFragmentTime < OldestTime)
+            {
+                OldestTime = Pair.Value.FirstFragmentTime;
+                OldestKey = Pair.Key;
+            }
+        }
+
+        UE_LOG(LogMultiServerSync, Warning, TEXT("Reassembly memory limit reached, dropping message %u"), static_cast<uint32>(OldestKey));
+        RemovePartial(OldestKey);
+        Stats.EvictedMessages++;
+    }
+}
+
+void FFragmentReassembler::RemovePartial(uint64 Key)
+{
+    const FPartialMessage* Partial = PartialMessages.Find(Key);
+    if (Partial)
+    {
+        BufferedBytes -= Partial->TotalSize;
+        PartialMessages.Remove(Key);
+    }
+}
+
+bool FFragmentReassembler::WasRecentlyCompleted(uint64 Key) const
+{
+    return RecentlyCompleted.Contains(Key);
+}
+
+// FFragmentSendCache 구현
+FFragmentSendCache::FFragmentSendCache(int64 InMaxCachedBytes, double InRetentionSeconds)
+    : MaxCachedBytes(InMaxCachedBytes)
+    , RetentionSeconds(InRetentionSeconds)
+    , CachedBytes(0)
+{
+}
+
+void FFragmentSendCache::Add(uint32 MessageId, TArray<TArray<uint8>>&& Datagrams, double Now)
+{
+    int64 Bytes = 0;
+    for (const TArray<uint8>& Datagram : Datagrams)
+    {
+        Bytes += Datagram.Num();
+    }
+
+    // 한도를 넘으면 가장 오래된 메시지부터 버림
+    while (Messages.Num() > 0 && CachedBytes + Bytes > MaxCachedBytes)
+    {
+        CachedBytes -= Messages[0].Bytes;
+        Messages.RemoveAt(0, 1, EAllowShrinking::No);
+    }
+
+    if (Bytes > MaxCachedBytes)
+    {
+        return;
+    }
+
+    FSentMessage& Sent = Messages.AddDefaulted_GetRef();
+    Sent.MessageId = MessageId;
+    Sent.Datagrams = MoveTemp(Datagrams);
+    Sent.Bytes = Bytes;
+    Sent.SendTime = Now;
+    CachedBytes += Bytes;
+}
+
+const TArray<TArray<uint8>>* FFragmentSendCache::Find(uint32 MessageId) const
+{
+    for (const FSentMessage& Sent : Messages)
+    {
+        if (Sent.MessageId == MessageId)
+        {
+            return &Sent.Datagrams;
+        }
+    }
+
+    return nullptr;
+}
+
+void FFragmentSendCache::Expire(double Now)
+{
+    int32 ExpiredCount = 0;
+    while (ExpiredCount < Messages.Num() && Now - Messages[ExpiredCount].SendTime > RetentionSeconds)
+    {
+        CachedBytes -= Messages[ExpiredCount].Bytes;
+        ExpiredCount++;
+    }
+
+    if (ExpiredCount > 0)
+    {
+        Messages.RemoveAt(0, ExpiredCount, EAllowShrinking::No);
+    }
+}
+
+void FFragmentSendCache::Reset()
+{
+    Messages.Empty();
+    CachedBytes = 0;
+}
@@ -10,6 +10,70 @@
 #include "Misc/Timespan.h"
 #include "HAL/PlatformTime.h"
 #include "HAL/PlatformProcess.h"
+#include "Misc/Crc.h"
+#include "HAL/RunnableThread.h"
+
+#if PLATFORM_LINUX
+#include <pthread.h>
+#include <sched.h>
+#include <errno.h>
+#endif
+
+namespace
+{
+    /** 가변 길이 정수 기록 (7비트씩 하위 바이트부터, 최상위 비트는 다음 바이트가 있는지 표시) */
+    int32 WriteVarUint16(uint8* Out, uint16 Value)
+    {
+        int32 Written = 0;
+        while (Value >= 0x80)
+        {
+            Out[Written++] = static_cast<uint8>(Value | 0x80);
+            Value >>= 7;
+        }
+        Out[Written++] = static_cast<uint8>(Value);
+        return Written;
+    }
+
+    /** 가변 길이 정수 읽기 (uint16은 최대 3바이트, 범위를 넘거나 데이터가 끝나면 false) */
+    bool ReadVarUint16(TArrayView<const uint8> Data, int32& InOutOffset, uint16& OutValue)
+    {
+        uint32 Value = 0;
+        for (int32 Shift = 0; Shift < 21; Shift += 7)
+        {
+            if (InOutOffset >= Data.Num())
+            {
+                return false;
+            }
+
+            const uint8 Byte = Data[InOutOffset++];
+            Value |= static_cast<uint32>(Byte & 0x7F) << Shift;
+            if ((Byte & 0x80) == 0)
+            {
+                if (Value > MAX_uint16)
+                {
+                    return false;
+                }
+
+                OutValue = static_cast<uint16>(Value);
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    /** 마스터 정보를 마스터 정보 페이로드로 변환 */
+    FMasterInfoPayload MakeMasterInfoPayload(const FMasterInfo& MasterInfo)
+    {
+        FMasterInfoPayload Payload;
+        Payload.ServerIdHash = MasterInfo.ServerIdHash;
+        Payload.IPAddress = MasterInfo.IPAddress;
+        Payload.Port = MasterInfo.Port;
+        Payload.Priority = MasterInfo.Priority;
+        Payload.ElectionTerm = MasterInfo.ElectionTerm;
+        return Payload;
+    }
+}
 
 // FNetworkMessage 클래스 구현
 FNetworkMessage::FNetworkMessage()
@@ -57,6 +121,90 @@ TArray<uint8> FNetworkMessage::Serialize() const
     return Result;
 }
 
+TArray<uint8> FNetworkMessage::SerializeCompact(uint32 SessionToken) const
+{
+    TArray<uint8> Result;
+    Result.SetNumUninitialized(MAX_COMPACT_HEADER_SIZE + Data.Num());
+
+    const int32 HeaderSize = WriteCompactHeader(Result.GetData(), Header.Type, Header.Flags, Header.SequenceNumber, SessionToken, Data.Num());
+    if (Data.Num() > 0)
+    {
+        FMemory::Memcpy(Result.GetData() + HeaderSize, Data.GetData(), Data.Num());
+    }
+
+    Result.SetNum(HeaderSize + Data.Num(), EAllowShrinking::No);
+    return Result;
+}
+
+int32 FNetworkMessage::WriteCompactHeader(uint8* Out, ENetworkMessageType Type, uint8 Flags, uint16 SequenceNumber, uint32 SessionToken, int32 PayloadSize)
+{
+    checkSlow(PayloadSize >= 0 && PayloadSize <= MAX_uint16);
+
+    // 표식 | 유형 | 플래그 | 세션 토큰 | 페이로드 크기(가변) | 시퀀스 번호(가변)
+    uint8* Cursor = Out;
+    *Cursor++ = COMPACT_HEADER_MARKER;
+    *Cursor++ = static_cast<uint8>(Type);
+    *Cursor++ = Flags;
+    FMemory::Memcpy(Cursor, &SessionToken, sizeof(SessionToken));
+    Cursor += sizeof(SessionToken);
+    Cursor += WriteVarUint16(Cursor, static_cast<uint16>(PayloadSize));
+    Cursor += WriteVarUint16(Cursor, SequenceNumber);
+    return static_cast<int32>(Cursor - Out);
+}
+
+uint32 FNetworkMessage::MakeSessionToken(const FGuid& ProjectId)
+{
+    return FCrc::MemCrc32(&ProjectId, sizeof(FGuid));
+}
+
+bool FNetworkMessage::SerializeFragments(uint32 MessageId, int32 MaxDatagramSize, TArray<TArray<uint8>>& OutDatagrams) const
+{
+    const int32 ChunkSize = MaxDatagramSize - sizeof(FNetworkMessageHeader) - sizeof(FFragmentHeader);
+    if (ChunkSize <= 0)
+    {
+        return false;
+    }
+
+    const int32 FragmentCount = FMath::Max(1, FMath::DivideAndRoundUp(Data.Num(), ChunkSize));
+    if (FragmentCount > MAX_uint16)
+    {
+        return false;
+    }
+
+    // 조각마다 원본 헤더를 복사하고 유형과 크기만 바꿈
+    FNetworkMessageHeader FragmentMessageHeader = Header;
+    FragmentMessageHeader.Type = ENetworkMessageType::Fragment;
+
+    FFragmentHeader FragmentHeader;
+    FragmentHeader.MessageId = MessageId;
+    FragmentHeader.TotalSize = static_cast<uint32>(Data.Num());
+    FragmentHeader.FragmentCount = static_cast<uint16>(FragmentCount);
+    FragmentHeader.OriginalType = static_cast<uint8>(Header.Type);
+
+    OutDatagrams.Reset(FragmentCount);
+    for (int32 Index = 0; Index < FragmentCount; ++Index)
+    {
+        const int32 Offset = Index * ChunkSize;
+        const int32 Size = FMath::Min(ChunkSize, Data.Num() - Offset);
+
+        FragmentMessageHeader.Size = static_cast<uint16>(sizeof(FNetworkMessageHeader) + sizeof(FFragmentHeader) + Size);
+        FragmentHeader.Offset = static_cast<uint32>(Offset);
+        FragmentHeader.FragmentIndex = static_cast<uint16>(Index);
+
+        TArray<uint8>& Datagram = OutDatagrams.AddDefaulted_GetRef();
+        Datagram.SetNumUninitialized(FragmentMessageHeader.Size);
+
+        uint8* Cursor = Datagram.GetData();
+        FMemory::Memcpy(Cursor, &FragmentMessageHeader, sizeof(FNetworkMessageHeader));
+        Cursor += sizeof(FNetworkMessageHeader);
+        FMemory::Memcpy(Cursor, &FragmentHeader, sizeof(FFragmentHeader));
+        Cursor += sizeof(FFragmentHeader);
+        FMemory::Memcpy(Cursor, Data.GetData() + Offset, Size);
+    }
+
+    return true;
+}
+
 bool FNetworkMessage::Deserialize(const TArray<uint8>& RawData)
 {
     // 최소 크기 확인
@@ -95,213 +243,636 @@ bool FNetworkMessage::Deserialize(const TArray<uint8>& RawData)
     return true;
 }
 
-// FNetworkReceiverWorker 클래스 구현
-FNetworkReceiverWorker::FNetworkReceiverWorker(FNetworkManager* InOwner, FSocket* InSocket)
-    : Owner(InOwner)
-    , Socket(InSocket)
-    , bStopRequested(false)
-    , StopEvent(nullptr)
+// FNetworkMessageView 클래스 구현
+FNetworkMessageView::FNetworkMessageView()
+    : SessionToken(0)
+    , bCompact(false)
+    , ReceiveCycles(0)
 {
+    FMemory::Memzero(Header);
 }
 
-FNetworkReceiverWorker::~FNetworkReceiverWorker()
+FNetworkMessageView::FNetworkMessageView(const FNetworkMessage& Message)
+    : Header(Message.Header)
+    , Payload(Message.Data)
+    , SessionToken(0)
+    , bCompact(false)
+    , ReceiveCycles(0)
 {
-    if (StopEvent)
-    {
-        FPlatformProcess::ReturnSynchEventToPool(StopEvent);
-        StopEvent = nullptr;
-    }
 }
 
-bool FNetworkReceiverWorker::Init()
+FNetworkMessageView::FNetworkMessageView(const FNetworkMessageHeader& InHeader, TArrayView<const uint8> InPayload)
+    : Header(InHeader)
+    , Payload(InPayload)
+    , SessionToken(0)
+    , bCompact(false)
+    , ReceiveCycles(0)
 {
-    // 동기화 이벤트 생성
-    StopEvent = FPlatformProcess::GetSynchEventFromPool(false);
-    return StopEvent != nullptr;
 }
 
-uint32 FNetworkReceiverWorker::Run()
+bool FNetworkMessageView::Parse(TArrayView<const uint8> RawData)
 {
-    UE_LOG(LogMultiServerSync, Display, TEXT("Network receiver thread started"));
-
-    const int32 BufferSize = 65507; // UDP 최대 크기
-    TArray<uint8> ReceiveBuffer;
-    ReceiveBuffer.SetNumUninitialized(BufferSize);
+    // v2 압축 헤더
+    if (RawData.Num() > 0 && RawData[0] == FNetworkMessage::COMPACT_HEADER_MARKER)
+    {
+        int32 HeaderSize = 0;
+        int32 PayloadSize = 0;
+        if (!ParseCompactHeader(RawData, Header, SessionToken, HeaderSize, PayloadSize) || HeaderSize + PayloadSize != RawData.Num())
+        {
+            return false;
+        }
 
-    // 소켓 설정
-    Socket->SetNonBlocking(true);
+        bCompact = true;
+        Payload = RawData.Slice(HeaderSize, PayloadSize);
+        return true;
+    }
 
-    // 수신 주소
-    TSharedRef<FInternetAddr> SenderAddr = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->CreateInternetAddr();
+    bCompact = false;
+    SessionToken = 0;
 
-    while (!bStopRequested)
+    // 최소 크기 확인
+    if (RawData.Num() < sizeof(FNetworkMessageHeader))
     {
-        // 메시지 수신 대기
-        int32 BytesRead = 0;
-        if (Socket->RecvFrom(ReceiveBuffer.GetData(), BufferSize, BytesRead, *SenderAddr))
-        {
-            if (BytesRead > 0)
-            {
-                // 수신 데이터 복사
-                TArray<uint8> ReceivedData;
-                ReceivedData.SetNumUninitialized(BytesRead);
-                FMemory::Memcpy(ReceivedData.GetData(), ReceiveBuffer.GetData(), BytesRead);
-
-                // 발신자 엔드포인트 생성
-                FIPv4Address SenderIP(0);
-                uint32 SenderIPValue = 0;
-                SenderAddr->GetIp(SenderIPValue);
-                SenderIP = FIPv4Address(SenderIPValue);
-
-                int32 SenderPort = SenderAddr->GetPort();
-                FIPv4Endpoint SenderEndpoint(SenderIP, SenderPort);
-
-                // 데이터 처리 (메인 스레드에서 처리하면 더 좋을 수 있음)
-                Owner->ProcessReceivedData(ReceivedData, SenderEndpoint);
-            }
-        }
+        return false;
+    }
 
-        // 약간의 휴식으로 CPU 사용률 감소
-        FPlatformProcess::Sleep(0.001f);
+    // 헤더만 복사 (페이로드는 복사하지 않음)
+    FMemory::Memcpy(&Header, RawData.GetData(), sizeof(FNetworkMessageHeader));
+
+    // 매직 넘버와 크기 확인
+    if (Header.MagicNumber != FNetworkMessage::MESSAGE_MAGIC || Header.Size != RawData.Num())
+    {
+        return false;
     }
 
-    UE_LOG(LogMultiServerSync, Display, TEXT("Network receiver thread stopped"));
-    return 0;
+    Payload = RawData.RightChop(sizeof(FNetworkMessageHeader));
+    return true;
 }
 
-void FNetworkReceiverWorker::Stop()
+bool FNetworkMessageView::ParseCompactHeader(TArrayView<const uint8> RawData, FNetworkMessageHeader& OutHeader, uint32& OutSessionToken, int32& OutHeaderSize, int32& OutPayloadSize)
 {
-    bStopRequested = true;
+    // 고정 부분 (표식 1 + 유형 1 + 플래그 1 + 세션 토큰 4)
+    constexpr int32 FixedSize = 3 + sizeof(uint32);
+    if (RawData.Num() < FixedSize || RawData[0] != FNetworkMessage::COMPACT_HEADER_MARKER)
+    {
+        return false;
+    }
 
-    if (StopEvent)
+    int32 Offset = FixedSize;
+    uint16 PayloadSize = 0;
+    uint16 SequenceNumber = 0;
+    if (!ReadVarUint16(RawData, Offset, PayloadSize) || !ReadVarUint16(RawData, Offset, SequenceNumber) ||
+        sizeof(FNetworkMessageHeader) + PayloadSize > MAX_uint16)
     {
-        StopEvent->Trigger();
+        return false;
     }
+
+    // 이후 처리 경로가 헤더 형식을 구분하지 않도록 v1 헤더 구조체로 풀어 둠
+    OutHeader.MagicNumber = FNetworkMessage::MESSAGE_MAGIC;
+    OutHeader.Type = static_cast<ENetworkMessageType>(RawData[1]);
+    OutHeader.Size = static_cast<uint16>(sizeof(FNetworkMessageHeader) + PayloadSize);
+    OutHeader.SequenceNumber = SequenceNumber;
+    OutHeader.ProjectId = FGuid();
+    OutHeader.Version = FNetworkMessage::COMPACT_HEADER_VERSION;
+    OutHeader.Flags = RawData[2];
+    FMemory::Memcpy(&OutSessionToken, RawData.GetData() + 3, sizeof(uint32));
+
+    OutHeaderSize = Offset;
+    OutPayloadSize = PayloadSize;
+    return true;
 }
 
-void FNetworkReceiverWorker::Exit()
+bool FNetworkMessageView::DetachPiggybackAck(FSelectiveAck& OutAck)
 {
-    // 스레드 종료 시 필요한 정리 작업
+    int32 PayloadSize = 0;
+    if (!(Header.Flags & FNetworkMessage::FLAG_HAS_ACK) ||
+        !OutAck.ReadTrailer(Payload, PayloadSize, (Header.Flags & FNetworkMessage::FLAG_CUMULATIVE_ACK) != 0))
+    {
+        return false;
+    }
+
+    Header.Size = static_cast<uint16>(Header.Size - (Payload.Num() - PayloadSize));
+    Header.Flags &= ~(FNetworkMessage::FLAG_HAS_ACK | FNetworkMessage::FLAG_CUMULATIVE_ACK);
+    Payload = Payload.Left(PayloadSize);
+    return true;
 }
 
-FNetworkManager::FNetworkManager()
-    : BroadcastSocket(nullptr)
-    , ReceiveSocket(nullptr)
-    , ReceiverThread(nullptr)
-    , MessageHandler(nullptr)
-    , bIsInitialized(false)
-    , CurrentSequenceNumber(0)
-    , Port(DEFAULT_PORT)
-    , ReceiverWorker(nullptr)
-    , bIsMaster(false)
-    , MasterPriority(0.0f)
-    , bElectionInProgress(false)
-    , CurrentElectionTerm(0)
-    , LastMasterAnnouncementTime(0.0)
-    , LastElectionStartTime(0.0)
-    , HardwareTimerInitTime(0)
-    , HardwareTimerOffset(0)
+int32 FNetworkMessageView::PeekMessageSize(TArrayView<const uint8> RawData)
 {
-    // 프로젝트 ID 초기화
-    ProjectId = FGuid::NewGuid();
-
-    // 호스트 이름 가져오기
-    ISocketSubsystem* SocketSubsystem = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM);
-    if (SocketSubsystem)
+    if (RawData.Num() > 0 && RawData[0] == FNetworkMessage::COMPACT_HEADER_MARKER)
     {
-        SocketSubsystem->GetHostName(HostName);
+        FNetworkMessageHeader CompactHeader;
+        uint32 CompactSessionToken = 0;
+        int32 HeaderSize = 0;
+        int32 PayloadSize = 0;
+        return ParseCompactHeader(RawData, CompactHeader, CompactSessionToken, HeaderSize, PayloadSize) ? HeaderSize + PayloadSize : 0;
     }
 
-    // 프로젝트 버전 설정
-    ProjectVersion = TEXT("1.0");
+    if (RawData.Num() < sizeof(FNetworkMessageHeader))
+    {
+        return 0;
+    }
 
-    // 마스터 우선순위 랜덤 초기화 (0.1 ~ 0.9)
-    MasterPriority = 0.1f + 0.8f * FMath::FRand();
+    uint16 Size = 0;
+    FMemory::Memcpy(&Size, RawData.GetData() + STRUCT_OFFSET(FNetworkMessageHeader, Size), sizeof(Size));
+    return Size;
 }
 
-// 마스터 상태 확인 메서드
-bool FNetworkManager::IsMaster() const
+int64 FNetworkMessageView::GetReceiveAgeMicroseconds() const
 {
-    return bIsMaster;
-}
+    if (ReceiveCycles == 0)
+    {
+        return 0;
+    }
 
-// 마스터 ID 반환 메서드
-FString FNetworkManager::GetMasterId() const
-{
-    return CurrentMaster.ServerId;
+    const uint64 NowCycles = FPlatformTime::Cycles64();
+    if (NowCycles <= ReceiveCycles)
+    {
+        return 0;
+    }
+
+    return static_cast<int64>(FPlatformTime::ToSeconds64(NowCycles - ReceiveCycles) * 1000000.0);
 }
 
-// 마스터 정보 반환 메서드
-FMasterInfo FNetworkManager::GetMasterInfo() const
+// FNetworkReceiverWorker 클래스 구현
+FNetworkReceiverWorker::FNetworkReceiverWorker(FSocket* InSocket, FDatagramHandler InHandler, EReceiverWaitMode InWaitMode)
+    : WaitMode(InWaitMode)
+    , bStopRequested(false)
+    , StopEvent(nullptr)
 {
-    return CurrentMaster;
+    for (std::atomic<uint64>& Bucket : WakeupBuckets)
+    {
+        Bucket.store(0, std::memory_order_relaxed);
+    }
+
+    OwnedTransport = MakeUnique<FSocketTransport>(InSocket, false);
+
+    AddTransport(OwnedTransport.Get(), [Handler = MoveTemp(InHandler)](const FReceivedDatagram* Datagrams, int32 Count)
+        {
+            for (int32 Index = 0; Index < Count; ++Index)
+            {
+                TArray<uint8> ReceivedData(Datagrams[Index].Data, Datagrams[Index].Size);
+                Handler(ReceivedData, Datagrams[Index].Sender);
+            }
+        });
 }
 
-// 마스터 우선순위 설정 메서드
-void FNetworkManager::SetMasterPriority(float Priority)
+FNetworkReceiverWorker::FNetworkReceiverWorker(INetworkTransport* InTransport, FDatagramBatchHandler InHandler, EReceiverWaitMode InWaitMode)
+    : WaitMode(InWaitMode)
+    , bStopRequested(false)
+    , StopEvent(nullptr)
 {
-    MasterPriority = FMath::Clamp(Priority, 0.0f, 1.0f);
-    UE_LOG(LogMultiServerSync, Display, TEXT("Master priority set to %.2f"), MasterPriority);
+    for (std::atomic<uint64>& Bucket : WakeupBuckets)
+    {
+        Bucket.store(0, std::memory_order_relaxed);
+    }
+
+    AddTransport(InTransport, MoveTemp(InHandler));
 }
 
-// 마스터 변경 핸들러 등록 메서드
-void FNetworkManager::RegisterMasterChangeHandler(TFunction<void(const FString&, bool)> Handler)
+bool FNetworkReceiverWorker::AddTransport(INetworkTransport* InTransport, FDatagramBatchHandler InHandler)
 {
-    MasterChangeHandler = Handler;
+    if (Reactor.Add(InTransport) == INDEX_NONE)
+    {
+        UE_LOG(LogMultiServerSync, Error, TEXT("Failed to add transport to receiver worker"));
+        return false;
+    }
+
+    BatchHandlers.Add(MoveTemp(InHandler));
+    return true;
 }
 
-FNetworkManager::~FNetworkManager()
+FNetworkReceiverWorker::~FNetworkReceiverWorker()
 {
-    if (bIsInitialized)
+    if (StopEvent)
     {
-        Shutdown();
+        FPlatformProcess::ReturnSynchEventToPool(StopEvent);
+        StopEvent = nullptr;
     }
 }
 
-bool FNetworkManager::Initialize()
+bool FNetworkReceiverWorker::Init()
 {
-    UE_LOG(LogMultiServerSync, Display, TEXT("Initializing Network Manager..."));
+    // 동기화 이벤트 생성
+    StopEvent = FPlatformProcess::GetSynchEventFromPool(false);
 
-    if (!InitializeSockets())
+    // Init은 수신 스레드에서 호출되므로 스레드 단위 설정을 여기서 적용
+    ApplyThreadSettings();
+
+    return StopEvent != nullptr;
+}
+
+void FNetworkReceiverWorker::ApplyThreadSettings()
+{
+    if (!ThreadSettings.IsLowLatency())
     {
-        UE_LOG(LogMultiServerSync, Error, TEXT("Failed to initialize sockets"));
-        return false;
+        return;
     }
 
-    if (!StartReceiverThread())
+    // 각 항목은 독립적으로 적용하며, 실패한 항목은 경고만 남기고 일반 동작으로 대체
+    if (ThreadSettings.BusyPollMicroseconds > 0)
     {
-        UE_LOG(LogMultiServerSync, Error, TEXT("Failed to start receiver thread"));
-        return false;
+        int32 EnabledCount = 0;
+        for (int32 TransportIndex = 0; TransportIndex < Reactor.Num(); ++TransportIndex)
+        {
+            if (Reactor.Get(TransportIndex)->SetBusyPoll(ThreadSettings.BusyPollMicroseconds))
+            {
+                EnabledCount++;
+            }
+        }
+
+        if (EnabledCount < Reactor.Num())
+        {
+            UE_LOG(LogMultiServerSync, Warning, TEXT("Receiver busy poll enabled on %d of %d sockets (unsupported backend or insufficient privilege)"),
+                EnabledCount, Reactor.Num());
+        }
     }
 
-    // 하드웨어 타이머 보정
-    CalibrateHardwareTimer();
+    if (ThreadSettings.CpuCore != INDEX_NONE)
+    {
+        const int32 CoreCount = FPlatformMisc::NumberOfCoresIncludingHyperthreads();
+        if (ThreadSettings.CpuCore < 0 || ThreadSettings.CpuCore >= FMath::Min(CoreCount, 64))
+        {
+            UE_LOG(LogMultiServerSync, Warning, TEXT("Receiver CPU core %d is out of range (%d cores), thread is not pinned"),
+                ThreadSettings.CpuCore, CoreCount);
+        }
+        else
+        {
+#if PLATFORM_LINUX
+            cpu_set_t CpuSet;
+            CPU_ZERO(&CpuSet);
+            CPU_SET(ThreadSettings.CpuCore, &CpuSet);
+            const int Result = pthread_setaffinity_np(pthread_self(), sizeof(CpuSet), &CpuSet);
+            if (Result != 0)
+            {
+                UE_LOG(LogMultiServerSync, Warning, TEXT("Failed to pin receiver thread to core %d (error %d)"), ThreadSettings.CpuCore, Result);
+            }
+#else
+            FPlatformProcess::SetThreadAffinityMask(1ull << ThreadSettings.CpuCore);
+#endif
+        }
+    }
 
-    UE_LOG(LogMultiServerSync, Display, TEXT("Network Manager initialized successfully"));
+    if (ThreadSettings.RealtimePriority > 0)
+    {
+#if PLATFORM_LINUX
+        sched_param Param;
+        FMemory::Memzero(Param);
+        Param.sched_priority = FMath::Clamp(ThreadSettings.RealtimePriority, sched_get_priority_min(SCHED_FIFO), sched_get_priority_max(SCHED_FIFO));
 
-    bIsInitialized = true;
+        // CAP_SYS_NICE나 RLIMIT_RTPRIO가 없으면 EPERM - 일반 스케줄링으로 계속 동작
+        const int Result = pthread_setschedparam(pthread_self(), SCHED_FIFO, &Param);
+        if (Result == EPERM)
+        {
+            UE_LOG(LogMultiServerSync, Warning, TEXT("SCHED_FIFO priority %d not permitted for receiver thread, using normal scheduling"), Param.sched_priority);
+        }
+        else if (Result != 0)
+        {
+            UE_LOG(LogMultiServerSync, Warning, TEXT("Failed to set SCHED_FIFO priority %d for receiver thread (error %d)"), Param.sched_priority, Result);
+        }
+#else
+        if (FRunnableThread* CurrentThread = FRunnableThread::GetRunnableThread())
+        {
+            CurrentThread->SetThreadPriority(TPri_TimeCritical);
+        }
+#endif
+    }
 
-    // 서버 탐색 시작
-    SendDiscoveryMessage();
+    UE_LOG(LogMultiServerSync, Display, TEXT("Receiver thread low-latency settings: %s"), *ThreadSettings.ToString());
+}
 
-    // 마스터 정보 요청
-    FString QueryData = HostName;
-    TArray<uint8> QueryBytes;
-    QueryBytes.SetNum(QueryData.Len() * sizeof(TCHAR));
-    FMemory::Memcpy(QueryBytes.GetData(), *QueryData, QueryData.Len() * sizeof(TCHAR));
+uint32 FNetworkReceiverWorker::Run()
+{
+    UE_LOG(LogMultiServerSync, Display, TEXT("Network receiver thread started (mode: %s, backend: %s, sockets: %d, multiplexer: %s)"),
+        WaitMode == EReceiverWaitMode::EventDriven ? TEXT("EventDriven") : TEXT("SleepPolling"),
+        Reactor.Num() > 0 ? Reactor.Get(0)->GetBackendName() : TEXT("none"),
+        Reactor.Num(), Reactor.GetMultiplexerName());
 
-    FNetworkMessage Message(ENetworkMessageType::MasterQuery, QueryBytes);
-    Message.SetProjectId(ProjectId);
-    Message.SetSequenceNumber(GetNextSequenceNumber());
+    // 배치 수신 결과 (데이터는 전송 계층의 미리 할당된 버퍼를 가리킴)
+    FReceivedDatagram Batch[INetworkTransport::MAX_RECEIVE_BATCH];
 
-    // 처음 5초 동안 2초 대기 후 마스터 정보가 없으면 마스터 선출 시작
-    FTimerHandle MasterElectionTimerHandle;
-    FTimerDelegate MasterElectionTimerDelegate;
-    MasterElectionTimerDelegate.BindLambda([this]() {
-        if (CurrentMaster.ServerId.IsEmpty() && !bElectionInProgress)
+    if (WaitMode == EReceiverWaitMode::EventDriven)
+    {
+        const FTimespan WaitTimeout = FTimespan::FromMilliseconds(RECEIVE_WAIT_TIMEOUT_MS);
+        const uint64 SpinCycles = ThreadSettings.SpinMicroseconds > 0
+            ? static_cast<uint64>(ThreadSettings.SpinMicroseconds / (FPlatformTime::GetSecondsPerCycle64() * 1000000.0))
+            : 0;
+
+        while (!bStopRequested)
         {
-            StartMasterElection();
-        }
+            uint32 ReadyMask = 0;
+
+            // 저지연 설정이면 잠들기 전에 잠시 논블로킹으로 확인하여 스케줄러 웨이크업 지연을 피함
+            if (SpinCycles > 0)
+            {
+                const uint64 SpinDeadline = FPlatformTime::Cycles64() + SpinCycles;
+                while (!bStopRequested && (ReadyMask = Reactor.Poll()) == 0 && FPlatformTime::Cycles64() < SpinDeadline)
+                {
+                    FPlatformProcess::Yield();
+                }
+            }
+
+            // 하나 이상의 소켓이 읽기 가능 상태가 될 때까지 대기 (Stop()의 리액터 웨이크업 또는 타임아웃으로 깨어남)
+            if (ReadyMask == 0 && !bStopRequested)
+            {
+                ReadyMask = Reactor.Wait(WaitTimeout);
+            }
+
+            // 한 번 깨어날 때 준비된 소켓의 큐에 쌓인 데이터그램을 추가한 순서대로 모두 처리
+            for (int32 TransportIndex = 0; TransportIndex < Reactor.Num(); ++TransportIndex)
+            {
+                if (ReadyMask & (1u << TransportIndex))
+                {
+                    DrainPendingDatagrams(TransportIndex, Batch);
+                }
+            }
+        }
+    }
+    else
+    {
+        while (!bStopRequested)
+        {
+            for (int32 TransportIndex = 0; TransportIndex < Reactor.Num(); ++TransportIndex)
+            {
+                DrainPendingDatagrams(TransportIndex, Batch);
+            }
+
+            // 약간의 휴식으로 CPU 사용률 감소
+            FPlatformProcess::Sleep(0.001f);
+        }
+    }
+
+    UE_LOG(LogMultiServerSync, Display, TEXT("Network receiver thread stopped"));
+    return 0;
+}
+
+int32 FNetworkReceiverWorker::DrainPendingDatagrams(int32 TransportIndex, FReceivedDatagram* Batch)
+{
+    INetworkTransport* Transport = Reactor.Get(TransportIndex);
+    const FDatagramBatchHandler& BatchHandler = BatchHandlers[TransportIndex];
+    int32 ProcessedCount = 0;
+
+    while (!bStopRequested)
+    {
+        const int32 ReceivedCount = Transport->ReceiveBatch(Batch, INetworkTransport::MAX_RECEIVE_BATCH);
+        if (ReceivedCount <= 0)
+        {
+            break;
+        }
+
+        // 빈 데이터그램은 Stop()의 웨이크업 신호이므로 제외
+        int32 ValidCount = 0;
+        for (int32 Index = 0; Index < ReceivedCount; ++Index)
+        {
+            if (Batch[Index].Size > 0)
+            {
+                Batch[ValidCount++] = Batch[Index];
+            }
+        }
+
+        if (ValidCount > 0)
+        {
+            RecordWakeupLatency(Batch, ValidCount);
+            BatchHandler(Batch, ValidCount);
+            ProcessedCount += ValidCount;
+        }
+
+        // 핸들러가 보관하지 않은 버퍼는 여기서 풀로 반환
+        for (int32 Index = 0; Index < ReceivedCount; ++Index)
+        {
+            Batch[Index].Buffer.SafeRelease();
+        }
+    }
+
+    return ProcessedCount;
+}
+
+void FNetworkReceiverWorker::RecordWakeupLatency(const FReceivedDatagram* Batch, int32 Count)
+{
+    const uint64 NowCycles = FPlatformTime::Cycles64();
+
+    for (int32 Index = 0; Index < Count; ++Index)
+    {
+        const uint64 ReceiveCycles = Batch[Index].ReceiveCycles;
+        if (ReceiveCycles == 0 || ReceiveCycles > NowCycles)
+        {
+            continue;
+        }
+
+        const double LatencyMicroseconds = FPlatformTime::ToSeconds64(NowCycles - ReceiveCycles) * 1000000.0;
+        WakeupBuckets[FLatencyHistogram::GetBucketIndex(LatencyMicroseconds)].fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+FLatencyHistogram FNetworkReceiverWorker::GetWakeupHistogram() const
+{
+    FLatencyHistogram Histogram;
+    for (int32 Index = 0; Index < FLatencyHistogram::NUM_BUCKETS; ++Index)
+    {
+        Histogram.Buckets[Index] = WakeupBuckets[Index].load(std::memory_order_relaxed);
+    }
+    return Histogram;
+}
+
+void FNetworkReceiverWorker::SendWakeUpDatagram()
+{
+    if (Reactor.Num() == 0)
+    {
+        return;
+    }
+
+    // 루프백으로 자기 포트에 빈 데이터그램을 보내 리액터 대기를 즉시 깨움
+    INetworkTransport* Transport = Reactor.Get(0);
+    uint8 Dummy = 0;
+    Transport->SendTo(&Dummy, 0, FIPv4Endpoint(FIPv4Address(127, 0, 0, 1), Transport->GetLocalPort()));
+}
+
+void FNetworkReceiverWorker::Stop()
+{
+    bStopRequested = true;
+
+    if (StopEvent)
+    {
+        StopEvent->Trigger();
+    }
+
+    // 이벤트 기반 모드에서는 소켓 대기 중이므로 리액터를 깨움
+    // (epoll을 쓰지 않는 플랫폼에서는 웨이크업 데이터그램으로 대신함)
+    if (WaitMode == EReceiverWaitMode::EventDriven && !Reactor.Wake())
+    {
+        SendWakeUpDatagram();
+    }
+}
+
+void FNetworkReceiverWorker::Exit()
+{
+    // 스레드 종료 시 필요한 정리 작업
+}
+
+FNetworkManager::FNetworkManager()
+    : DataTransport(nullptr)
+    , bFanOutTargetsDirty(false)
+    , bFanOutCompact(false)
+    , bFanOutBatch(false)
+    , PathMtu(DEFAULT_PATH_MTU)
+    , NextFragmentMessageId(0)
+    , bCoalescingEnabled(true)
+    , bCompactHeadersEnabled(true)
+    , SessionToken(0)
+    , bIsInitialized(false)
+    , CurrentSequenceNumber(0)
+    , Port(DEFAULT_PORT)
+    , ReceiverWaitMode(EReceiverWaitMode::EventDriven)
+    , ReceiveBackend(EReceiveBackend::SingleRead)
+    , ReceiveShardCount(1)
+    , InboxCapacity(DEFAULT_INBOX_CAPACITY)
+    , InboxEnqueuedPackets(0)
+    , InboxDroppedPackets(0)
+    , InboxDropLogCycles(0)
+    , InboxDroppedAtLastLog(0)
+    , InboxDispatchedPackets(0)
+    , InboxLatencySumMs(0.0)
+    , InboxLastLatencyMs(0.0)
+    , InboxMaxLatencyMs(0.0)
+    , bIsMaster(false)
+    , MasterPriority(0.0f)
+    , bElectionInProgress(false)
+    , CurrentElectionTerm(0)
+    , LastMasterAnnouncementTime(0.0)
+    , LastElectionStartTime(0.0)
+    , HardwareTimerInitTime(0)
+    , HardwareTimerOffset(0)
+    , LastRetryCheckTime(0.0)
+    , NextRetryDeadline(MAX_dbl)
+    , MinRetransmissionTimeout(DEFAULT_MIN_RETRANSMISSION_TIMEOUT)
+    , MaxRetransmissionTimeout(DEFAULT_MAX_RETRANSMISSION_TIMEOUT)
+    , bCongestionControlEnabled(true)
+    , bSelectiveAckEnabled(true)
+    , bPiggybackAcksEnabled(true)
+    , AckDelaySeconds(DEFAULT_ACK_DELAY_SECONDS)
+{
+    // 프로젝트 ID 초기화
+    ProjectId = FGuid::NewGuid();
+    SessionToken = FNetworkMessage::MakeSessionToken(ProjectId);
+
+    // 호스트 이름 가져오기
+    ISocketSubsystem* SocketSubsystem = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM);
+    if (SocketSubsystem)
+    {
+        SocketSubsystem->GetHostName(HostName);
+    }
+    LocalServerIdHash = HashServerId(HostName);
+
+    // 프로젝트 버전 설정
+    ProjectVersion = TEXT("1.0");
+
+    // 마스터 우선순위 랜덤 초기화 (0.1 ~ 0.9)
+    MasterPriority = 0.1f + 0.8f * FMath::FRand();
+
+    // 재시작 직후 이전 실행의 조각 메시지 ID와 겹치지 않도록 임의 값에서 시작
+    NextFragmentMessageId = static_cast<uint32>(FMath::Rand());
+
+    // 묶음 데이터그램은 조각과 같은 크기 제한을 따름
+    MessageCoalescer.SetMaxDatagramSize(GetMaxDatagramSize());
+    MessageCoalescer.SetProjectId(ProjectId);
+    MessageCoalescer.SetScheduler(&TrafficScheduler);
+
+    // 메시지 유형별 내부 처리 함수 테이블 구성
+    for (FInternalMessageHandler& Handler : InternalMessageHandlers)
+    {
+        Handler = nullptr;
+    }
+    RegisterInternalMessageHandlers();
+}
+
+// 마스터 상태 확인 메서드
+bool FNetworkManager::IsMaster() const
+{
+    return bIsMaster;
+}
+
+// 마스터 ID 반환 메서드
+FString FNetworkManager::GetMasterId() const
+{
+    // 마스터를 알게 된 뒤에 탐색된 서버도 서버 ID로 표시되도록 조회할 때마다 해시를 변환
+    return CurrentMaster.ServerId.IsEmpty() ? FString() : ResolveServerId(CurrentMaster.ServerIdHash);
+}
+
+// 마스터 정보 반환 메서드
+FMasterInfo FNetworkManager::GetMasterInfo() const
+{
+    FMasterInfo MasterInfo = CurrentMaster;
+    MasterInfo.ServerId = GetMasterId();
+    return MasterInfo;
+}
+
+// 마스터 우선순위 설정 메서드
+void FNetworkManager::SetMasterPriority(float Priority)
+{
+    MasterPriority = FMath::Clamp(Priority, 0.0f, 1.0f);
+    UE_LOG(LogMultiServerSync, Display, TEXT("Master priority set to %.2f"), MasterPriority);
+}
+
+// 마스터 변경 핸들러 등록 메서드
+void FNetworkManager::RegisterMasterChangeHandler(TFunction<void(const FString&, bool)> Handler)
+{
+    MasterChangeHandler = Handler;
+}
+
+FNetworkManager::~FNetworkManager()
+{
+    if (bIsInitialized)
+    {
+        Shutdown();
+    }
+}
+
+bool FNetworkManager::Initialize()
+{
+    UE_LOG(LogMultiServerSync, Display, TEXT("Initializing Network Manager..."));
+
+    if (!InitializeSockets())
+    {
+        UE_LOG(LogMultiServerSync, Error, TEXT("Failed to initialize sockets"));
+        return false;
+    }
+
+    if (!StartReceiverThread())
+    {
+        UE_LOG(LogMultiServerSync, Error, TEXT("Failed to start receiver thread"));
+        return false;
+    }
+
+    // 수신 인박스 처리 틱 등록 (매 프레임, 수신 메시지는 모두 이 틱에서 게임 스레드로 처리됨)
+    if (!InboxTickHandle.IsValid())
+    {
+        InboxTickHandle = FTSTicker::GetCoreTicker().AddTicker(
+            FTickerDelegate::CreateRaw(this, &FNetworkManager::TickInbox), 0.0f);
+    }
+
+    // 하드웨어 타이머 보정
+    CalibrateHardwareTimer();
+
+    UE_LOG(LogMultiServerSync, Display, TEXT("Network Manager initialized successfully"));
+
+    bIsInitialized = true;
+
+    // 서버 탐색 시작
+    SendDiscoveryMessage();
+
+    // 마스터 정보 요청
+    FNetworkMessage Message = FNetworkMessage::MakePayloadMessage<ENetworkMessageType::MasterQuery>(FServerIdPayload(LocalServerIdHash));
+    Message.SetProjectId(ProjectId);
+    Message.SetSequenceNumber(GetNextSequenceNumber());
+
+    // 처음 5초 동안 2초 대기 후 마스터 정보가 없으면 마스터 선출 시작
+    FTimerHandle MasterElectionTimerHandle;
+    FTimerDelegate MasterElectionTimerDelegate;
+    MasterElectionTimerDelegate.BindLambda([this]() {
+        if (CurrentMaster.ServerId.IsEmpty() && !bElectionInProgress)
+        {
+            StartMasterElection();
+        }
         });
 
     // 현재는 타이머 구현을 하지 않지만, 실제 구현에서는 타이머를 사용해야 합니다.
@@ -312,8 +883,8 @@ bool FNetworkManager::Initialize()
     FTickerDelegate TickDelegate = FTickerDelegate::CreateRaw(this, &FNetworkManager::MasterSlaveProtocolTick);
     MasterSlaveTickHandle = FTSTicker::GetCoreTicker().AddTicker(TickDelegate, 1.0f); // 1초마다 호출
 
-    // 네트워크 지연 통계 초기화
-    ServerLatencyStats.Empty();
+    // 피어별 상태 초기화 (지연 통계, 수신 시퀀스 추적기, ACK 대기 목록)
+    PeerRegistry.Reset();
 
     // 핑 시퀀스 번호 초기화
     NextPingSequenceNumber = 0;
@@ -343,42 +914,27 @@ bool FNetworkManager::Initialize()
 
     // 확인 대기 중인 메시지 정리
     PendingAcknowledgements.Empty();
-    EndpointSequenceMap.Empty();
+    ReliableBacklog.Reset();
+    PeersWithUnsentAcks.Reset();
 
     // 메시지 재전송 틱 추가
-    if (MessageRetryTickHandle.IsValid())
-    {
-        FTSTicker::GetCoreTicker().RemoveTicker(MessageRetryTickHandle);
-        MessageRetryTickHandle.Reset();
-    }
-
     FTickerDelegate RetryTickDelegate = FTickerDelegate::CreateRaw(this, &FNetworkManager::CheckMessageRetries);
     MessageRetryTickHandle = FTSTicker::GetCoreTicker().AddTicker(RetryTickDelegate, MESSAGE_RETRY_INTERVAL);
 
     // 메시지 확인 관련 변수 초기화
     LastRetryCheckTime = FPlatformTime::Seconds();
-    PendingAcknowledgements.Empty();
-    EndpointSequenceMap.Empty();
+    NextRetryDeadline = MAX_dbl;
 
     // 시퀀스 관리 초기화
     bOrderGuaranteedEnabled = false;
-    EndpointSequenceTrackers.Empty();
 
-    // 시퀀스 관리 틱 추가
-    if (SequenceManagementTickHandle.IsValid())
+    // 조각 재조립 틱 추가 (재전송 요청 지연의 절반 간격)
+    if (!FragmentTickHandle.IsValid())
     {
-        FTSTicker::GetCoreTicker().RemoveTicker(SequenceManagementTickHandle);
-        SequenceManagementTickHandle.Reset();
+        FragmentTickHandle = FTSTicker::GetCoreTicker().AddTicker(
+            FTickerDelegate::CreateRaw(this, &FNetworkManager::TickFragmentReassembly), static_cast<float>(FRAGMENT_NACK_DELAY_SECONDS * 0.5));
     }
 
-    FTickerDelegate SequenceTickDelegate = FTickerDelegate::CreateRaw(this, &FNetworkManager::CheckSequenceManagement);
-    SequenceManagementTickHandle = FTSTicker::GetCoreTicker().AddTicker(SequenceTickDelegate, SEQUENCE_MANAGEMENT_INTERVAL);
-
-    // 메시지 확인 관련 변수 초기화
-    LastRetryCheckTime = FPlatformTime::Seconds();
-    PendingAcknowledgements.Empty();
-    EndpointSequenceMap.Empty();
-
     return true;
 }
 
@@ -413,41 +969,68 @@ void FNetworkManager::Shutdown()
 {
     UE_LOG(LogMultiServerSync, Display, TEXT("Shutting down Network Manager..."));
 
-    // 수신 스레드 중지
-    if (ReceiverWorker)
+    // 모든 샤드에 중지를 먼저 요청한 뒤 스레드 종료를 기다림 (각 샤드의 리액터가 따로 깨어나므로 동시에 종료됨)
+    for (const TUniquePtr<FReceiveShard>& Shard : ReceiveShards)
     {
-        ReceiverWorker->Stop();
+        if (Shard->Worker)
+        {
+            Shard->Worker->Stop();
+        }
     }
 
-    if (ReceiverThread)
+    for (const TUniquePtr<FReceiveShard>& Shard : ReceiveShards)
     {
-        ReceiverThread->Kill(true);
-        delete ReceiverThread;
-        ReceiverThread = nullptr;
+        if (Shard->Thread)
+        {
+            Shard->Thread->Kill(true);
+            delete Shard->Thread;
+            Shard->Thread = nullptr;
+        }
     }
 
-    // 소켓 정리
-    if (BroadcastSocket)
+    // 모아둔 송신 묶음은 전송 계층을 닫기 전에 보냄
+    MessageCoalescer.FlushAll();
+    MessageCoalescer.Reset();
+
+    // 페이싱 대기열에 남은 데이터그램은 버림 (대량 전송을 종료 시점에 몰아서 보내지 않음)
+    TrafficScheduler.Reset();
+
+    // 인박스 틱 해제 후 남은 패킷 버림 (버퍼 풀은 전송 계층이 소유하므로 전송 계층보다 먼저 비워야 함)
+    if (InboxTickHandle.IsValid())
     {
-        BroadcastSocket->Close();
-        ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->DestroySocket(BroadcastSocket);
-        BroadcastSocket = nullptr;
+        FTSTicker::GetCoreTicker().RemoveTicker(InboxTickHandle);
+        InboxTickHandle.Reset();
     }
 
-    if (ReceiveSocket)
+    for (const TUniquePtr<FReceiveShard>& Shard : ReceiveShards)
     {
-        ReceiveSocket->Close();
-        ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->DestroySocket(ReceiveSocket);
-        ReceiveSocket = nullptr;
+        FInboxPacket DiscardedPacket;
+        while (Shard->PriorityInbox.Dequeue(DiscardedPacket))
+        {
+        }
+        while (Shard->Inbox.Dequeue(DiscardedPacket))
+        {
+        }
+
+        if (Shard->Transport)
+        {
+            Shard->Transport->Close();
+        }
+
+        delete Shard->Worker;
+        Shard->Worker = nullptr;
     }
 
+    // 소켓 정리
+    ReceiveShards.Reset();
+    DataTransport = nullptr;
+    MulticastTransport.Reset();
+    TimeSyncTransport.Reset();
+    DiscoveryTransport.Reset();
+
     // 틱 해제
     FTSTicker::GetCoreTicker().RemoveTicker(MasterSlaveTickHandle);
 
-    // 메모리 정리
-    delete ReceiverWorker;
-    ReceiverWorker = nullptr;
-
     bIsInitialized = false;
     UE_LOG(LogMultiServerSync, Display, TEXT("Network Manager shutdown completed"));
 
@@ -457,8 +1040,8 @@ void FNetworkManager::Shutdown()
     // 대기 중인 핑 요청 정리
     PendingPingRequests.Empty();
 
-    // 네트워크 지연 통계 정리
-    ServerLatencyStats.Empty();
+    // 피어별 상태 정리 (지연 통계, 수신 시퀀스 추적기, ACK 대기 목록)
+    PeerRegistry.Reset();
 
     // 틱 델리게이트 제거
     if (LatencyMeasurementTickHandle.IsValid())
@@ -480,16 +1063,6 @@ void FNetworkManager::Shutdown()
         QualityAssessmentTickHandle.Reset();
     }
 
-    // 시퀀스 관리 틱 해제
-    if (SequenceManagementTickHandle.IsValid())
-    {
-        FTSTicker::GetCoreTicker().RemoveTicker(SequenceManagementTickHandle);
-        SequenceManagementTickHandle.Reset();
-    }
-
-    // 시퀀스 추적 정보 정리
-    EndpointSequenceTrackers.Empty();
-
     // 메시지 재전송 틱 해제
     if (MessageRetryTickHandle.IsValid())
     {
@@ -497,9 +1070,20 @@ void FNetworkManager::Shutdown()
         MessageRetryTickHandle.Reset();
     }
 
-    // 확인 대기 중인 메시지 정리
+    // 확인 대기 중인 메시지와 윈도우가 차서 보관 중인 메시지 정리
     PendingAcknowledgements.Empty();
-    EndpointSequenceMap.Empty();
+    ReliableBacklog.Reset();
+    PeersWithUnsentAcks.Reset();
+
+    // 조각 재조립 틱 해제 및 재조립/보관 중인 조각 정리
+    if (FragmentTickHandle.IsValid())
+    {
+        FTSTicker::GetCoreTicker().RemoveTicker(FragmentTickHandle);
+        FragmentTickHandle.Reset();
+    }
+
+    FragmentReassembler.Reset();
+    FragmentSendCache.Reset();
 }
 
 bool FNetworkManager::SendMessage(const FString& EndpointId, const TArray<uint8>& Message)
@@ -543,15 +1127,110 @@ bool FNetworkManager::BroadcastMessage(const TArray<uint8>& Message)
 
 void FNetworkManager::RegisterMessageHandler(TFunction<void(const FString&, const TArray<uint8>&)> Handler)
 {
-    MessageHandler = Handler;
+    // 이전 단일 핸들러 구독 해제 (기존 API는 핸들러를 하나만 유지)
+    for (const TPair<ENetworkMessageType, FDelegateHandle>& Subscription : LegacyHandlerSubscriptions)
+    {
+        UnsubscribeMessage(Subscription.Key, Subscription.Value);
+    }
+    LegacyHandlerSubscriptions.Reset();
+
+    if (!Handler)
+    {
+        return;
+    }
+
+    // 기존에 MessageHandler로 전달되던 메시지 유형에 페이로드 복사본을 전달
+    const ENetworkMessageType LegacyTypes[] = {
+        ENetworkMessageType::TimeSync,
+        ENetworkMessageType::Command,
+        ENetworkMessageType::Data,
+        ENetworkMessageType::Custom,
+        ENetworkMessageType::SettingsSync,
+        ENetworkMessageType::SettingsRequest,
+        ENetworkMessageType::SettingsResponse
+    };
+
+    for (ENetworkMessageType Type : LegacyTypes)
+    {
+        FDelegateHandle Handle = SubscribeMessage(Type, FOnNetworkMessageReceived::FDelegate::CreateLambda(
+            [Handler](const FReceivedNetworkMessage& Received)
+            {
+                Handler(Received.SenderId, TArray<uint8>(Received.Payload.GetData(), Received.Payload.Num()));
+            }));
+        LegacyHandlerSubscriptions.Add(TPair<ENetworkMessageType, FDelegateHandle>(Type, Handle));
+    }
 }
 
-bool FNetworkManager::DiscoverServers()
+FDelegateHandle FNetworkManager::SubscribeMessage(ENetworkMessageType Type, const FOnNetworkMessageReceived::FDelegate& Delegate)
 {
-    return SendDiscoveryMessage();
+    return MessageSubscribers[static_cast<uint8>(Type)].Add(Delegate);
 }
 
-TArray<FString> FNetworkManager::GetDiscoveredServers() const
+void FNetworkManager::UnsubscribeMessage(ENetworkMessageType Type, FDelegateHandle Handle)
+{
+    MessageSubscribers[static_cast<uint8>(Type)].Remove(Handle);
+}
+
+bool FNetworkManager::HasMessageSubscribers(ENetworkMessageType Type) const
+{
+    return MessageSubscribers[static_cast<uint8>(Type)].IsBound();
+}
+
+void FNetworkManager::RegisterInternalMessageHandlers()
+{
+    auto Register = [this](ENetworkMessageType Type, FInternalMessageHandler Handler)
+        {
+            InternalMessageHandlers[static_cast<uint8>(Type)] = Handler;
+        };
+
+    Register(ENetworkMessageType::Discovery, &FNetworkManager::HandleDiscoveryMessage);
+    Register(ENetworkMessageType::DiscoveryResponse, &FNetworkManager::HandleDiscoveryResponseMessage);
+    Register(ENetworkMessageType::TimeSync, &FNetworkManager::HandleTimeSyncMessage);
+    Register(ENetworkMessageType::FrameSync, &FNetworkManager::HandleFrameSyncMessage);
+    Register(ENetworkMessageType::Command, &FNetworkManager::HandleCommandMessage);
+    Register(ENetworkMessageType::Data, &FNetworkManager::HandleDataMessage);
+
+    // 마스터-슬레이브 프로토콜 메시지
+    Register(ENetworkMessageType::MasterAnnouncement, &FNetworkManager::HandleMasterAnnouncement);
+    Register(ENetworkMessageType::MasterQuery, &FNetworkManager::HandleMasterQuery);
+    Register(ENetworkMessageType::MasterResponse, &FNetworkManager::HandleMasterResponse);
+    Register(ENetworkMessageType::MasterElection, &FNetworkManager::HandleMasterElection);
+    Register(ENetworkMessageType::MasterVote, &FNetworkManager::HandleMasterVote);
+    Register(ENetworkMessageType::MasterResign, &FNetworkManager::HandleMasterResign);
+    Register(ENetworkMessageType::RoleChange, &FNetworkManager::HandleRoleChange);
+
+    // 설정 관련 메시지
+    Register(ENetworkMessageType::SettingsSync, &FNetworkManager::HandleSettingsSyncMessage);
+    Register(ENetworkMessageType::SettingsRequest, &FNetworkManager::HandleSettingsRequestMessage);
+    Register(ENetworkMessageType::SettingsResponse, &FNetworkManager::HandleSettingsResponseMessage);
+
+    Register(ENetworkMessageType::Custom, &FNetworkManager::HandleCustomMessage);
+    Register(ENetworkMessageType::PingRequest, &FNetworkManager::HandlePingRequest);
+    Register(ENetworkMessageType::PingResponse, &FNetworkManager::HandlePingResponse);
+    Register(ENetworkMessageType::MessageAck, &FNetworkManager::HandleMessageAck);
+    Register(ENetworkMessageType::MessageRetry, &FNetworkManager::HandleMessageRetryRequest);
+    Register(ENetworkMessageType::Fragment, &FNetworkManager::HandleFragment);
+    Register(ENetworkMessageType::FragmentNack, &FNetworkManager::HandleFragmentNack);
+}
+
+FString FNetworkManager::FindServerIdForEndpoint(const FIPv4Endpoint& Endpoint) const
+{
+    // 피어 등록 시 만든 표시용 ID 사용 (발견된 서버면 서버 ID)
+    const FPeerId PeerId = PeerRegistry.Find(Endpoint);
+    if (PeerId != INVALID_PEER_ID)
+    {
+        return PeerRegistry.GetDisplayId(PeerId);
+    }
+
+    return Endpoint.ToString();
+}
+
+bool FNetworkManager::DiscoverServers()
+{
+    return SendDiscoveryMessage();
+}
+
+TArray<FString> FNetworkManager::GetDiscoveredServers() const
 {
     TArray<FString> Result;
     for (const auto& Pair : DiscoveredServers)
@@ -569,6 +1248,8 @@ FGuid FNetworkManager::GenerateProjectId() const
 void FNetworkManager::SetProjectId(const FGuid& InProjectId)
 {
     ProjectId = InProjectId;
+    SessionToken = FNetworkMessage::MakeSessionToken(InProjectId);
+    MessageCoalescer.SetProjectId(InProjectId);
 }
 
 FGuid FNetworkManager::GetProjectId() const
@@ -577,108 +1258,257 @@ FGuid FNetworkManager::GetProjectId() const
 }
 
 // ProcessReceivedData 함수에 설정 메시지 처리 추가
+void FNetworkManager::ProcessReceivedBatch(int32 ShardIndex, ENetworkChannel Channel, const FReceivedDatagram* Datagrams, int32 Count)
+{
+    // 수신 스레드에서는 파싱과 자기 샤드 인박스 추가만 수행하고 상태는 변경하지 않음
+    // 시간 동기화 채널과 멀티캐스트 채널(클러스터 전체 동기화 메시지)은 탐색/데이터 메시지 뒤에 밀리지 않도록 우선 인박스로 보냄
+    FReceiveShard& Shard = *ReceiveShards[ShardIndex];
+    const bool bPriority = Channel == ENetworkChannel::TimeSync || Channel == ENetworkChannel::Multicast;
+    TSpscBoundedQueue<FInboxPacket>& Inbox = bPriority ? Shard.PriorityInbox : Shard.Inbox;
+    const double EnqueueTime = FPlatformTime::Seconds();
+
+    // 뷰가 가리키는 버퍼 참조를 함께 넘겨 처리될 때까지 풀로 반환되지 않도록 함
+    auto EnqueuePacket = [this, &Inbox, ShardIndex, bPriority, EnqueueTime](const FNetworkMessageView& Message, const FReceivedDatagram& Datagram)
+        {
+            FInboxPacket Packet;
+            Packet.Message = Message;
+            Packet.Message.SetReceiveCycles(Datagram.ReceiveCycles);
+            Packet.Buffer = Datagram.Buffer;
+            Packet.Sender = Datagram.Sender;
+            Packet.EnqueueTime = EnqueueTime;
+
+            if (Inbox.Enqueue(MoveTemp(Packet)))
+            {
+                InboxEnqueuedPackets.fetch_add(1, std::memory_order_relaxed);
+            }
+            else
+            {
+                const uint64 Dropped = InboxDroppedPackets.fetch_add(1, std::memory_order_relaxed) + 1;
+
+                // 간격마다 첫 번째 버림만 기록 (여러 수신 스레드 중 시각을 먼저 갱신한 스레드가 기록)
+                const uint64 NowCycles = FPlatformTime::Cycles64();
+                uint64 LastLogCycles = InboxDropLogCycles.load(std::memory_order_relaxed);
+                if ((LastLogCycles == 0 || FPlatformTime::ToSeconds64(NowCycles - LastLogCycles) >= INBOX_DROP_LOG_INTERVAL_SECONDS) &&
+                    InboxDropLogCycles.compare_exchange_strong(LastLogCycles, NowCycles, std::memory_order_relaxed))
+                {
+                    const uint64 DroppedSinceLastLog = Dropped - InboxDroppedAtLastLog.exchange(Dropped, std::memory_order_relaxed);
+                    UE_LOG(LogMultiServerSync, Warning, TEXT("Receive inbox full on shard %d (%s, capacity %u), dropped %llu packets since last report (%llu total)"),
+                        ShardIndex, bPriority ? TEXT("priority") : TEXT("normal"), Inbox.GetCapacity(), DroppedSinceLastLog, Dropped);
+                }
+            }
+        };
+
+    for (int32 Index = 0; Index < Count; ++Index)
+    {
+        // 풀 버퍼를 직접 가리키는 뷰로 파싱 (복사 없음)
+        FNetworkMessageView Message;
+        if (!Message.Parse(TArrayView<const uint8>(Datagrams[Index].Data, Datagrams[Index].Size)))
+        {
+            continue;
+        }
+
+        if (Message.GetType() != ENetworkMessageType::Batch)
+        {
+            EnqueuePacket(Message, Datagrams[Index]);
+            continue;
+        }
+
+        // 묶음 데이터그램은 담긴 메시지마다 같은 버퍼를 가리키는 뷰로 나눠 인박스에 넣음
+        TArrayView<const uint8> Remaining = Message.GetData();
+        while (Remaining.Num() > 0)
+        {
+            const int32 InnerSize = FNetworkMessageView::PeekMessageSize(Remaining);
+            FNetworkMessageView InnerMessage;
+            if (InnerSize <= 0 || InnerSize > Remaining.Num() || !InnerMessage.Parse(Remaining.Left(InnerSize)))
+            {
+                break;
+            }
+
+            // 묶음 안의 묶음은 만들지 않음
+            if (InnerMessage.GetType() != ENetworkMessageType::Batch)
+            {
+                EnqueuePacket(InnerMessage, Datagrams[Index]);
+            }
+
+            Remaining = Remaining.RightChop(InnerSize);
+        }
+    }
+}
+
+int32 FNetworkManager::DrainInbox()
+{
+    int32 DispatchedCount = 0;
+
+    // 시간 동기화 채널을 먼저 처리
+    // 한 피어의 패킷은 항상 같은 샤드, 같은 소켓으로 들어오므로 인박스 단위로 비워도 피어별 순서는 유지됨
+    for (const TUniquePtr<FReceiveShard>& Shard : ReceiveShards)
+    {
+        DispatchedCount += DrainInboxQueue(Shard->PriorityInbox);
+    }
+
+    for (const TUniquePtr<FReceiveShard>& Shard : ReceiveShards)
+    {
+        DispatchedCount += DrainInboxQueue(Shard->Inbox);
+    }
+
+    return DispatchedCount;
+}
+
+int32 FNetworkManager::DrainInboxQueue(TSpscBoundedQueue<FInboxPacket>& Queue)
+{
+    int32 DispatchedCount = 0;
+    FInboxPacket Packet;
+
+    while (Queue.Dequeue(Packet))
+    {
+        const double LatencyMs = (FPlatformTime::Seconds() - Packet.EnqueueTime) * 1000.0;
+        InboxLastLatencyMs = LatencyMs;
+        InboxMaxLatencyMs = FMath::Max(InboxMaxLatencyMs, LatencyMs);
+        InboxLatencySumMs += LatencyMs;
+
+        ProcessReceivedMessage(Packet.Message, Packet.Sender);
+
+        // 처리가 끝난 버퍼는 바로 풀로 반환
+        Packet.Buffer.SafeRelease();
+        InboxDispatchedPackets.fetch_add(1, std::memory_order_relaxed);
+        ++DispatchedCount;
+    }
+
+    return DispatchedCount;
+}
+
+bool FNetworkManager::TickInbox(float DeltaTime)
+{
+    DrainInbox();
+
+    // ACK 지연 동안 다른 메시지에 실려 나가지 못한 ACK를 발신자별 선택적 ACK 하나로 보냄 (아래 묶음 전송에 함께 실림)
+    const double Now = FPlatformTime::Seconds();
+    FlushPendingAcks(Now, bPiggybackAcksEnabled ? AckDelaySeconds : 0.0);
+
+    // 이번 틱에 모은 묶음 중 지연 기한이 된 것을 보냄 (수신 처리 중 보낸 응답도 함께 묶임)
+    MessageCoalescer.FlushDue(Now);
+
+    // 토큰이 충전된 만큼 페이싱 대기열을 보냄 (페이싱 해상도는 인박스 틱 간격)
+    TrafficScheduler.Pump(Now);
+    return true;
+}
+
+FNetworkInboxStats FNetworkManager::GetInboxStats() const
+{
+    FNetworkInboxStats Stats;
+    for (const TUniquePtr<FReceiveShard>& Shard : ReceiveShards)
+    {
+        Stats.Depth += static_cast<int32>(Shard->Inbox.Num() + Shard->PriorityInbox.Num());
+        Stats.Capacity += static_cast<int32>(Shard->Inbox.GetCapacity() + Shard->PriorityInbox.GetCapacity());
+    }
+    Stats.EnqueuedPackets = InboxEnqueuedPackets.load(std::memory_order_relaxed);
+    Stats.DroppedPackets = InboxDroppedPackets.load(std::memory_order_relaxed);
+    Stats.DispatchedPackets = InboxDispatchedPackets.load(std::memory_order_relaxed);
+    Stats.LastDispatchLatencyMs = InboxLastLatencyMs;
+    Stats.MaxDispatchLatencyMs = InboxMaxLatencyMs;
+    Stats.AverageDispatchLatencyMs = Stats.DispatchedPackets > 0 ? InboxLatencySumMs / Stats.DispatchedPackets : 0.0;
+    return Stats;
+}
+
+FLatencyHistogram FNetworkManager::GetReceiverWakeupHistogram(int32 ShardIndex) const
+{
+    if (!ReceiveShards.IsValidIndex(ShardIndex) || !ReceiveShards[ShardIndex]->Worker)
+    {
+        return FLatencyHistogram();
+    }
+
+    return ReceiveShards[ShardIndex]->Worker->GetWakeupHistogram();
+}
+
 void FNetworkManager::ProcessReceivedData(const TArray<uint8>& Data, const FIPv4Endpoint& Sender)
 {
     // 메시지 파싱
-    FNetworkMessage Message(Data);
+    FNetworkMessageView Message;
+    if (Message.Parse(Data))
+    {
+        ProcessReceivedMessage(Message, Sender);
+    }
+}
 
-    // 우리 프로젝트의 메시지가 아니면 무시
-    if (Message.GetProjectId().IsValid() && Message.GetProjectId() != ProjectId)
+void FNetworkManager::ProcessReceivedMessage(const FNetworkMessageView& Message, const FIPv4Endpoint& Sender)
+{
+    // 우리 프로젝트의 메시지가 아니면 무시 (압축 헤더는 프로젝트 ID 대신 세션 토큰 4바이트만 비교)
+    if (Message.IsCompact()
+        ? Message.GetSessionToken() != SessionToken
+        : Message.GetProjectId().IsValid() && Message.GetProjectId() != ProjectId)
     {
         return;
     }
 
-    // 메시지 역직렬화
-    FNetworkMessage DeserializedMessage;
-    if (DeserializedMessage.Deserialize(Data))
+    // 실려 온 ACK를 먼저 처리하고, 핸들러와 구독자에게는 ACK를 뗀 메시지를 전달
+    if (Message.GetFlags() & FNetworkMessage::FLAG_HAS_ACK)
     {
-        // 메시지 순서 확인 (일부 메시지 유형은 제외)
-        if (Message.GetType() != ENetworkMessageType::Discovery &&
-            Message.GetType() != ENetworkMessageType::DiscoveryResponse &&
-            Message.GetType() != ENetworkMessageType::MessageAck &&
-            Message.GetType() != ENetworkMessageType::MessageRetry)
+        FNetworkMessageView Stripped = Message;
+        FSelectiveAck PiggybackAck;
+        if (!Stripped.DetachPiggybackAck(PiggybackAck))
         {
-            if (!ShouldProcessMessage(Sender, Message.GetSequenceNumber()))
-            {
-                return; // 순서가 맞지 않는 메시지는 처리하지 않음
-            }
+            UE_LOG(LogMultiServerSync, Warning, TEXT("Received message with invalid piggybacked ACK from %s"), *Sender.ToString());
+            return;
         }
 
-        // 메시지 유형에 따라 처리
-        switch (Message.GetType())
+        ++AckStats.PiggybackedAcksReceived;
+        ProcessSelectiveAck(PiggybackAck, Sender);
+        ProcessReceivedMessage(Stripped, Sender);
+        return;
+    }
+
+    // 발신자 피어 등록 및 마지막 수신 시간 갱신 (이후 피어 상태 조회는 정수 키 캐시로 처리)
+    const FPeerId PeerId = PeerRegistry.FindOrAdd(Sender);
+    if (PeerId != INVALID_PEER_ID)
+    {
+        PeerRegistry.SetLastSeenTime(PeerId, FPlatformTime::Seconds());
+    }
+
+    // 메시지 순서 확인 (일부 메시지 유형은 제외, 조각은 재조립한 메시지로 한 번만 확인)
+    if (Message.GetType() != ENetworkMessageType::Discovery &&
+        Message.GetType() != ENetworkMessageType::DiscoveryResponse &&
+        Message.GetType() != ENetworkMessageType::MessageAck &&
+        Message.GetType() != ENetworkMessageType::MessageRetry &&
+        Message.GetType() != ENetworkMessageType::Fragment &&
+        Message.GetType() != ENetworkMessageType::FragmentNack)
+    {
+        if (!ShouldProcessMessage(Sender, FNetworkMessage::GetSequenceChannel(Message.GetFlags()), Message.GetSequenceNumber()))
         {
-        case ENetworkMessageType::Discovery:
-            HandleDiscoveryMessage(Message, Sender);
-            break;
-        case ENetworkMessageType::DiscoveryResponse:
-            HandleDiscoveryResponseMessage(Message, Sender);
-            break;
-        case ENetworkMessageType::TimeSync:
-            HandleTimeSyncMessage(Message, Sender);
-            break;
-        case ENetworkMessageType::FrameSync:
-            HandleFrameSyncMessage(Message, Sender);
-            break;
-        case ENetworkMessageType::Command:
-            HandleCommandMessage(Message, Sender);
-            break;
-        case ENetworkMessageType::Data:
-            HandleDataMessage(Message, Sender);
-            break;
-            // 마스터-슬레이브 프로토콜 메시지 처리
-        case ENetworkMessageType::MasterAnnouncement:
-            HandleMasterAnnouncement(Message, Sender);
-            break;
-        case ENetworkMessageType::MasterQuery:
-            HandleMasterQuery(Message, Sender);
-            break;
-        case ENetworkMessageType::MasterResponse:
-            HandleMasterResponse(Message, Sender);
-            break;
-        case ENetworkMessageType::MasterElection:
-            HandleMasterElection(Message, Sender);
-            break;
-        case ENetworkMessageType::MasterVote:
-            HandleMasterVote(Message, Sender);
-            break;
-        case ENetworkMessageType::MasterResign:
-            HandleMasterResign(Message, Sender);
-            break;
-        case ENetworkMessageType::RoleChange:
-            HandleRoleChange(Message, Sender);
-            break;
-            // 설정 관련 메시지 처리 - 새로 추가
-        case ENetworkMessageType::SettingsSync:
-            HandleSettingsSyncMessage(Message, Sender);
-            break;
-        case ENetworkMessageType::SettingsRequest:
-            HandleSettingsRequestMessage(Message, Sender);
-            break;
-        case ENetworkMessageType::SettingsResponse:
-            HandleSettingsResponseMessage(Message, Sender);
-            break;
-        case ENetworkMessageType::Custom:
-            HandleCustomMessage(Message, Sender);
-            break;
-        case ENetworkMessageType::PingRequest:
+            return; // 중복이거나 순서가 맞지 않는 메시지는 처리하지 않음
+        }
+    }
+
+    const uint8 TypeIndex = static_cast<uint8>(Message.GetType());
+
+    // 내부 프로토콜 처리 (서버 목록, 마스터 선출, 지연 측정, ACK 등)
+    const FInternalMessageHandler InternalHandler = InternalMessageHandlers[TypeIndex];
+    if (InternalHandler)
+    {
+        (this->*InternalHandler)(Message, Sender);
+    }
+
+    // 유형별 구독자에게 페이로드 뷰 전달
+    const FOnNetworkMessageReceived& Subscribers = MessageSubscribers[TypeIndex];
+    if (Subscribers.IsBound())
+    {
+        // 내부 핸들러가 피어를 추가/제거했을 수 있으므로 표시용 ID는 전달 직전에 조회 (레지스트리 문자열을 복사하지 않음)
+        const FPeerId SenderPeerId = PeerRegistry.Find(Sender);
+        if (SenderPeerId != INVALID_PEER_ID)
         {
-            // 수정된 코드 - FMemoryReader 사용
-            TArray<uint8> DataCopy = Message.GetData();
-            TSharedPtr<FMemoryReader> Reader = MakeShareable(new FMemoryReader(DataCopy));
-            HandlePingRequest(Reader, Sender);
+            FReceivedNetworkMessage Received(Message, Sender, SenderPeerId, PeerRegistry.GetDisplayId(SenderPeerId));
+            Subscribers.Broadcast(Received);
         }
-        break;
-        case ENetworkMessageType::MessageAck:
-            HandleMessageAck(Message, Sender);
-            break;
-        case ENetworkMessageType::MessageRetry:
-            HandleMessageRetryRequest(Message, Sender);
-            break;
-        default:
-            UE_LOG(LogMultiServerSync, Warning, TEXT("Unknown message type received: %d"), (int)Message.GetType());
-            break;
+        else
+        {
+            const FString EndpointId = Sender.ToString();
+            FReceivedNetworkMessage Received(Message, Sender, INVALID_PEER_ID, EndpointId);
+            Subscribers.Broadcast(Received);
         }
     }
+    else if (!InternalHandler)
+    {
+        UE_LOG(LogMultiServerSync, Warning, TEXT("Unknown message type received: %d"), (int)Message.GetType());
+    }
 }
 
 // 핑 타임아웃 검사 함수
@@ -713,9 +1543,9 @@ void FNetworkManager::CheckPingTimeouts()
                 SequenceNumber, *ServerID, ElapsedTime);
 
             // 패킷 손실 통계 업데이트
-            if (ServerLatencyStats.Contains(ServerID))
+            if (FNetworkLatencyStats* Stats = PeerRegistry.FindLatencyStats(ServerEndpoint))
             {
-                ServerLatencyStats[ServerID].LostPackets++;
+                Stats->LostPackets++;
             }
 
             // 연속 타임아웃 증가
@@ -769,7 +1599,7 @@ bool FNetworkManager::RequestSettings()
 }
 
 // 설정 동기화 메시지 처리 구현
-void FNetworkManager::HandleSettingsSyncMessage(const FNetworkMessage& Message, const FIPv4Endpoint& Sender)
+void FNetworkManager::HandleSettingsSyncMessage(const FNetworkMessageView& Message, const FIPv4Endpoint& Sender)
 {
     if (!bIsInitialized)
     {
@@ -777,33 +1607,14 @@ void FNetworkManager::HandleSettingsSyncMessage(const FNetworkMessage& Message,
     }
 
     // 발신자 식별
-    FString SenderId;
-    for (const auto& Pair : DiscoveredServers)
-    {
-        if (Pair.Value.IPAddress == Sender.Address && Pair.Value.Port == Sender.Port)
-        {
-            SenderId = Pair.Key;
-            break;
-        }
-    }
-
-    if (SenderId.IsEmpty())
-    {
-        SenderId = Sender.ToString();
-    }
+    const FString SenderId = FindServerIdForEndpoint(Sender);
 
     UE_LOG(LogMultiServerSync, Display, TEXT("Received settings sync message from %s (%d bytes)"),
         *SenderId, Message.GetData().Num());
-
-    // 설정 데이터 전달
-    if (MessageHandler)
-    {
-        MessageHandler(SenderId, Message.GetData());
-    }
 }
 
 // 설정 요청 메시지 처리 구현
-void FNetworkManager::HandleSettingsRequestMessage(const FNetworkMessage& Message, const FIPv4Endpoint& Sender)
+void FNetworkManager::HandleSettingsRequestMessage(const FNetworkMessageView& Message, const FIPv4Endpoint& Sender)
 {
     if (!bIsInitialized)
     {
@@ -812,19 +1623,10 @@ void FNetworkManager::HandleSettingsRequestMessage(const FNetworkMessage& Messag
 
     UE_LOG(LogMultiServerSync, Display, TEXT("Received settings request from %s"), *Sender.ToString());
 
-    // 마스터 노드일 때만 응답
+    // 마스터 노드일 때만 응답 (응답은 SettingsRequest 구독자가 처리)
     if (bIsMaster)
     {
         UE_LOG(LogMultiServerSync, Display, TEXT("As master, responding to settings request"));
-
-        // 메시지 핸들러를 통해 알림
-        if (MessageHandler)
-        {
-            // 특수 메시지로 설정 요청을 알림
-            TArray<uint8> RequestNotification;
-            RequestNotification.Add(static_cast<uint8>(ENetworkMessageType::SettingsRequest));
-            MessageHandler(Sender.ToString(), RequestNotification);
-        }
     }
     else
     {
@@ -833,7 +1635,7 @@ void FNetworkManager::HandleSettingsRequestMessage(const FNetworkMessage& Messag
 }
 
 // 설정 응답 메시지 처리 구현
-void FNetworkManager::HandleSettingsResponseMessage(const FNetworkMessage& Message, const FIPv4Endpoint& Sender)
+void FNetworkManager::HandleSettingsResponseMessage(const FNetworkMessageView& Message, const FIPv4Endpoint& Sender)
 {
     if (!bIsInitialized)
     {
@@ -841,34 +1643,15 @@ void FNetworkManager::HandleSettingsResponseMessage(const FNetworkMessage& Messa
     }
 
     // 발신자 식별
-    FString SenderId;
-    for (const auto& Pair : DiscoveredServers)
-    {
-        if (Pair.Value.IPAddress == Sender.Address && Pair.Value.Port == Sender.Port)
-        {
-            SenderId = Pair.Key;
-            break;
-        }
-    }
-
-    if (SenderId.IsEmpty())
-    {
-        SenderId = Sender.ToString();
-    }
+    const FString SenderId = FindServerIdForEndpoint(Sender);
 
     UE_LOG(LogMultiServerSync, Display, TEXT("Received settings response from %s (%d bytes)"),
         *SenderId, Message.GetData().Num());
-
-    // 설정 데이터 전달
-    if (MessageHandler)
-    {
-        MessageHandler(SenderId, Message.GetData());
-    }
 }
 
 bool FNetworkManager::SendDiscoveryMessage()
 {
-    if (!bIsInitialized || !BroadcastSocket)
+    if (!bIsInitialized || !DiscoveryTransport)
     {
         return false;
     }
@@ -876,10 +1659,11 @@ bool FNetworkManager::SendDiscoveryMessage()
     UE_LOG(LogMultiServerSync, Display, TEXT("Sending discovery message..."));
 
     // 디스커버리 메시지 생성
-    // 호스트 이름을 데이터로 포함
+    // 호스트 이름과 데이터 포트를 데이터로 포함 (탐색 소켓의 발신 포트는 데이터 포트가 아님)
+    FString DiscoveryData = FString::Printf(TEXT("%s:%d"), *HostName, Port);
     TArray<uint8> HostNameData;
-    HostNameData.SetNum(HostName.Len() * sizeof(TCHAR));
-    FMemory::Memcpy(HostNameData.GetData(), *HostName, HostName.Len() * sizeof(TCHAR));
+    HostNameData.SetNum(DiscoveryData.Len() * sizeof(TCHAR));
+    FMemory::Memcpy(HostNameData.GetData(), *DiscoveryData, DiscoveryData.Len() * sizeof(TCHAR));
 
     FNetworkMessage Message(ENetworkMessageType::Discovery, HostNameData);
     Message.SetProjectId(ProjectId);
@@ -888,106 +1672,588 @@ bool FNetworkManager::SendDiscoveryMessage()
     // 직렬화
     TArray<uint8> Data = Message.Serialize();
 
-    // 브로드캐스트 주소 생성
-    TSharedRef<FInternetAddr> BroadcastAddr = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->CreateInternetAddr();
-    BroadcastAddr->SetBroadcastAddress();
-    BroadcastAddr->SetPort(BROADCAST_PORT);
+    // 멀티캐스트 그룹에 가입했으면 그룹으로, 아니면 탐색 소켓으로 브로드캐스트
+    INetworkTransport* Transport = MulticastTransport ? MulticastTransport.Get() : DiscoveryTransport.Get();
+    const FIPv4Endpoint Target = MulticastTransport
+        ? FIPv4Endpoint(MulticastSettings.GroupAddress, MulticastSettings.Port)
+        : FIPv4Endpoint(FIPv4Address(255, 255, 255, 255), BROADCAST_PORT);
+
+    if (!Transport->SendTo(Data.GetData(), Data.Num(), Target))
+    {
+        UE_LOG(LogMultiServerSync, Error, TEXT("Failed to send discovery message (%d bytes)"), Data.Num());
+        return false;
+    }
+
+    UE_LOG(LogMultiServerSync, Display, TEXT("Discovery message sent successfully"));
+    return true;
+}
+
+bool FNetworkManager::SendDiscoveryResponse(const FIPv4Endpoint& TargetEndpoint)
+{
+    if (!bIsInitialized || !DataTransport)
+    {
+        return false;
+    }
+
+    UE_LOG(LogMultiServerSync, Display, TEXT("Sending discovery response to %s..."), *TargetEndpoint.ToString());
+
+    // 응답 메시지 생성
+    // 호스트 이름과 포트를 데이터로 포함
+    FString ResponseData = FString::Printf(TEXT("%s:%d"), *HostName, Port);
+    TArray<uint8> ResponseBytes;
+    ResponseBytes.SetNum(ResponseData.Len() * sizeof(TCHAR));
+    FMemory::Memcpy(ResponseBytes.GetData(), *ResponseData, ResponseData.Len() * sizeof(TCHAR));
+
+    FNetworkMessage Message(ENetworkMessageType::DiscoveryResponse, ResponseBytes);
+    Message.SetProjectId(ProjectId);
+    Message.SetSequenceNumber(GetNextSequenceNumber());
+
+    return SendMessageToEndpoint(TargetEndpoint, Message);
+}
+
+void FNetworkManager::AddOrUpdateServer(const FServerEndpoint& ServerInfo)
+{
+    // 자신은 목록에 추가하지 않음
+    FServerEndpoint LocalInfo = CreateLocalServerInfo();
+    if (ServerInfo == LocalInfo)
+    {
+        return;
+    }
+
+    // 새 서버이거나 주소 또는 지원 버전이 바뀐 경우에만 팬아웃 대상 재구성
+    const FServerEndpoint* ExistingServer = DiscoveredServers.Find(ServerInfo.Id);
+    if (ExistingServer && ExistingServer->ProtocolVersion != ServerInfo.ProtocolVersion)
+    {
+        bFanOutTargetsDirty = true;
+    }
+
+    if (!ExistingServer || ExistingServer->IPAddress != ServerInfo.IPAddress || ExistingServer->Port != ServerInfo.Port)
+    {
+        bFanOutTargetsDirty = true;
+
+        // 이전 주소의 피어는 더 이상 이 서버 ID로 표시하지 않음
+        if (ExistingServer)
+        {
+            PeerRegistry.SetServerId(PeerRegistry.Find(FIPv4Endpoint(ExistingServer->IPAddress, ExistingServer->Port)), FString());
+        }
+
+        // 서버 엔드포인트의 피어에 서버 ID 연결
+        PeerRegistry.SetServerId(PeerRegistry.FindOrAdd(FIPv4Endpoint(ServerInfo.IPAddress, ServerInfo.Port)), ServerInfo.Id);
+    }
+
+    const FIPv4Address PreviousAddress = ExistingServer ? ExistingServer->IPAddress : ServerInfo.IPAddress;
+
+    // 서버 추가 또는 업데이트
+    DiscoveredServers.Add(ServerInfo.Id, ServerInfo);
+    KnownServerIds.Add(HashServerId(ServerInfo.Id), ServerInfo.Id);
+
+    // 양쪽이 모두 지원하는 버전으로 헤더 형식 합의 (그 주소의 모든 소켓으로 보내는 메시지에 적용)
+    UpdateAddressProtocolVersion(ServerInfo.IPAddress);
+    if (PreviousAddress != ServerInfo.IPAddress)
+    {
+        UpdateAddressProtocolVersion(PreviousAddress);
+    }
+
+    UE_LOG(LogMultiServerSync, Display, TEXT("Server added/updated: %s (%s)"),
+        *ServerInfo.Id, *ServerInfo.ToString());
+}
+
+bool FNetworkManager::SendMessageToEndpoint(const FIPv4Endpoint& Endpoint, const FNetworkMessage& Message)
+{
+    const ENetworkChannel Channel = GetChannelForMessageType(Message.GetType());
+    INetworkTransport* Transport = GetChannelTransport(Channel);
+    if (!bIsInitialized || !Transport)
+    {
+        return false;
+    }
+
+    // 한 데이터그램에 담기지 않으면 조각으로 나눠 데이터 소켓으로 보냄
+    if (Message.GetSerializedSize() > GetMaxDatagramSize())
+    {
+        return SendFragmentedMessage(Message, &Endpoint, 1);
+    }
+
+    // 시간 동기화 메시지는 같은 서버의 시간 동기화 소켓으로 보냄
+    const FIPv4Endpoint Target = Channel == ENetworkChannel::TimeSync ? FIPv4Endpoint(Endpoint.Address, TIME_SYNC_PORT) : Endpoint;
+
+    // 이 피어에게 보낼 ACK가 밀려 있으면 메시지 끝에 실어 보냄
+    FNetworkMessage WithAck;
+    const bool bHasAck = AttachPiggybackAck(Endpoint, Message, WithAck);
+
+    // 메시지 직렬화 (v2를 지원하는 서버에는 압축 헤더)
+    TArray<uint8> Data = SerializeForWire(bHasAck ? WithAck : Message, !RequiresFullHeader(Message.GetType()) && IsCompactHeaderPeer(Endpoint));
+
+    // 작은 메시지는 대상별 묶음에 모아 다음 인박스 틱에 한 데이터그램으로 보냄 (묶음을 풀 수 있는 서버만)
+    const ETrafficClass Class = GetTrafficClassForMessageType(Message.GetType());
+    if (ShouldCoalesce(Message) && IsBatchCapablePeer(Target))
+    {
+        return MessageCoalescer.Enqueue(Transport, Target, Data.GetData(), Data.Num(), FPlatformTime::Seconds(), Class);
+    }
+
+    if (MessageCoalescer.SendImmediately(Transport, Data.GetData(), Data.Num(), &Target, 1, Class) != 1)
+    {
+        UE_LOG(LogMultiServerSync, Warning, TEXT("Failed to send message to %s: %d bytes"),
+            *Target.ToString(), Data.Num());
+        return false;
+    }
+
+    return true;
+}
+
+ENetworkChannel FNetworkManager::GetChannelForMessageType(ENetworkMessageType Type)
+{
+    switch (Type)
+    {
+    case ENetworkMessageType::TimeSync:
+    case ENetworkMessageType::PingRequest:
+    case ENetworkMessageType::PingResponse:
+        return ENetworkChannel::TimeSync;
+
+    case ENetworkMessageType::Discovery:
+        return ENetworkChannel::Discovery;
+
+    default:
+        return ENetworkChannel::Data;
+    }
+}
+
+INetworkTransport* FNetworkManager::GetChannelTransport(ENetworkChannel Channel) const
+{
+    switch (Channel)
+    {
+    case ENetworkChannel::Discovery:
+        return DiscoveryTransport.Get();
+
+    case ENetworkChannel::TimeSync:
+        return TimeSyncTransport.Get();
+
+    case ENetworkChannel::Multicast:
+        return MulticastTransport.Get();
+
+    default:
+        return DataTransport;
+    }
+}
+
+bool FNetworkManager::IsClusterWideMessageType(ENetworkMessageType Type)
+{
+    switch (Type)
+    {
+    case ENetworkMessageType::Discovery:
+    case ENetworkMessageType::MasterAnnouncement:
+    case ENetworkMessageType::TimeSync:
+    case ENetworkMessageType::FrameSync:
+        return true;
+
+    default:
+        return false;
+    }
+}
+
+bool FNetworkManager::IsTimeCriticalMessageType(ENetworkMessageType Type)
+{
+    switch (Type)
+    {
+    case ENetworkMessageType::TimeSync:
+    case ENetworkMessageType::PingRequest:
+    case ENetworkMessageType::PingResponse:
+        return true;
+
+    default:
+        return false;
+    }
+}
+
+ETrafficClass FNetworkManager::GetTrafficClassForMessageType(ENetworkMessageType Type)
+{
+    switch (Type)
+    {
+    case ENetworkMessageType::TimeSync:
+    case ENetworkMessageType::PingRequest:
+    case ENetworkMessageType::PingResponse:
+        return ETrafficClass::Clock;
+
+    case ENetworkMessageType::FrameSync:
+        return ETrafficClass::Frame;
+
+    case ENetworkMessageType::Data:
+    case ENetworkMessageType::Fragment:
+    case ENetworkMessageType::SettingsSync:
+    case ENetworkMessageType::SettingsRequest:
+    case ENetworkMessageType::SettingsResponse:
+        return ETrafficClass::Bulk;
+
+    default:
+        return ETrafficClass::Control;
+    }
+}
+
+void FNetworkManager::SetTrafficClassConfig(ETrafficClass Class, const FTrafficClassConfig& Config)
+{
+    const uint8 PreviousDscp = TrafficScheduler.GetClassConfig(Class).Dscp;
+    TrafficScheduler.SetClassConfig(Class, Config);
+
+    const FTrafficClassConfig& Applied = TrafficScheduler.GetClassConfig(Class);
+    if (bIsInitialized && Applied.Dscp != PreviousDscp)
+    {
+        ApplyTrafficClassDscp();
+    }
+
+    UE_LOG(LogMultiServerSync, Display, TEXT("%s traffic class: %lld bytes/s, burst %d bytes, queue %d, DSCP %u"),
+        GetTrafficClassName(Class), Applied.RateBytesPerSecond, Applied.BurstBytes, Applied.MaxQueueDepth, Applied.Dscp);
+}
+
+void FNetworkManager::ApplyTrafficClassDscp()
+{
+    // 소켓으로 나가는 클래스 중 DSCP를 지정한 가장 높은 우선순위 클래스의 값
+    auto GetSocketDscp = [this](ETrafficClass HighestClass, ETrafficClass LowestClass) -> uint8
+    {
+        for (int32 Index = static_cast<int32>(HighestClass); Index <= static_cast<int32>(LowestClass); ++Index)
+        {
+            const uint8 Dscp = TrafficScheduler.GetClassConfig(static_cast<ETrafficClass>(Index)).Dscp;
+            if (Dscp != 0)
+            {
+                return Dscp;
+            }
+        }
+        return 0;
+    };
+
+    if (TimeSyncTransport)
+    {
+        TimeSyncTransport->SetDscp(GetSocketDscp(ETrafficClass::Clock, ETrafficClass::Clock));
+    }
+
+    if (MulticastTransport)
+    {
+        MulticastTransport->SetDscp(GetSocketDscp(ETrafficClass::Clock, ETrafficClass::Control));
+    }
+
+    const uint8 DataDscp = GetSocketDscp(ETrafficClass::Frame, ETrafficClass::Bulk);
+    for (const TUniquePtr<FReceiveShard>& Shard : ReceiveShards)
+    {
+        Shard->Transport->SetDscp(DataDscp);
+    }
+}
+
+bool FNetworkManager::RequiresFullHeader(ENetworkMessageType Type)
+{
+    return Type == ENetworkMessageType::Discovery || Type == ENetworkMessageType::DiscoveryResponse;
+}
+
+bool FNetworkManager::IsCompactHeaderPeer(const FIPv4Endpoint& Endpoint) const
+{
+    // 데이터 포트가 아닌 소켓(시간 동기화 등)으로 보내는 응답도 같은 서버이므로 주소로 판단
+    return bCompactHeadersEnabled &&
+        PeerRegistry.GetProtocolVersion(Endpoint.Address) >= FNetworkMessage::COMPACT_HEADER_VERSION;
+}
+
+bool FNetworkManager::IsBatchCapablePeer(const FIPv4Endpoint& Endpoint) const
+{
+    return PeerRegistry.GetProtocolVersion(Endpoint.Address) >= FNetworkMessage::BATCH_MESSAGE_VERSION;
+}
+
+void FNetworkManager::UpdateAddressProtocolVersion(const FIPv4Address& Address)
+{
+    // 한 주소에 여러 서버가 있으면 모두가 읽을 수 있는 가장 낮은 버전 사용 (서버가 없으면 v1)
+    uint8 Version = 0;
+    for (const auto& Pair : DiscoveredServers)
+    {
+        if (Pair.Value.IPAddress == Address)
+        {
+            const uint8 ServerVersion = FMath::Min(Pair.Value.ProtocolVersion, FNetworkMessage::COMPACT_HEADER_VERSION);
+            Version = Version == 0 ? ServerVersion : FMath::Min(Version, ServerVersion);
+        }
+    }
+
+    PeerRegistry.SetProtocolVersion(Address, Version == 0 ? 1 : Version);
+}
+
+void FNetworkManager::SetCompactHeadersEnabled(bool bEnable)
+{
+    bCompactHeadersEnabled = bEnable;
+    UE_LOG(LogMultiServerSync, Display, TEXT("Compact message headers %s"), bEnable ? TEXT("enabled") : TEXT("disabled"));
+}
+
+bool FNetworkManager::ShouldCoalesce(const FNetworkMessage& Message) const
+{
+    // 타임스탬프가 담긴 메시지는 틱 지연만큼 측정값이 틀어지므로 묶지 않음
+    return bCoalescingEnabled &&
+        !IsTimeCriticalMessageType(Message.GetType()) &&
+        (Message.GetFlags() & FNetworkMessage::FLAG_BYPASS_COALESCING) == 0;
+}
+
+void FNetworkManager::SetCoalescingEnabled(bool bEnable)
+{
+    // 끌 때 모아둔 묶음이 남지 않도록 바로 보냄
+    if (!bEnable)
+    {
+        MessageCoalescer.FlushAll();
+    }
+
+    bCoalescingEnabled = bEnable;
+}
+
+bool FNetworkManager::BroadcastMessageToServers(const FNetworkMessage& Message)
+{
+    // 한 데이터그램에 담기지 않으면 조각으로 나눠 모든 서버의 데이터 소켓으로 보냄
+    if (Message.GetSerializedSize() > GetMaxDatagramSize())
+    {
+        if (bFanOutTargetsDirty)
+        {
+            RebuildFanOutTargets();
+        }
+
+        return FanOutTargets.Num() == 0 || SendFragmentedMessage(Message, FanOutTargets.GetData(), FanOutTargets.Num());
+    }
+
+    // 클러스터 전체 메시지는 그룹으로 한 번만 전송 (송신 비용이 노드 수와 무관하고, 아직 발견하지 못한 노드에도 전달됨)
+    if (MulticastTransport && IsClusterWideMessageType(Message.GetType()))
+    {
+        if (!bIsInitialized)
+        {
+            return false;
+        }
+
+        if (bFanOutTargetsDirty)
+        {
+            RebuildFanOutTargets();
+        }
+
+        TArray<uint8> Data = Message.Serialize();
+        const FIPv4Endpoint GroupEndpoint(MulticastSettings.GroupAddress, MulticastSettings.Port);
+        const ETrafficClass Class = GetTrafficClassForMessageType(Message.GetType());
+
+        // 그룹의 모든 수신자가 받으므로 탐색된 서버가 모두 묶음을 풀 수 있을 때만 묶음
+        if (ShouldCoalesce(Message) && bFanOutBatch)
+        {
+            return MessageCoalescer.Enqueue(MulticastTransport.Get(), GroupEndpoint, Data.GetData(), Data.Num(), FPlatformTime::Seconds(), Class);
+        }
+
+        if (MessageCoalescer.SendImmediately(MulticastTransport.Get(), Data.GetData(), Data.Num(), &GroupEndpoint, 1, Class) != 1)
+        {
+            UE_LOG(LogMultiServerSync, Warning, TEXT("Failed to send multicast message to %s:%d (%d bytes)"),
+                *MulticastSettings.GroupAddress.ToString(), MulticastSettings.Port, Data.Num());
+            return false;
+        }
+
+        return true;
+    }
+
+    if (bFanOutTargetsDirty)
+    {
+        RebuildFanOutTargets();
+    }
+
+    if (FanOutTargets.Num() == 0)
+    {
+        return true;
+    }
+
+    const ENetworkChannel Channel = GetChannelForMessageType(Message.GetType());
+    INetworkTransport* Transport = GetChannelTransport(Channel);
+    if (!bIsInitialized || !Transport)
+    {
+        return false;
+    }
+
+    // 한 번만 직렬화하고 모든 대상에 같은 버퍼를 전송
+    const TArray<FIPv4Endpoint>& Targets = Channel == ENetworkChannel::TimeSync ? TimeSyncFanOutTargets : FanOutTargets;
+    TArray<uint8> Data = SerializeForWire(Message, bCompactHeadersEnabled && bFanOutCompact && !RequiresFullHeader(Message.GetType()));
+
+    // 묶을 메시지는 대상마다 묶음에 추가 (묶음을 보낼 때 대상별로 한 데이터그램씩 전송됨)
+    const ETrafficClass Class = GetTrafficClassForMessageType(Message.GetType());
+    if (ShouldCoalesce(Message))
+    {
+        const double Now = FPlatformTime::Seconds();
+        bool bAllSent = true;
+        for (const FIPv4Endpoint& Target : Targets)
+        {
+            // 묶음을 풀 수 없는 v1 서버에는 바로 보냄
+            if (bFanOutBatch || IsBatchCapablePeer(Target))
+            {
+                MessageCoalescer.Enqueue(Transport, Target, Data.GetData(), Data.Num(), Now, Class);
+            }
+            else if (MessageCoalescer.SendImmediately(Transport, Data.GetData(), Data.Num(), &Target, 1, Class) != 1)
+            {
+                bAllSent = false;
+            }
+        }
+
+        if (!bAllSent)
+        {
+            UE_LOG(LogMultiServerSync, Warning, TEXT("Broadcast failed to reach some v1 servers"));
+        }
+
+        return bAllSent;
+    }
+
+    const int32 SentCount = MessageCoalescer.SendImmediately(Transport, Data.GetData(), Data.Num(), Targets.GetData(), Targets.Num(), Class);
+
+    if (SentCount != Targets.Num())
+    {
+        UE_LOG(LogMultiServerSync, Warning, TEXT("Broadcast sent to %d of %d servers"), SentCount, Targets.Num());
+        return false;
+    }
+
+    return true;
+}
+
+bool FNetworkManager::SendFragmentedMessage(const FNetworkMessage& Message, const FIPv4Endpoint* Targets, int32 TargetCount)
+{
+    if (!bIsInitialized || !DataTransport)
+    {
+        return false;
+    }
 
-    int32 BytesSent = 0;
-    bool bSuccess = BroadcastSocket->SendTo(Data.GetData(), Data.Num(), BytesSent, *BroadcastAddr);
+    // 대상에게 먼저 보낸 메시지가 조각보다 늦게 도착하지 않도록 모아둔 묶음을 먼저 보냄
+    for (int32 Index = 0; Index < TargetCount; ++Index)
+    {
+        MessageCoalescer.Flush(Targets[Index]);
+    }
 
-    if (!bSuccess || BytesSent != Data.Num())
+    const uint32 MessageId = NextFragmentMessageId++;
+    TArray<TArray<uint8>> Datagrams;
+    if (!Message.SerializeFragments(MessageId, GetMaxDatagramSize(), Datagrams))
     {
-        UE_LOG(LogMultiServerSync, Error, TEXT("Failed to send discovery message: %d bytes sent, expected %d"),
-            BytesSent, Data.Num());
+        UE_LOG(LogMultiServerSync, Error, TEXT("Message too large to fragment: %d bytes"), Message.GetSerializedSize());
         return false;
     }
 
-    UE_LOG(LogMultiServerSync, Display, TEXT("Discovery message sent successfully"));
-    return true;
+    // 조각마다 독립 데이터그램으로 전송 (일부가 유실되면 수신 측 재전송 요청으로 그 조각만 다시 보냄)
+    // 조각은 대량 전송 클래스로 페이싱하여 한꺼번에 스위치 큐를 채우지 않도록 함
+    const double Now = FPlatformTime::Seconds();
+    bool bAllSent = true;
+    for (const TArray<uint8>& Datagram : Datagrams)
+    {
+        bAllSent &= TrafficScheduler.SendToMany(ETrafficClass::Bulk, DataTransport, Datagram.GetData(), Datagram.Num(), Targets, TargetCount, Now) == TargetCount;
+    }
+
+    UE_LOG(LogMultiServerSync, Verbose, TEXT("Sent message %u as %d fragments to %d targets (%d bytes)"),
+        MessageId, Datagrams.Num(), TargetCount, Message.GetSerializedSize());
+
+    FragmentSendCache.Add(MessageId, MoveTemp(Datagrams), Now);
+    return bAllSent;
 }
 
-bool FNetworkManager::SendDiscoveryResponse(const FIPv4Endpoint& TargetEndpoint)
+void FNetworkManager::HandleFragment(const FNetworkMessageView& Message, const FIPv4Endpoint& Sender)
 {
-    if (!bIsInitialized || !ReceiveSocket)
+    const TArrayView<const uint8> Bytes = Message.GetData();
+    if (Bytes.Num() < sizeof(FFragmentHeader))
     {
-        return false;
+        return;
     }
 
-    UE_LOG(LogMultiServerSync, Display, TEXT("Sending discovery response to %s..."), *TargetEndpoint.ToString());
+    FFragmentHeader FragmentHeader;
+    FMemory::Memcpy(&FragmentHeader, Bytes.GetData(), sizeof(FFragmentHeader));
 
-    // 응답 메시지 생성
-    // 호스트 이름과 포트를 데이터로 포함
-    FString ResponseData = FString::Printf(TEXT("%s:%d"), *HostName, Port);
-    TArray<uint8> ResponseBytes;
-    ResponseBytes.SetNum(ResponseData.Len() * sizeof(TCHAR));
-    FMemory::Memcpy(ResponseBytes.GetData(), *ResponseData, ResponseData.Len() * sizeof(TCHAR));
+    // 조각 안의 조각은 만들지 않음
+    if (FragmentHeader.OriginalType == static_cast<uint8>(ENetworkMessageType::Fragment))
+    {
+        return;
+    }
 
-    FNetworkMessage Message(ENetworkMessageType::DiscoveryResponse, ResponseBytes);
-    Message.SetProjectId(ProjectId);
-    Message.SetSequenceNumber(GetNextSequenceNumber());
+    // ProcessReceivedMessage에서 이미 등록한 피어이므로 캐시된 조회
+    const FPeerId PeerId = PeerRegistry.Find(Sender);
+    TArray<uint8> Payload;
+    const EFragmentResult Result = FragmentReassembler.AddFragment(PeerId, Sender, FragmentHeader,
+        Bytes.RightChop(sizeof(FFragmentHeader)), FPlatformTime::Seconds(), Payload);
 
-    return SendMessageToEndpoint(TargetEndpoint, Message);
+    if (Result != EFragmentResult::Complete)
+    {
+        return;
+    }
+
+    // 원본 헤더를 복원하여 일반 메시지와 같은 경로로 처리
+    // (64KB를 넘는 메시지는 헤더의 Size로 표현할 수 없으므로 페이로드 뷰의 크기를 사용)
+    FNetworkMessageHeader OriginalHeader = Message.GetHeader();
+    OriginalHeader.Type = static_cast<ENetworkMessageType>(FragmentHeader.OriginalType);
+    OriginalHeader.Size = static_cast<uint16>(FMath::Min<int32>(sizeof(FNetworkMessageHeader) + Payload.Num(), MAX_uint16));
+
+    // 재조립한 메시지의 도착 시각은 마지막 조각의 도착 시각
+    FNetworkMessageView Reassembled(OriginalHeader, Payload);
+    Reassembled.SetReceiveCycles(Message.GetReceiveCycles());
+    ProcessReceivedMessage(Reassembled, Sender);
 }
 
-void FNetworkManager::AddOrUpdateServer(const FServerEndpoint& ServerInfo)
+void FNetworkManager::HandleFragmentNack(const FNetworkMessageView& Message, const FIPv4Endpoint& Sender)
 {
-    // 자신은 목록에 추가하지 않음
-    FServerEndpoint LocalInfo = CreateLocalServerInfo();
-    if (ServerInfo == LocalInfo)
+    FFragmentNack Nack;
+    if (!Nack.Deserialize(Message.GetData()) || !DataTransport)
     {
         return;
     }
 
-    // 서버 추가 또는 업데이트
-    DiscoveredServers.Add(ServerInfo.Id, ServerInfo);
+    const TArray<TArray<uint8>>* Datagrams = FragmentSendCache.Find(Nack.MessageId);
+    if (!Datagrams)
+    {
+        UE_LOG(LogMultiServerSync, Verbose, TEXT("Fragment NACK for expired message %u from %s"), Nack.MessageId, *Sender.ToString());
+        return;
+    }
 
-    UE_LOG(LogMultiServerSync, Display, TEXT("Server added/updated: %s (%s)"),
-        *ServerInfo.Id, *ServerInfo.ToString());
+    // 요청한 조각만 요청한 노드에게 다시 보냄
+    const double Now = FPlatformTime::Seconds();
+    int32 ResentCount = 0;
+    for (uint16 FragmentIndex : Nack.MissingFragments)
+    {
+        if (Datagrams->IsValidIndex(FragmentIndex))
+        {
+            const TArray<uint8>& Datagram = (*Datagrams)[FragmentIndex];
+            if (TrafficScheduler.Send(ETrafficClass::Bulk, DataTransport, Datagram.GetData(), Datagram.Num(), Sender, Now))
+            {
+                ResentCount++;
+            }
+        }
+    }
+
+    FragmentReassembler.AddRetransmittedFragments(ResentCount);
+    UE_LOG(LogMultiServerSync, Verbose, TEXT("Resent %d fragments of message %u to %s"), ResentCount, Nack.MessageId, *Sender.ToString());
 }
 
-bool FNetworkManager::SendMessageToEndpoint(const FIPv4Endpoint& Endpoint, const FNetworkMessage& Message)
+bool FNetworkManager::TickFragmentReassembly(float DeltaTime)
 {
-    if (!bIsInitialized || !ReceiveSocket)
+    if (!bIsInitialized)
     {
-        return false;
+        return true;
     }
 
-    // 메시지 직렬화
-    TArray<uint8> Data = Message.Serialize();
-
-    // 엔드포인트 주소 생성
-    TSharedRef<FInternetAddr> TargetAddr = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->CreateInternetAddr();
-    TargetAddr->SetIp(Endpoint.Address.Value);
-    TargetAddr->SetPort(Endpoint.Port);
+    const double CurrentTime = FPlatformTime::Seconds();
+    FragmentReassembler.ExpireStale(CurrentTime);
+    FragmentSendCache.Expire(CurrentTime);
 
-    int32 BytesSent = 0;
-    bool bSuccess = ReceiveSocket->SendTo(Data.GetData(), Data.Num(), BytesSent, *TargetAddr);
+    // 진척이 멈춘 메시지의 누락 조각을 발신자에게 요청 (요청 하나가 한 데이터그램에 담기도록 조각 수 제한)
+    const int32 MaxMissingPerNack = (GetMaxDatagramSize() - static_cast<int32>(sizeof(FNetworkMessageHeader)) - FFragmentNack::FIXED_SIZE) / static_cast<int32>(sizeof(uint16));
+    TArray<FFragmentReassembler::FStalledMessage> StalledMessages;
+    FragmentReassembler.CollectStalled(CurrentTime, FRAGMENT_NACK_DELAY_SECONDS, MaxMissingPerNack, StalledMessages);
 
-    if (!bSuccess || BytesSent != Data.Num())
+    for (const FFragmentReassembler::FStalledMessage& Stalled : StalledMessages)
     {
-        UE_LOG(LogMultiServerSync, Warning, TEXT("Failed to send message to %s: %d bytes sent, expected %d"),
-            *Endpoint.ToString(), BytesSent, Data.Num());
-        return false;
+        FNetworkMessage NackMessage(ENetworkMessageType::FragmentNack, Stalled.Nack.Serialize());
+        NackMessage.SetProjectId(ProjectId);
+        NackMessage.SetSequenceNumber(GetNextSequenceNumber());
+        SendMessageToEndpoint(Stalled.Sender, NackMessage);
     }
 
+    FragmentReassembler.AddNacksSent(StalledMessages.Num());
     return true;
 }
 
-bool FNetworkManager::BroadcastMessageToServers(const FNetworkMessage& Message)
+void FNetworkManager::RebuildFanOutTargets()
 {
-    bool bAllSucceeded = true;
-    
+    FanOutTargets.Reset(DiscoveredServers.Num());
+    TimeSyncFanOutTargets.Reset(DiscoveredServers.Num());
+    bFanOutCompact = true;
+    bFanOutBatch = true;
+
     for (const auto& Pair : DiscoveredServers)
     {
-        FIPv4Endpoint Endpoint(Pair.Value.IPAddress, Pair.Value.Port);
-        if (!SendMessageToEndpoint(Endpoint, Message))
-        {
-            bAllSucceeded = false;
-        }
+        FanOutTargets.Add(FIPv4Endpoint(Pair.Value.IPAddress, Pair.Value.Port));
+        TimeSyncFanOutTargets.Add(FIPv4Endpoint(Pair.Value.IPAddress, TIME_SYNC_PORT));
+        bFanOutCompact &= Pair.Value.ProtocolVersion >= FNetworkMessage::COMPACT_HEADER_VERSION;
+        bFanOutBatch &= Pair.Value.ProtocolVersion >= FNetworkMessage::BATCH_MESSAGE_VERSION;
     }
-    
-    return bAllSucceeded;
+
+    bFanOutTargetsDirty = false;
 }
 
 bool FNetworkManager::InitializeSockets()
@@ -1005,6 +2271,28 @@ bool FNetworkManager::InitializeSockets()
         UE_LOG(LogMultiServerSync, Error, TEXT("Failed to create receive socket"));
         return false;
     }
+
+    if (!CreateTimeSyncSocket())
+    {
+        UE_LOG(LogMultiServerSync, Error, TEXT("Failed to create time sync socket"));
+        return false;
+    }
+
+    // 멀티캐스트는 선택 사항이므로 실패해도 유니캐스트 팬아웃으로 계속 동작
+    if (MulticastSettings.bEnabled && !CreateMulticastSocket())
+    {
+        UE_LOG(LogMultiServerSync, Warning, TEXT("Multicast unavailable, falling back to unicast fan-out and broadcast discovery"));
+    }
+
+    // DSCP를 지정한 클래스가 있을 때만 표시 (기본값은 소켓 옵션을 건드리지 않음)
+    for (int32 Index = 0; Index < NUM_TRAFFIC_CLASSES; ++Index)
+    {
+        if (TrafficScheduler.GetClassConfig(static_cast<ETrafficClass>(Index)).Dscp != 0)
+        {
+            ApplyTrafficClassDscp();
+            break;
+        }
+    }
     
     UE_LOG(LogMultiServerSync, Display, TEXT("Sockets initialized successfully"));
     return true;
@@ -1012,80 +2300,165 @@ bool FNetworkManager::InitializeSockets()
 
 bool FNetworkManager::CreateBroadcastSocket()
 {
-    // 브로드캐스트 소켓 생성
-    BroadcastSocket = FUdpSocketBuilder(TEXT("MultiServerSync_BroadcastSocket"))
-        .AsReusable()
-        .WithBroadcast()
-        .WithSendBufferSize(65507) // UDP 최대 크기
-        .Build();
-    
-    if (!BroadcastSocket)
+    // 브로드캐스트 탐색 소켓 생성
+    // 탐색 메시지 송신과 다른 서버의 브로드캐스트 수신을 모두 BROADCAST_PORT에서 처리
+    DiscoveryTransport = INetworkTransport::Create(ReceiveBackend, FIPv4Address::Any, BROADCAST_PORT,
+        TEXT("MultiServerSync_DiscoverySocket"));
+
+    if (!DiscoveryTransport)
     {
         UE_LOG(LogMultiServerSync, Error, TEXT("Failed to create broadcast socket"));
         return false;
     }
-    
+
     return true;
 }
 
+int32 FNetworkManager::ResolveInboxCapacity(int32 InCapacity)
+{
+    const int32 Requested = InCapacity > 0 ? InCapacity : DEFAULT_INBOX_CAPACITY;
+    return static_cast<int32>(FMath::RoundUpToPowerOfTwo(
+        static_cast<uint32>(FMath::Clamp(Requested, INetworkTransport::MAX_RECEIVE_BATCH, MAX_INBOX_CAPACITY))));
+}
+
 bool FNetworkManager::CreateReceiveSocket()
 {
-    // 수신 소켓 생성
-    ReceiveSocket = FUdpSocketBuilder(TEXT("MultiServerSync_ReceiveSocket"))
-        .AsReusable()
-        .BoundToPort(Port)
-        .WithReceiveBufferSize(65507) // UDP 최대 크기
-        .Build();
-    
-    if (!ReceiveSocket)
+    int32 ShardCount = ReceiveShardCount;
+    if (ShardCount > 1 && !INetworkTransport::SupportsReusePort())
     {
-        UE_LOG(LogMultiServerSync, Error, TEXT("Failed to create receive socket"));
-        return false;
+        UE_LOG(LogMultiServerSync, Warning, TEXT("SO_REUSEPORT is not supported on this platform, using a single receive shard"));
+        ShardCount = 1;
     }
-    
-    // 브로드캐스트 수신을 위한 추가 소켓
-    FSocket* BroadcastReceiveSocket = FUdpSocketBuilder(TEXT("MultiServerSync_BroadcastReceiveSocket"))
-        .AsReusable()
-        .BoundToPort(BROADCAST_PORT)
-        .WithReceiveBufferSize(65507) // UDP 최대 크기
-        .Build();
-    
-    if (!BroadcastReceiveSocket)
+
+    // 유니캐스트 데이터 소켓 생성 (Port)
+    // 샤드가 여럿이면 모든 소켓을 SO_REUSEPORT로 같은 포트에 바인딩
+    const bool bReusePort = ShardCount > 1;
+    for (int32 ShardIndex = 0; ShardIndex < ShardCount; ++ShardIndex)
+    {
+        TUniquePtr<FReceiveShard> Shard = MakeUnique<FReceiveShard>(InboxCapacity);
+        Shard->Transport = INetworkTransport::Create(ReceiveBackend, FIPv4Address::Any, Port,
+            FString::Printf(TEXT("MultiServerSync_DataSocket_%d"), ShardIndex), bReusePort);
+
+        if (!Shard->Transport)
+        {
+            UE_LOG(LogMultiServerSync, Error, TEXT("Failed to create data socket for shard %d"), ShardIndex);
+            ReceiveShards.Reset();
+            DataTransport = nullptr;
+            return false;
+        }
+
+        ReceiveShards.Add(MoveTemp(Shard));
+    }
+
+    DataTransport = ReceiveShards[0]->Transport.Get();
+
+    UE_LOG(LogMultiServerSync, Display, TEXT("Data socket bound to port %d (backend: %s, shards: %d)"),
+        DataTransport->GetLocalPort(), DataTransport->GetBackendName(), ReceiveShards.Num());
+
+    return true;
+}
+
+bool FNetworkManager::CreateTimeSyncSocket()
+{
+    // 시간 동기화 전용 소켓 생성 (탐색/데이터 폭주가 이 소켓의 수신 버퍼를 채우지 않음)
+    TimeSyncTransport = INetworkTransport::Create(ReceiveBackend, FIPv4Address::Any, TIME_SYNC_PORT,
+        TEXT("MultiServerSync_TimeSyncSocket"));
+
+    if (!TimeSyncTransport)
     {
-        UE_LOG(LogMultiServerSync, Error, TEXT("Failed to create broadcast receive socket"));
-        ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->DestroySocket(ReceiveSocket);
-        ReceiveSocket = nullptr;
+        UE_LOG(LogMultiServerSync, Error, TEXT("Failed to create time sync socket"));
         return false;
     }
-    
-    // 이미 있는 수신 소켓을 정리하고 브로드캐스트 수신 소켓을 기본 수신 소켓으로 설정
-    ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->DestroySocket(ReceiveSocket);
-    ReceiveSocket = BroadcastReceiveSocket;
-    
+
+    UE_LOG(LogMultiServerSync, Display, TEXT("Time sync socket bound to port %d"), TimeSyncTransport->GetLocalPort());
     return true;
 }
 
-bool FNetworkManager::StartReceiverThread()
+bool FNetworkManager::CreateMulticastSocket()
 {
-    // 수신 작업자 생성
-    ReceiverWorker = new FNetworkReceiverWorker(this, ReceiveSocket);
-    if (!ReceiverWorker)
+    if (!MulticastSettings.GroupAddress.IsMulticastAddress())
     {
-        UE_LOG(LogMultiServerSync, Error, TEXT("Failed to create receiver worker"));
+        UE_LOG(LogMultiServerSync, Error, TEXT("%s is not a multicast group address"), *MulticastSettings.GroupAddress.ToString());
         return false;
     }
-    
-    // 수신 스레드 시작
-    ReceiverThread = FRunnableThread::Create(ReceiverWorker, TEXT("MultiServerSync_ReceiverThread"));
-    if (!ReceiverThread)
+
+    // 그룹 포트에 바인딩한 뒤 선택한 인터페이스로 그룹에 가입 (같은 호스트의 다른 노드와 포트를 공유할 수 있도록 재사용 옵션 사용)
+    TUniquePtr<INetworkTransport> Transport = INetworkTransport::Create(ReceiveBackend, FIPv4Address::Any, MulticastSettings.Port,
+        TEXT("MultiServerSync_MulticastSocket"));
+
+    if (!Transport)
     {
-        UE_LOG(LogMultiServerSync, Error, TEXT("Failed to create receiver thread"));
-        delete ReceiverWorker;
-        ReceiverWorker = nullptr;
+        UE_LOG(LogMultiServerSync, Error, TEXT("Failed to create multicast socket on port %d"), MulticastSettings.Port);
         return false;
     }
-    
-    UE_LOG(LogMultiServerSync, Display, TEXT("Receiver thread started"));
+
+    if (!Transport->EnableMulticast(MulticastSettings.GroupAddress, MulticastSettings.InterfaceAddress,
+        MulticastSettings.TimeToLive, MulticastSettings.bLoopback))
+    {
+        UE_LOG(LogMultiServerSync, Error, TEXT("Failed to join multicast group %s on interface %s"),
+            *MulticastSettings.GroupAddress.ToString(), *MulticastSettings.InterfaceAddress.ToString());
+        return false;
+    }
+
+    MulticastTransport = MoveTemp(Transport);
+
+    UE_LOG(LogMultiServerSync, Display, TEXT("Joined multicast group %s:%d on interface %s (TTL %d, loopback %s)"),
+        *MulticastSettings.GroupAddress.ToString(), MulticastSettings.Port, *MulticastSettings.InterfaceAddress.ToString(),
+        MulticastSettings.TimeToLive, MulticastSettings.bLoopback ? TEXT("on") : TEXT("off"));
+    return true;
+}
+
+bool FNetworkManager::StartReceiverThread()
+{
+    for (int32 ShardIndex = 0; ShardIndex < ReceiveShards.Num(); ++ShardIndex)
+    {
+        FReceiveShard& Shard = *ReceiveShards[ShardIndex];
+
+        // 채널별 수신 데이터그램을 이 샤드의 인박스로 넘기는 처리 함수
+        auto MakeHandler = [this, ShardIndex](ENetworkChannel Channel) -> FDatagramBatchHandler
+            {
+                return [this, ShardIndex, Channel](const FReceivedDatagram* Datagrams, int32 Count)
+                    {
+                        ProcessReceivedBatch(ShardIndex, Channel, Datagrams, Count);
+                    };
+            };
+
+        // 수신 작업자 생성
+        // 샤드 0은 리액터 하나로 시간 동기화, 멀티캐스트, 데이터, 탐색 소켓을 함께 감시 (동시에 준비되면 이 순서로 처리)
+        if (ShardIndex == 0)
+        {
+            Shard.Worker = new FNetworkReceiverWorker(TimeSyncTransport.Get(), MakeHandler(ENetworkChannel::TimeSync), ReceiverWaitMode);
+            if (MulticastTransport)
+            {
+                Shard.Worker->AddTransport(MulticastTransport.Get(), MakeHandler(ENetworkChannel::Multicast));
+            }
+            Shard.Worker->AddTransport(Shard.Transport.Get(), MakeHandler(ENetworkChannel::Data));
+            Shard.Worker->AddTransport(DiscoveryTransport.Get(), MakeHandler(ENetworkChannel::Discovery));
+
+            // 저지연 설정은 시간 동기화 소켓을 감시하는 이 스레드에만 적용
+            Shard.Worker->SetThreadSettings(ReceiverThreadSettings);
+        }
+        else
+        {
+            Shard.Worker = new FNetworkReceiverWorker(Shard.Transport.Get(), MakeHandler(ENetworkChannel::Data), ReceiverWaitMode);
+        }
+
+        // 수신 스레드 시작
+        const FString ThreadName = ShardIndex == 0
+            ? FString(TEXT("MultiServerSync_ReceiverThread"))
+            : FString::Printf(TEXT("MultiServerSync_ReceiverThread_%d"), ShardIndex);
+
+        Shard.Thread = FRunnableThread::Create(Shard.Worker, *ThreadName);
+        if (!Shard.Thread)
+        {
+            UE_LOG(LogMultiServerSync, Error, TEXT("Failed to create receiver thread for shard %d"), ShardIndex);
+            delete Shard.Worker;
+            Shard.Worker = nullptr;
+            return false;
+        }
+    }
+
+    UE_LOG(LogMultiServerSync, Display, TEXT("Receiver threads started (%d)"), ReceiveShards.Num());
     return true;
 }
 
@@ -1130,12 +2503,21 @@ void FNetworkManager::CleanupServerList()
     
     for (const FString& ServerId : ServersToRemove)
     {
+        // 제거된 서버의 피어 상태도 정리하여 인덱스를 재사용
+        const FServerEndpoint& Server = DiscoveredServers[ServerId];
+        const FPeerId PeerId = PeerRegistry.Find(FIPv4Endpoint(Server.IPAddress, Server.Port));
+        DiscardPendingAcks(PeerId);
+        PeerRegistry.Remove(PeerId);
+
+        const FIPv4Address ServerAddress = Server.IPAddress;
         DiscoveredServers.Remove(ServerId);
+        UpdateAddressProtocolVersion(ServerAddress);
+        bFanOutTargetsDirty = true;
         UE_LOG(LogMultiServerSync, Display, TEXT("Server removed due to timeout: %s"), *ServerId);
     }
 }
 
-void FNetworkManager::HandleDiscoveryMessage(const FNetworkMessage& Message, const FIPv4Endpoint& Sender)
+void FNetworkManager::HandleDiscoveryMessage(const FNetworkMessageView& Message, const FIPv4Endpoint& Sender)
 {
     // 디스커버리 요청에 응답
     UE_LOG(LogMultiServerSync, Display, TEXT("Discovery message received from %s"), *Sender.ToString());
@@ -1146,14 +2528,24 @@ void FNetworkManager::HandleDiscoveryMessage(const FNetworkMessage& Message, con
     {
         SenderHostName = FString((TCHAR*)Message.GetData().GetData(), Message.GetData().Num() / sizeof(TCHAR));
     }
+
+    // 호스트 이름과 데이터 포트 파싱 (포트가 없으면 발신 포트 사용)
+    uint16 SenderPort = Sender.Port;
+    int32 ColonPos = SenderHostName.Find(TEXT(":"));
+    if (ColonPos != INDEX_NONE)
+    {
+        SenderPort = FCString::Atoi(*SenderHostName.Mid(ColonPos + 1));
+        SenderHostName = SenderHostName.Left(ColonPos);
+    }
     
     // 서버 정보 생성
     FServerEndpoint ServerInfo;
     ServerInfo.Id = SenderHostName.IsEmpty() ? Sender.ToString() : SenderHostName;
     ServerInfo.HostName = SenderHostName;
     ServerInfo.IPAddress = Sender.Address;
-    ServerInfo.Port = Sender.Port;
+    ServerInfo.Port = SenderPort;
     ServerInfo.ProjectId = Message.GetProjectId();
+    ServerInfo.ProtocolVersion = Message.GetVersion();
     ServerInfo.LastCommunicationTime = FPlatformTime::Seconds();
     
     // 서버 목록에 추가
@@ -1163,7 +2555,7 @@ void FNetworkManager::HandleDiscoveryMessage(const FNetworkMessage& Message, con
     SendDiscoveryResponse(Sender);
 }
 
-void FNetworkManager::HandleDiscoveryResponseMessage(const FNetworkMessage& Message, const FIPv4Endpoint& Sender)
+void FNetworkManager::HandleDiscoveryResponseMessage(const FNetworkMessageView& Message, const FIPv4Endpoint& Sender)
 {
     UE_LOG(LogMultiServerSync, Display, TEXT("Discovery response received from %s"), *Sender.ToString());
 
@@ -1193,159 +2585,90 @@ void FNetworkManager::HandleDiscoveryResponseMessage(const FNetworkMessage& Mess
     ServerInfo.IPAddress = Sender.Address;
     ServerInfo.Port = SenderPort;
     ServerInfo.ProjectId = Message.GetProjectId();
+    ServerInfo.ProtocolVersion = Message.GetVersion();
     ServerInfo.LastCommunicationTime = FPlatformTime::Seconds();
 
     // 서버 목록에 추가
     AddOrUpdateServer(ServerInfo);
 }
 
-void FNetworkManager::HandleTimeSyncMessage(const FNetworkMessage& Message, const FIPv4Endpoint& Sender)
+void FNetworkManager::HandleTimeSyncMessage(const FNetworkMessageView& Message, const FIPv4Endpoint& Sender)
 {
-    // 발신자 ID 찾기
-    FString SenderId;
-    for (const auto& Pair : DiscoveredServers)
-    {
-        if (Pair.Value.IPAddress == Sender.Address && Pair.Value.Port == Sender.Port)
-        {
-            SenderId = Pair.Key;
-            break;
-        }
-    }
+    // PTP 메시지는 TimeSync 구독자에게 전달됨 (ProcessReceivedMessage에서 디스패치)
+    UE_LOG(LogMultiServerSync, Verbose, TEXT("Received time sync message from %s (%d bytes)"),
+        *Sender.ToString(), Message.GetData().Num());
+}
 
-    if (SenderId.IsEmpty())
+bool FNetworkManager::SendTimeSyncMessage(const TArray<uint8>& PTPMessage)
+{
+    if (!bIsInitialized)
     {
-        SenderId = Sender.ToString();
+        return false;
     }
 
-    UE_LOG(LogMultiServerSync, Verbose, TEXT("Received time sync message from %s"), *SenderId);
-
-    // 메시지를 TimeSync 모듈로 전달
-    // 이 부분은 직접 구현하기보다 주석으로 표시만 하고,
-    // 나중에 필요할 때 FSyncFrameworkManager에서 구현하는 것이 좋습니다.
-
-    /*
-    // 직접적인 모듈 참조는 순환 의존성을 일으킬 수 있으므로 주석 처리
-    TSharedPtr<ISyncFrameworkManager> FrameworkManager = FMultiServerSyncModule::GetFrameworkManager();
-    if (FrameworkManager.IsValid())
-    {
-        TSharedPtr<ITimeSync> TimeSync = FrameworkManager->GetTimeSync();
-        if (TimeSync.IsValid())
-        {
-            // TimeSync를 FTimeSync로 캐스팅하여 PTP 메시지 처리 함수 호출
-            FTimeSync* TimeSyncImpl = static_cast<FTimeSync*>(TimeSync.Get());
-            TimeSyncImpl->ProcessPTPMessage(Message.GetData());
-        }
-    }
-    */
+    // 시간 동기화 메시지 생성
+    FNetworkMessage Message(ENetworkMessageType::TimeSync, PTPMessage);
+    Message.SetProjectId(ProjectId);
+    Message.SetSequenceNumber(GetNextSequenceNumber());
 
-    // 대신, 메시지 핸들러가 설정되어 있으면 그것을 호출합니다
-    if (MessageHandler)
-    {
-        MessageHandler(SenderId, Message.GetData());
-    }
+    // 모든 서버에 브로드캐스트
+    return BroadcastMessageToServers(Message);
 }
 
-bool FNetworkManager::SendTimeSyncMessage(const TArray<uint8>& PTPMessage)
+bool FNetworkManager::SendFrameSyncMessage(const TArray<uint8>& FrameSyncData)
 {
     if (!bIsInitialized)
     {
         return false;
     }
 
-    // 시간 동기화 메시지 생성
-    FNetworkMessage Message(ENetworkMessageType::TimeSync, PTPMessage);
+    // 프레임 동기화 메시지 생성
+    FNetworkMessage Message(ENetworkMessageType::FrameSync, FrameSyncData);
     Message.SetProjectId(ProjectId);
     Message.SetSequenceNumber(GetNextSequenceNumber());
 
-    // 모든 서버에 브로드캐스트
+    // 모든 서버에 브로드캐스트 (멀티캐스트가 활성화되어 있으면 그룹으로 한 번만 전송)
     return BroadcastMessageToServers(Message);
 }
 
-void FNetworkManager::HandleFrameSyncMessage(const FNetworkMessage& Message, const FIPv4Endpoint& Sender)
+void FNetworkManager::HandleFrameSyncMessage(const FNetworkMessageView& Message, const FIPv4Endpoint& Sender)
 {
-    // 프레임 동기화 메시지 처리 (모듈 5에서 구현 예정)
+    // 프레임 동기화 메시지는 FrameSync 구독자에게 전달됨 (ProcessReceivedMessage에서 디스패치)
 }
 
-void FNetworkManager::HandleCommandMessage(const FNetworkMessage& Message, const FIPv4Endpoint& Sender)
+void FNetworkManager::HandleCommandMessage(const FNetworkMessageView& Message, const FIPv4Endpoint& Sender)
 {
-    // 명령 메시지 처리
-    if (MessageHandler)
-    {
-        // 발신자 ID 찾기
-        FString SenderId;
-        for (const auto& Pair : DiscoveredServers)
-        {
-            if (Pair.Value.IPAddress == Sender.Address && Pair.Value.Port == Sender.Port)
-            {
-                SenderId = Pair.Key;
-                break;
-            }
-        }
-        
-        if (SenderId.IsEmpty())
-        {
-            SenderId = Sender.ToString();
-        }
-        
-        // 메시지 핸들러 호출
-        MessageHandler(SenderId, Message.GetData());
-    }
+    // 명령 메시지는 Command 구독자에게 전달됨 (ProcessReceivedMessage에서 디스패치)
+    UE_LOG(LogMultiServerSync, Verbose, TEXT("Received %d message from %s (%d bytes)"),
+        static_cast<int32>(Message.GetType()), *Sender.ToString(), Message.GetData().Num());
 }
 
-void FNetworkManager::HandleDataMessage(const FNetworkMessage& Message, const FIPv4Endpoint& Sender)
+void FNetworkManager::HandleDataMessage(const FNetworkMessageView& Message, const FIPv4Endpoint& Sender)
 {
     // 데이터 메시지 처리 (HandleCommandMessage와 동일한 로직)
     HandleCommandMessage(Message, Sender);
 
-    // ACK 필요 여부 확인 (플래그의 첫 번째 비트 확인)
-    if (Message.GetFlags() & 1) // Flag = 1: ACK 필요
+    // ACK 필요 여부 확인
+    if (Message.GetFlags() & FNetworkMessage::FLAG_ACK_REQUIRED)
     {
-        // ACK 메시지 생성
-        TArray<uint8> AckData;
-        uint16 SequenceNumber = Message.GetSequenceNumber();
-        AckData.SetNum(sizeof(uint16));
-        FMemory::Memcpy(AckData.GetData(), &SequenceNumber, sizeof(uint16));
-
-        FNetworkMessage AckMessage(ENetworkMessageType::MessageAck, AckData);
-        AckMessage.SetProjectId(ProjectId);
-        AckMessage.SetSequenceNumber(GetNextSequenceNumber());
-
-        // ACK 메시지 전송
-        SendMessageToEndpoint(Sender, AckMessage);
-
-        UE_LOG(LogMultiServerSync, Verbose, TEXT("Sent ACK for message (Seq: %u, to: %s)"),
-            SequenceNumber, *Sender.ToString());
+        QueueAck(Sender, Message.GetSequenceNumber());
     }
 }
 
-void FNetworkManager::HandleCustomMessage(const FNetworkMessage& Message, const FIPv4Endpoint& Sender)
+void FNetworkManager::HandleCustomMessage(const FNetworkMessageView& Message, const FIPv4Endpoint& Sender)
 {
     // 사용자 정의 메시지 처리 (HandleCommandMessage와 동일한 로직)
     HandleCommandMessage(Message, Sender);
 
-    if (Message.GetFlags() & 1) // Flag = 1: ACK 필요
+    if (Message.GetFlags() & FNetworkMessage::FLAG_ACK_REQUIRED)
     {
-        // ACK 메시지 생성
-        TArray<uint8> AckData;
-        uint16 SequenceNumber = Message.GetSequenceNumber();
-        AckData.SetNum(sizeof(uint16));
-        FMemory::Memcpy(AckData.GetData(), &SequenceNumber, sizeof(uint16));
-
-        FNetworkMessage AckMessage(ENetworkMessageType::MessageAck, AckData);
-        AckMessage.SetProjectId(ProjectId);
-        AckMessage.SetSequenceNumber(GetNextSequenceNumber());
-
-        // ACK 메시지 전송
-        SendMessageToEndpoint(Sender, AckMessage);
-
-        UE_LOG(LogMultiServerSync, Verbose, TEXT("Sent ACK for message (Seq: %u, to: %s)"),
-            SequenceNumber, *Sender.ToString());
+        QueueAck(Sender, Message.GetSequenceNumber());
     }
 }
 
 uint16 FNetworkManager::GetNextSequenceNumber()
 {
-    return ++CurrentSequenceNumber;
+    return FSequenceNumber::Truncate(++CurrentSequenceNumber);
 }
 
 bool FNetworkManager::HasEnoughTimePassed(double& LastTime, double Interval) const
@@ -1386,21 +2709,20 @@ bool FNetworkManager::StartMasterElection()
 
     // 자신에게 투표
     float SelfVotePriority = CalculateVotePriority();
-    ElectionVotes.Add(HostName, SelfVotePriority);
+    ElectionVotes.Add(LocalServerIdHash, SelfVotePriority);
 
     // 선출 메시지 생성
-    FString ElectionData = FString::Printf(TEXT("%s:%d:%f"),
-        *HostName, CurrentElectionTerm, SelfVotePriority);
-    TArray<uint8> ElectionBytes;
-    ElectionBytes.SetNum(ElectionData.Len() * sizeof(TCHAR));
-    FMemory::Memcpy(ElectionBytes.GetData(), *ElectionData, ElectionData.Len() * sizeof(TCHAR));
+    FMasterElectionPayload Election;
+    Election.CandidateIdHash = LocalServerIdHash;
+    Election.ElectionTerm = CurrentElectionTerm;
+    Election.Priority = SelfVotePriority;
 
     // 선출 메시지 브로드캐스트
-    FNetworkMessage Message(ENetworkMessageType::MasterElection, ElectionBytes);
+    FNetworkMessage Message = FNetworkMessage::MakePayloadMessage<ENetworkMessageType::MasterElection>(Election);
     Message.SetProjectId(ProjectId);
     Message.SetSequenceNumber(GetNextSequenceNumber());
 
-    UE_LOG(LogMultiServerSync, Display, TEXT("Broadcasting election message: %s"), *ElectionData);
+    UE_LOG(LogMultiServerSync, Display, TEXT("Broadcasting election message: term %d, priority %.2f"), CurrentElectionTerm, SelfVotePriority);
     return BroadcastMessageToServers(Message);
 }
 
@@ -1424,6 +2746,7 @@ void FNetworkManager::AnnounceMaster()
     // 마스터 정보 생성
     FMasterInfo MasterInfo;
     MasterInfo.ServerId = HostName;
+    MasterInfo.ServerIdHash = LocalServerIdHash;
     MasterInfo.Priority = MasterPriority;
     MasterInfo.LastUpdateTime = FPlatformTime::Seconds();
     MasterInfo.ElectionTerm = CurrentElectionTerm;
@@ -1440,27 +2763,15 @@ void FNetworkManager::AnnounceMaster()
     // 여기서 클래스 멤버 변수를 사용
     MasterInfo.Port = this->Port;
 
-    // 마스터 정보를 문자열로 직렬화
-    FString MasterData = FString::Printf(TEXT("%s:%s:%d:%f:%d"),
-        *MasterInfo.ServerId,
-        *MasterInfo.IPAddress.ToString(),
-        MasterInfo.Port,
-        MasterInfo.Priority,
-        MasterInfo.ElectionTerm);
-
-    TArray<uint8> MasterBytes;
-    MasterBytes.SetNum(MasterData.Len() * sizeof(TCHAR));
-    FMemory::Memcpy(MasterBytes.GetData(), *MasterData, MasterData.Len() * sizeof(TCHAR));
-
     // 마스터 공지 메시지 생성 및 브로드캐스트
-    FNetworkMessage Message(ENetworkMessageType::MasterAnnouncement, MasterBytes);
+    FNetworkMessage Message = FNetworkMessage::MakePayloadMessage<ENetworkMessageType::MasterAnnouncement>(MakeMasterInfoPayload(MasterInfo));
     Message.SetProjectId(ProjectId);
     Message.SetSequenceNumber(GetNextSequenceNumber());
 
     BroadcastMessageToServers(Message);
     LastMasterAnnouncementTime = FPlatformTime::Seconds();
 
-    UE_LOG(LogMultiServerSync, Display, TEXT("Master announcement sent: %s"), *MasterData);
+    UE_LOG(LogMultiServerSync, Display, TEXT("Master announcement sent: %s"), *MasterInfo.ToString());
 }
 
 // 마스터 사임 메서드
@@ -1473,14 +2784,8 @@ void FNetworkManager::ResignMaster()
 
     UE_LOG(LogMultiServerSync, Display, TEXT("Resigning as master..."));
 
-    // 마스터 사임 메시지 생성
-    FString ResignData = HostName;
-    TArray<uint8> ResignBytes;
-    ResignBytes.SetNum(ResignData.Len() * sizeof(TCHAR));
-    FMemory::Memcpy(ResignBytes.GetData(), *ResignData, ResignData.Len() * sizeof(TCHAR));
-
     // 사임 메시지 브로드캐스트
-    FNetworkMessage Message(ENetworkMessageType::MasterResign, ResignBytes);
+    FNetworkMessage Message = FNetworkMessage::MakePayloadMessage<ENetworkMessageType::MasterResign>(FServerIdPayload(LocalServerIdHash));
     Message.SetProjectId(ProjectId);
     Message.SetSequenceNumber(GetNextSequenceNumber());
 
@@ -1504,24 +2809,24 @@ void FNetworkManager::ResignMaster()
 }
 
 // 마스터 투표 전송 메서드 
-void FNetworkManager::SendElectionVote(const FString& CandidateId)
+void FNetworkManager::SendElectionVote(FServerIdHash CandidateIdHash)
 {
     if (!bIsInitialized)
     {
         return;
     }
 
-    UE_LOG(LogMultiServerSync, Display, TEXT("Sending vote for candidate: %s"), *CandidateId);
+    UE_LOG(LogMultiServerSync, Display, TEXT("Sending vote for candidate: %s"), *ResolveServerId(CandidateIdHash));
 
     // 투표 메시지 생성
-    FString VoteData = FString::Printf(TEXT("%s:%s:%d:%f"),
-        *HostName, *CandidateId, CurrentElectionTerm, MasterPriority);
-    TArray<uint8> VoteBytes;
-    VoteBytes.SetNum(VoteData.Len() * sizeof(TCHAR));
-    FMemory::Memcpy(VoteBytes.GetData(), *VoteData, VoteData.Len() * sizeof(TCHAR));
+    FMasterVotePayload Vote;
+    Vote.VoterIdHash = LocalServerIdHash;
+    Vote.CandidateIdHash = CandidateIdHash;
+    Vote.ElectionTerm = CurrentElectionTerm;
+    Vote.VoterPriority = MasterPriority;
 
     // 투표 메시지 브로드캐스트
-    FNetworkMessage Message(ENetworkMessageType::MasterVote, VoteBytes);
+    FNetworkMessage Message = FNetworkMessage::MakePayloadMessage<ENetworkMessageType::MasterVote>(Vote);
     Message.SetProjectId(ProjectId);
     Message.SetSequenceNumber(GetNextSequenceNumber());
 
@@ -1546,7 +2851,8 @@ bool FNetworkManager::TryBecomeMaster()
     }
 
     // 투표 집계 및 우승자 결정
-    FString WinnerId;
+    FServerIdHash WinnerIdHash = 0;
+    bool bHasWinner = false;
     float HighestPriority = -1.0f;
 
     for (const auto& Pair : ElectionVotes)
@@ -1554,12 +2860,13 @@ bool FNetworkManager::TryBecomeMaster()
         if (Pair.Value > HighestPriority)
         {
             HighestPriority = Pair.Value;
-            WinnerId = Pair.Key;
+            WinnerIdHash = Pair.Key;
+            bHasWinner = true;
         }
     }
 
     // 우승자가 자신인 경우
-    if (WinnerId == HostName)
+    if (bHasWinner && WinnerIdHash == LocalServerIdHash)
     {
         UE_LOG(LogMultiServerSync, Display, TEXT("Local server won election with priority %.2f"), HighestPriority);
 
@@ -1568,6 +2875,7 @@ bool FNetworkManager::TryBecomeMaster()
 
         // 마스터 정보 업데이트
         CurrentMaster.ServerId = HostName;
+        CurrentMaster.ServerIdHash = LocalServerIdHash;
 
         // 로컬 IP 주소 가져오기
         bool bCanBindAll = false;
@@ -1597,26 +2905,27 @@ bool FNetworkManager::TryBecomeMaster()
     }
     else
     {
-        UE_LOG(LogMultiServerSync, Display, TEXT("Election lost to %s with priority %.2f"), *WinnerId, HighestPriority);
+        UE_LOG(LogMultiServerSync, Display, TEXT("Election lost to %s with priority %.2f"),
+            bHasWinner ? *ResolveServerId(WinnerIdHash) : TEXT("(none)"), HighestPriority);
         return false;
     }
 }
 
 // 선출 종료 메서드
-void FNetworkManager::EndElection(const FString& WinnerId, int32 ElectionTerm)
+void FNetworkManager::EndElection(FServerIdHash WinnerIdHash, int32 ElectionTerm)
 {
     if (!bIsInitialized || !bElectionInProgress)
     {
         return;
     }
 
-    UE_LOG(LogMultiServerSync, Display, TEXT("Ending election: winner=%s, term=%d"), *WinnerId, ElectionTerm);
+    UE_LOG(LogMultiServerSync, Display, TEXT("Ending election: winner=%s, term=%d"), *ResolveServerId(WinnerIdHash), ElectionTerm);
 
     // 선출 진행 플래그 초기화
     bElectionInProgress = false;
 
     // 자신이 우승자인 경우
-    if (WinnerId == HostName)
+    if (WinnerIdHash == LocalServerIdHash)
     {
         TryBecomeMaster();
     }
@@ -1710,71 +3019,66 @@ void FNetworkManager::SendRoleChangeNotification()
         bIsMaster ? TEXT("true") : TEXT("false"));
 
     // 역할 정보 생성
-    FString RoleData = FString::Printf(TEXT("%s:%s:%d"),
-        *HostName, bIsMaster ? TEXT("true") : TEXT("false"), CurrentElectionTerm);
-    TArray<uint8> RoleBytes;
-    RoleBytes.SetNum(RoleData.Len() * sizeof(TCHAR));
-    FMemory::Memcpy(RoleBytes.GetData(), *RoleData, RoleData.Len() * sizeof(TCHAR));
+    FRoleChangePayload Role;
+    Role.ServerIdHash = LocalServerIdHash;
+    Role.ElectionTerm = CurrentElectionTerm;
+    Role.bIsMaster = bIsMaster;
 
     // 역할 변경 메시지 생성 및 브로드캐스트
-    FNetworkMessage Message(ENetworkMessageType::RoleChange, RoleBytes);
+    FNetworkMessage Message = FNetworkMessage::MakePayloadMessage<ENetworkMessageType::RoleChange>(Role);
     Message.SetProjectId(ProjectId);
     Message.SetSequenceNumber(GetNextSequenceNumber());
 
     BroadcastMessageToServers(Message);
 }
 
-// 마스터 공지 메시지 처리 메서드
-void FNetworkManager::HandleMasterAnnouncement(const FNetworkMessage& Message, const FIPv4Endpoint& Sender)
+FString FNetworkManager::ResolveServerId(FServerIdHash ServerIdHash) const
 {
-    if (!bIsInitialized)
+    if (ServerIdHash == LocalServerIdHash)
     {
-        return;
+        return HostName;
     }
 
-    // 메시지 데이터 파싱
-    FString MasterData;
-    if (Message.GetData().Num() > 0)
+    // 아직 탐색하지 못한 서버는 해시로 표시 (탐색 후 다음 공지부터 서버 ID로 표시됨)
+    const FString* ServerId = KnownServerIds.Find(ServerIdHash);
+    return ServerId ? *ServerId : FString::Printf(TEXT("Server-%08X"), ServerIdHash);
+}
+
+// 마스터 공지 메시지 처리 메서드
+void FNetworkManager::HandleMasterAnnouncement(const FNetworkMessageView& Message, const FIPv4Endpoint& Sender)
+{
+    if (!bIsInitialized)
     {
-        MasterData = FString((TCHAR*)Message.GetData().GetData(), Message.GetData().Num() / sizeof(TCHAR));
+        return;
     }
 
-    UE_LOG(LogMultiServerSync, Display, TEXT("Received master announcement: %s"), *MasterData);
-
     // 마스터 정보 파싱
-    TArray<FString> Parts;
-    MasterData.ParseIntoArray(Parts, TEXT(":"), true);
-
-    if (Parts.Num() < 5)
+    FMasterInfoPayload Payload;
+    if (!Message.ReadPayload<ENetworkMessageType::MasterAnnouncement>(Payload))
     {
-        UE_LOG(LogMultiServerSync, Warning, TEXT("Invalid master announcement data format"));
+        UE_LOG(LogMultiServerSync, Warning, TEXT("Invalid master announcement payload from %s (%d bytes)"),
+            *Sender.ToString(), Message.GetData().Num());
         return;
     }
 
-    FString MasterId = Parts[0];
-    FString IPAddressStr = Parts[1];
-    // 'Port' 변수 이름 변경 -> 'PortNumber'
-    int32 PortNumber = FCString::Atoi(*Parts[2]);
-    float Priority = FCString::Atof(*Parts[3]);
-    int32 ElectionTerm = FCString::Atoi(*Parts[4]);
-
     // 발신자가 자신인 경우 무시
-    if (MasterId == HostName)
+    if (Payload.ServerIdHash == LocalServerIdHash)
     {
         return;
     }
 
-    // IP 주소 파싱
-    FIPv4Address MasterIP;
-    FIPv4Address::Parse(IPAddressStr, MasterIP);
+    const int32 ElectionTerm = Payload.ElectionTerm;
+    const FString MasterId = ResolveServerId(Payload.ServerIdHash);
 
-    // 마스터 정보 업데이트
+    // 마스터 정보 업데이트 (식별은 해시로 하고 서버 ID는 표시용)
     FMasterInfo NewMasterInfo;
     NewMasterInfo.ServerId = MasterId;
-    NewMasterInfo.IPAddress = MasterIP;
-    // 변경된 변수명 사용
-    NewMasterInfo.Port = PortNumber;
-    NewMasterInfo.Priority = Priority;
+    NewMasterInfo.ServerIdHash = Payload.ServerIdHash;
+    NewMasterInfo.IPAddress = Payload.IPAddress;
+    NewMasterInfo.Port = Payload.Port;
+    NewMasterInfo.Priority = Payload.Priority;
+
+    UE_LOG(LogMultiServerSync, Display, TEXT("Received master announcement: %s"), *NewMasterInfo.ToString());
 
     // 현재 선출 기간보다 이전이면 무시
     if (ElectionTerm < CurrentElectionTerm)
@@ -1799,7 +3103,7 @@ void FNetworkManager::HandleMasterAnnouncement(const FNetworkMessage& Message, c
 }
 
 // 마스터 정보 요청 메시지 처리 메서드
-void FNetworkManager::HandleMasterQuery(const FNetworkMessage& Message, const FIPv4Endpoint& Sender)
+void FNetworkManager::HandleMasterQuery(const FNetworkMessageView& Message, const FIPv4Endpoint& Sender)
 {
     if (!bIsInitialized)
     {
@@ -1807,13 +3111,14 @@ void FNetworkManager::HandleMasterQuery(const FNetworkMessage& Message, const FI
     }
 
     // 메시지 데이터 파싱
-    FString QueryData;
-    if (Message.GetData().Num() > 0)
+    FServerIdPayload Query;
+    if (!Message.ReadPayload<ENetworkMessageType::MasterQuery>(Query))
     {
-        QueryData = FString((TCHAR*)Message.GetData().GetData(), Message.GetData().Num() / sizeof(TCHAR));
+        UE_LOG(LogMultiServerSync, Warning, TEXT("Invalid master query payload from %s"), *Sender.ToString());
+        return;
     }
 
-    UE_LOG(LogMultiServerSync, Display, TEXT("Received master query from: %s"), *QueryData);
+    UE_LOG(LogMultiServerSync, Display, TEXT("Received master query from: %s"), *ResolveServerId(Query.ServerIdHash));
 
     // 현재 마스터 정보 확인
     if (bIsMaster)
@@ -1824,18 +3129,7 @@ void FNetworkManager::HandleMasterQuery(const FNetworkMessage& Message, const FI
     else if (!CurrentMaster.ServerId.IsEmpty())
     {
         // 알고 있는 마스터 정보가 있는 경우, 마스터 정보 응답 전송
-        FString MasterData = FString::Printf(TEXT("%s:%s:%d:%f:%d"),
-            *CurrentMaster.ServerId,
-            *CurrentMaster.IPAddress.ToString(),
-            CurrentMaster.Port,
-            CurrentMaster.Priority,
-            CurrentMaster.ElectionTerm);
-
-        TArray<uint8> MasterBytes;
-        MasterBytes.SetNum(MasterData.Len() * sizeof(TCHAR));
-        FMemory::Memcpy(MasterBytes.GetData(), *MasterData, MasterData.Len() * sizeof(TCHAR));
-
-        FNetworkMessage Response(ENetworkMessageType::MasterResponse, MasterBytes);
+        FNetworkMessage Response = FNetworkMessage::MakePayloadMessage<ENetworkMessageType::MasterResponse>(MakeMasterInfoPayload(CurrentMaster));
         Response.SetProjectId(ProjectId);
         Response.SetSequenceNumber(GetNextSequenceNumber());
 
@@ -1849,52 +3143,36 @@ void FNetworkManager::HandleMasterQuery(const FNetworkMessage& Message, const FI
 }
 
 // 마스터 정보 응답 메시지 처리 메서드
-void FNetworkManager::HandleMasterResponse(const FNetworkMessage& Message, const FIPv4Endpoint& Sender)
+void FNetworkManager::HandleMasterResponse(const FNetworkMessageView& Message, const FIPv4Endpoint& Sender)
 {
     if (!bIsInitialized)
     {
         return;
     }
 
-    // 메시지 데이터 파싱
-    FString MasterData;
-    if (Message.GetData().Num() > 0)
-    {
-        MasterData = FString((TCHAR*)Message.GetData().GetData(), Message.GetData().Num() / sizeof(TCHAR));
-    }
-
-    UE_LOG(LogMultiServerSync, Display, TEXT("Received master response: %s"), *MasterData);
-
     // 마스터 정보 파싱
-    TArray<FString> Parts;
-    MasterData.ParseIntoArray(Parts, TEXT(":"), true);
-
-    if (Parts.Num() < 5)
+    FMasterInfoPayload Payload;
+    if (!Message.ReadPayload<ENetworkMessageType::MasterResponse>(Payload))
     {
-        UE_LOG(LogMultiServerSync, Warning, TEXT("Invalid master response data format"));
+        UE_LOG(LogMultiServerSync, Warning, TEXT("Invalid master response payload from %s (%d bytes)"),
+            *Sender.ToString(), Message.GetData().Num());
         return;
     }
 
-    FString MasterId = Parts[0];
-    FString IPAddressStr = Parts[1];
-    // 'Port' 변수 이름 변경 -> 'PortNumber'
-    int32 PortNumber = FCString::Atoi(*Parts[2]);
-    float Priority = FCString::Atof(*Parts[3]);
-    int32 ElectionTerm = FCString::Atoi(*Parts[4]);
-
-    // IP 주소 파싱
-    FIPv4Address MasterIP;
-    FIPv4Address::Parse(IPAddressStr, MasterIP);
+    const int32 ElectionTerm = Payload.ElectionTerm;
+    const FString MasterId = ResolveServerId(Payload.ServerIdHash);
 
-    // 마스터 정보 업데이트
+    // 마스터 정보 업데이트 (식별은 해시로 하고 서버 ID는 표시용)
     FMasterInfo NewMasterInfo;
     NewMasterInfo.ServerId = MasterId;
-    NewMasterInfo.IPAddress = MasterIP;
-    // 여기서 변경된 변수명 사용
-    NewMasterInfo.Port = PortNumber;
-    NewMasterInfo.Priority = Priority;
+    NewMasterInfo.ServerIdHash = Payload.ServerIdHash;
+    NewMasterInfo.IPAddress = Payload.IPAddress;
+    NewMasterInfo.Port = Payload.Port;
+    NewMasterInfo.Priority = Payload.Priority;
     NewMasterInfo.ElectionTerm = ElectionTerm;
 
+    UE_LOG(LogMultiServerSync, Display, TEXT("Received master response: %s"), *NewMasterInfo.ToString());
+
     // 현재 선출 기간보다 이전이면 무시
     if (ElectionTerm < CurrentElectionTerm)
     {
@@ -1908,7 +3186,7 @@ void FNetworkManager::HandleMasterResponse(const FNetworkMessage& Message, const
     bElectionInProgress = false;
 
     // 자신이 이전에 마스터였다면 역할 변경
-    if (bIsMaster && MasterId != HostName)
+    if (bIsMaster && Payload.ServerIdHash != LocalServerIdHash)
     {
         bIsMaster = false;
         UpdateMasterStatus(MasterId, false);
@@ -1918,42 +3196,33 @@ void FNetworkManager::HandleMasterResponse(const FNetworkMessage& Message, const
 }
 
 // 마스터 선출 메시지 처리 메서드
-void FNetworkManager::HandleMasterElection(const FNetworkMessage& Message, const FIPv4Endpoint& Sender)
+void FNetworkManager::HandleMasterElection(const FNetworkMessageView& Message, const FIPv4Endpoint& Sender)
 {
     if (!bIsInitialized)
     {
         return;
     }
 
-    // 메시지 데이터 파싱
-    FString ElectionData;
-    if (Message.GetData().Num() > 0)
-    {
-        ElectionData = FString((TCHAR*)Message.GetData().GetData(), Message.GetData().Num() / sizeof(TCHAR));
-    }
-
-    UE_LOG(LogMultiServerSync, Display, TEXT("Received election message: %s"), *ElectionData);
-
     // 선출 정보 파싱
-    TArray<FString> Parts;
-    ElectionData.ParseIntoArray(Parts, TEXT(":"), true);
-
-    if (Parts.Num() < 3)
+    FMasterElectionPayload Election;
+    if (!Message.ReadPayload<ENetworkMessageType::MasterElection>(Election))
     {
-        UE_LOG(LogMultiServerSync, Warning, TEXT("Invalid election data format"));
+        UE_LOG(LogMultiServerSync, Warning, TEXT("Invalid election payload from %s"), *Sender.ToString());
         return;
     }
 
-    FString CandidateId = Parts[0];
-    int32 ElectionTerm = FCString::Atoi(*Parts[1]);
-    float Priority = FCString::Atof(*Parts[2]);
-
     // 발신자가 자신인 경우 무시
-    if (CandidateId == HostName)
+    if (Election.CandidateIdHash == LocalServerIdHash)
     {
         return;
     }
 
+    const FString CandidateId = ResolveServerId(Election.CandidateIdHash);
+    const int32 ElectionTerm = Election.ElectionTerm;
+    const float Priority = Election.Priority;
+
+    UE_LOG(LogMultiServerSync, Display, TEXT("Received election message: %s (term %d, priority %.2f)"), *CandidateId, ElectionTerm, Priority);
+
     // 현재 선출 기간보다 이전이면 무시
     if (ElectionTerm < CurrentElectionTerm)
     {
@@ -1971,50 +3240,37 @@ void FNetworkManager::HandleMasterElection(const FNetworkMessage& Message, const
     }
 
     // 후보자에게 투표
-    ElectionVotes.Add(CandidateId, Priority);
-    SendElectionVote(CandidateId);
+    ElectionVotes.Add(Election.CandidateIdHash, Priority);
+    SendElectionVote(Election.CandidateIdHash);
 
     UE_LOG(LogMultiServerSync, Display, TEXT("Voted for candidate: %s with priority %.2f"), *CandidateId, Priority);
 }
 
 // 마스터 투표 메시지 처리 메서드
-void FNetworkManager::HandleMasterVote(const FNetworkMessage& Message, const FIPv4Endpoint& Sender)
+void FNetworkManager::HandleMasterVote(const FNetworkMessageView& Message, const FIPv4Endpoint& Sender)
 {
     if (!bIsInitialized || !bElectionInProgress)
     {
         return;
     }
 
-    // 메시지 데이터 파싱
-    FString VoteData;
-    if (Message.GetData().Num() > 0)
-    {
-        VoteData = FString((TCHAR*)Message.GetData().GetData(), Message.GetData().Num() / sizeof(TCHAR));
-    }
-
-    UE_LOG(LogMultiServerSync, Display, TEXT("Received vote: %s"), *VoteData);
-
     // 투표 정보 파싱
-    TArray<FString> Parts;
-    VoteData.ParseIntoArray(Parts, TEXT(":"), true);
-
-    if (Parts.Num() < 4)
+    FMasterVotePayload Vote;
+    if (!Message.ReadPayload<ENetworkMessageType::MasterVote>(Vote))
     {
-        UE_LOG(LogMultiServerSync, Warning, TEXT("Invalid vote data format"));
+        UE_LOG(LogMultiServerSync, Warning, TEXT("Invalid vote payload from %s"), *Sender.ToString());
         return;
     }
 
-    FString VoterId = Parts[0];
-    FString CandidateId = Parts[1];
-    int32 ElectionTerm = FCString::Atoi(*Parts[2]);
-    float VoterPriority = FCString::Atof(*Parts[3]);
-
     // 발신자가 자신인 경우 무시
-    if (VoterId == HostName)
+    if (Vote.VoterIdHash == LocalServerIdHash)
     {
         return;
     }
 
+    const int32 ElectionTerm = Vote.ElectionTerm;
+    const float VoterPriority = Vote.VoterPriority;
+
     // 선출 기간이 맞지 않으면 무시
     if (ElectionTerm != CurrentElectionTerm)
     {
@@ -2023,13 +3279,13 @@ void FNetworkManager::HandleMasterVote(const FNetworkMessage& Message, const FIP
     }
 
     // 자신이 후보자인 경우에만 투표 수집
-    if (CandidateId == HostName)
+    if (Vote.CandidateIdHash == LocalServerIdHash)
     {
-        float* ExistingVote = ElectionVotes.Find(VoterId);
+        float* ExistingVote = ElectionVotes.Find(Vote.VoterIdHash);
         if (!ExistingVote || *ExistingVote < VoterPriority)
         {
-            ElectionVotes.Add(VoterId, VoterPriority);
-            UE_LOG(LogMultiServerSync, Display, TEXT("Received vote from %s with priority %.2f"), *VoterId, VoterPriority);
+            ElectionVotes.Add(Vote.VoterIdHash, VoterPriority);
+            UE_LOG(LogMultiServerSync, Display, TEXT("Received vote from %s with priority %.2f"), *ResolveServerId(Vote.VoterIdHash), VoterPriority);
         }
 
         // 투표 수가 서버 총 개수의 과반수 이상이면 마스터 결정
@@ -2043,7 +3299,7 @@ void FNetworkManager::HandleMasterVote(const FNetworkMessage& Message, const FIP
 }
 
 // 마스터 사임 메시지 처리 메서드
-void FNetworkManager::HandleMasterResign(const FNetworkMessage& Message, const FIPv4Endpoint& Sender)
+void FNetworkManager::HandleMasterResign(const FNetworkMessageView& Message, const FIPv4Endpoint& Sender)
 {
     if (!bIsInitialized)
     {
@@ -2051,19 +3307,17 @@ void FNetworkManager::HandleMasterResign(const FNetworkMessage& Message, const F
     }
 
     // 메시지 데이터 파싱
-    FString ResignData;
-    if (Message.GetData().Num() > 0)
+    FServerIdPayload Resign;
+    if (!Message.ReadPayload<ENetworkMessageType::MasterResign>(Resign))
     {
-        ResignData = FString((TCHAR*)Message.GetData().GetData(), Message.GetData().Num() / sizeof(TCHAR));
+        UE_LOG(LogMultiServerSync, Warning, TEXT("Invalid master resign payload from %s"), *Sender.ToString());
+        return;
     }
 
-    UE_LOG(LogMultiServerSync, Display, TEXT("Received master resign: %s"), *ResignData);
-
-    // 사임한 마스터 ID
-    FString ResignedMasterId = ResignData;
+    UE_LOG(LogMultiServerSync, Display, TEXT("Received master resign: %s"), *ResolveServerId(Resign.ServerIdHash));
 
     // 현재 마스터가 사임한 경우에만 처리
-    if (ResignedMasterId == CurrentMaster.ServerId)
+    if (!CurrentMaster.ServerId.IsEmpty() && Resign.ServerIdHash == CurrentMaster.ServerIdHash)
     {
         UE_LOG(LogMultiServerSync, Display, TEXT("Current master has resigned, starting new election"));
 
@@ -2076,35 +3330,23 @@ void FNetworkManager::HandleMasterResign(const FNetworkMessage& Message, const F
 }
 
 // 역할 변경 메시지 처리 메서드 (계속)
-void FNetworkManager::HandleRoleChange(const FNetworkMessage& Message, const FIPv4Endpoint& Sender)
+void FNetworkManager::HandleRoleChange(const FNetworkMessageView& Message, const FIPv4Endpoint& Sender)
 {
     if (!bIsInitialized)
     {
         return;
     }
 
-    // 메시지 데이터 파싱
-    FString RoleData;
-    if (Message.GetData().Num() > 0)
-    {
-        RoleData = FString((TCHAR*)Message.GetData().GetData(), Message.GetData().Num() / sizeof(TCHAR));
-    }
-
-    UE_LOG(LogMultiServerSync, Display, TEXT("Received role change: %s"), *RoleData);
-
     // 역할 정보 파싱
-    TArray<FString> Parts;
-    RoleData.ParseIntoArray(Parts, TEXT(":"), true);
-
-    if (Parts.Num() < 3)
+    FRoleChangePayload Role;
+    if (!Message.ReadPayload<ENetworkMessageType::RoleChange>(Role))
     {
-        UE_LOG(LogMultiServerSync, Warning, TEXT("Invalid role change data format"));
+        UE_LOG(LogMultiServerSync, Warning, TEXT("Invalid role change payload from %s"), *Sender.ToString());
         return;
     }
 
-    FString ServerId = Parts[0];
-    bool bServerIsMaster = Parts[1].ToBool();
-    int32 ElectionTerm = FCString::Atoi(*Parts[2]);
+    const bool bServerIsMaster = Role.bIsMaster;
+    const int32 ElectionTerm = Role.ElectionTerm;
 
     // 선출 기간이 맞지 않으면 무시
     if (ElectionTerm < CurrentElectionTerm)
@@ -2114,11 +3356,15 @@ void FNetworkManager::HandleRoleChange(const FNetworkMessage& Message, const FIP
     }
 
     // 발신자가 자신인 경우 무시
-    if (ServerId == HostName)
+    if (Role.ServerIdHash == LocalServerIdHash)
     {
         return;
     }
 
+    const FString ServerId = ResolveServerId(Role.ServerIdHash);
+    UE_LOG(LogMultiServerSync, Display, TEXT("Received role change: %s master=%s (term %d)"),
+        *ServerId, bServerIsMaster ? TEXT("true") : TEXT("false"), ElectionTerm);
+
     // 서버가 마스터가 된 경우
     if (bServerIsMaster)
     {
@@ -2197,6 +3443,10 @@ void FPingMessage::Serialize(FMemoryWriter& Writer) const
     // 시퀀스 번호 직렬화 - 임시 변수를 사용하여 수정
     uint32 TempSequenceNumber = SequenceNumber;
     Writer << TempSequenceNumber;
+
+    // 보류 시간 직렬화
+    uint32 TempHoldTime = HoldTimeMicroseconds;
+    Writer << TempHoldTime;
 }
 
 void FPingMessage::Deserialize(FMemoryReader& Reader)
@@ -2211,6 +3461,13 @@ void FPingMessage::Deserialize(FMemoryReader& Reader)
 
     // 시퀀스 번호 역직렬화
     Reader << SequenceNumber;
+
+    // 보류 시간 역직렬화 (이전 버전 페이로드에는 없음)
+    HoldTimeMicroseconds = 0;
+    if (Reader.TotalSize() - Reader.Tell() >= static_cast<int64>(sizeof(uint32)))
+    {
+        Reader << HoldTimeMicroseconds;
+    }
 }
 
 // 핑 요청 전송 함수 구현
@@ -2228,15 +3485,8 @@ uint32 FNetworkManager::SendPingRequest(const FIPv4Endpoint& ServerEndpoint)
     PingRequest.Timestamp = CurrentTimestamp;
     PingRequest.SequenceNumber = SequenceNumber;
 
-    // 메시지 직렬화
-    TArray<uint8> MessageData;
-    FMemoryWriter Writer(MessageData);
-
-    // 핑 메시지 직렬화
-    PingRequest.Serialize(Writer);
-
-    // 네트워크 메시지 생성
-    FNetworkMessage NetworkMessage(ENetworkMessageType::PingRequest, MessageData);
+    // 스키마로 직렬화해 네트워크 메시지 생성
+    FNetworkMessage NetworkMessage = FNetworkMessage::MakePayloadMessage<ENetworkMessageType::PingRequest>(PingRequest);
 
     // 메시지 전송
     SendMessageToEndpoint(ServerEndpoint, NetworkMessage);
@@ -2251,7 +3501,7 @@ uint32 FNetworkManager::SendPingRequest(const FIPv4Endpoint& ServerEndpoint)
     return SequenceNumber;
 }
 
-void FNetworkManager::SendPingResponse(const FPingMessage& RequestMessage, const FIPv4Endpoint& SourceEndpoint)
+void FNetworkManager::SendPingResponse(const FPingMessage& RequestMessage, const FIPv4Endpoint& SourceEndpoint, uint64 RequestArrivalTime)
 {
     // 핑 응답 메시지 생성
     FPingMessage PingResponse;
@@ -2259,84 +3509,85 @@ void FNetworkManager::SendPingResponse(const FPingMessage& RequestMessage, const
     PingResponse.Timestamp = RequestMessage.Timestamp; // 원본 타임스탬프 유지
     PingResponse.SequenceNumber = RequestMessage.SequenceNumber; // 원본 시퀀스 번호 유지
 
-    // 현재 처리 시간 기록 (새로 추가)
+    // 요청이 인박스에서 틱을 기다린 시간을 포함한 보류 시간 (요청 측이 RTT에서 뺌)
+    // 핑은 묶지 않고 바로 보내므로 송신 직전 시각으로 충분
     uint64 ProcessTime = GetHighPrecisionTimestamp();
+    const uint64 HoldTime = ProcessTime > RequestArrivalTime ? ProcessTime - RequestArrivalTime : 0;
+    PingResponse.HoldTimeMicroseconds = static_cast<uint32>(FMath::Min<uint64>(HoldTime, MAX_uint32));
 
-    // 메시지 직렬화
-    TArray<uint8> MessageData;
-    FMemoryWriter Writer(MessageData);
-
-    // 핑 메시지 직렬화
-    PingResponse.Serialize(Writer);
-
-    // 네트워크 메시지 생성
-    FNetworkMessage NetworkMessage(ENetworkMessageType::PingResponse, MessageData);
+    // 스키마로 직렬화해 네트워크 메시지 생성
+    FNetworkMessage NetworkMessage = FNetworkMessage::MakePayloadMessage<ENetworkMessageType::PingResponse>(PingResponse);
 
     // 메시지 전송
     SendMessageToEndpoint(SourceEndpoint, NetworkMessage);
 
-    UE_LOG(LogMultiServerSync, Verbose, TEXT("Sent ping response to %s (Seq: %u, Original timestamp: %llu, Process time: %llu)"),
-        *SourceEndpoint.ToString(), RequestMessage.SequenceNumber, RequestMessage.Timestamp, ProcessTime);
+    UE_LOG(LogMultiServerSync, Verbose, TEXT("Sent ping response to %s (Seq: %u, Original timestamp: %llu, Process time: %llu, Hold: %u μs)"),
+        *SourceEndpoint.ToString(), RequestMessage.SequenceNumber, RequestMessage.Timestamp, ProcessTime, PingResponse.HoldTimeMicroseconds);
 }
 
 // 핑 요청 처리 함수
-void FNetworkManager::HandlePingRequest(const TSharedPtr<FMemoryReader>& ReaderPtr, const FIPv4Endpoint& SourceEndpoint)
+void FNetworkManager::HandlePingRequest(const FNetworkMessageView& Message, const FIPv4Endpoint& SourceEndpoint)
 {
-    // 수신 시간 기록
-    uint64 ReceiveTime = GetHighPrecisionTimestamp();
+    // 수신 시간 기록 (처리 시각이 아니라 소켓 도착 시각)
+    uint64 ReceiveTime = GetHighPrecisionTimestamp() - Message.GetReceiveAgeMicroseconds();
 
-    // 요청 메시지 파싱
+    // 요청 메시지 파싱 (수신 버퍼에서 직접)
     FPingMessage RequestMessage;
-    RequestMessage.Deserialize(*ReaderPtr);
+    if (!RequestMessage.Deserialize(Message.GetData()))
+    {
+        return;
+    }
 
     UE_LOG(LogMultiServerSync, Verbose, TEXT("Received ping request from %s (Seq: %u, Timestamp: %llu, Received: %llu)"),
         *SourceEndpoint.ToString(), RequestMessage.SequenceNumber, RequestMessage.Timestamp, ReceiveTime);
 
     // 응답 전송
-    SendPingResponse(RequestMessage, SourceEndpoint);
+    SendPingResponse(RequestMessage, SourceEndpoint, ReceiveTime);
 }
 
 // 약 4270줄 근처, HandlePingResponse 메서드 수정
-void FNetworkManager::HandlePingResponse(const TSharedPtr<FMemoryReader>& ReaderPtr, const FIPv4Endpoint& SourceEndpoint)
+void FNetworkManager::HandlePingResponse(const FNetworkMessageView& Message, const FIPv4Endpoint& SourceEndpoint)
 {
-    // 응답 메시지 파싱
+    // 응답 메시지 파싱 (수신 버퍼에서 직접, 보류 시간이 없는 이전 버전 응답도 받음)
     FPingMessage ResponseMessage;
-    ResponseMessage.Deserialize(*ReaderPtr);
+    if (!ResponseMessage.Deserialize(Message.GetData()))
+    {
+        return;
+    }
 
     // 요청 시간 찾기
     uint32 SequenceNumber = ResponseMessage.SequenceNumber;
     if (PendingPingRequests.Contains(SequenceNumber))
     {
-        // 요청 정보 얻기
+        // 요청 정보 얻기 (응답은 시간 동기화 소켓에서 오므로 통계는 요청한 서버 엔드포인트 기준)
         TPair<FIPv4Endpoint, double> RequestInfo = PendingPingRequests[SequenceNumber];
+        const FIPv4Endpoint& ServerEndpoint = RequestInfo.Key;
         double RequestTime = RequestInfo.Value;
 
-        // 고정밀 타임스탬프로 계산
+        // 고정밀 타임스탬프로 계산 (수신 스레드와 인박스 대기 시간이 RTT에 섞이지 않도록 소켓 도착 시각 사용)
         uint64 RequestTimestamp = ResponseMessage.Timestamp;
-        uint64 CurrentTimestamp = GetHighPrecisionTimestamp();
+        uint64 CurrentTimestamp = GetHighPrecisionTimestamp() - Message.GetReceiveAgeMicroseconds();
 
-        // 고정밀 RTT 계산 (마이크로초)
+        // 고정밀 RTT 계산 (마이크로초, 응답 측이 요청을 붙잡고 있던 시간은 네트워크 지연이 아니므로 뺌)
         uint64 PreciseRTT = CurrentTimestamp - RequestTimestamp;
+        PreciseRTT = PreciseRTT > ResponseMessage.HoldTimeMicroseconds ? PreciseRTT - ResponseMessage.HoldTimeMicroseconds : 0;
 
         // 밀리초 단위로 변환
         double RTT = static_cast<double>(PreciseRTT) / 1000.0;
 
         // 통계 업데이트
-        UpdateRTTStatistics(SourceEndpoint, RTT);
+        UpdateRTTStatistics(ServerEndpoint, RTT);
 
         // 연속 타임아웃 리셋
-        ResetConsecutiveTimeouts(SourceEndpoint);
-
-        // 서버 ID 가져오기
-        FString ServerID = SourceEndpoint.ToString();
+        ResetConsecutiveTimeouts(ServerEndpoint);
 
         // 주기적 핑 상태 업데이트
         for (FPeriodicPingState& PingState : PeriodicPingStates)
         {
-            if (PingState.ServerEndpoint == SourceEndpoint && PingState.bIsActive && PingState.bDynamicSampling)
+            if (PingState.ServerEndpoint == ServerEndpoint && PingState.bIsActive && PingState.bDynamicSampling)
             {
                 // 네트워크 품질 계수 업데이트
-                UpdateNetworkQualityFactor(PingState, ServerID);
+                UpdateNetworkQualityFactor(PingState, ServerEndpoint);
 
                 // 새 샘플링 간격 계산
                 float NewInterval = CalculateDynamicSamplingRate(PingState);
@@ -2348,7 +3599,7 @@ void FNetworkManager::HandlePingResponse(const TSharedPtr<FMemoryReader>& Reader
                     PingState.IntervalSeconds = NewInterval;
 
                     UE_LOG(LogMultiServerSync, Verbose, TEXT("Updated sampling interval for %s: %.2f -> %.2f seconds"),
-                        *ServerID, OldInterval, NewInterval);
+                        *ServerEndpoint.ToString(), OldInterval, NewInterval);
                 }
 
                 break;
@@ -2371,18 +3622,20 @@ void FNetworkManager::HandlePingResponse(const TSharedPtr<FMemoryReader>& Reader
 // RTT 통계 업데이트
 void FNetworkManager::UpdateRTTStatistics(const FIPv4Endpoint& ServerEndpoint, double RTT)
 {
-    // 서버 ID 가져오기
-    FString ServerID = ServerEndpoint.ToString();
-
-    // 해당 서버의 통계 가져오기 또는 생성
-    if (!ServerLatencyStats.Contains(ServerID))
+    // 피어 인덱스로 통계 조회 (없으면 생성)
+    const FPeerId PeerId = PeerRegistry.FindOrAdd(ServerEndpoint);
+    if (PeerId == INVALID_PEER_ID)
     {
-        ServerLatencyStats.Add(ServerID, FNetworkLatencyStats());
+        return;
     }
 
     // 통계 업데이트
-    FNetworkLatencyStats& Stats = ServerLatencyStats[ServerID];
-    Stats.AddRTTSample(RTT);
+    PeerRegistry.FindOrAddLatencyStats(PeerId).AddRTTSample(RTT);
+
+    // 혼잡 제어기는 이상치 필터를 거치지 않은 값으로 대기열 지연을 판단 (지연이 튀는 것이 곧 혼잡 신호)
+    const double Now = FPlatformTime::Seconds();
+    PeerRegistry.GetCongestionController(PeerId).OnClockRttSample(CongestionConfig, RTT, Now);
+    ApplyCongestionRate(ServerEndpoint, PeerId, Now);
 }
 
 // 주기적 핑 활성화 함수 구현
@@ -2511,11 +3764,9 @@ bool FNetworkManager::TickLatencyMeasurement(float DeltaTime)
 // 네트워크 지연 통계 가져오기
 FNetworkLatencyStats FNetworkManager::GetLatencyStats(const FIPv4Endpoint& ServerEndpoint) const
 {
-    FString ServerID = ServerEndpoint.ToString();
-
-    if (ServerLatencyStats.Contains(ServerID))
+    if (const FNetworkLatencyStats* Stats = PeerRegistry.FindLatencyStats(ServerEndpoint))
     {
-        return ServerLatencyStats[ServerID];
+        return *Stats;
     }
 
     // 서버 통계가 없으면 기본값 반환
@@ -2525,14 +3776,13 @@ FNetworkLatencyStats FNetworkManager::GetLatencyStats(const FIPv4Endpoint& Serve
 // 네트워크 품질 평가 함수
 int32 FNetworkManager::EvaluateNetworkQuality(const FIPv4Endpoint& ServerEndpoint) const
 {
-    FString ServerID = ServerEndpoint.ToString();
-
-    if (!ServerLatencyStats.Contains(ServerID))
+    const FNetworkLatencyStats* FoundStats = PeerRegistry.FindLatencyStats(ServerEndpoint);
+    if (!FoundStats)
     {
         return 0; // 불량 (데이터 없음)
     }
 
-    const FNetworkLatencyStats& Stats = ServerLatencyStats[ServerID];
+    const FNetworkLatencyStats& Stats = *FoundStats;
 
     // 기본 품질 점수
     int32 QualityScore = 3; // 최고 점수부터 시작
@@ -2614,9 +3864,9 @@ void FNetworkManager::StopLatencyMeasurement(const FIPv4Endpoint& ServerEndpoint
 
     // 지연 통계 정보 출력
     FString ServerID = ServerEndpoint.ToString();
-    if (ServerLatencyStats.Contains(ServerID))
+    if (const FNetworkLatencyStats* FoundStats = PeerRegistry.FindLatencyStats(ServerEndpoint))
     {
-        const FNetworkLatencyStats& Stats = ServerLatencyStats[ServerID];
+        const FNetworkLatencyStats& Stats = *FoundStats;
         UE_LOG(LogMultiServerSync, Log, TEXT("Latency statistics for %s: Min=%.2f ms, Max=%.2f ms, Avg=%.2f ms, Jitter=%.2f ms, Samples=%d, Lost=%d"),
             *ServerID, Stats.MinRTT, Stats.MaxRTT, Stats.AvgRTT, Stats.Jitter, Stats.SampleCount, Stats.LostPackets);
     }
@@ -2671,15 +3921,16 @@ float FNetworkManager::CalculateDynamicSamplingRate(const FPeriodicPingState& Pi
 }
 
 // 네트워크 품질 계수 업데이트
-void FNetworkManager::UpdateNetworkQualityFactor(FPeriodicPingState& PingState, const FString& ServerID)
+void FNetworkManager::UpdateNetworkQualityFactor(FPeriodicPingState& PingState, const FIPv4Endpoint& ServerEndpoint)
 {
     // 서버 통계가 없으면 기본값 유지
-    if (!ServerLatencyStats.Contains(ServerID))
+    const FNetworkLatencyStats* FoundStats = PeerRegistry.FindLatencyStats(ServerEndpoint);
+    if (!FoundStats)
     {
         return;
     }
 
-    const FNetworkLatencyStats& Stats = ServerLatencyStats[ServerID];
+    const FNetworkLatencyStats& Stats = *FoundStats;
 
     // 샘플 수가 너무 적으면 업데이트하지 않음
     if (Stats.SampleCount < 5)
@@ -2711,7 +3962,7 @@ void FNetworkManager::UpdateNetworkQualityFactor(FPeriodicPingState& PingState,
     PingState.NetworkQualityFactor = PingState.NetworkQualityFactor * 0.7f + QualityFactor * 0.3f;
 
     UE_LOG(LogMultiServerSync, Verbose, TEXT("Updated network quality factor for %s: %.2f (RTT: %.2f ms, Jitter: %.2f ms, Loss: %.2f%%)"),
-        *ServerID, PingState.NetworkQualityFactor, Stats.AvgRTT, Stats.Jitter, LossRate * 100.0f);
+        *ServerEndpoint.ToString(), PingState.NetworkQualityFactor, Stats.AvgRTT, Stats.Jitter, LossRate * 100.0f);
 }
 
 // 연속 타임아웃 증가
@@ -2767,9 +4018,9 @@ void FNetworkManager::SetOutlierFiltering(const FIPv4Endpoint& ServerEndpoint, b
 {
     FString ServerID = ServerEndpoint.ToString();
 
-    if (ServerLatencyStats.Contains(ServerID))
+    if (FNetworkLatencyStats* Stats = PeerRegistry.FindLatencyStats(ServerEndpoint))
     {
-        ServerLatencyStats[ServerID].bFilterOutliers = bEnableFiltering;
+        Stats->bFilterOutliers = bEnableFiltering;
 
         UE_LOG(LogMultiServerSync, Display, TEXT("Outlier filtering for %s: %s"),
             *ServerID, bEnableFiltering ? TEXT("Enabled") : TEXT("Disabled"));
@@ -2779,16 +4030,15 @@ void FNetworkManager::SetOutlierFiltering(const FIPv4Endpoint& ServerEndpoint, b
 // 이상치 통계 가져오기
 bool FNetworkManager::GetOutlierStats(const FIPv4Endpoint& ServerEndpoint, int32& OutliersDetected, double& OutlierThreshold) const
 {
-    FString ServerID = ServerEndpoint.ToString();
-
-    if (!ServerLatencyStats.Contains(ServerID))
+    const FNetworkLatencyStats* FoundStats = PeerRegistry.FindLatencyStats(ServerEndpoint);
+    if (!FoundStats)
     {
         OutliersDetected = 0;
         OutlierThreshold = 0.0;
         return false;
     }
 
-    const FNetworkLatencyStats& Stats = ServerLatencyStats[ServerID];
+    const FNetworkLatencyStats& Stats = *FoundStats;
     OutliersDetected = Stats.OutliersDetected;
     OutlierThreshold = Stats.OutlierThreshold;
 
@@ -2800,9 +4050,9 @@ void FNetworkManager::SetTimeSeriesSampleInterval(const FIPv4Endpoint& ServerEnd
 {
     FString ServerID = ServerEndpoint.ToString();
 
-    if (ServerLatencyStats.Contains(ServerID))
+    if (FNetworkLatencyStats* Stats = PeerRegistry.FindLatencyStats(ServerEndpoint))
     {
-        ServerLatencyStats[ServerID].SetTimeSeriesSampleInterval(IntervalSeconds);
+        Stats->SetTimeSeriesSampleInterval(IntervalSeconds);
 
         UE_LOG(LogMultiServerSync, Display, TEXT("Time series sampling interval for %s set to %.2f seconds"),
             *ServerID, IntervalSeconds);
@@ -2812,15 +4062,14 @@ void FNetworkManager::SetTimeSeriesSampleInterval(const FIPv4Endpoint& ServerEnd
 // 시계열 데이터 가져오기
 bool FNetworkManager::GetTimeSeriesData(const FIPv4Endpoint& ServerEndpoint, TArray<FLatencyTimeSeriesSample>& OutTimeSeries) const
 {
-    FString ServerID = ServerEndpoint.ToString();
-
-    if (!ServerLatencyStats.Contains(ServerID))
+    const FNetworkLatencyStats* FoundStats = PeerRegistry.FindLatencyStats(ServerEndpoint);
+    if (!FoundStats)
     {
         OutTimeSeries.Empty();
         return false;
     }
 
-    const FNetworkLatencyStats& Stats = ServerLatencyStats[ServerID];
+    const FNetworkLatencyStats& Stats = *FoundStats;
     OutTimeSeries = Stats.GetTimeSeries();
 
     return OutTimeSeries.Num() > 0;
@@ -2829,15 +4078,14 @@ bool FNetworkManager::GetTimeSeriesData(const FIPv4Endpoint& ServerEndpoint, TAr
 // 추세 분석 결과 가져오기
 bool FNetworkManager::GetNetworkTrendAnalysis(const FIPv4Endpoint& ServerEndpoint, FNetworkTrendAnalysis& OutTrendAnalysis) const
 {
-    FString ServerID = ServerEndpoint.ToString();
-
-    if (!ServerLatencyStats.Contains(ServerID))
+    const FNetworkLatencyStats* FoundStats = PeerRegistry.FindLatencyStats(ServerEndpoint);
+    if (!FoundStats)
     {
         OutTrendAnalysis = FNetworkTrendAnalysis();
         return false;
     }
 
-    const FNetworkLatencyStats& Stats = ServerLatencyStats[ServerID];
+    const FNetworkLatencyStats& Stats = *FoundStats;
     OutTrendAnalysis = Stats.GetTrendAnalysis();
 
     return true;
@@ -2846,10 +4094,9 @@ bool FNetworkManager::GetNetworkTrendAnalysis(const FIPv4Endpoint& ServerEndpoin
 FNetworkQualityAssessment FNetworkManager::EvaluateNetworkQualityDetailed(const FIPv4Endpoint& ServerEndpoint) const
 {
     FNetworkQualityAssessment Result;
-    FString ServerID = ServerEndpoint.ToString();
-
     // 서버 통계가 없으면 기본 품질 평가 반환
-    if (!ServerLatencyStats.Contains(ServerID))
+    const FNetworkLatencyStats* FoundStats = PeerRegistry.FindLatencyStats(ServerEndpoint);
+    if (!FoundStats)
     {
         Result.QualityLevel = 0;
         Result.QualityString = TEXT("Unknown");
@@ -2858,7 +4105,7 @@ FNetworkQualityAssessment FNetworkManager::EvaluateNetworkQualityDetailed(const
         return Result;
     }
 
-    const FNetworkLatencyStats& Stats = ServerLatencyStats[ServerID];
+    const FNetworkLatencyStats& Stats = *FoundStats;
 
     // 샘플 수가 너무 적으면 낮은 신뢰도 표시
     if (Stats.SampleCount < 10)
@@ -2984,9 +4231,9 @@ void FNetworkManager::SetNetworkStateChangeThreshold(const FIPv4Endpoint& Server
 {
     FString ServerID = ServerEndpoint.ToString();
 
-    if (ServerLatencyStats.Contains(ServerID))
+    if (FNetworkLatencyStats* FoundStats = PeerRegistry.FindLatencyStats(ServerEndpoint))
     {
-        FNetworkLatencyStats& Stats = ServerLatencyStats[ServerID];
+        FNetworkLatencyStats& Stats = *FoundStats;
         Stats.StateChangeThreshold = FMath::Max(5.0, Threshold);  // 최소 5점 이상의 변화
 
         UE_LOG(LogMultiServerSync, Display, TEXT("Network state change threshold for %s set to %.2f"),
@@ -3007,9 +4254,9 @@ void FNetworkManager::SetNetworkPerformanceThresholds(const FIPv4Endpoint& Serve
 {
     FString ServerID = ServerEndpoint.ToString();
 
-    if (ServerLatencyStats.Contains(ServerID))
+    if (FNetworkLatencyStats* FoundStats = PeerRegistry.FindLatencyStats(ServerEndpoint))
     {
-        FNetworkLatencyStats& Stats = ServerLatencyStats[ServerID];
+        FNetworkLatencyStats& Stats = *FoundStats;
         Stats.SetPerformanceThresholds(LatencyThreshold, JitterThreshold, PacketLossThreshold);
 
         UE_LOG(LogMultiServerSync, Display, TEXT("Network performance thresholds for %s set to: Latency=%.2f ms, Jitter=%.2f ms, Loss=%.2f%%"),
@@ -3027,9 +4274,9 @@ void FNetworkManager::SetQualityAssessmentInterval(const FIPv4Endpoint& ServerEn
 {
     FString ServerID = ServerEndpoint.ToString();
 
-    if (ServerLatencyStats.Contains(ServerID))
+    if (FNetworkLatencyStats* FoundStats = PeerRegistry.FindLatencyStats(ServerEndpoint))
     {
-        FNetworkLatencyStats& Stats = ServerLatencyStats[ServerID];
+        FNetworkLatencyStats& Stats = *FoundStats;
         Stats.SetQualityAssessmentInterval(IntervalSeconds);
 
         UE_LOG(LogMultiServerSync, Display, TEXT("Quality assessment interval for %s set to %.2f seconds"),
@@ -3047,9 +4294,9 @@ void FNetworkManager::SetNetworkStateMonitoring(const FIPv4Endpoint& ServerEndpo
 {
     FString ServerID = ServerEndpoint.ToString();
 
-    if (ServerLatencyStats.Contains(ServerID))
+    if (FNetworkLatencyStats* FoundStats = PeerRegistry.FindLatencyStats(ServerEndpoint))
     {
-        FNetworkLatencyStats& Stats = ServerLatencyStats[ServerID];
+        FNetworkLatencyStats& Stats = *FoundStats;
         Stats.bMonitorStateChanges = bEnable;
 
         UE_LOG(LogMultiServerSync, Display, TEXT("Network state monitoring for %s %s"),
@@ -3065,15 +4312,15 @@ void FNetworkManager::SetNetworkStateMonitoring(const FIPv4Endpoint& ServerEndpo
 // 네트워크 이벤트 기록 가져오기
 bool FNetworkManager::GetNetworkEventHistory(const FIPv4Endpoint& ServerEndpoint, TArray<ENetworkEventType>& OutEvents) const
 {
-    FString ServerID = ServerEndpoint.ToString();
     OutEvents.Empty();
 
-    if (!ServerLatencyStats.Contains(ServerID))
+    const FNetworkLatencyStats* FoundStats = PeerRegistry.FindLatencyStats(ServerEndpoint);
+    if (!FoundStats)
     {
         return false;
     }
 
-    const FNetworkLatencyStats& Stats = ServerLatencyStats[ServerID];
+    const FNetworkLatencyStats& Stats = *FoundStats;
     OutEvents = Stats.RecentEvents;
 
     return true;
@@ -3147,246 +4394,661 @@ int32 FNetworkManager::CalculatePacketLossScore(double LossRate, double HighPack
     double NormalizedLoss = (LossRate - LowLossThreshold) / (HighPacketLossThreshold - LowLossThreshold);
     double Score = 100.0 * (1.0 - pow(NormalizedLoss, 0.7));
 
-    return FMath::Clamp<int32>(FMath::RoundToInt(Score), 0, 100);
-}
+    return FMath::Clamp<int32>(FMath::RoundToInt(Score), 0, 100);
+}
+
+// 안정성 점수 계산 (0-100)
+int32 FNetworkManager::CalculateStabilityScore(const FNetworkTrendAnalysis& TrendAnalysis) const
+{
+    // 안정성 점수 계산 (추세 분석 기반)
+    // 변동성이 낮고 장기 추세가 좋을수록 높은 점수
+
+    // 변동성 점수 (변동성이 낮을수록 높은 점수)
+    double VolatilityScore = 100.0;
+    if (TrendAnalysis.Volatility > 0.0)
+    {
+        // 변동성이 5ms 이하면 최고 점수, 50ms 이상이면 최저 점수
+        VolatilityScore = FMath::Clamp(100.0 - (TrendAnalysis.Volatility / 50.0) * 100.0, 0.0, 100.0);
+    }
+
+    // 추세 점수 (추세가 좋을수록 높은 점수)
+    double TrendScore = 50.0;  // 기본값: 중립
+
+    // 장기 추세가 개선되고 있으면 점수 증가, 악화되고 있으면 점수 감소
+    if (TrendAnalysis.LongTermTrend < 0.0)  // 개선 중
+    {
+        // 최대 -10ms/s까지 고려 (그 이상은 동일하게 처리)
+        TrendScore = 50.0 + FMath::Min(fabs(TrendAnalysis.LongTermTrend) / 10.0 * 50.0, 50.0);
+    }
+    else if (TrendAnalysis.LongTermTrend > 0.0)  // 악화 중
+    {
+        // 최대 10ms/s까지 고려 (그 이상은 동일하게 처리)
+        TrendScore = 50.0 - FMath::Min(TrendAnalysis.LongTermTrend / 10.0 * 50.0, 50.0);
+    }
+
+    // 종합 안정성 점수 (변동성 70%, 추세 30%)
+    int32 StabilityScore = FMath::RoundToInt(VolatilityScore * 0.7 + TrendScore * 0.3);
+    return FMath::Clamp(StabilityScore, 0, 100);
+}
+
+// 네트워크 상태 변화 감지 및 처리
+void FNetworkManager::ProcessNetworkStateChange(const FIPv4Endpoint& ServerEndpoint, ENetworkEventType EventType, const FNetworkQualityAssessment& Quality)
+{
+    FString ServerID = ServerEndpoint.ToString();
+
+    // 통계 객체에 이벤트 기록 (있는 경우만)
+    if (FNetworkLatencyStats* FoundStats = PeerRegistry.FindLatencyStats(ServerEndpoint))
+    {
+        FNetworkLatencyStats& Stats = *FoundStats;
+
+        // 이벤트 기록에 추가
+        Stats.AddNetworkEvent(EventType, FPlatformTime::Seconds());
+
+        // 현재 품질 정보 업데이트
+        Stats.CurrentQuality = Quality;
+        Stats.CurrentQuality.LatestEvent = EventType;
+        Stats.CurrentQuality.EventTimestamp = FPlatformTime::Seconds();
+
+        // 품질 히스토리에 추가
+        Stats.QualityHistory.Add(Quality);
+
+        // 최대 히스토리 크기 유지
+        while (Stats.QualityHistory.Num() > Stats.MaxQualityHistoryCount)
+        {
+            Stats.QualityHistory.RemoveAt(0);
+        }
+    }
+
+    // 이벤트 핸들러가 등록되어 있으면 호출
+    if (NetworkStateChangeHandler)
+    {
+        NetworkStateChangeHandler(ServerEndpoint, EventType, Quality);
+
+        UE_LOG(LogMultiServerSync, Display, TEXT("Network state change event: %s for server %s, quality: %d/100"),
+            *FNetworkQualityAssessment::EventTypeToString(EventType), *ServerID, Quality.QualityScore);
+    }
+}
+
+// 주기적인 품질 평가 수행
+bool FNetworkManager::CheckQualityAssessments(float DeltaTime)
+{
+    double CurrentTime = FPlatformTime::Seconds();
+
+    // 피어별로 품질 평가 시간 확인
+    for (int32 PeerIndex = 0; PeerIndex < PeerRegistry.GetPeerIdLimit(); ++PeerIndex)
+    {
+        const FPeerId PeerId = static_cast<FPeerId>(PeerIndex);
+        FNetworkLatencyStats* FoundStats = PeerRegistry.FindLatencyStats(PeerId);
+        if (!FoundStats)
+            continue;
+
+        FNetworkLatencyStats& Stats = *FoundStats;
+
+        // 모니터링이 비활성화되었거나 충분한 샘플이 없으면 건너뜀
+        if (!Stats.bMonitorStateChanges || Stats.SampleCount < 10)
+            continue;
+
+        // 평가 간격이 지났는지 확인
+        if (CurrentTime - Stats.LastQualityAssessmentTime >= Stats.QualityAssessmentInterval)
+        {
+            // 기존 품질 평가 저장
+            FNetworkQualityAssessment PreviousQuality = Stats.CurrentQuality;
+
+            // 피어 엔드포인트 (상태 변화 핸들러 호출 중 배열이 바뀌어도 안전하도록 복사)
+            const FIPv4Endpoint ServerEndpoint = PeerRegistry.GetEndpoint(PeerId);
+
+            // 새 품질 평가 수행
+            FNetworkQualityAssessment NewQuality = EvaluateNetworkQualityDetailed(ServerEndpoint);
+
+            // 품질 변화 확인
+            if (Stats.QualityHistory.Num() > 0)
+            {
+                // 이전 평가가 있으면 변화 감지
+                ENetworkEventType StateChangeEvent = Stats.DetectStateChange(NewQuality, PreviousQuality);
+
+                // 감지된 이벤트가 있으면 처리
+                if (StateChangeEvent != ENetworkEventType::None)
+                {
+                    ProcessNetworkStateChange(ServerEndpoint, StateChangeEvent, NewQuality);
+                }
+            }
+            else
+            {
+                // 첫 번째 평가면 그냥 기록
+                Stats.QualityHistory.Add(NewQuality);
+                Stats.CurrentQuality = NewQuality;
+            }
+
+            // 평가 시간 갱신
+            Stats.LastQualityAssessmentTime = CurrentTime;
+        }
+    }
+
+    return true;  // 계속 틱 유지
+}
+
+// ACK가 필요한 메시지 전송
+bool FNetworkManager::SendMessageWithAck(const FIPv4Endpoint& Endpoint, FNetworkMessage Message)
+{
+    if (!bIsInitialized)
+    {
+        return false;
+    }
+
+    // 시퀀스 번호와 ACK 대기 상태는 피어별로 관리하므로 피어 인덱스가 필요함
+    const FPeerId PeerId = PeerRegistry.FindOrAdd(Endpoint);
+    if (PeerId == INVALID_PEER_ID)
+    {
+        UE_LOG(LogMultiServerSync, Warning, TEXT("Peer registry is full, cannot send reliable message to %s"), *Endpoint.ToString());
+        return false;
+    }
+
+    // 윈도우가 가득 찼거나 먼저 보관된 메시지가 있으면 ACK가 올 때까지 순서대로 보관
+    TArray<FNetworkMessage>* Backlog = ReliableBacklog.Find(Endpoint);
+    if ((Backlog && Backlog->Num() > 0) || !CanTransmitReliable(PeerId, Message.GetSerializedSize()))
+    {
+        if (!Backlog)
+        {
+            Backlog = &ReliableBacklog.Add(Endpoint);
+        }
+
+        if (Backlog->Num() >= MAX_RELIABLE_BACKLOG)
+        {
+            UE_LOG(LogMultiServerSync, Warning, TEXT("Reliable backlog to %s is full (%d messages), dropping message"),
+                *Endpoint.ToString(), Backlog->Num());
+            return false;
+        }
+
+        Backlog->Add(MoveTemp(Message));
+        return true;
+    }
+
+    return TransmitReliableMessage(Endpoint, PeerId, Message);
+}
+
+// 신뢰성 메시지를 지금 보낼 수 있는지 확인 (시퀀스 윈도우와 혼잡 윈도우)
+bool FNetworkManager::CanTransmitReliable(FPeerId PeerId, int32 Bytes) const
+{
+    if (!PeerRegistry.CanSendReliable(PeerId))
+    {
+        return false;
+    }
+
+    return !bCongestionControlEnabled || PeerRegistry.GetCongestionController(PeerId).CanSend(CongestionConfig, Bytes);
+}
+
+// 피어별 신뢰성 시퀀스 번호를 매겨 보내고 ACK 추적 시작
+bool FNetworkManager::TransmitReliableMessage(const FIPv4Endpoint& Endpoint, FPeerId PeerId, FNetworkMessage& Message)
+{
+    // 현재 시간
+    double CurrentTime = FPlatformTime::Seconds();
+
+    // 보내는 순간에 번호를 매겨 보관 중에 버려진 메시지가 받는 쪽에 빈 번호로 남지 않도록 함
+    const uint32 SequenceNumber = PeerRegistry.AllocateReliableSequence(PeerId);
+    Message.SetSequenceNumber(FSequenceNumber::Truncate(SequenceNumber));
+    Message.SetFlags(Message.GetFlags() | FNetworkMessage::FLAG_ACK_REQUIRED);
+
+    // 메시지 전송 (실패해도 번호는 쓴 것으로 보고 추적하여 재전송 타임아웃에 다시 보냄)
+    const bool bSuccess = SendMessageToEndpoint(Endpoint, Message);
+
+    // 메시지 추적 정보 생성 (재전송할 수 있도록 메시지 내용도 보관)
+    FMessageAckData AckData(SequenceNumber, Endpoint);
+    AckData.Status = bSuccess ? EMessageAckStatus::Sent : EMessageAckStatus::Failed;
+    AckData.SentTime = CurrentTime;
+    AckData.LastAttemptTime = CurrentTime;
+    AckData.AttemptCount = 1;
+    AckData.RetryDeadline = CurrentTime + GetRetransmissionTimeout(Endpoint, AckData.AttemptCount);
+    NextRetryDeadline = FMath::Min(NextRetryDeadline, AckData.RetryDeadline);
+    AckData.MessageType = static_cast<uint8>(Message.GetType());
+    AckData.MessageFlags = Message.GetFlags();
+    AckData.Payload = Message.GetData();
+    AckData.MessageSize = Message.GetSerializedSize();
+
+    // 추적 목록에 추가
+    PendingAcknowledgements.Add(FPeerRegistry::MakeSequenceKey(PeerId, SequenceNumber), MoveTemp(AckData));
+
+    // 피어별 ACK 대기 시퀀스 목록과 혼잡 윈도우 업데이트
+    PeerRegistry.GetPendingAckSequences(PeerId).Add(SequenceNumber);
+    PeerRegistry.GetCongestionController(PeerId).OnSend(Message.GetSerializedSize());
+
+    UE_LOG(LogMultiServerSync, Verbose, TEXT("Sent message with ACK to %s (Seq: %u)"),
+        *Endpoint.ToString(), SequenceNumber);
+
+    return true;
+}
+
+// 윈도우에 자리가 난 만큼 보관 중인 신뢰성 메시지를 보냄
+void FNetworkManager::ReleaseReliableBacklog(const FIPv4Endpoint& Endpoint)
+{
+    TArray<FNetworkMessage>* Backlog = ReliableBacklog.Find(Endpoint);
+    if (!Backlog)
+    {
+        return;
+    }
+
+    const FPeerId PeerId = PeerRegistry.Find(Endpoint);
+    if (PeerId == INVALID_PEER_ID)
+    {
+        ReliableBacklog.Remove(Endpoint);
+        return;
+    }
+
+    int32 ReleasedCount = 0;
+    while (ReleasedCount < Backlog->Num())
+    {
+        FNetworkMessage& Next = (*Backlog)[ReleasedCount];
+        if (!CanTransmitReliable(PeerId, Next.GetSerializedSize()))
+        {
+            break;
+        }
+
+        // 전송 실패는 SendMessageToEndpoint에서 기록하고 다음 메시지로 넘어감
+        TransmitReliableMessage(Endpoint, PeerId, Next);
+        ++ReleasedCount;
+    }
+
+    if (ReleasedCount == Backlog->Num())
+    {
+        ReliableBacklog.Remove(Endpoint);
+    }
+    else if (ReleasedCount > 0)
+    {
+        Backlog->RemoveAt(0, ReleasedCount, EAllowShrinking::No);
+    }
+}
+
+// 혼잡 제어기의 송신 속도를 대량 전송 클래스 페이싱에 반영
+void FNetworkManager::ApplyCongestionRate(const FIPv4Endpoint& Endpoint, FPeerId PeerId, double Now)
+{
+    if (bCongestionControlEnabled && PeerId != INVALID_PEER_ID)
+    {
+        const int64 Rate = static_cast<int64>(PeerRegistry.GetCongestionController(PeerId).GetRate(CongestionConfig));
+        TrafficScheduler.SetPeerRateLimit(Endpoint.Address, ETrafficClass::Bulk, Rate, Now);
+    }
+}
+
+void FNetworkManager::SetCongestionControlEnabled(bool bEnable)
+{
+    if (bCongestionControlEnabled == bEnable)
+    {
+        return;
+    }
+
+    bCongestionControlEnabled = bEnable;
+
+    if (!bEnable)
+    {
+        // 보관 중인 메시지를 모두 보내고 피어별 속도 제한 해제
+        TArray<FIPv4Endpoint> BacklogEndpoints;
+        ReliableBacklog.GetKeys(BacklogEndpoints);
+        for (const FIPv4Endpoint& Endpoint : BacklogEndpoints)
+        {
+            ReleaseReliableBacklog(Endpoint);
+        }
+
+        const double Now = FPlatformTime::Seconds();
+        for (int32 PeerIndex = 0; PeerIndex < PeerRegistry.GetPeerIdLimit(); ++PeerIndex)
+        {
+            const FPeerId PeerId = static_cast<FPeerId>(PeerIndex);
+            if (PeerRegistry.IsValid(PeerId))
+            {
+                TrafficScheduler.SetPeerRateLimit(PeerRegistry.GetEndpoint(PeerId).Address, ETrafficClass::Bulk, 0, Now);
+            }
+        }
+    }
+
+    UE_LOG(LogMultiServerSync, Display, TEXT("Congestion control %s (target delay %.2f ms)"),
+        bEnable ? TEXT("enabled") : TEXT("disabled"), CongestionConfig.TargetDelayMs);
+}
+
+const FCongestionController* FNetworkManager::FindCongestionController(const FIPv4Endpoint& Endpoint) const
+{
+    const FPeerId PeerId = PeerRegistry.Find(Endpoint);
+    return PeerRegistry.IsValid(PeerId) ? &PeerRegistry.GetCongestionController(PeerId) : nullptr;
+}
+
+// ACK 메시지 처리
+void FNetworkManager::HandleMessageAck(const FNetworkMessageView& Message, const FIPv4Endpoint& Sender)
+{
+    // 선택적 ACK 블록 추출 (이전 형식의 단일 시퀀스 ACK도 블록 하나로 읽음)
+    FSelectiveAck Ack;
+    if (!Ack.Deserialize(Message.GetData(), (Message.GetFlags() & FNetworkMessage::FLAG_CUMULATIVE_ACK) != 0))
+    {
+        UE_LOG(LogMultiServerSync, Warning, TEXT("Received invalid ACK message (%d bytes) from %s"),
+            Message.GetData().Num(), *Sender.ToString());
+        return;
+    }
+
+    ++AckStats.AckMessagesReceived;
+    ProcessSelectiveAck(Ack, Sender);
+}
+
+// 선택적 ACK가 확인한 메시지를 한 번에 정리 (이미 처리했거나 알 수 없는 시퀀스는 건너뜀)
+void FNetworkManager::ProcessSelectiveAck(const FSelectiveAck& Ack, const FIPv4Endpoint& Sender)
+{
+    // ACK는 보낸 피어의 신뢰성 공간 번호이므로 그 피어로 보낸 메시지만 확인
+    const FPeerId PeerId = PeerRegistry.Find(Sender);
+    if (PeerId == INVALID_PEER_ID || PeerRegistry.GetPendingAckSequences(PeerId).Num() == 0)
+    {
+        return;
+    }
+
+    // 16비트 번호를 마지막으로 보낸 번호 이하의 32비트 번호로 복원
+    // (ACK 대기 번호는 시퀀스 윈도우 안에 있으므로 하위 16비트가 같은 대기 메시지는 하나뿐)
+    const double Now = FPlatformTime::Seconds();
+    const uint32 LastSent = PeerRegistry.GetLastReliableSequence(PeerId);
+    FCongestionController& Controller = PeerRegistry.GetCongestionController(PeerId);
+    int32 AckedCount = 0;
+    auto Acknowledge = [this, PeerId, &Controller, &AckedCount, Now](uint32 Sequence, bool bRttSample)
+        {
+            const uint64 Key = FPeerRegistry::MakeSequenceKey(PeerId, Sequence);
+            FMessageAckData* AckData = PendingAcknowledgements.Find(Key);
+            if (!AckData)
+            {
+                return false;
+            }
+
+            UE_LOG(LogMultiServerSync, Verbose, TEXT("Message acknowledged (Seq: %u, Endpoint: %s)"),
+                AckData->SequenceNumber, *AckData->TargetEndpoint.ToString());
+
+            // 혼잡 윈도우에서 빼고 ACK RTT 반영 (재전송한 메시지는 어느 전송의 ACK인지 모르므로 RTT 샘플로 쓰지 않음)
+            const double AckRtt = bRttSample && AckData->AttemptCount == 1 ? Now - AckData->SentTime : -1.0;
+            Controller.OnAck(CongestionConfig, AckData->MessageSize, AckRtt, Now);
 
-// 안정성 점수 계산 (0-100)
-int32 FNetworkManager::CalculateStabilityScore(const FNetworkTrendAnalysis& TrendAnalysis) const
-{
-    // 안정성 점수 계산 (추세 분석 기반)
-    // 변동성이 낮고 장기 추세가 좋을수록 높은 점수
+            PendingAcknowledgements.Remove(Key);
+            ++AckStats.MessagesAcknowledged;
+            ++AckedCount;
+            return true;
+        };
 
-    // 변동성 점수 (변동성이 낮을수록 높은 점수)
-    double VolatilityScore = 100.0;
-    if (TrendAnalysis.Volatility > 0.0)
+    // 누적 ACK 지점까지의 대기 메시지 확인 (대기 목록은 보낸 순서이므로 앞부분만 봄)
+    // 지점 앞의 번호는 언제 받았는지 알 수 없으므로 (앞서 보낸 ACK가 유실되었을 수 있음) RTT 샘플은 지점 블록에서만 얻음
+    if (Ack.bHasCumulativeAck)
     {
-        // 변동성이 5ms 이하면 최고 점수, 50ms 이상이면 최저 점수
-        VolatilityScore = FMath::Clamp(100.0 - (TrendAnalysis.Volatility / 50.0) * 100.0, 0.0, 100.0);
+        const uint32 CumulativeSequence = FSequenceNumber::ExtendBefore(Ack.CumulativeSequence, LastSent);
+        for (const uint32 Sequence : PeerRegistry.GetPendingAckSequences(PeerId))
+        {
+            if (FSequenceNumber::IsAfter(Sequence, CumulativeSequence))
+            {
+                break;
+            }
+
+            if (Sequence != CumulativeSequence && Acknowledge(Sequence, false))
+            {
+                ++AckStats.CumulativelyAcknowledged;
+            }
+        }
     }
 
-    // 추세 점수 (추세가 좋을수록 높은 점수)
-    double TrendScore = 50.0;  // 기본값: 중립
+    Ack.ForEachSequence([&Acknowledge, LastSent](uint16 AckedSequence)
+        {
+            Acknowledge(FSequenceNumber::ExtendBefore(AckedSequence, LastSent), true);
+        });
 
-    // 장기 추세가 개선되고 있으면 점수 증가, 악화되고 있으면 점수 감소
-    if (TrendAnalysis.LongTermTrend < 0.0)  // 개선 중
-    {
-        // 최대 -10ms/s까지 고려 (그 이상은 동일하게 처리)
-        TrendScore = 50.0 + FMath::Min(fabs(TrendAnalysis.LongTermTrend) / 10.0 * 50.0, 50.0);
-    }
-    else if (TrendAnalysis.LongTermTrend > 0.0)  // 악화 중
+    if (AckedCount == 0)
     {
-        // 최대 10ms/s까지 고려 (그 이상은 동일하게 처리)
-        TrendScore = 50.0 - FMath::Min(TrendAnalysis.LongTermTrend / 10.0 * 50.0, 50.0);
+        return;
     }
 
-    // 종합 안정성 점수 (변동성 70%, 추세 30%)
-    int32 StabilityScore = FMath::RoundToInt(VolatilityScore * 0.7 + TrendScore * 0.3);
-    return FMath::Clamp(StabilityScore, 0, 100);
+    // 피어별 ACK 대기 목록에서 확인된 시퀀스를 보낸 순서를 유지하며 한 번의 순회로 제거
+    PeerRegistry.GetPendingAckSequences(PeerId).RemoveAll([&Ack](uint32 Sequence)
+        {
+            return Ack.Contains(FSequenceNumber::Truncate(Sequence));
+        });
+    ApplyCongestionRate(Sender, PeerId, Now);
+
+    // 윈도우에 자리가 났으면 보관 중인 메시지를 보냄
+    ReleaseReliableBacklog(Sender);
 }
 
-// 네트워크 상태 변화 감지 및 처리
-void FNetworkManager::ProcessNetworkStateChange(const FIPv4Endpoint& ServerEndpoint, ENetworkEventType EventType, const FNetworkQualityAssessment& Quality)
+// 받은 신뢰성 메시지의 ACK 예약 (선택적 ACK를 끄면 바로 보냄)
+void FNetworkManager::QueueAck(const FIPv4Endpoint& Sender, uint16 SequenceNumber)
 {
-    FString ServerID = ServerEndpoint.ToString();
-
-    // 통계 객체에 이벤트 기록 (있는 경우만)
-    if (ServerLatencyStats.Contains(ServerID))
+    const FPeerId PeerId = PeerRegistry.FindOrAdd(Sender);
+    if (bSelectiveAckEnabled && PeerId != INVALID_PEER_ID)
     {
-        FNetworkLatencyStats& Stats = ServerLatencyStats[ServerID];
-
-        // 이벤트 기록에 추가
-        Stats.AddNetworkEvent(EventType, FPlatformTime::Seconds());
-
-        // 현재 품질 정보 업데이트
-        Stats.CurrentQuality = Quality;
-        Stats.CurrentQuality.LatestEvent = EventType;
-        Stats.CurrentQuality.EventTimestamp = FPlatformTime::Seconds();
-
-        // 품질 히스토리에 추가
-        Stats.QualityHistory.Add(Quality);
-
-        // 최대 히스토리 크기 유지
-        while (Stats.QualityHistory.Num() > Stats.MaxQualityHistoryCount)
+        TArray<uint16>& UnsentAcks = PeerRegistry.GetUnsentAcks(PeerId);
+        if (UnsentAcks.Num() == 0)
         {
-            Stats.QualityHistory.RemoveAt(0);
+            PeersWithUnsentAcks.Emplace(PeerId, FPlatformTime::Seconds());
         }
+        UnsentAcks.Add(SequenceNumber);
+        return;
     }
 
-    // 이벤트 핸들러가 등록되어 있으면 호출
-    if (NetworkStateChangeHandler)
-    {
-        NetworkStateChangeHandler(ServerEndpoint, EventType, Quality);
+    // 이전 형식: 시퀀스 번호 하나만 담은 ACK
+    TArray<uint8> AckData;
+    AckData.SetNum(sizeof(uint16));
+    FMemory::Memcpy(AckData.GetData(), &SequenceNumber, sizeof(uint16));
 
-        UE_LOG(LogMultiServerSync, Display, TEXT("Network state change event: %s for server %s, quality: %d/100"),
-            *FNetworkQualityAssessment::EventTypeToString(EventType), *ServerID, Quality.QualityScore);
+    FNetworkMessage AckMessage(ENetworkMessageType::MessageAck, AckData);
+    AckMessage.SetProjectId(ProjectId);
+    AckMessage.SetSequenceNumber(GetNextSequenceNumber());
+
+    // ACK 메시지 전송
+    if (SendMessageToEndpoint(Sender, AckMessage))
+    {
+        ++AckStats.AckMessagesSent;
+        ++AckStats.AckedSequencesSent;
     }
+
+    UE_LOG(LogMultiServerSync, Verbose, TEXT("Sent ACK for message (Seq: %u, to: %s)"),
+        SequenceNumber, *Sender.ToString());
 }
 
-// 주기적인 품질 평가 수행
-bool FNetworkManager::CheckQualityAssessments(float DeltaTime)
+// 예약한 지 Delay가 지난 ACK를 발신자별 선택적 ACK로 묶어 전송
+void FNetworkManager::FlushPendingAcks(double Now, double Delay)
 {
-    double CurrentTime = FPlatformTime::Seconds();
+    if (PeersWithUnsentAcks.Num() == 0)
+    {
+        return;
+    }
 
-    // 서버별로 품질 평가 시간 확인
-    for (auto& Pair : ServerLatencyStats)
+    FSelectiveAck Ack;
+    int32 KeptCount = 0;
+    for (int32 Index = 0; Index < PeersWithUnsentAcks.Num(); ++Index)
     {
-        FString ServerID = Pair.Key;
-        FNetworkLatencyStats& Stats = Pair.Value;
+        const FPeerId PeerId = PeersWithUnsentAcks[Index].Key;
 
-        // 모니터링이 비활성화되었거나 충분한 샘플이 없으면 건너뜀
-        if (!Stats.bMonitorStateChanges || Stats.SampleCount < 10)
+        // 예약 후 제거된 피어나 다른 메시지에 모두 실려 나간 피어는 UnsentAcks가 비어 있음
+        if (!PeerRegistry.IsValid(PeerId) || PeerRegistry.GetUnsentAcks(PeerId).Num() == 0)
+        {
             continue;
+        }
 
-        // 평가 간격이 지났는지 확인
-        if (CurrentTime - Stats.LastQualityAssessmentTime >= Stats.QualityAssessmentInterval)
+        // 아직 지연 시간 안이면 다음 틱까지 실어 보낼 메시지를 기다림 (ACK를 실을 수 없는 피어는 기다리지 않음)
+        const FIPv4Endpoint& Endpoint = PeerRegistry.GetEndpoint(PeerId);
+        if (Now - PeersWithUnsentAcks[Index].Value < Delay && IsPiggybackAckPeer(Endpoint))
         {
-            // 기존 품질 평가 저장
-            FNetworkQualityAssessment PreviousQuality = Stats.CurrentQuality;
+            PeersWithUnsentAcks[KeptCount++] = PeersWithUnsentAcks[Index];
+            continue;
+        }
 
-            // 새로운 품질 평가 수행
-            FIPv4Endpoint ServerEndpoint;
+        TArray<uint16>& UnsentAcks = PeerRegistry.GetUnsentAcks(PeerId);
+        Ack.Build(UnsentAcks);
+        const int32 SequenceCount = Ack.GetSequenceCount();
+        AddCumulativeAck(PeerId, Ack);
 
-            // 서버 ID에서 엔드포인트 정보 추출
-            TArray<FString> Parts;
-            ServerID.ParseIntoArray(Parts, TEXT(":"), true);
-            if (Parts.Num() >= 2)
+        for (int32 FirstBlock = 0; FirstBlock < Ack.Blocks.Num(); FirstBlock += FSelectiveAck::MAX_BLOCKS_PER_MESSAGE)
+        {
+            FNetworkMessage AckMessage(ENetworkMessageType::MessageAck, Ack.Serialize(FirstBlock, FSelectiveAck::MAX_BLOCKS_PER_MESSAGE));
+            AckMessage.SetProjectId(ProjectId);
+            AckMessage.SetSequenceNumber(GetNextSequenceNumber());
+            if (FirstBlock == 0 && Ack.bHasCumulativeAck)
             {
-                FIPv4Address IPAddress;
-                if (FIPv4Address::Parse(Parts[0], IPAddress))
-                {
-                    uint16 PortNumber = FCString::Atoi(*Parts[1]);
-                    ServerEndpoint = FIPv4Endpoint(IPAddress, Port);
-
-                    // 새 품질 평가 수행
-                    FNetworkQualityAssessment NewQuality = EvaluateNetworkQualityDetailed(ServerEndpoint);
-
-                    // 품질 변화 확인
-                    if (Stats.QualityHistory.Num() > 0)
-                    {
-                        // 이전 평가가 있으면 변화 감지
-                        ENetworkEventType StateChangeEvent = Stats.DetectStateChange(NewQuality, PreviousQuality);
-
-                        // 감지된 이벤트가 있으면 처리
-                        if (StateChangeEvent != ENetworkEventType::None)
-                        {
-                            ProcessNetworkStateChange(ServerEndpoint, StateChangeEvent, NewQuality);
-                        }
-                    }
-                    else
-                    {
-                        // 첫 번째 평가면 그냥 기록
-                        Stats.QualityHistory.Add(NewQuality);
-                        Stats.CurrentQuality = NewQuality;
-                    }
+                AckMessage.SetFlags(FNetworkMessage::FLAG_CUMULATIVE_ACK);
+            }
 
-                    // 평가 시간 갱신
-                    Stats.LastQualityAssessmentTime = CurrentTime;
-                }
+            if (SendMessageToEndpoint(Endpoint, AckMessage))
+            {
+                ++AckStats.AckMessagesSent;
             }
         }
+
+        AckStats.AckedSequencesSent += SequenceCount;
+
+        UE_LOG(LogMultiServerSync, Verbose, TEXT("Sent selective ACK for %d messages in %d blocks to %s"),
+            SequenceCount, Ack.Blocks.Num(), *Endpoint.ToString());
+
+        UnsentAcks.Reset();
     }
 
-    return true;  // 계속 틱 유지
+    PeersWithUnsentAcks.SetNum(KeptCount, EAllowShrinking::No);
 }
 
-// ACK가 필요한 메시지 전송
-bool FNetworkManager::SendMessageWithAck(const FIPv4Endpoint& Endpoint, const FNetworkMessage& Message)
+// 피어의 신뢰성 공간에서 순서대로 처리한 마지막 번호를 누적 ACK 지점으로 추가
+// (앞서 보낸 ACK가 유실되어도 다음 ACK가 그 앞을 모두 확인하므로 보낸 쪽이 불필요하게 재전송하지 않음)
+void FNetworkManager::AddCumulativeAck(FPeerId PeerId, FSelectiveAck& Ack) const
 {
-    if (!bIsInitialized)
+    const FMessageSequenceTracker* Tracker = PeerRegistry.FindSequenceTracker(PeerId, ESequenceChannel::Reliable);
+    if (Tracker && Tracker->bSynchronized)
     {
-        return false;
+        Ack.SetCumulativeAck(FSequenceNumber::Truncate(Tracker->LastProcessedSequence));
     }
+}
 
-    // 현재 시간
-    double CurrentTime = FPlatformTime::Seconds();
+// 같은 피어에게 밀린 ACK를 메시지 끝에 덧붙인 사본 생성 (실을 ACK가 없거나 실을 수 없는 메시지면 false)
+bool FNetworkManager::IsPiggybackAckPeer(const FIPv4Endpoint& Endpoint) const
+{
+    // FLAG_HAS_ACK를 모르는 v1 노드는 ACK 블록을 페이로드로 잘못 읽으므로 합의한 버전으로 판단
+    return bPiggybackAcksEnabled &&
+        PeerRegistry.GetProtocolVersion(Endpoint.Address) >= FNetworkMessage::PIGGYBACK_ACK_VERSION;
+}
 
-    // 메시지 전송
-    bool bSuccess = SendMessageToEndpoint(Endpoint, Message);
-    if (!bSuccess)
+bool FNetworkManager::AttachPiggybackAck(const FIPv4Endpoint& Endpoint, const FNetworkMessage& Message, FNetworkMessage& OutMessage)
+{
+    // ACK 전용 메시지와 탐색 메시지(아직 모르는 노드에게도 감)에는 싣지 않음
+    // 받는 쪽은 ACK를 보낸 엔드포인트의 피어 공간에서 시퀀스를 찾으므로 데이터 소켓으로 나가는 메시지에만 실음
+    if (!bSelectiveAckEnabled || PeersWithUnsentAcks.Num() == 0 ||
+        Message.GetType() == ENetworkMessageType::MessageAck || RequiresFullHeader(Message.GetType()) ||
+        GetChannelForMessageType(Message.GetType()) != ENetworkChannel::Data || !IsPiggybackAckPeer(Endpoint))
     {
         return false;
     }
 
-    // 시퀀스 번호 가져오기
-    uint16 SequenceNumber = Message.GetSequenceNumber();
+    const FPeerId PeerId = PeerRegistry.Find(Endpoint);
+    if (PeerId == INVALID_PEER_ID || PeerRegistry.GetUnsentAcks(PeerId).Num() == 0)
+    {
+        return false;
+    }
 
-    // 메시지 추적 정보 생성
-    FMessageAckData AckData(SequenceNumber, Endpoint);
-    AckData.Status = EMessageAckStatus::Sent;
-    AckData.SentTime = CurrentTime;
-    AckData.LastAttemptTime = CurrentTime;
-    AckData.AttemptCount = 1;
+    // 데이터그램 하나에 들어가는 만큼만 실음 (나머지는 다음 메시지나 ACK 전용 메시지로)
+    FSelectiveAck Ack;
+    TArray<uint16>& UnsentAcks = PeerRegistry.GetUnsentAcks(PeerId);
+    Ack.Build(UnsentAcks);
+    AddCumulativeAck(PeerId, Ack);
 
-    // 추적 목록에 추가
-    PendingAcknowledgements.Add(SequenceNumber, AckData);
+    int32 BlockCount = FMath::Min(Ack.Blocks.Num(), static_cast<int32>(FSelectiveAck::MAX_PIGGYBACK_BLOCKS));
+    while (BlockCount > 0 && Message.GetSerializedSize() + FSelectiveAck::GetTrailerSize(BlockCount) > GetMaxDatagramSize())
+    {
+        --BlockCount;
+    }
 
-    // 엔드포인트별 시퀀스 매핑 업데이트
-    FString EndpointStr = Endpoint.ToString();
-    if (!EndpointSequenceMap.Contains(EndpointStr))
+    if (BlockCount == 0)
     {
-        EndpointSequenceMap.Add(EndpointStr, TArray<uint16>());
+        return false;
     }
-    EndpointSequenceMap[EndpointStr].Add(SequenceNumber);
 
-    UE_LOG(LogMultiServerSync, Verbose, TEXT("Sent message with ACK to %s (Seq: %u)"),
-        *EndpointStr, SequenceNumber);
+    TArray<uint8> Payload;
+    Payload.Reserve(Message.GetData().Num() + FSelectiveAck::GetTrailerSize(BlockCount));
+    Payload.Append(Message.GetData());
+    Ack.AppendTrailer(Payload, 0, BlockCount);
+
+    OutMessage = FNetworkMessage(Message.GetType(), Payload);
+    OutMessage.SetProjectId(Message.GetProjectId());
+    OutMessage.SetSequenceNumber(Message.GetSequenceNumber());
+    OutMessage.SetFlags(Message.GetFlags() | FNetworkMessage::FLAG_HAS_ACK |
+        (Ack.bHasCumulativeAck ? FNetworkMessage::FLAG_CUMULATIVE_ACK : 0));
+
+    // 실어 보낸 시퀀스를 예약 목록에서 제거 (누적 ACK 지점 이하의 번호 포함)
+    const int32 UnsentCount = UnsentAcks.Num();
+    if (BlockCount == Ack.Blocks.Num())
+    {
+        UnsentAcks.Reset();
+    }
+    else
+    {
+        Ack.Blocks.SetNum(BlockCount);
+        UnsentAcks.RemoveAllSwap([&Ack](uint16 Sequence) { return Ack.Contains(Sequence); }, EAllowShrinking::No);
+    }
 
+    AckStats.AckedSequencesSent += UnsentCount - UnsentAcks.Num();
+
+    ++AckStats.PiggybackedAcksSent;
     return true;
 }
 
-// ACK 메시지 처리
-// HandleMessageAck 함수 수정 - 약 4270줄 근처
-void FNetworkManager::HandleMessageAck(const FNetworkMessage& Message, const FIPv4Endpoint& Sender)
+void FNetworkManager::SetSelectiveAckEnabled(bool bEnable)
 {
-    // ACK 메시지에서 원본 시퀀스 번호 추출
-    if (Message.GetData().Num() < sizeof(uint16))
+    // 끄기 전에 모아둔 ACK를 보냄
+    if (!bEnable)
     {
-        UE_LOG(LogMultiServerSync, Warning, TEXT("Received invalid ACK message (too small)"));
-        return;
+        FlushPendingAcks(FPlatformTime::Seconds(), 0.0);
     }
 
-    uint16 AckedSequence = 0;
-    FMemory::Memcpy(&AckedSequence, Message.GetData().GetData(), sizeof(uint16));
+    bSelectiveAckEnabled = bEnable;
+}
 
-    // 추적 중인 메시지인지 확인
-    if (!PendingAcknowledgements.Contains(AckedSequence))
-    {
-        // 이미 처리되었거나 알 수 없는 메시지일 수 있음
-        UE_LOG(LogMultiServerSync, Verbose, TEXT("Received ACK for unknown sequence: %u"), AckedSequence);
-        return;
-    }
+void FNetworkManager::SetPiggybackAcksEnabled(bool bEnable)
+{
+    bPiggybackAcksEnabled = bEnable;
+    UE_LOG(LogMultiServerSync, Display, TEXT("Piggybacked ACKs %s (ACK delay %.1f ms)"),
+        bEnable ? TEXT("enabled") : TEXT("disabled"), AckDelaySeconds * 1000.0);
+}
+
+// 재전송 타임아웃 범위 설정
+void FNetworkManager::SetRetransmissionTimeoutBounds(double MinSeconds, double MaxSeconds)
+{
+    MinRetransmissionTimeout = FMath::Max(MinSeconds, static_cast<double>(MESSAGE_RETRY_INTERVAL));
+    MaxRetransmissionTimeout = FMath::Max(MaxSeconds, MinRetransmissionTimeout);
+
+    UE_LOG(LogMultiServerSync, Display, TEXT("Retransmission timeout bounds set to %.0f-%.0f ms"),
+        MinRetransmissionTimeout * 1000.0, MaxRetransmissionTimeout * 1000.0);
+}
 
-    // 메시지 상태 업데이트
-    FMessageAckData& AckData = PendingAcknowledgements[AckedSequence];
+// 피어별 재전송 타임아웃 (RFC 6298)
+double FNetworkManager::GetRetransmissionTimeout(const FIPv4Endpoint& Endpoint, int32 AttemptCount) const
+{
+    double Timeout = MESSAGE_TIMEOUT_SECONDS;
 
-    // 수신자가 예상 수신자와 다른 경우 확인
-    if (AckData.TargetEndpoint != Sender)
+    // 핑 RTT에는 받는 쪽이 ACK를 모아 보내는 지연이 들어 있지 않으므로 더함 (클러스터가 같은 설정을 쓴다고 가정)
+    const FNetworkLatencyStats* Stats = PeerRegistry.FindLatencyStats(Endpoint);
+    const double RttTimeoutMs = Stats ? Stats->GetRetransmissionTimeout(MESSAGE_RETRY_INTERVAL * 1000.0) : -1.0;
+    if (RttTimeoutMs >= 0.0)
     {
-        UE_LOG(LogMultiServerSync, Warning, TEXT("Received ACK from unexpected sender: %s (expected: %s)"),
-            *Sender.ToString(), *AckData.TargetEndpoint.ToString());
-        // 잘못된 ACK일 수 있으나, 혹시 모르니 처리는 함
+        Timeout = RttTimeoutMs / 1000.0 + (bPiggybackAcksEnabled ? AckDelaySeconds : 0.0);
     }
 
-    AckData.Status = EMessageAckStatus::Acknowledged;
+    Timeout = FMath::Clamp(Timeout, MinRetransmissionTimeout, MaxRetransmissionTimeout);
 
-    UE_LOG(LogMultiServerSync, Verbose, TEXT("Message acknowledged (Seq: %u, Endpoint: %s)"),
-        AckedSequence, *AckData.TargetEndpoint.ToString());
+    // 지수 백오프: 재전송할 때마다 두 배 (RFC 6298 5.5절)
+    const int32 BackoffShift = FMath::Clamp(AttemptCount - 1, 0, 16);
+    return FMath::Min(Timeout * static_cast<double>(1 << BackoffShift), MaxRetransmissionTimeout);
+}
 
-    // 확인된 메시지 추적 목록에서 제거
-    FString EndpointStr = AckData.TargetEndpoint.ToString();
-    if (EndpointSequenceMap.Contains(EndpointStr))
+// 피어별 ACK 대기 목록에서 시퀀스 제거 (보낸 순서 유지)
+void FNetworkManager::RemovePendingAckSequence(FPeerId PeerId, uint32 SequenceNumber)
+{
+    if (PeerRegistry.IsValid(PeerId))
     {
-        EndpointSequenceMap[EndpointStr].Remove(AckedSequence);
+        PeerRegistry.GetPendingAckSequences(PeerId).RemoveSingle(SequenceNumber);
+    }
+}
 
-        // 엔드포인트의 모든 메시지가 확인되면 맵에서 제거
-        if (EndpointSequenceMap[EndpointStr].Num() == 0)
-        {
-            EndpointSequenceMap.Remove(EndpointStr);
-        }
+// 제거되는 피어의 ACK 대기 메시지와 보관 메시지를 버림 (피어 인덱스가 재사용되어도 이전 상태와 섞이지 않도록)
+void FNetworkManager::DiscardPendingAcks(FPeerId PeerId)
+{
+    if (!PeerRegistry.IsValid(PeerId))
+    {
+        return;
     }
 
-    // 확인된 메시지 제거
-    PendingAcknowledgements.Remove(AckedSequence);
+    for (uint32 Sequence : PeerRegistry.GetPendingAckSequences(PeerId))
+    {
+        PendingAcknowledgements.Remove(FPeerRegistry::MakeSequenceKey(PeerId, Sequence));
+    }
+    PeerRegistry.GetPendingAckSequences(PeerId).Reset();
+    ReliableBacklog.Remove(PeerRegistry.GetEndpoint(PeerId));
 }
 
 // 메시지 재전송 체크
@@ -3399,14 +5061,23 @@ bool FNetworkManager::CheckMessageRetries(float DeltaTime)
 
     double CurrentTime = FPlatformTime::Seconds();
 
-    // 타임아웃된 메시지 목록
-    TArray<uint16> TimeoutSequences;
-    TArray<uint16> RetrySequences;
+    // 가장 이른 재전송 기한 전이면 목록을 훑지 않음 (틱 간격은 재전송 타임아웃의 시계 단위일 뿐)
+    if (CurrentTime < NextRetryDeadline)
+    {
+        return true;
+    }
+
+    // 타임아웃된 메시지 목록 (FPeerRegistry::MakeSequenceKey 키)
+    TArray<uint64> TimeoutSequences;
+    TArray<uint64> RetrySequences;
+
+    // 남은 메시지의 기한으로 다시 구함 (재전송한 메시지는 RetryMessage가 새 기한을 반영)
+    NextRetryDeadline = MAX_dbl;
 
     // 모든 대기 중인 메시지 검사
     for (auto& Pair : PendingAcknowledgements)
     {
-        uint16 SequenceNumber = Pair.Key;
+        const uint64 PendingKey = Pair.Key;
         FMessageAckData& AckData = Pair.Value;
 
         // 이미 확인된 메시지는 건너뜀
@@ -3415,54 +5086,77 @@ bool FNetworkManager::CheckMessageRetries(float DeltaTime)
             continue;
         }
 
-        double ElapsedTime = CurrentTime - AckData.LastAttemptTime;
-
-        // 타임아웃 확인
-        if (ElapsedTime > MESSAGE_TIMEOUT_SECONDS)
+        // 타임아웃 확인 (보낼 때 피어 RTT로 구한 타임아웃을 보낸 횟수만큼 두 배씩 늘린 기한)
+        if (CurrentTime < AckData.RetryDeadline)
+        {
+            NextRetryDeadline = FMath::Min(NextRetryDeadline, AckData.RetryDeadline);
+        }
+        else
         {
             // 최대 시도 횟수를 초과하면 실패로 처리
             if (AckData.AttemptCount >= MAX_RETRY_ATTEMPTS)
             {
                 // 타임아웃 로그
                 UE_LOG(LogMultiServerSync, Warning, TEXT("Message timed out after %d attempts (Seq: %u, Endpoint: %s)"),
-                    AckData.AttemptCount, SequenceNumber, *AckData.TargetEndpoint.ToString());
+                    AckData.AttemptCount, AckData.SequenceNumber, *AckData.TargetEndpoint.ToString());
 
                 AckData.Status = EMessageAckStatus::Timeout;
-                TimeoutSequences.Add(SequenceNumber);
+                TimeoutSequences.Add(PendingKey);
             }
             else
             {
                 // 재전송 목록에 추가
-                RetrySequences.Add(SequenceNumber);
+                RetrySequences.Add(PendingKey);
             }
         }
     }
 
+    // ACK 시간 초과는 손실 신호로 보고 감속 (같은 피어의 여러 시간 초과는 RTT마다 한 번만 반영됨)
+    TSet<FIPv4Endpoint> LossEndpoints;
+    for (uint64 PendingKey : TimeoutSequences)
+    {
+        LossEndpoints.Add(PendingAcknowledgements[PendingKey].TargetEndpoint);
+    }
+    for (uint64 PendingKey : RetrySequences)
+    {
+        LossEndpoints.Add(PendingAcknowledgements[PendingKey].TargetEndpoint);
+    }
+    for (const FIPv4Endpoint& Endpoint : LossEndpoints)
+    {
+        const FPeerId PeerId = PeerRegistry.Find(Endpoint);
+        if (PeerId != INVALID_PEER_ID)
+        {
+            PeerRegistry.GetCongestionController(PeerId).OnLoss(CongestionConfig, CurrentTime);
+            ApplyCongestionRate(Endpoint, PeerId, CurrentTime);
+        }
+    }
+
     // 타임아웃된 메시지 처리
-    for (uint16 Sequence : TimeoutSequences)
+    for (uint64 PendingKey : TimeoutSequences)
     {
-        // 엔드포인트별 매핑에서 제거
-        FMessageAckData& AckData = PendingAcknowledgements[Sequence];
-        FString EndpointStr = AckData.TargetEndpoint.ToString();
+        // 피어별 ACK 대기 목록과 혼잡 윈도우에서 제거
+        const FPeerId PeerId = FPeerRegistry::GetSequenceKeyPeer(PendingKey);
+        RemovePendingAckSequence(PeerId, FPeerRegistry::GetSequenceKeySequence(PendingKey));
 
-        if (EndpointSequenceMap.Contains(EndpointStr))
+        if (PeerRegistry.IsValid(PeerId))
         {
-            EndpointSequenceMap[EndpointStr].Remove(Sequence);
-
-            if (EndpointSequenceMap[EndpointStr].Num() == 0)
-            {
-                EndpointSequenceMap.Remove(EndpointStr);
-            }
+            PeerRegistry.GetCongestionController(PeerId).OnDiscard(PendingAcknowledgements[PendingKey].MessageSize);
         }
 
         // 추적 목록에서 제거
-        PendingAcknowledgements.Remove(Sequence);
+        PendingAcknowledgements.Remove(PendingKey);
     }
 
     // 재전송 메시지 처리
-    for (uint16 Sequence : RetrySequences)
+    for (uint64 PendingKey : RetrySequences)
+    {
+        RetryMessage(PendingKey);
+    }
+
+    // 포기한 메시지만큼 윈도우에 자리가 났으면 보관 중인 메시지를 보냄
+    for (const FIPv4Endpoint& Endpoint : LossEndpoints)
     {
-        RetryMessage(Sequence);
+        ReleaseReliableBacklog(Endpoint);
     }
 
     // 마지막 체크 시간 업데이트
@@ -3486,17 +5180,16 @@ bool FNetworkManager::SendMessageWithAcknowledgement(const FString& EndpointId,
         return false;
     }
 
-    // 메시지 생성
+    // 메시지 생성 (시퀀스 번호는 보낼 때 대상 피어의 신뢰성 공간에서 할당)
     FNetworkMessage NetworkMessage(ENetworkMessageType::Data, Message);
     NetworkMessage.SetProjectId(ProjectId);
-    NetworkMessage.SetSequenceNumber(GetNextSequenceNumber());
 
     // ACK 필요함을 나타내는 플래그 설정
-    NetworkMessage.SetFlags(1); // Flag = 1: ACK 필요
+    NetworkMessage.SetFlags(FNetworkMessage::FLAG_ACK_REQUIRED);
 
     // 엔드포인트로 전송
     FIPv4Endpoint Endpoint(TargetServer->IPAddress, TargetServer->Port);
-    return SendMessageWithAck(Endpoint, NetworkMessage);
+    return SendMessageWithAck(Endpoint, MoveTemp(NetworkMessage));
 }
 
 // 확인 대기 중인 메시지 개수 반환
@@ -3504,9 +5197,13 @@ TMap<FString, int32> FNetworkManager::GetPendingAcknowledgements() const
 {
     TMap<FString, int32> Result;
 
-    for (const auto& Pair : EndpointSequenceMap)
+    for (int32 PeerIndex = 0; PeerIndex < PeerRegistry.GetPeerIdLimit(); ++PeerIndex)
     {
-        Result.Add(Pair.Key, Pair.Value.Num());
+        const FPeerId PeerId = static_cast<FPeerId>(PeerIndex);
+        if (PeerRegistry.IsValid(PeerId) && PeerRegistry.GetPendingAckSequences(PeerId).Num() > 0)
+        {
+            Result.Add(PeerRegistry.GetEndpoint(PeerId).ToString(), PeerRegistry.GetPendingAckSequences(PeerId).Num());
+        }
     }
 
     return Result;
@@ -3517,10 +5214,17 @@ void FNetworkManager::SetOrderGuaranteed(bool bEnable)
 {
     bOrderGuaranteedEnabled = bEnable;
 
-    // 모든, 시퀀스 추적기에 설정 적용
-    for (auto& Pair : EndpointSequenceTrackers)
+    // 모든 시퀀스 추적기에 설정 적용 (비신뢰성 공간은 순서를 보장하지 않음)
+    for (int32 PeerIndex = 0; PeerIndex < PeerRegistry.GetPeerIdLimit(); ++PeerIndex)
     {
-        Pair.Value.bOrderGuaranteed = bEnable;
+        for (int32 ChannelIndex = 0; ChannelIndex < NUM_SEQUENCE_CHANNELS; ++ChannelIndex)
+        {
+            const ESequenceChannel Channel = static_cast<ESequenceChannel>(ChannelIndex);
+            if (FMessageSequenceTracker* Tracker = PeerRegistry.FindSequenceTracker(static_cast<FPeerId>(PeerIndex), Channel))
+            {
+                Tracker->bOrderGuaranteed = IsOrderGuaranteedChannel(Channel);
+            }
+        }
     }
 
     UE_LOG(LogMultiServerSync, Display, TEXT("Message order guarantee %s"),
@@ -3533,202 +5237,85 @@ bool FNetworkManager::IsOrderGuaranteed() const
     return bOrderGuaranteedEnabled;
 }
 
-// 누락된 시퀀스 목록 가져오기
+// 누락된 시퀀스 목록 가져오기 (비신뢰성 공간, 헤더의 16비트 번호로 보고)
 TMap<FString, TArray<int32>> FNetworkManager::GetMissingSequences() const
 {
     TMap<FString, TArray<int32>> Result;
 
-    for (const auto& Pair : EndpointSequenceTrackers)
+    for (int32 PeerIndex = 0; PeerIndex < PeerRegistry.GetPeerIdLimit(); ++PeerIndex)
     {
-        TArray<uint16> MissingSeqs = Pair.Value.GetMissingSequences();
+        const FPeerId PeerId = static_cast<FPeerId>(PeerIndex);
+        // 비신뢰성 공간의 빈 번호는 다른 피어에게 간 번호일 수 있으므로 신뢰성 공간만 보고
+        const FMessageSequenceTracker* Tracker = PeerRegistry.FindSequenceTracker(PeerId, ESequenceChannel::Reliable);
+        if (!Tracker || !Tracker->NeedsRetransmissionRequest())
+        {
+            continue;
+        }
 
-        if (MissingSeqs.Num() > 0)
+        TArray<int32> MissingInts;
+        for (uint32 Seq : Tracker->GetMissingSequences())
         {
-            TArray<int32> MissingInts;
-            for (uint16 Seq : MissingSeqs)
-            {
-                MissingInts.Add((int32)Seq);
-            }
-            Result.Add(Pair.Key, MissingInts);
+            MissingInts.Add((int32)FSequenceNumber::Truncate(Seq));
         }
+        Result.Add(PeerRegistry.GetEndpoint(PeerId).ToString(), MissingInts);
     }
 
     return Result;
 }
 
 // 수신된 시퀀스 추적
-bool FNetworkManager::TrackReceivedSequence(const FIPv4Endpoint& Sender, uint16 SequenceNumber)
+ESequenceAddResult FNetworkManager::TrackReceivedSequence(const FIPv4Endpoint& Sender, ESequenceChannel Channel, uint16 SequenceNumber)
 {
-    FString EndpointStr = Sender.ToString();
-
-    // 엔드포인트의 시퀀스 추적기가 없으면 생성
-    if (!EndpointSequenceTrackers.Contains(EndpointStr))
-    {
-        FMessageSequenceTracker Tracker;
-        Tracker.bOrderGuaranteed = bOrderGuaranteedEnabled;
-        EndpointSequenceTrackers.Add(EndpointStr, Tracker);
-    }
-
-    // 시퀀스 처리
-    FMessageSequenceTracker& Tracker = EndpointSequenceTrackers[EndpointStr];
-    bool bCanProcess = Tracker.AddSequence(SequenceNumber);
-
-    // 누락된 메시지가 있으면 로그 출력
-    TArray<uint16> MissingSeqs = Tracker.GetMissingSequences();
-    if (MissingSeqs.Num() > 0)
+    // 피어 인덱스로 시퀀스 추적기 조회 (없으면 생성)
+    const FPeerId PeerId = PeerRegistry.FindOrAdd(Sender);
+    if (PeerId == INVALID_PEER_ID)
     {
-        UE_LOG(LogMultiServerSync, Verbose, TEXT("Missing sequences from %s: %d"),
-            *EndpointStr, MissingSeqs.Num());
+        return ESequenceAddResult::InOrder; // 레지스트리가 가득 차면 추적하지 않고 처리
     }
 
-    return bCanProcess;
+    // 시퀀스 처리 (헤더의 16비트 번호를 32비트로 복원)
+    // 비신뢰성 공간은 다른 피어에게 간 번호가 빈 번호로 보이므로 중복만 걸러내고 순서는 보장하지 않음
+    FMessageSequenceTracker& Tracker = PeerRegistry.FindOrAddSequenceTracker(PeerId, Channel, IsOrderGuaranteedChannel(Channel));
+    return Tracker.AddSequence(Tracker.ExtendSequence(SequenceNumber));
 }
 
 // 메시지가 순서대로 도착했는지 확인
 bool FNetworkManager::IsMessageInOrder(const FIPv4Endpoint& Sender, uint16 SequenceNumber)
 {
-    FString EndpointStr = Sender.ToString();
-
-    if (!EndpointSequenceTrackers.Contains(EndpointStr))
+    const FMessageSequenceTracker* Tracker = PeerRegistry.FindSequenceTracker(PeerRegistry.Find(Sender), ESequenceChannel::Unreliable);
+    if (!Tracker)
     {
         return true; // 첫 메시지는 항상 순서대로 간주
     }
 
-    const FMessageSequenceTracker& Tracker = EndpointSequenceTrackers[EndpointStr];
-    return SequenceNumber == Tracker.NextExpectedSequence;
-}
-
-// 누락된 메시지 요청
-void FNetworkManager::RequestMissingMessages(const FIPv4Endpoint& Endpoint)
-{
-    FString EndpointStr = Endpoint.ToString();
-
-    if (!EndpointSequenceTrackers.Contains(EndpointStr))
-    {
-        return;
-    }
-
-    const FMessageSequenceTracker& Tracker = EndpointSequenceTrackers[EndpointStr];
-    TArray<uint16> MissingSeqs = Tracker.GetMissingSequences();
-
-    if (MissingSeqs.Num() == 0)
-    {
-        return;
-    }
-
-    // 최대 10개 시퀀스만 요청 (과도한 요청 방지)
-    const int32 MaxRequestCount = 10;
-    if (MissingSeqs.Num() > MaxRequestCount)
-    {
-        MissingSeqs.SetNum(MaxRequestCount);
-    }
-
-    // 재전송 요청 메시지 생성
-    TArray<uint8> RequestData;
-    RequestData.SetNum(MissingSeqs.Num() * sizeof(uint16));
-
-    for (int32 i = 0; i < MissingSeqs.Num(); i++)
-    {
-        FMemory::Memcpy(RequestData.GetData() + (i * sizeof(uint16)), &MissingSeqs[i], sizeof(uint16));
-    }
-
-    FNetworkMessage Message(ENetworkMessageType::MessageRetry, RequestData);
-    Message.SetProjectId(ProjectId);
-    Message.SetSequenceNumber(GetNextSequenceNumber());
-
-    // 요청 전송
-    SendMessageToEndpoint(Endpoint, Message);
-
-    UE_LOG(LogMultiServerSync, Verbose, TEXT("Requested %d missing messages from %s"),
-        MissingSeqs.Num(), *EndpointStr);
+    return SequenceNumber == FSequenceNumber::Truncate(Tracker->NextExpectedSequence);
 }
 
 // 메시지 재전송 요청 처리
-void FNetworkManager::HandleMessageRetryRequest(const FNetworkMessage& Message, const FIPv4Endpoint& Sender)
+void FNetworkManager::HandleMessageRetryRequest(const FNetworkMessageView& Message, const FIPv4Endpoint& Sender)
 {
-    // 요청된 시퀀스 번호 추출
-    const TArray<uint8>& Data = Message.GetData();
-    int32 SequenceCount = Data.Num() / sizeof(uint16);
-
-    if (SequenceCount == 0)
-    {
-        return;
-    }
-
-    TArray<uint16> RequestedSequences;
-    RequestedSequences.SetNumZeroed(SequenceCount);
-
-    for (int32 i = 0; i < SequenceCount; i++)
-    {
-        uint16 SequenceNumber = 0;
-        FMemory::Memcpy(&SequenceNumber, Data.GetData() + (i * sizeof(uint16)), sizeof(uint16));
-        RequestedSequences.Add(SequenceNumber);
-    }
-
-    // 각 시퀀스에 대해 재전송 처리
-    // 실제 구현에서는 원본 메시지를 캐싱해야 함
-    for (uint16 Sequence : RequestedSequences)
-    {
-        UE_LOG(LogMultiServerSync, Verbose, TEXT("Received retry request for sequence %u from %s"),
-            Sequence, *Sender.ToString());
-
-        // 가상의 원본 메시지 재전송
-        // 실제 구현에서는 캐싱된 메시지 사용
-        TArray<uint8> DummyData;
-        FNetworkMessage RetryMessage(ENetworkMessageType::Data, DummyData);
-        RetryMessage.SetProjectId(ProjectId);
-        RetryMessage.SetSequenceNumber(Sequence);
-        RetryMessage.SetFlags(1); // ACK 필요 표시
-
-        SendMessageToEndpoint(Sender, RetryMessage);
-    }
+    // 비신뢰성 메시지는 보관하지 않으므로 다시 보낼 것이 없음 (이전 빌드가 보내는 요청은 무시)
+    // 비신뢰성 공간은 발신자 전체 번호라 수신자마다 빈 번호가 생기는 것이 정상이고, 신뢰성 메시지는 재전송 타임아웃으로 복구됨
+    UE_LOG(LogMultiServerSync, Verbose, TEXT("Ignoring retry request for %d unreliable messages from %s"),
+        Message.GetData().Num() / static_cast<int32>(sizeof(uint16)), *Sender.ToString());
 }
 
-// 시퀀스 관리 정기 체크
-bool FNetworkManager::CheckSequenceManagement(float DeltaTime)
+// 메시지 처리 여부 결정
+bool FNetworkManager::ShouldProcessMessage(const FIPv4Endpoint& Sender, ESequenceChannel Channel, uint16 SequenceNumber)
 {
-    if (!bIsInitialized)
-    {
-        return true; // 계속 틱 유지
-    }
+    // 수신된 시퀀스 추적
+    const ESequenceAddResult Result = TrackReceivedSequence(Sender, Channel, SequenceNumber);
 
-    // 누락된 메시지가 있는 엔드포인트에 재전송 요청
-    for (const auto& Pair : EndpointSequenceTrackers)
+    // 재전송 등으로 다시 받은 메시지는 순서 보장 여부와 관계없이 버림
+    if (Result == ESequenceAddResult::Duplicate)
     {
-        FString EndpointStr = Pair.Key;
-        const FMessageSequenceTracker& Tracker = Pair.Value;
-
-        if (Tracker.NeedsRetransmissionRequest())
-        {
-            // 엔드포인트 파싱
-            FIPv4Address Address;
-            uint16 PortNumber = 0;  // Port를 PortNumber로 변경
-
-            TArray<FString> Parts;
-            EndpointStr.ParseIntoArray(Parts, TEXT(":"), true);
-
-            if (Parts.Num() >= 2 && FIPv4Address::Parse(Parts[0], Address))
-            {
-                PortNumber = FCString::Atoi(*Parts[1]);  // Port를 PortNumber로 변경
-                FIPv4Endpoint Endpoint(Address, PortNumber);  // 여기도 변경
-
-                // 누락 메시지 요청
-                RequestMissingMessages(Endpoint);
-            }
-        }
+        UE_LOG(LogMultiServerSync, Verbose, TEXT("Duplicate message (Seq: %u, from: %s), dropping"),
+            SequenceNumber, *Sender.ToString());
+        return false;
     }
 
-    return true; // 계속 틱 유지
-}
-
-// 메시지 처리 여부 결정
-bool FNetworkManager::ShouldProcessMessage(const FIPv4Endpoint& Sender, uint16 SequenceNumber)
-{
-    // 수신된 시퀀스 추적
-    bool bCanProcess = TrackReceivedSequence(Sender, SequenceNumber);
-
-    // 순서 보장이 활성화되어 있고, 처리할 수 없는 경우
-    if (bOrderGuaranteedEnabled && !bCanProcess)
+    // 순서 보장이 활성화되어 있으면 신뢰성 공간에서 앞의 번호보다 먼저 온 메시지는 보류
+    if (IsOrderGuaranteedChannel(Channel) && Result == ESequenceAddResult::OutOfOrder)
     {
         UE_LOG(LogMultiServerSync, Verbose, TEXT("Message out of order (Seq: %u, from: %s), deferring processing"),
             SequenceNumber, *Sender.ToString());
@@ -3739,28 +5326,31 @@ bool FNetworkManager::ShouldProcessMessage(const FIPv4Endpoint& Sender, uint16 S
 }
 
 // 메시지 재전송 함수
-void FNetworkManager::RetryMessage(uint16 SequenceNumber)
+void FNetworkManager::RetryMessage(uint64 PendingKey)
 {
-    if (!PendingAcknowledgements.Contains(SequenceNumber))
+    FMessageAckData* Found = PendingAcknowledgements.Find(PendingKey);
+    if (!Found)
     {
         return;
     }
 
-    FMessageAckData& AckData = PendingAcknowledgements[SequenceNumber];
+    FMessageAckData& AckData = *Found;
+    const uint32 SequenceNumber = AckData.SequenceNumber;
 
     // 현재 시간
     double CurrentTime = FPlatformTime::Seconds();
 
-    // 시도 횟수 증가
+    // 시도 횟수 증가 (다음 기한은 백오프한 재전송 타임아웃)
     AckData.AttemptCount++;
     AckData.LastAttemptTime = CurrentTime;
+    AckData.RetryDeadline = CurrentTime + GetRetransmissionTimeout(AckData.TargetEndpoint, AckData.AttemptCount);
+    NextRetryDeadline = FMath::Min(NextRetryDeadline, AckData.RetryDeadline);
 
-    // 메시지 재전송을 위한 가상의 메시지 생성
-    // 실제 구현에서는 원본 메시지 내용을 저장해 두어야 함
-    TArray<uint8> DummyData; // 실제 구현에서는 저장된 원본 데이터 사용
-    FNetworkMessage Message(ENetworkMessageType::Data, DummyData);
+    // 보관해 둔 원본 메시지를 같은 시퀀스 번호로 다시 만듦
+    FNetworkMessage Message(static_cast<ENetworkMessageType>(AckData.MessageType), AckData.Payload);
     Message.SetProjectId(ProjectId);
-    Message.SetSequenceNumber(SequenceNumber);
+    Message.SetSequenceNumber(FSequenceNumber::Truncate(SequenceNumber));
+    Message.SetFlags(AckData.MessageFlags);
 
     // 메시지 재전송
     bool bSuccess = SendMessageToEndpoint(AckData.TargetEndpoint, Message);
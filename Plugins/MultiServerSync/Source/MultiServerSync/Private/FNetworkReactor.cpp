@@ -0,0 +1,208 @@
+﻿// FNetworkReactor.cpp
+#include "FNetworkReactor.h"
+#include "FSyncLog.h"
+
+#if PLATFORM_LINUX
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+#include <errno.h>
+
+namespace
+{
+    /** 웨이크업 eventfd의 epoll 이벤트 데이터 (전송 계층 등록 인덱스와 겹치지 않는 값) */
+    constexpr uint32 WAKE_EVENT_TOKEN = FNetworkReactor::MAX_TRANSPORTS;
+
+    /** epoll 결과를 준비된 전송 계층 비트마스크로 변환 (웨이크업 이벤트는 카운터를 비우고 제외) */
+    uint32 CollectReadyMask(const epoll_event* Events, int ReadyCount, int32 WakeFd)
+    {
+        uint32 ReadyMask = 0;
+        for (int Index = 0; Index < ReadyCount; ++Index)
+        {
+            if (Events[Index].data.u32 == WAKE_EVENT_TOKEN)
+            {
+                uint64 Counter = 0;
+                const ssize_t Ignored = read(WakeFd, &Counter, sizeof(Counter));
+                (void)Ignored;
+                continue;
+            }
+
+            ReadyMask |= 1u << Events[Index].data.u32;
+        }
+
+        return ReadyMask;
+    }
+}
+#endif
+
+FNetworkReactor::FNetworkReactor()
+    : EpollFd(-1)
+    , WakeFd(-1)
+    , bUseEpoll(false)
+{
+#if PLATFORM_LINUX
+    EpollFd = epoll_create1(EPOLL_CLOEXEC);
+    bUseEpoll = EpollFd >= 0;
+    if (!bUseEpoll)
+    {
+        UE_LOG(LogMultiServerSync, Warning, TEXT("Network reactor: epoll_create1 failed (errno %d), falling back to polling"), errno);
+        return;
+    }
+
+    // 중지 요청 등으로 대기를 깨우기 위한 eventfd (소켓이 아니므로 SO_REUSEPORT 샤드 분산과 무관하게 이 리액터만 깨움)
+    WakeFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (WakeFd >= 0)
+    {
+        epoll_event Event;
+        FMemory::Memzero(Event);
+        Event.events = EPOLLIN;
+        Event.data.u32 = WAKE_EVENT_TOKEN;
+
+        if (epoll_ctl(EpollFd, EPOLL_CTL_ADD, WakeFd, &Event) != 0)
+        {
+            close(WakeFd);
+            WakeFd = -1;
+        }
+    }
+
+    if (WakeFd < 0)
+    {
+        UE_LOG(LogMultiServerSync, Warning, TEXT("Network reactor: wake-up eventfd unavailable (errno %d)"), errno);
+    }
+#endif
+}
+
+FNetworkReactor::~FNetworkReactor()
+{
+#if PLATFORM_LINUX
+    if (WakeFd >= 0)
+    {
+        close(WakeFd);
+        WakeFd = -1;
+    }
+
+    if (EpollFd >= 0)
+    {
+        close(EpollFd);
+        EpollFd = -1;
+    }
+#endif
+}
+
+int32 FNetworkReactor::Add(INetworkTransport* Transport)
+{
+    if (!Transport || Transports.Num() >= MAX_TRANSPORTS)
+    {
+        return INDEX_NONE;
+    }
+
+    const int32 Index = Transports.Add(Transport);
+
+#if PLATFORM_LINUX
+    if (bUseEpoll)
+    {
+        // 이벤트 데이터에 등록 인덱스를 넣어 준비된 전송 계층을 바로 찾음
+        epoll_event Event;
+        FMemory::Memzero(Event);
+        Event.events = EPOLLIN;
+        Event.data.u32 = static_cast<uint32>(Index);
+
+        const int32 Handle = Transport->GetNativeHandle();
+        if (Handle == INDEX_NONE || epoll_ctl(EpollFd, EPOLL_CTL_ADD, Handle, &Event) != 0)
+        {
+            UE_LOG(LogMultiServerSync, Warning, TEXT("Network reactor: %s transport cannot be registered with epoll, falling back to polling"),
+                Transport->GetBackendName());
+            bUseEpoll = false;
+        }
+    }
+#endif
+
+    return Index;
+}
+
+uint32 FNetworkReactor::Wait(const FTimespan& Timeout)
+{
+    if (Transports.Num() == 0)
+    {
+        FPlatformProcess::Sleep(static_cast<float>(Timeout.GetTotalSeconds()));
+        return 0;
+    }
+
+#if PLATFORM_LINUX
+    if (bUseEpoll)
+    {
+        epoll_event Events[MAX_TRANSPORTS + 1];
+        const int ReadyCount = epoll_wait(EpollFd, Events, Transports.Num() + 1, static_cast<int>(Timeout.GetTotalMilliseconds()));
+        return CollectReadyMask(Events, ReadyCount, WakeFd);
+    }
+#endif
+
+    // 전송 계층이 하나뿐이면 그 소켓에서 직접 대기
+    if (Transports.Num() == 1)
+    {
+        return Transports[0]->WaitForRead(Timeout) ? 1u : 0u;
+    }
+
+    // 여러 소켓을 함께 기다릴 수 없으므로 대기 없이 확인하고 아무것도 없으면 잠시 쉼
+    uint32 ReadyMask = 0;
+    for (int32 Index = 0; Index < Transports.Num(); ++Index)
+    {
+        if (Transports[Index]->WaitForRead(FTimespan::Zero()))
+        {
+            ReadyMask |= 1u << Index;
+        }
+    }
+
+    if (ReadyMask == 0)
+    {
+        FPlatformProcess::Sleep(0.001f);
+    }
+
+    return ReadyMask;
+}
+
+uint32 FNetworkReactor::Poll()
+{
+#if PLATFORM_LINUX
+    if (bUseEpoll)
+    {
+        epoll_event Events[MAX_TRANSPORTS + 1];
+        const int ReadyCount = Transports.Num() > 0 ? epoll_wait(EpollFd, Events, Transports.Num() + 1, 0) : 0;
+        return CollectReadyMask(Events, ReadyCount, WakeFd);
+    }
+#endif
+
+    uint32 ReadyMask = 0;
+    for (int32 Index = 0; Index < Transports.Num(); ++Index)
+    {
+        if (Transports[Index]->WaitForRead(FTimespan::Zero()))
+        {
+            ReadyMask |= 1u << Index;
+        }
+    }
+
+    return ReadyMask;
+}
+
+bool FNetworkReactor::Wake()
+{
+#if PLATFORM_LINUX
+    if (bUseEpoll && WakeFd >= 0)
+    {
+        const uint64 Increment = 1;
+        return write(WakeFd, &Increment, sizeof(Increment)) == sizeof(Increment) || errno == EAGAIN;
+    }
+#endif
+
+    return false;
+}
+
+const TCHAR* FNetworkReactor::GetMultiplexerName() const
+{
+    if (bUseEpoll)
+    {
+        return TEXT("epoll");
+    }
+
+    return Transports.Num() <= 1 ? TEXT("WaitForRead") : TEXT("polling");
+}
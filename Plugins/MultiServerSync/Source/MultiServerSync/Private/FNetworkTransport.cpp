@@ -0,0 +1,1291 @@
+﻿// FNetworkTransport.cpp
+#include "FNetworkTransport.h"
+#include "FSyncLog.h"
+#include "SocketSubsystem.h"
+#include "IPAddress.h"
+#include "Common/UdpSocketBuilder.h"
+#include "HAL/PlatformTime.h"
+
+#if PLATFORM_LINUX
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <time.h>
+#include <unistd.h>
+#include <errno.h>
+
+// io_uring은 멀티샷 recvmsg(커널 6.0)를 정의한 헤더로 빌드할 때만 사용 (오래된 sysroot에서는 recvmmsg로 대체)
+#if defined(__has_include)
+#if __has_include(<linux/io_uring.h>)
+#include <linux/io_uring.h>
+#endif
+#endif
+
+#if defined(IORING_RECV_MULTISHOT)
+#define MSYNC_WITH_IO_URING 1
+#include <sys/mman.h>
+#include <sys/eventfd.h>
+#include <sys/syscall.h>
+
+// 시스템 콜 번호가 없는 libc 헤더용 (x86_64와 asm-generic 모두 같은 번호)
+#ifndef __NR_io_uring_setup
+#define __NR_io_uring_setup 425
+#endif
+#ifndef __NR_io_uring_enter
+#define __NR_io_uring_enter 426
+#endif
+#ifndef __NR_io_uring_register
+#define __NR_io_uring_register 427
+#endif
+#endif
+#endif
+
+#ifndef MSYNC_WITH_IO_URING
+#define MSYNC_WITH_IO_URING 0
+#endif
+
+// INetworkTransport 기본 구현
+int32 INetworkTransport::SendToMany(const uint8* Data, int32 Size, const FIPv4Endpoint* Targets, int32 TargetCount)
+{
+    int32 SentCount = 0;
+    for (int32 Index = 0; Index < TargetCount; ++Index)
+    {
+        if (SendTo(Data, Size, Targets[Index]))
+        {
+            SentCount++;
+        }
+    }
+
+    return SentCount;
+}
+
+// FSocketTransport 구현
+FSocketTransport::FSocketTransport(FSocket* InSocket, bool bInOwnsSocket)
+    : Socket(InSocket)
+    , bOwnsSocket(bInOwnsSocket)
+{
+    SenderAddr = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->CreateInternetAddr();
+}
+
+FSocketTransport::~FSocketTransport()
+{
+    Close();
+}
+
+uint16 FSocketTransport::GetLocalPort() const
+{
+    return Socket ? static_cast<uint16>(Socket->GetPortNo()) : 0;
+}
+
+bool FSocketTransport::SendTo(const uint8* Data, int32 Size, const FIPv4Endpoint& Target)
+{
+    if (!Socket)
+    {
+        return false;
+    }
+
+    const TSharedPtr<FInternetAddr> TargetAddr = FindOrCreateTargetAddr(Target);
+
+    int32 BytesSent = 0;
+    const bool bSuccess = Socket->SendTo(Data, Size, BytesSent, *TargetAddr);
+
+    Stats.SendSyscalls++;
+    if (bSuccess)
+    {
+        Stats.SentDatagrams++;
+    }
+
+    return bSuccess && BytesSent == Size;
+}
+
+int32 FSocketTransport::SendToMany(const uint8* Data, int32 Size, const FIPv4Endpoint* Targets, int32 TargetCount)
+{
+    if (!Socket)
+    {
+        return 0;
+    }
+
+    int32 SentCount = 0;
+    for (int32 Index = 0; Index < TargetCount; ++Index)
+    {
+        const TSharedPtr<FInternetAddr> TargetAddr = FindOrCreateTargetAddr(Targets[Index]);
+
+        int32 BytesSent = 0;
+        Stats.SendSyscalls++;
+        if (Socket->SendTo(Data, Size, BytesSent, *TargetAddr) && BytesSent == Size)
+        {
+            Stats.SentDatagrams++;
+            SentCount++;
+        }
+    }
+
+    return SentCount;
+}
+
+TSharedPtr<FInternetAddr> FSocketTransport::FindOrCreateTargetAddr(const FIPv4Endpoint& Target)
+{
+    FScopeLock ScopeLock(&TargetAddrLock);
+
+    // 클러스터 규모보다 훨씬 많은 대상이 쌓이면 캐시를 비움
+    if (CachedTargetAddrs.Num() > MAX_CACHED_TARGET_ADDRS)
+    {
+        CachedTargetAddrs.Reset();
+    }
+
+    // 대상 주소는 처음 한 번만 생성하고 이후 재사용
+    TSharedPtr<FInternetAddr>& TargetAddr = CachedTargetAddrs.FindOrAdd(Target);
+    if (!TargetAddr.IsValid())
+    {
+        TargetAddr = Target.ToInternetAddr();
+    }
+
+    return TargetAddr;
+}
+
+bool FSocketTransport::WaitForRead(const FTimespan& Timeout)
+{
+    return Socket && Socket->Wait(ESocketWaitConditions::WaitForRead, Timeout);
+}
+
+bool FSocketTransport::EnableMulticast(const FIPv4Address& GroupAddress, const FIPv4Address& InterfaceAddress, uint8 TimeToLive, bool bLoopback)
+{
+    if (!Socket)
+    {
+        return false;
+    }
+
+    ISocketSubsystem* SocketSubsystem = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM);
+    TSharedRef<FInternetAddr> GroupAddr = SocketSubsystem->CreateInternetAddr();
+    GroupAddr->SetIp(GroupAddress.Value);
+    TSharedRef<FInternetAddr> InterfaceAddr = SocketSubsystem->CreateInternetAddr();
+    InterfaceAddr->SetIp(InterfaceAddress.Value);
+
+    if (!Socket->JoinMulticastGroup(*GroupAddr, *InterfaceAddr))
+    {
+        UE_LOG(LogMultiServerSync, Warning, TEXT("FSocket transport: failed to join multicast group %s"), *GroupAddress.ToString());
+        return false;
+    }
+
+    return Socket->SetMulticastInterface(*InterfaceAddr)
+        && Socket->SetMulticastTtl(TimeToLive)
+        && Socket->SetMulticastLoopback(bLoopback);
+}
+
+int32 FSocketTransport::ReceiveBatch(FReceivedDatagram* OutDatagrams, int32 MaxCount)
+{
+    if (!Socket || MaxCount <= 0)
+    {
+        return 0;
+    }
+
+    // 이전 데이터그램을 넘겨준 경우 풀에서 새 버퍼 획득
+    if (!ReceiveBuffer.IsValid())
+    {
+        ReceiveBuffer = PacketPool.Acquire();
+    }
+
+    // FSocket은 한 번에 하나만 읽을 수 있으므로 배치 크기는 항상 1
+    int32 BytesRead = 0;
+    Stats.ReceiveSyscalls++;
+    if (!Socket->RecvFrom(ReceiveBuffer->GetData(), ReceiveBuffer->GetCapacity(), BytesRead, *SenderAddr))
+    {
+        return 0;
+    }
+
+    // FSocket은 커널 수신 타임스탬프를 노출하지 않으므로 RecvFrom이 반환된 시각을 도착 시각으로 사용
+    const uint64 ReceiveCycles = FPlatformTime::Cycles64();
+
+    uint32 SenderIPValue = 0;
+    SenderAddr->GetIp(SenderIPValue);
+    const FIPv4Endpoint Sender(FIPv4Address(SenderIPValue), SenderAddr->GetPort());
+
+    ReceiveBuffer->SetSize(BytesRead);
+    ReceiveBuffer->SetSender(Sender);
+
+    // 복사 없이 버퍼 자체를 넘겨줌
+    OutDatagrams[0].Data = ReceiveBuffer->GetData();
+    OutDatagrams[0].Size = BytesRead;
+    OutDatagrams[0].Sender = Sender;
+    OutDatagrams[0].Buffer = MoveTemp(ReceiveBuffer);
+    OutDatagrams[0].ReceiveCycles = ReceiveCycles;
+
+    Stats.ReceivedDatagrams++;
+    return 1;
+}
+
+void FSocketTransport::Close()
+{
+    if (Socket && bOwnsSocket)
+    {
+        Socket->Close();
+        ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->DestroySocket(Socket);
+    }
+
+    Socket = nullptr;
+}
+
+#if PLATFORM_LINUX
+/**
+ * Linux 네이티브 소켓 기반 전송 계층
+ * recvmmsg로 시스템 콜 한 번에 최대 MaxBatchSize개의 데이터그램을 풀 버퍼 슬롯 링에 수신하고,
+ * 배치 모드의 팬아웃 송신은 sendmmsg로 모든 대상을 한 번에 제출
+ * SO_TIMESTAMPNS로 커널이 데이터그램을 받은 시각을 제어 메시지로 함께 받아 도착 시각으로 사용
+ * 리액터가 epoll로 감시할 수 있도록 모든 수신 백엔드가 Linux에서는 이 구현을 사용
+ */
+class FLinuxSocketTransport : public INetworkTransport
+{
+public:
+    /**
+     * 생성자
+     * @param InMaxBatchSize 시스템 콜 한 번에 수신할 최대 데이터그램 수 (1이면 단일 수신/송신)
+     * @param InPacketBufferCapacity 풀 버퍼 하나의 용량 (데이터그램 앞에 수신 결과 헤더를 함께 받는 구현은 그만큼 크게)
+     */
+    explicit FLinuxSocketTransport(int32 InMaxBatchSize, int32 InPacketBufferCapacity = MAX_DATAGRAM_SIZE)
+        : INetworkTransport(InPacketBufferCapacity)
+        , SocketFd(-1)
+        , LocalPort(0)
+        , MaxBatchSize(FMath::Clamp(InMaxBatchSize, 1, MAX_RECEIVE_BATCH))
+        , bKernelTimestamps(false)
+    {
+    }
+
+    virtual ~FLinuxSocketTransport()
+    {
+        Close();
+    }
+
+    /** 소켓 생성 및 바인딩, recvmmsg 수신 슬롯 링 준비 */
+    bool Open(const FIPv4Address& BindAddress, uint16 Port, bool bReusePort)
+    {
+        if (!OpenSocket(BindAddress, Port, bReusePort))
+        {
+            return false;
+        }
+
+        // 수신 슬롯 링 준비 - 각 슬롯은 풀 버퍼로 채워지며 이후에는 반환된 버퍼만 재사용
+        SlotBuffers.SetNum(MaxBatchSize);
+        SlotAddrs.SetNumZeroed(MaxBatchSize);
+        SlotIoVecs.SetNumZeroed(MaxBatchSize);
+        SlotHeaders.SetNumZeroed(MaxBatchSize);
+        SlotControls.SetNumZeroed(MaxBatchSize);
+
+        for (int32 Index = 0; Index < MaxBatchSize; ++Index)
+        {
+            RefillSlot(Index);
+            SlotHeaders[Index].msg_hdr.msg_iov = &SlotIoVecs[Index];
+            SlotHeaders[Index].msg_hdr.msg_iovlen = 1;
+            SlotHeaders[Index].msg_hdr.msg_name = &SlotAddrs[Index];
+            SlotHeaders[Index].msg_hdr.msg_control = SlotControls[Index].Data;
+        }
+
+        return true;
+    }
+
+    /** 소켓 생성 및 바인딩 (수신 슬롯은 만들지 않음) */
+    bool OpenSocket(const FIPv4Address& BindAddress, uint16 Port, bool bReusePort)
+    {
+        SocketFd = socket(AF_INET, SOCK_DGRAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+        if (SocketFd < 0)
+        {
+            UE_LOG(LogMultiServerSync, Warning, TEXT("Native transport: socket() failed (errno %d)"), errno);
+            return false;
+        }
+
+        // FUdpSocketBuilder의 AsReusable/WithBroadcast와 동일한 옵션
+        int Enable = 1;
+        setsockopt(SocketFd, SOL_SOCKET, SO_REUSEADDR, &Enable, sizeof(Enable));
+        setsockopt(SocketFd, SOL_SOCKET, SO_BROADCAST, &Enable, sizeof(Enable));
+
+        // 같은 포트의 소켓끼리 커널이 발신자 주소/포트 해시로 유니캐스트 데이터그램을 나눠 전달
+        if (bReusePort && setsockopt(SocketFd, SOL_SOCKET, SO_REUSEPORT, &Enable, sizeof(Enable)) != 0)
+        {
+            UE_LOG(LogMultiServerSync, Warning, TEXT("Native transport: SO_REUSEPORT failed (errno %d)"), errno);
+            Close();
+            return false;
+        }
+
+        int ReceiveBufferSize = 2 * 1024 * 1024;
+        setsockopt(SocketFd, SOL_SOCKET, SO_RCVBUF, &ReceiveBufferSize, sizeof(ReceiveBufferSize));
+
+        // 커널 소프트웨어 수신 타임스탬프 (실패해도 시스템 콜 반환 시각으로 대체하므로 계속 진행)
+        bKernelTimestamps = setsockopt(SocketFd, SOL_SOCKET, SO_TIMESTAMPNS, &Enable, sizeof(Enable)) == 0;
+        if (!bKernelTimestamps)
+        {
+            UE_LOG(LogMultiServerSync, Warning, TEXT("Native transport: SO_TIMESTAMPNS failed (errno %d), using receive time"), errno);
+        }
+
+        sockaddr_in Addr;
+        FMemory::Memzero(Addr);
+        Addr.sin_family = AF_INET;
+        Addr.sin_port = htons(Port);
+        Addr.sin_addr.s_addr = htonl(BindAddress.Value);
+
+        if (bind(SocketFd, reinterpret_cast<sockaddr*>(&Addr), sizeof(Addr)) != 0)
+        {
+            UE_LOG(LogMultiServerSync, Warning, TEXT("Native transport: bind to port %d failed (errno %d)"), Port, errno);
+            Close();
+            return false;
+        }
+
+        socklen_t AddrLen = sizeof(Addr);
+        getsockname(SocketFd, reinterpret_cast<sockaddr*>(&Addr), &AddrLen);
+        LocalPort = ntohs(Addr.sin_port);
+
+        return true;
+    }
+
+    // INetworkTransport 인터페이스 구현
+    virtual const TCHAR* GetBackendName() const override { return MaxBatchSize > 1 ? TEXT("recvmmsg") : TEXT("native"); }
+
+    virtual uint16 GetLocalPort() const override { return LocalPort; }
+
+    virtual bool SendTo(const uint8* Data, int32 Size, const FIPv4Endpoint& Target) override
+    {
+        if (SocketFd < 0)
+        {
+            return false;
+        }
+
+        sockaddr_in Addr;
+        FMemory::Memzero(Addr);
+        Addr.sin_family = AF_INET;
+        Addr.sin_port = htons(Target.Port);
+        Addr.sin_addr.s_addr = htonl(Target.Address.Value);
+
+        const ssize_t BytesSent = sendto(SocketFd, Data, Size, 0, reinterpret_cast<sockaddr*>(&Addr), sizeof(Addr));
+
+        Stats.SendSyscalls++;
+        if (BytesSent == Size)
+        {
+            Stats.SentDatagrams++;
+            return true;
+        }
+
+        return false;
+    }
+
+    virtual int32 SendToMany(const uint8* Data, int32 Size, const FIPv4Endpoint* Targets, int32 TargetCount) override
+    {
+        if (SocketFd < 0 || TargetCount <= 0)
+        {
+            return 0;
+        }
+
+        // 단일 모드는 대상마다 sendto 한 번
+        if (MaxBatchSize == 1)
+        {
+            return INetworkTransport::SendToMany(Data, Size, Targets, TargetCount);
+        }
+
+        // 클러스터가 커질 때만 배열이 늘어나며 이후 호출에서는 재사용
+        if (SendHeaders.Num() < TargetCount)
+        {
+            SendHeaders.SetNumZeroed(TargetCount);
+            SendAddrs.SetNumZeroed(TargetCount);
+        }
+
+        // 모든 대상이 같은 페이로드를 공유
+        SendIoVec.iov_base = const_cast<uint8*>(Data);
+        SendIoVec.iov_len = Size;
+
+        for (int32 Index = 0; Index < TargetCount; ++Index)
+        {
+            sockaddr_in& Addr = SendAddrs[Index];
+            Addr.sin_family = AF_INET;
+            Addr.sin_port = htons(Targets[Index].Port);
+            Addr.sin_addr.s_addr = htonl(Targets[Index].Address.Value);
+
+            msghdr& Header = SendHeaders[Index].msg_hdr;
+            Header.msg_name = &Addr;
+            Header.msg_namelen = sizeof(sockaddr_in);
+            Header.msg_iov = &SendIoVec;
+            Header.msg_iovlen = 1;
+            Header.msg_control = nullptr;
+            Header.msg_controllen = 0;
+            Header.msg_flags = 0;
+        }
+
+        // sendmmsg는 일부만 전송할 수 있으므로 남은 대상을 이어서 제출
+        int32 SentCount = 0;
+        while (SentCount < TargetCount)
+        {
+            Stats.SendSyscalls++;
+            const int Result = sendmmsg(SocketFd, SendHeaders.GetData() + SentCount, TargetCount - SentCount, 0);
+            if (Result <= 0)
+            {
+                break;
+            }
+
+            SentCount += Result;
+        }
+
+        Stats.SentDatagrams += SentCount;
+        return SentCount;
+    }
+
+    virtual bool WaitForRead(const FTimespan& Timeout) override
+    {
+        if (SocketFd < 0)
+        {
+            return false;
+        }
+
+        pollfd PollFd;
+        PollFd.fd = SocketFd;
+        PollFd.events = POLLIN;
+        PollFd.revents = 0;
+
+        return poll(&PollFd, 1, static_cast<int>(Timeout.GetTotalMilliseconds())) > 0;
+    }
+
+    virtual bool SetBusyPoll(int32 Microseconds) override
+    {
+#ifdef SO_BUSY_POLL
+        if (SocketFd < 0)
+        {
+            return false;
+        }
+
+        // 0보다 큰 값은 커널 4.x 이전이나 net.core 설정에 따라 CAP_NET_ADMIN이 필요할 수 있음
+        int Value = FMath::Max(Microseconds, 0);
+        if (setsockopt(SocketFd, SOL_SOCKET, SO_BUSY_POLL, &Value, sizeof(Value)) != 0)
+        {
+            UE_LOG(LogMultiServerSync, Warning, TEXT("Native transport: SO_BUSY_POLL %d us failed on port %d (errno %d)"), Value, LocalPort, errno);
+            return false;
+        }
+
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    virtual bool SetDscp(uint8 Dscp) override
+    {
+        if (SocketFd < 0 || Dscp > 63)
+        {
+            return false;
+        }
+
+        // ECN 비트(하위 2비트)는 커널에 맡김
+        int Value = Dscp << 2;
+        if (setsockopt(SocketFd, IPPROTO_IP, IP_TOS, &Value, sizeof(Value)) != 0)
+        {
+            UE_LOG(LogMultiServerSync, Warning, TEXT("Native transport: DSCP %u failed on port %d (errno %d)"), Dscp, LocalPort, errno);
+            return false;
+        }
+
+        return true;
+    }
+
+    virtual bool EnableMulticast(const FIPv4Address& GroupAddress, const FIPv4Address& InterfaceAddress, uint8 TimeToLive, bool bLoopback) override
+    {
+        if (SocketFd < 0)
+        {
+            return false;
+        }
+
+        ip_mreq Membership;
+        FMemory::Memzero(Membership);
+        Membership.imr_multiaddr.s_addr = htonl(GroupAddress.Value);
+        Membership.imr_interface.s_addr = htonl(InterfaceAddress.Value);
+
+        if (setsockopt(SocketFd, IPPROTO_IP, IP_ADD_MEMBERSHIP, &Membership, sizeof(Membership)) != 0)
+        {
+            UE_LOG(LogMultiServerSync, Warning, TEXT("Native transport: failed to join multicast group %s (errno %d)"), *GroupAddress.ToString(), errno);
+            return false;
+        }
+
+        // Any 주소에 바인딩한 소켓이 같은 호스트의 다른 소켓이 가입한 그룹까지 받지 않도록 함
+#ifdef IP_MULTICAST_ALL
+        int MulticastAll = 0;
+        setsockopt(SocketFd, IPPROTO_IP, IP_MULTICAST_ALL, &MulticastAll, sizeof(MulticastAll));
+#endif
+
+        in_addr Interface;
+        Interface.s_addr = htonl(InterfaceAddress.Value);
+        int Ttl = TimeToLive;
+        int Loopback = bLoopback ? 1 : 0;
+
+        if (setsockopt(SocketFd, IPPROTO_IP, IP_MULTICAST_IF, &Interface, sizeof(Interface)) != 0
+            || setsockopt(SocketFd, IPPROTO_IP, IP_MULTICAST_TTL, &Ttl, sizeof(Ttl)) != 0
+            || setsockopt(SocketFd, IPPROTO_IP, IP_MULTICAST_LOOP, &Loopback, sizeof(Loopback)) != 0)
+        {
+            UE_LOG(LogMultiServerSync, Warning, TEXT("Native transport: failed to set multicast options (errno %d)"), errno);
+            return false;
+        }
+
+        return true;
+    }
+
+    virtual int32 GetNativeHandle() const override { return SocketFd; }
+
+    virtual int32 ReceiveBatch(FReceivedDatagram* OutDatagrams, int32 MaxCount) override
+    {
+        if (SocketFd < 0 || MaxCount <= 0)
+        {
+            return 0;
+        }
+
+        const int32 RequestCount = FMath::Min(MaxCount, MaxBatchSize);
+        for (int32 Index = 0; Index < RequestCount; ++Index)
+        {
+            // recvmmsg가 덮어쓰는 필드 재설정
+            SlotHeaders[Index].msg_hdr.msg_namelen = sizeof(sockaddr_in);
+            SlotHeaders[Index].msg_hdr.msg_controllen = bKernelTimestamps ? sizeof(FControlBuffer) : 0;
+            SlotHeaders[Index].msg_hdr.msg_flags = 0;
+        }
+
+        Stats.ReceiveSyscalls++;
+        const int ReceivedCount = recvmmsg(SocketFd, SlotHeaders.GetData(), RequestCount, MSG_DONTWAIT, nullptr);
+        if (ReceivedCount <= 0)
+        {
+            return 0;
+        }
+
+        // 커널 타임스탬프(CLOCK_REALTIME)를 Cycles64 기준으로 옮기기 위한 기준점 (배치마다 한 번)
+        const uint64 NowCycles = FPlatformTime::Cycles64();
+        timespec NowRealtime;
+        clock_gettime(CLOCK_REALTIME, &NowRealtime);
+        const int64 NowRealtimeNs = static_cast<int64>(NowRealtime.tv_sec) * 1000000000LL + NowRealtime.tv_nsec;
+
+        int32 OutCount = 0;
+        for (int32 Index = 0; Index < ReceivedCount; ++Index)
+        {
+            const mmsghdr& Header = SlotHeaders[Index];
+            if (Header.msg_hdr.msg_flags & MSG_TRUNC)
+            {
+                Stats.TruncatedDatagrams++;
+                UE_LOG(LogMultiServerSync, Warning, TEXT("Native transport: dropped truncated datagram (%llu total)"), Stats.TruncatedDatagrams);
+                continue;
+            }
+
+            const sockaddr_in& Addr = SlotAddrs[Index];
+            const FIPv4Endpoint Sender(FIPv4Address(ntohl(Addr.sin_addr.s_addr)), ntohs(Addr.sin_port));
+
+            FPacketBufferRef& SlotBuffer = SlotBuffers[Index];
+            SlotBuffer->SetSize(static_cast<int32>(Header.msg_len));
+            SlotBuffer->SetSender(Sender);
+
+            // 복사 없이 슬롯 버퍼를 넘겨주고 슬롯은 풀에서 다시 채움
+            FReceivedDatagram& Datagram = OutDatagrams[OutCount++];
+            Datagram.Data = SlotBuffer->GetData();
+            Datagram.Size = SlotBuffer->GetSize();
+            Datagram.Sender = Sender;
+            Datagram.Buffer = MoveTemp(SlotBuffer);
+            Datagram.ReceiveCycles = GetArrivalCycles(Header.msg_hdr, NowCycles, NowRealtimeNs);
+
+            RefillSlot(Index);
+        }
+
+        Stats.ReceivedDatagrams += OutCount;
+        return OutCount;
+    }
+
+    virtual void Close() override
+    {
+        if (SocketFd >= 0)
+        {
+            close(SocketFd);
+            SocketFd = -1;
+        }
+    }
+
+protected:
+    /** 슬롯별 제어 메시지 버퍼 (cmsghdr 정렬 보장) */
+    union FControlBuffer
+    {
+        cmsghdr Align;
+        uint8 Data[CMSG_SPACE(sizeof(timespec))];
+    };
+
+    /**
+     * 수신 헤더의 SCM_TIMESTAMPNS 제어 메시지로 도착 시각을 구합니다.
+     * 커널 시각과 현재 시각의 차이(대기 시간)를 NowCycles에서 빼며, 타임스탬프가 없으면 NowCycles를 반환
+     */
+    uint64 GetArrivalCycles(const msghdr& Header, uint64 NowCycles, int64 NowRealtimeNs)
+    {
+        for (cmsghdr* Control = CMSG_FIRSTHDR(&Header); Control != nullptr; Control = CMSG_NXTHDR(const_cast<msghdr*>(&Header), Control))
+        {
+            if (Control->cmsg_level != SOL_SOCKET || Control->cmsg_type != SCM_TIMESTAMPNS)
+            {
+                continue;
+            }
+
+            timespec KernelTime;
+            FMemory::Memcpy(&KernelTime, CMSG_DATA(Control), sizeof(KernelTime));
+            const int64 KernelTimeNs = static_cast<int64>(KernelTime.tv_sec) * 1000000000LL + KernelTime.tv_nsec;
+
+            // 벽시계가 조정되어 음수가 되거나 커널 시각이 미래면 지금 도착한 것으로 봄
+            const int64 AgeNs = NowRealtimeNs - KernelTimeNs;
+            Stats.KernelTimestampedDatagrams++;
+            if (AgeNs <= 0)
+            {
+                return NowCycles;
+            }
+
+            const uint64 AgeCycles = static_cast<uint64>(AgeNs * 1e-9 / FPlatformTime::GetSecondsPerCycle64());
+            return AgeCycles < NowCycles ? NowCycles - AgeCycles : NowCycles;
+        }
+
+        return NowCycles;
+    }
+
+    /** 슬롯에 풀 버퍼를 채우고 I/O 벡터를 갱신 */
+    void RefillSlot(int32 Index)
+    {
+        SlotBuffers[Index] = PacketPool.Acquire();
+        SlotIoVecs[Index].iov_base = SlotBuffers[Index]->GetData();
+        SlotIoVecs[Index].iov_len = SlotBuffers[Index]->GetCapacity();
+    }
+
+    /** 네이티브 소켓 디스크립터 */
+    int SocketFd;
+
+    /** 바인딩된 포트 */
+    uint16 LocalPort;
+
+    /** 시스템 콜 한 번에 수신할 최대 데이터그램 수 */
+    int32 MaxBatchSize;
+
+    /** SO_TIMESTAMPNS 설정 성공 여부 */
+    bool bKernelTimestamps;
+
+    /** 슬롯별 수신 풀 버퍼 */
+    TArray<FPacketBufferRef> SlotBuffers;
+
+    /** 슬롯별 발신자 주소 */
+    TArray<sockaddr_in> SlotAddrs;
+
+    /** 슬롯별 I/O 벡터 */
+    TArray<iovec> SlotIoVecs;
+
+    /** recvmmsg 헤더 배열 */
+    TArray<mmsghdr> SlotHeaders;
+
+    /** 슬롯별 제어 메시지 버퍼 (수신 타임스탬프) */
+    TArray<FControlBuffer> SlotControls;
+
+    /** sendmmsg 헤더 배열 (팬아웃 대상 수만큼) */
+    TArray<mmsghdr> SendHeaders;
+
+    /** sendmmsg 대상 주소 배열 */
+    TArray<sockaddr_in> SendAddrs;
+
+    /** 팬아웃 송신 I/O 벡터 (모든 대상이 공유) */
+    iovec SendIoVec;
+};
+
+#if MSYNC_WITH_IO_URING
+/**
+ * io_uring 기반 전송 계층
+ * 멀티샷 recvmsg 요청 하나를 제출해 두면 커널이 데이터그램마다 제공 버퍼 링에서 버퍼를 골라 수신하고 완료 큐에 결과를 쌓으므로
+ * 수신 경로에서는 데이터그램마다 시스템 콜을 할 필요가 없음
+ * 완료가 생기면 등록한 eventfd가 신호되어 리액터의 epoll이 깨어나고, ReceiveBatch는 공유 메모리의 완료 큐만 읽음
+ * 제공 버퍼는 풀 버퍼이므로 핸들러가 참조를 보관해도 복사하지 않으며, 보관된 버퍼 자리는 풀의 새 버퍼로 채움
+ * 송신은 기반 클래스의 sendto/sendmmsg 경로를 그대로 사용 (팬아웃은 sendmmsg 한 번으로 제출)
+ */
+class FIoUringTransport : public FLinuxSocketTransport
+{
+public:
+    FIoUringTransport()
+        : FLinuxSocketTransport(MAX_RECEIVE_BATCH, MAX_DATAGRAM_SIZE + RECEIVE_HEADER_CAPACITY)
+        , RingFd(-1)
+        , EventFd(-1)
+        , RingMemory(nullptr)
+        , RingMemorySize(0)
+        , CompletionMemory(nullptr)
+        , CompletionMemorySize(0)
+        , SubmissionEntries(nullptr)
+        , SubmissionEntriesSize(0)
+        , SubmissionTail(nullptr)
+        , SubmissionArray(nullptr)
+        , SubmissionMask(0)
+        , CompletionHead(nullptr)
+        , CompletionTail(nullptr)
+        , CompletionEntries(nullptr)
+        , CompletionMask(0)
+        , BufferRing(nullptr)
+        , BufferRingSize(0)
+        , BufferRingTail(0)
+        , bReceiveArmed(false)
+    {
+        FMemory::Memzero(ReceiveTemplate);
+    }
+
+    virtual ~FIoUringTransport()
+    {
+        Close();
+    }
+
+    /** 소켓 생성 및 바인딩, 링 준비와 멀티샷 수신 제출 (커널이 지원하지 않으면 false) */
+    bool Open(const FIPv4Address& BindAddress, uint16 Port, bool bReusePort)
+    {
+        if (!OpenSocket(BindAddress, Port, bReusePort))
+        {
+            return false;
+        }
+
+        if (!SetupRing())
+        {
+            Close();
+            return false;
+        }
+
+        return true;
+    }
+
+    // INetworkTransport 인터페이스 구현
+    virtual const TCHAR* GetBackendName() const override { return TEXT("io_uring"); }
+
+    /** 리액터는 소켓 대신 완료 알림 eventfd를 감시 */
+    virtual int32 GetNativeHandle() const override { return EventFd; }
+
+    virtual bool WaitForRead(const FTimespan& Timeout) override
+    {
+        if (EventFd < 0)
+        {
+            return false;
+        }
+
+        if (HasCompletions())
+        {
+            return true;
+        }
+
+        pollfd PollFd;
+        PollFd.fd = EventFd;
+        PollFd.events = POLLIN;
+        PollFd.revents = 0;
+
+        return poll(&PollFd, 1, static_cast<int>(Timeout.GetTotalMilliseconds())) > 0;
+    }
+
+    virtual int32 ReceiveBatch(FReceivedDatagram* OutDatagrams, int32 MaxCount) override
+    {
+        if (RingFd < 0 || MaxCount <= 0)
+        {
+            return 0;
+        }
+
+        // 이전 호출에서 넘겨준 버퍼는 호출자가 모두 해제했으므로 링에 되돌림
+        RecycleBuffers();
+
+        int32 OutCount = ReapCompletions(OutDatagrams, MaxCount);
+
+        // 버퍼 부족 등으로 멀티샷 수신이 끝났으면 다시 제출 (소켓 큐에 남은 데이터그램은 유실되지 않고 제출 즉시 완료로 들어옴)
+        if (!bReceiveArmed && ArmReceive() && OutCount == 0)
+        {
+            OutCount = ReapCompletions(OutDatagrams, MaxCount);
+        }
+
+        if (OutCount == 0)
+        {
+            // 완료 큐가 비었으면 eventfd를 비워 리액터가 다시 잠들 수 있게 하고, 그 사이에 들어온 완료를 다시 확인
+            uint64 Counter = 0;
+            Stats.ReceiveSyscalls++;
+            if (read(EventFd, &Counter, sizeof(Counter)) > 0)
+            {
+                OutCount = ReapCompletions(OutDatagrams, MaxCount);
+            }
+        }
+
+        Stats.ReceivedDatagrams += OutCount;
+        return OutCount;
+    }
+
+    virtual void Close() override
+    {
+        // 링을 먼저 닫아 진행 중인 수신 요청을 취소
+        if (RingFd >= 0)
+        {
+            close(RingFd);
+            RingFd = -1;
+        }
+
+        if (EventFd >= 0)
+        {
+            close(EventFd);
+            EventFd = -1;
+        }
+
+        UnmapRegion(SubmissionEntries, SubmissionEntriesSize);
+        if (CompletionMemory != RingMemory)
+        {
+            UnmapRegion(CompletionMemory, CompletionMemorySize);
+        }
+        CompletionMemory = nullptr;
+        UnmapRegion(RingMemory, RingMemorySize);
+        UnmapRegion(BufferRing, BufferRingSize);
+
+        SubmissionTail = nullptr;
+        SubmissionArray = nullptr;
+        CompletionHead = nullptr;
+        CompletionTail = nullptr;
+        CompletionEntries = nullptr;
+        bReceiveArmed = false;
+
+        FLinuxSocketTransport::Close();
+
+        ProvidedBuffers.Empty();
+        RecycledBufferIds.Empty();
+    }
+
+private:
+    /** 제출 큐 크기 (수신 요청 재제출에만 사용) */
+    static constexpr uint32 SUBMISSION_ENTRIES = 8;
+
+    /** 완료 큐 크기 (수신 스레드가 늦어져도 넘치지 않도록 제공 버퍼 수보다 넉넉하게) */
+    static constexpr uint32 COMPLETION_ENTRIES = 1024;
+
+    /** 제공 버퍼 수 (2의 거듭제곱) - 모두 사용 중이면 멀티샷 수신이 끝나고 버퍼가 돌아온 뒤 다시 제출 */
+    static constexpr int32 PROVIDED_BUFFER_COUNT = 64;
+
+    /** 제공 버퍼 그룹 ID */
+    static constexpr uint16 BUFFER_GROUP_ID = 0;
+
+    /** 수신 요청 식별값 */
+    static constexpr uint64 RECEIVE_USER_DATA = 1;
+
+    /**
+     * 멀티샷 recvmsg가 제공 버퍼 앞쪽에 데이터그램보다 먼저 기록하는 최대 크기
+     * (io_uring_recvmsg_out + 발신자 주소 + 제어 메시지) - 제공 버퍼는 이만큼 더 커야 최대 크기 데이터그램이 잘리지 않음
+     */
+    static constexpr int32 RECEIVE_HEADER_CAPACITY = static_cast<int32>(sizeof(io_uring_recvmsg_out) + sizeof(sockaddr_in) + sizeof(FControlBuffer));
+
+    /** io_uring 시스템 콜 래퍼 */
+    static int SetupSyscall(uint32 Entries, io_uring_params* Params)
+    {
+        return static_cast<int>(syscall(__NR_io_uring_setup, Entries, Params));
+    }
+
+    static int EnterSyscall(int Fd, uint32 ToSubmit, uint32 MinComplete, uint32 Flags)
+    {
+        return static_cast<int>(syscall(__NR_io_uring_enter, Fd, ToSubmit, MinComplete, Flags, nullptr, 0));
+    }
+
+    static int RegisterSyscall(int Fd, uint32 Opcode, void* Arg, uint32 ArgCount)
+    {
+        return static_cast<int>(syscall(__NR_io_uring_register, Fd, Opcode, Arg, ArgCount));
+    }
+
+    static void* MapRing(size_t Size, int Fd, off_t Offset)
+    {
+        void* Memory = mmap(nullptr, Size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, Fd, Offset);
+        return Memory == MAP_FAILED ? nullptr : Memory;
+    }
+
+    template <typename PointerType>
+    static void UnmapRegion(PointerType*& Memory, size_t& Size)
+    {
+        if (Memory)
+        {
+            munmap(const_cast<void*>(static_cast<const void*>(Memory)), Size);
+            Memory = nullptr;
+            Size = 0;
+        }
+    }
+
+    /** 링 생성, 공유 메모리 매핑, 제공 버퍼 링과 eventfd 등록, 멀티샷 수신 제출 */
+    bool SetupRing()
+    {
+        io_uring_params Params;
+        FMemory::Memzero(Params);
+        Params.flags = IORING_SETUP_CQSIZE;
+        Params.cq_entries = COMPLETION_ENTRIES;
+
+        RingFd = SetupSyscall(SUBMISSION_ENTRIES, &Params);
+        if (RingFd < 0)
+        {
+            UE_LOG(LogMultiServerSync, Warning, TEXT("io_uring transport: io_uring_setup failed (errno %d)"), errno);
+            return false;
+        }
+
+        // 제출/완료 링 매핑 (SINGLE_MMAP 커널은 한 영역에 둘 다 있음)
+        const bool bSingleMap = (Params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+        RingMemorySize = Params.sq_off.array + Params.sq_entries * sizeof(uint32);
+        CompletionMemorySize = Params.cq_off.cqes + Params.cq_entries * sizeof(io_uring_cqe);
+        if (bSingleMap)
+        {
+            RingMemorySize = FMath::Max(RingMemorySize, CompletionMemorySize);
+        }
+
+        RingMemory = static_cast<uint8*>(MapRing(RingMemorySize, RingFd, IORING_OFF_SQ_RING));
+        CompletionMemory = bSingleMap ? RingMemory : static_cast<uint8*>(MapRing(CompletionMemorySize, RingFd, IORING_OFF_CQ_RING));
+        SubmissionEntriesSize = Params.sq_entries * sizeof(io_uring_sqe);
+        SubmissionEntries = static_cast<io_uring_sqe*>(MapRing(SubmissionEntriesSize, RingFd, IORING_OFF_SQES));
+        if (!RingMemory || !CompletionMemory || !SubmissionEntries)
+        {
+            UE_LOG(LogMultiServerSync, Warning, TEXT("io_uring transport: failed to map rings (errno %d)"), errno);
+            return false;
+        }
+
+        SubmissionTail = reinterpret_cast<uint32*>(RingMemory + Params.sq_off.tail);
+        SubmissionArray = reinterpret_cast<uint32*>(RingMemory + Params.sq_off.array);
+        SubmissionMask = *reinterpret_cast<const uint32*>(RingMemory + Params.sq_off.ring_mask);
+        CompletionHead = reinterpret_cast<uint32*>(CompletionMemory + Params.cq_off.head);
+        CompletionTail = reinterpret_cast<const uint32*>(CompletionMemory + Params.cq_off.tail);
+        CompletionEntries = reinterpret_cast<const io_uring_cqe*>(CompletionMemory + Params.cq_off.cqes);
+        CompletionMask = *reinterpret_cast<const uint32*>(CompletionMemory + Params.cq_off.ring_mask);
+
+        // 제공 버퍼 링 (커널 5.19 이상) - 링 메모리는 페이지 정렬이 필요하므로 익명 매핑 사용
+        BufferRingSize = FMath::Max<size_t>(PROVIDED_BUFFER_COUNT * sizeof(io_uring_buf), static_cast<size_t>(sysconf(_SC_PAGESIZE)));
+        void* BufferRingMemory = mmap(nullptr, BufferRingSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (BufferRingMemory == MAP_FAILED)
+        {
+            BufferRingSize = 0;
+            UE_LOG(LogMultiServerSync, Warning, TEXT("io_uring transport: failed to allocate buffer ring (errno %d)"), errno);
+            return false;
+        }
+        BufferRing = static_cast<io_uring_buf*>(BufferRingMemory);
+        FMemory::Memzero(BufferRing, BufferRingSize);
+
+        io_uring_buf_reg BufferRegistration;
+        FMemory::Memzero(BufferRegistration);
+        BufferRegistration.ring_addr = reinterpret_cast<uint64>(BufferRing);
+        BufferRegistration.ring_entries = PROVIDED_BUFFER_COUNT;
+        BufferRegistration.bgid = BUFFER_GROUP_ID;
+        if (RegisterSyscall(RingFd, IORING_REGISTER_PBUF_RING, &BufferRegistration, 1) != 0)
+        {
+            UE_LOG(LogMultiServerSync, Warning, TEXT("io_uring transport: provided buffer ring is not supported (errno %d)"), errno);
+            return false;
+        }
+
+        ProvidedBuffers.SetNum(PROVIDED_BUFFER_COUNT);
+        for (int32 BufferId = 0; BufferId < PROVIDED_BUFFER_COUNT; ++BufferId)
+        {
+            ProvidedBuffers[BufferId] = PacketPool.Acquire();
+            AddProvidedBuffer(static_cast<uint16>(BufferId));
+        }
+        PublishProvidedBuffers();
+
+        // 완료가 생길 때마다 신호되는 eventfd (리액터의 epoll이 감시)
+        EventFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+        if (EventFd < 0 || RegisterSyscall(RingFd, IORING_REGISTER_EVENTFD, &EventFd, 1) != 0)
+        {
+            UE_LOG(LogMultiServerSync, Warning, TEXT("io_uring transport: failed to register completion eventfd (errno %d)"), errno);
+            return false;
+        }
+
+        // 멀티샷 recvmsg는 발신자 주소와 제어 메시지 길이를 이 템플릿에서 읽고, 결과는 버퍼 앞쪽에 io_uring_recvmsg_out과 함께 기록
+        ReceiveTemplate.msg_namelen = sizeof(sockaddr_in);
+        ReceiveTemplate.msg_controllen = bKernelTimestamps ? sizeof(FControlBuffer) : 0;
+
+        if (!ArmReceive())
+        {
+            return false;
+        }
+
+        // 멀티샷 recvmsg를 모르는 커널(6.0 미만)은 제출 즉시 EINVAL로 완료하므로 여기서 확인하고 recvmmsg로 대체
+        if (HasCompletions())
+        {
+            const io_uring_cqe& Completion = CompletionEntries[*CompletionHead & CompletionMask];
+            if (Completion.res == -EINVAL)
+            {
+                UE_LOG(LogMultiServerSync, Warning, TEXT("io_uring transport: multishot recvmsg is not supported by this kernel"));
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    /** 멀티샷 recvmsg 제출 */
+    bool ArmReceive()
+    {
+        const uint32 Tail = *SubmissionTail;
+        const uint32 Index = Tail & SubmissionMask;
+
+        io_uring_sqe& Submission = SubmissionEntries[Index];
+        FMemory::Memzero(Submission);
+        Submission.opcode = IORING_OP_RECVMSG;
+        Submission.fd = SocketFd;
+        Submission.addr = reinterpret_cast<uint64>(&ReceiveTemplate);
+        Submission.len = 1;
+        Submission.ioprio = IORING_RECV_MULTISHOT;
+        Submission.flags = IOSQE_BUFFER_SELECT;
+        Submission.buf_group = BUFFER_GROUP_ID;
+        Submission.user_data = RECEIVE_USER_DATA;
+
+        SubmissionArray[Index] = Index;
+        __atomic_store_n(SubmissionTail, Tail + 1, __ATOMIC_RELEASE);
+
+        Stats.ReceiveSyscalls++;
+        bReceiveArmed = EnterSyscall(RingFd, 1, 0, 0) == 1;
+        if (!bReceiveArmed)
+        {
+            UE_LOG(LogMultiServerSync, Warning, TEXT("io_uring transport: failed to submit receive on port %d (errno %d)"), LocalPort, errno);
+        }
+
+        return bReceiveArmed;
+    }
+
+    /** 완료 큐에 처리할 항목이 있는지 여부 */
+    bool HasCompletions() const
+    {
+        return CompletionHead && *CompletionHead != __atomic_load_n(CompletionTail, __ATOMIC_ACQUIRE);
+    }
+
+    /** 완료 큐에서 최대 MaxCount개의 데이터그램을 꺼냄 */
+    int32 ReapCompletions(FReceivedDatagram* OutDatagrams, int32 MaxCount)
+    {
+        uint32 Head = *CompletionHead;
+        const uint32 Tail = __atomic_load_n(CompletionTail, __ATOMIC_ACQUIRE);
+        if (Head == Tail)
+        {
+            return 0;
+        }
+
+        // 커널 타임스탬프(CLOCK_REALTIME)를 Cycles64 기준으로 옮기기 위한 기준점 (배치마다 한 번)
+        const uint64 NowCycles = FPlatformTime::Cycles64();
+        timespec NowRealtime;
+        clock_gettime(CLOCK_REALTIME, &NowRealtime);
+        const int64 NowRealtimeNs = static_cast<int64>(NowRealtime.tv_sec) * 1000000000LL + NowRealtime.tv_nsec;
+
+        const int32 HeaderSize = static_cast<int32>(sizeof(io_uring_recvmsg_out) + ReceiveTemplate.msg_namelen + ReceiveTemplate.msg_controllen);
+
+        int32 OutCount = 0;
+        for (; Head != Tail && OutCount < MaxCount; ++Head)
+        {
+            const io_uring_cqe& Completion = CompletionEntries[Head & CompletionMask];
+            if (Completion.user_data != RECEIVE_USER_DATA)
+            {
+                continue;
+            }
+
+            // F_MORE가 없으면 멀티샷 수신이 끝난 것이므로 다시 제출해야 함
+            if (!(Completion.flags & IORING_CQE_F_MORE))
+            {
+                bReceiveArmed = false;
+            }
+
+            if (!(Completion.flags & IORING_CQE_F_BUFFER))
+            {
+                // 버퍼 없이 끝난 완료 (-ENOBUFS: 제공 버퍼가 모두 사용 중)
+                if (Completion.res < 0 && Completion.res != -ENOBUFS)
+                {
+                    UE_LOG(LogMultiServerSync, Warning, TEXT("io_uring transport: receive failed on port %d (error %d)"), LocalPort, -Completion.res);
+                }
+                continue;
+            }
+
+            const uint16 BufferId = static_cast<uint16>(Completion.flags >> IORING_CQE_BUFFER_SHIFT);
+            RecycledBufferIds.Add(BufferId);
+            if (Completion.res < HeaderSize || !ProvidedBuffers.IsValidIndex(BufferId))
+            {
+                continue;
+            }
+
+            FPacketBufferRef& Buffer = ProvidedBuffers[BufferId];
+            uint8* Base = Buffer->GetData();
+            const io_uring_recvmsg_out* Out = reinterpret_cast<const io_uring_recvmsg_out*>(Base);
+            if (Out->flags & MSG_TRUNC)
+            {
+                Stats.TruncatedDatagrams++;
+                UE_LOG(LogMultiServerSync, Warning, TEXT("io_uring transport: dropped truncated datagram (%llu total)"), Stats.TruncatedDatagrams);
+                continue;
+            }
+
+            const int32 PayloadSize = FMath::Min(static_cast<int32>(Out->payloadlen), Completion.res - HeaderSize);
+
+            sockaddr_in Addr;
+            FMemory::Memcpy(&Addr, Base + sizeof(io_uring_recvmsg_out), sizeof(Addr));
+            const FIPv4Endpoint Sender(FIPv4Address(ntohl(Addr.sin_addr.s_addr)), ntohs(Addr.sin_port));
+
+            // 제어 메시지 영역을 msghdr로 감싸 기반 클래스의 타임스탬프 해석을 그대로 사용
+            msghdr ControlHeader;
+            FMemory::Memzero(ControlHeader);
+            ControlHeader.msg_control = Base + sizeof(io_uring_recvmsg_out) + ReceiveTemplate.msg_namelen;
+            ControlHeader.msg_controllen = FMath::Min<size_t>(Out->controllen, ReceiveTemplate.msg_controllen);
+
+            Buffer->SetSize(HeaderSize + PayloadSize);
+            Buffer->SetSender(Sender);
+
+            // 복사 없이 제공 버퍼를 넘겨줌 (데이터는 버퍼 앞쪽의 수신 결과 헤더 다음부터)
+            FReceivedDatagram& Datagram = OutDatagrams[OutCount++];
+            Datagram.Data = Base + HeaderSize;
+            Datagram.Size = PayloadSize;
+            Datagram.Sender = Sender;
+            Datagram.Buffer = Buffer;
+            Datagram.ReceiveCycles = GetArrivalCycles(ControlHeader, NowCycles, NowRealtimeNs);
+        }
+
+        __atomic_store_n(CompletionHead, Head, __ATOMIC_RELEASE);
+        return OutCount;
+    }
+
+    /**
+     * 완료로 소비된 버퍼를 제공 버퍼 링에 되돌립니다.
+     * 호출자가 참조를 보관 중인 버퍼는 그대로 넘기고 그 자리를 풀의 새 버퍼로 채움
+     */
+    void RecycleBuffers()
+    {
+        if (RecycledBufferIds.Num() == 0)
+        {
+            return;
+        }
+
+        for (const uint16 BufferId : RecycledBufferIds)
+        {
+            FPacketBufferRef& Buffer = ProvidedBuffers[BufferId];
+            if (Buffer->GetRefCount() > 1)
+            {
+                Buffer = PacketPool.Acquire();
+            }
+            AddProvidedBuffer(BufferId);
+        }
+
+        RecycledBufferIds.Reset();
+        PublishProvidedBuffers();
+    }
+
+    /** 제공 버퍼 링에 버퍼 항목 추가 (PublishProvidedBuffers로 커널에 공개) */
+    void AddProvidedBuffer(uint16 BufferId)
+    {
+        // io_uring_buf_ring::bufs는 C++에서 빈 구조체 때문에 오프셋이 달라지므로 링 메모리를 항목 배열로 직접 접근
+        io_uring_buf& Entry = BufferRing[BufferRingTail & (PROVIDED_BUFFER_COUNT - 1)];
+        Entry.addr = reinterpret_cast<uint64>(ProvidedBuffers[BufferId]->GetData());
+        Entry.len = static_cast<uint32>(ProvidedBuffers[BufferId]->GetCapacity());
+        Entry.bid = BufferId;
+        BufferRingTail++;
+    }
+
+    /** 추가한 버퍼 항목을 커널에 공개 (링 꼬리는 첫 항목의 resv 필드 자리) */
+    void PublishProvidedBuffers()
+    {
+        __atomic_store_n(&reinterpret_cast<io_uring_buf_ring*>(BufferRing)->tail, BufferRingTail, __ATOMIC_RELEASE);
+    }
+
+    /** io_uring 디스크립터 */
+    int RingFd;
+
+    /** 완료 알림 eventfd */
+    int EventFd;
+
+    /** 제출 링 매핑 (SINGLE_MMAP이면 완료 링 포함) */
+    uint8* RingMemory;
+    size_t RingMemorySize;
+
+    /** 완료 링 매핑 (SINGLE_MMAP이면 RingMemory와 같음) */
+    uint8* CompletionMemory;
+    size_t CompletionMemorySize;
+
+    /** 제출 항목 배열 매핑 */
+    io_uring_sqe* SubmissionEntries;
+    size_t SubmissionEntriesSize;
+
+    /** 제출 링 포인터 */
+    uint32* SubmissionTail;
+    uint32* SubmissionArray;
+    uint32 SubmissionMask;
+
+    /** 완료 링 포인터 */
+    uint32* CompletionHead;
+    const uint32* CompletionTail;
+    const io_uring_cqe* CompletionEntries;
+    uint32 CompletionMask;
+
+    /** 제공 버퍼 링 (항목 배열) */
+    io_uring_buf* BufferRing;
+    size_t BufferRingSize;
+
+    /** 제공 버퍼 링 꼬리 (다음에 쓸 항목 위치) */
+    uint16 BufferRingTail;
+
+    /** 버퍼 ID별 제공 버퍼 */
+    TArray<FPacketBufferRef> ProvidedBuffers;
+
+    /** 다음 ReceiveBatch에서 링에 되돌릴 버퍼 ID */
+    TArray<uint16> RecycledBufferIds;
+
+    /** 멀티샷 recvmsg 템플릿 (발신자 주소와 제어 메시지 길이) */
+    msghdr ReceiveTemplate;
+
+    /** 멀티샷 수신이 제출되어 진행 중인지 여부 */
+    bool bReceiveArmed;
+};
+#endif // MSYNC_WITH_IO_URING
+#endif // PLATFORM_LINUX
+
+bool INetworkTransport::SupportsReusePort()
+{
+#if PLATFORM_LINUX
+    return true;
+#else
+    return false;
+#endif
+}
+
+TUniquePtr<INetworkTransport> INetworkTransport::Create(EReceiveBackend Backend, const FIPv4Address& BindAddress, uint16 Port, const FString& Description, bool bReusePort)
+{
+#if PLATFORM_LINUX
+#if MSYNC_WITH_IO_URING
+    if (Backend == EReceiveBackend::IoUring)
+    {
+        TUniquePtr<FIoUringTransport> RingTransport = MakeUnique<FIoUringTransport>();
+        if (RingTransport->Open(BindAddress, Port, bReusePort))
+        {
+            UE_LOG(LogMultiServerSync, Display, TEXT("%s: using %s transport on port %d%s"), *Description,
+                RingTransport->GetBackendName(), RingTransport->GetLocalPort(), bReusePort ? TEXT(" (SO_REUSEPORT)") : TEXT(""));
+            return RingTransport;
+        }
+
+        UE_LOG(LogMultiServerSync, Warning, TEXT("%s: io_uring transport unavailable, falling back to recvmmsg"), *Description);
+    }
+#else
+    if (Backend == EReceiveBackend::IoUring)
+    {
+        UE_LOG(LogMultiServerSync, Display, TEXT("%s: built without io_uring support, using recvmmsg"), *Description);
+    }
+#endif
+
+    {
+        const int32 BatchSize = Backend != EReceiveBackend::SingleRead ? MAX_RECEIVE_BATCH : 1;
+        TUniquePtr<FLinuxSocketTransport> NativeTransport = MakeUnique<FLinuxSocketTransport>(BatchSize);
+        if (NativeTransport->Open(BindAddress, Port, bReusePort))
+        {
+            UE_LOG(LogMultiServerSync, Display, TEXT("%s: using %s transport on port %d%s"), *Description,
+                NativeTransport->GetBackendName(), NativeTransport->GetLocalPort(), bReusePort ? TEXT(" (SO_REUSEPORT)") : TEXT(""));
+            return NativeTransport;
+        }
+
+        // SO_REUSEPORT 그룹에 FSocket(SO_REUSEADDR만 설정)을 섞으면 분배가 깨지므로 대체하지 않음
+        if (bReusePort)
+        {
+            UE_LOG(LogMultiServerSync, Error, TEXT("%s: failed to open SO_REUSEPORT socket on port %d"), *Description, Port);
+            return nullptr;
+        }
+
+        UE_LOG(LogMultiServerSync, Warning, TEXT("%s: native transport unavailable, falling back to FSocket"), *Description);
+    }
+#else
+    if (bReusePort)
+    {
+        UE_LOG(LogMultiServerSync, Error, TEXT("%s: SO_REUSEPORT is not supported on this platform"), *Description);
+        return nullptr;
+    }
+
+    if (Backend != EReceiveBackend::SingleRead)
+    {
+        UE_LOG(LogMultiServerSync, Display, TEXT("%s: %s is not supported on this platform, using FSocket"), *Description,
+            Backend == EReceiveBackend::IoUring ? TEXT("io_uring") : TEXT("recvmmsg"));
+    }
+#endif
+
+    FSocket* Socket = FUdpSocketBuilder(Description)
+        .AsNonBlocking()
+        .AsReusable()
+        .WithBroadcast()
+        .BoundToAddress(BindAddress)
+        .BoundToPort(Port)
+        .WithReceiveBufferSize(MAX_DATAGRAM_SIZE)
+        .Build();
+
+    if (!Socket)
+    {
+        UE_LOG(LogMultiServerSync, Error, TEXT("%s: failed to create socket on port %d"), *Description, Port);
+        return nullptr;
+    }
+
+    return MakeUnique<FSocketTransport>(Socket, true);
+}
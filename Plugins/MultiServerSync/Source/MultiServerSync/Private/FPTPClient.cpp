@@ -3,8 +3,7 @@
 #include "Misc/DateTime.h"
 #include "FSyncLog.h"
 #include "HAL/PlatformTime.h"
-#include "Serialization/MemoryWriter.h"
-#include "Serialization/MemoryReader.h"
+#include "FMessageSchema.h"
 
 // PTP 메시지 구조체 정의
 #pragma pack(push, 1)
@@ -50,6 +49,31 @@ struct FPTPDelayRespMessage {
 };
 #pragma pack(pop)
 
+// Follow-Up 본문 (헤더 뒤의 정확한 오리진 타임스탬프)
+struct FPTPFollowUpBody {
+    uint32 Seconds;
+    uint32 NanoSeconds;
+
+    using FSchema = TMessageSchema<FPTPFollowUpBody,
+        MSYNC_SCHEMA_FIELD(FPTPFollowUpBody, Seconds),
+        MSYNC_SCHEMA_FIELD(FPTPFollowUpBody, NanoSeconds)>;
+};
+
+// DelayResp 본문 (헤더 뒤의 수신 타임스탬프와 요청 포트 ID)
+struct FPTPDelayRespBody {
+    uint32 Seconds;
+    uint32 NanoSeconds;
+    uint8 RequestingPortIdentity[10];
+
+    using FSchema = TMessageSchema<FPTPDelayRespBody,
+        MSYNC_SCHEMA_FIELD(FPTPDelayRespBody, Seconds),
+        MSYNC_SCHEMA_FIELD(FPTPDelayRespBody, NanoSeconds),
+        MSYNC_SCHEMA_FIELD(FPTPDelayRespBody, RequestingPortIdentity)>;
+};
+
+static_assert(FPTPFollowUpBody::FSchema::EncodedSize == sizeof(FPTPFollowUpMessage) - sizeof(FPTPMessageHeader), "Follow-Up body schema does not match the message layout");
+static_assert(FPTPDelayRespBody::FSchema::EncodedSize == sizeof(FPTPDelayRespMessage) - sizeof(FPTPMessageHeader), "DelayResp body schema does not match the message layout");
+
 FPTPClient::FPTPClient()
     : bIsMaster(false)
     , bIsInitialized(false)
@@ -151,16 +175,13 @@ void FPTPClient::SendFollowUpMessage(int64 OriginTimestampMicros)
     // Follow-Up 메시지 생성
     TArray<uint8> FollowUpMessage = CreatePTPMessage(EPTPMessageType::FollowUp);
 
-    // 메시지 데이터에 정확한 타임스탬프 추가
-    FMemoryWriter Writer(FollowUpMessage);
-    Writer.Seek(sizeof(FPTPMessageHeader)); // 헤더 이후 위치로 이동
-
     // 마이크로초를 초 및 나노초로 변환
-    uint32 Seconds = static_cast<uint32>(OriginTimestampMicros / 1000000);
-    uint32 NanoSeconds = static_cast<uint32>((OriginTimestampMicros % 1000000) * 1000);
+    FPTPFollowUpBody Body;
+    Body.Seconds = static_cast<uint32>(OriginTimestampMicros / 1000000);
+    Body.NanoSeconds = static_cast<uint32>((OriginTimestampMicros % 1000000) * 1000);
 
-    Writer << Seconds;
-    Writer << NanoSeconds;
+    // 헤더 뒤에 정확한 타임스탬프 기록 (CreatePTPMessage가 본문 크기만큼 공간을 확보)
+    FPTPFollowUpBody::FSchema::EncodeTo(FollowUpMessage.GetData() + sizeof(FPTPMessageHeader), Body);
 
     UE_LOG(LogMultiServerSync, Verbose, TEXT("Sending Follow-Up message, sequence: %d, precise timestamp: %lld"),
         SyncSequenceNumber - 1, OriginTimestampMicros);
@@ -199,21 +220,17 @@ void FPTPClient::SendDelayRespMessage(int64 RequestReceivedTimestamp, uint16 Seq
     // DelayResp 메시지 생성
     TArray<uint8> DelayRespMessage = CreatePTPMessage(EPTPMessageType::DelayResp);
 
-    // 메시지 데이터에 수신 타임스탬프 추가
-    FMemoryWriter Writer(DelayRespMessage);
-    Writer.Seek(sizeof(FPTPMessageHeader)); // 헤더 이후 위치로 이동
-
     // 마이크로초를 초 및 나노초로 변환
-    uint32 Seconds = static_cast<uint32>(RequestReceivedTimestamp / 1000000);
-    uint32 NanoSeconds = static_cast<uint32>((RequestReceivedTimestamp % 1000000) * 1000);
+    FPTPDelayRespBody Body;
+    Body.Seconds = static_cast<uint32>(RequestReceivedTimestamp / 1000000);
+    Body.NanoSeconds = static_cast<uint32>((RequestReceivedTimestamp % 1000000) * 1000);
 
-    Writer << Seconds;
-    Writer << NanoSeconds;
+    // 요청 포트 식별자 (간소화: 시퀀스 ID만 사용)
+    FMemory::Memzero(Body.RequestingPortIdentity, sizeof(Body.RequestingPortIdentity));
+    FMemory::Memcpy(Body.RequestingPortIdentity, &SequenceId, sizeof(uint16));
 
-    // 요청 포트 식별자 추가 (간소화: 시퀀스 ID만 사용)
-    uint8 RequestingPortId[10] = { 0 };
-    FMemory::Memcpy(RequestingPortId, &SequenceId, sizeof(uint16));
-    Writer.Serialize(RequestingPortId, 10);
+    // 헤더 뒤에 수신 타임스탬프와 요청 포트 ID 기록
+    FPTPDelayRespBody::FSchema::EncodeTo(DelayRespMessage.GetData() + sizeof(FPTPMessageHeader), Body);
 
     UE_LOG(LogMultiServerSync, Verbose, TEXT("Sending Delay Response message, request received at: %lld"),
         RequestReceivedTimestamp);
@@ -222,24 +239,27 @@ void FPTPClient::SendDelayRespMessage(int64 RequestReceivedTimestamp, uint16 Seq
     // NetworkManager->BroadcastMessage(DelayRespMessage);
 }
 
-void FPTPClient::ProcessMessage(const TArray<uint8>& Message)
+void FPTPClient::ProcessMessage(const TArray<uint8>& Message, int64 ReceiveAgeMicroseconds)
 {
     if (!bIsInitialized || Message.Num() < sizeof(FPTPMessageHeader))
     {
         return;
     }
 
+    // 처리 시각에서 소켓 도착 후 지난 시간을 빼 도착 시각을 구함 (수신 스레드/인박스 대기 시간 제거)
+    const int64 ArrivalTime = GetTimestampMicroseconds() - FMath::Max<int64>(ReceiveAgeMicroseconds, 0);
+
     EPTPMessageType Type = ParsePTPMessageType(Message);
     switch (Type)
     {
     case EPTPMessageType::Sync:
-        ProcessSyncMessage(Message);
+        ProcessSyncMessage(Message, ArrivalTime);
         break;
     case EPTPMessageType::FollowUp:
         ProcessFollowUpMessage(Message);
         break;
     case EPTPMessageType::DelayReq:
-        ProcessDelayReqMessage(Message);
+        ProcessDelayReqMessage(Message, ArrivalTime);
         break;
     case EPTPMessageType::DelayResp:
         ProcessDelayRespMessage(Message);
@@ -312,15 +332,15 @@ FPTPClient::EPTPMessageType FPTPClient::ParsePTPMessageType(const TArray<uint8>&
     }
 }
 
-void FPTPClient::ProcessSyncMessage(const TArray<uint8>& Message)
+void FPTPClient::ProcessSyncMessage(const TArray<uint8>& Message, int64 ArrivalTime)
 {
     if (bIsMaster)
     {
         return; // 마스터는 Sync 메시지를 처리하지 않음
     }
 
-    // T2 타임스탬프 저장 (Sync 메시지 수신 시간)
-    T2 = GetTimestampMicroseconds();
+    // T2 타임스탬프 저장 (Sync 메시지 도착 시간)
+    T2 = ArrivalTime;
 
     // 메시지 시퀀스 ID 추출
     FPTPMessageHeader Header;
@@ -345,23 +365,18 @@ void FPTPClient::ProcessFollowUpMessage(const TArray<uint8>& Message)
     }
 
     // 메시지가 충분히 큰지 확인
-    if (Message.Num() < sizeof(FPTPMessageHeader) + sizeof(FPTPTimestamp))
+    if (Message.Num() < sizeof(FPTPMessageHeader) + FPTPFollowUpBody::FSchema::EncodedSize)
     {
         UE_LOG(LogMultiServerSync, Warning, TEXT("Follow-Up message too small"));
         return;
     }
 
     // 정확한 오리진 타임스탬프(T1) 추출
-    FMemoryReader Reader(Message);
-    Reader.Seek(sizeof(FPTPMessageHeader));
-
-    uint32 Seconds;
-    uint32 NanoSeconds;
-    Reader << Seconds;
-    Reader << NanoSeconds;
+    FPTPFollowUpBody Body;
+    FPTPFollowUpBody::FSchema::DecodeFrom(Message.GetData() + sizeof(FPTPMessageHeader), Body);
 
     // T1 (마스터의 Sync 전송 시간)
-    int64 PreciseT1 = (static_cast<int64>(Seconds) * 1000000) + (NanoSeconds / 1000);
+    int64 PreciseT1 = (static_cast<int64>(Body.Seconds) * 1000000) + (Body.NanoSeconds / 1000);
 
     UE_LOG(LogMultiServerSync, Verbose, TEXT("Received Follow-Up message, precise T1: %lld, T2: %lld"),
         PreciseT1, T2);
@@ -391,15 +406,15 @@ void FPTPClient::ProcessFollowUpMessage(const TArray<uint8>& Message)
     }
 }
 
-void FPTPClient::ProcessDelayReqMessage(const TArray<uint8>& Message)
+void FPTPClient::ProcessDelayReqMessage(const TArray<uint8>& Message, int64 ArrivalTime)
 {
     if (!bIsMaster)
     {
         return; // 슬레이브는 DelayReq 메시지를 처리하지 않음
     }
 
-    // T4 타임스탬프 저장 (DelayReq 메시지 수신 시간)
-    int64 ReceivedTime = GetTimestampMicroseconds();
+    // T4 타임스탬프 저장 (DelayReq 메시지 도착 시간)
+    int64 ReceivedTime = ArrivalTime;
 
     // 메시지 시퀀스 ID 추출
     FPTPMessageHeader Header;
@@ -420,27 +435,18 @@ void FPTPClient::ProcessDelayRespMessage(const TArray<uint8>& Message)
     }
 
     // 메시지가 충분히 큰지 확인
-    if (Message.Num() < sizeof(FPTPMessageHeader) + sizeof(FPTPTimestamp) + 10)
+    if (Message.Num() < sizeof(FPTPMessageHeader) + FPTPDelayRespBody::FSchema::EncodedSize)
     {
         UE_LOG(LogMultiServerSync, Warning, TEXT("DelayResp message too small"));
         return;
     }
 
-    // T4 타임스탬프 추출 (DelayReq 메시지 수신 시간)
-    FMemoryReader Reader(Message);
-    Reader.Seek(sizeof(FPTPMessageHeader));
-
-    uint32 Seconds;
-    uint32 NanoSeconds;
-    Reader << Seconds;
-    Reader << NanoSeconds;
+    // T4 타임스탬프 추출 (DelayReq 메시지 수신 시간, 요청 포트 식별자 확인은 간소화로 생략)
+    FPTPDelayRespBody Body;
+    FPTPDelayRespBody::FSchema::DecodeFrom(Message.GetData() + sizeof(FPTPMessageHeader), Body);
 
     // T4 (마스터의 DelayReq 수신 시간)
-    int64 MasterReceivedTime = (static_cast<int64>(Seconds) * 1000000) + (NanoSeconds / 1000);
-
-    // 요청 포트 식별자 확인 (간소화: 패스)
-    uint8 RequestingPortId[10];
-    Reader.Serialize(RequestingPortId, 10);
+    int64 MasterReceivedTime = (static_cast<int64>(Body.Seconds) * 1000000) + (Body.NanoSeconds / 1000);
 
     UE_LOG(LogMultiServerSync, Verbose, TEXT("Received Delay Response message, T3: %lld, T4: %lld"),
         T3, MasterReceivedTime);
@@ -0,0 +1,91 @@
+﻿// FPacketBuffer.cpp
+#include "FPacketBuffer.h"
+#include "FSyncLog.h"
+
+// FPacketBuffer 구현
+FPacketBuffer::FPacketBuffer(FPacketBufferPool* InPool, int32 InCapacity)
+    : Size(0)
+    , Pool(InPool)
+{
+    Storage.SetNumUninitialized(InCapacity);
+}
+
+uint32 FPacketBuffer::AddRef() const
+{
+    return static_cast<uint32>(RefCount.Increment());
+}
+
+uint32 FPacketBuffer::Release() const
+{
+    const int32 NewCount = RefCount.Decrement();
+    if (NewCount == 0)
+    {
+        // 마지막 참조 해제 - 해제하지 않고 풀로 반환
+        Pool->ReturnToPool(const_cast<FPacketBuffer*>(this));
+    }
+
+    return static_cast<uint32>(NewCount);
+}
+
+// FPacketBufferPool 구현
+FPacketBufferPool::FPacketBufferPool(int32 InBufferCapacity, int32 InMaxPooledBuffers)
+    : BufferCapacity(InBufferCapacity)
+    , MaxPooledBuffers(InMaxPooledBuffers)
+{
+    // 반환 경로에서 배열이 커지지 않도록 미리 예약
+    FreeBuffers.Reserve(MaxPooledBuffers);
+}
+
+FPacketBufferPool::~FPacketBufferPool()
+{
+    FScopeLock ScopeLock(&Lock);
+
+    for (FPacketBuffer* Buffer : FreeBuffers)
+    {
+        delete Buffer;
+    }
+    FreeBuffers.Empty();
+}
+
+FPacketBufferRef FPacketBufferPool::Acquire()
+{
+    FPacketBuffer* Buffer = nullptr;
+
+    {
+        FScopeLock ScopeLock(&Lock);
+        if (FreeBuffers.Num() > 0)
+        {
+            Buffer = FreeBuffers.Pop(EAllowShrinking::No);
+        }
+    }
+
+    if (!Buffer)
+    {
+        Buffer = new FPacketBuffer(this, BufferCapacity);
+        AllocationCount.Increment();
+    }
+
+    Buffer->Size = 0;
+    return FPacketBufferRef(Buffer);
+}
+
+int32 FPacketBufferPool::GetFreeCount() const
+{
+    FScopeLock ScopeLock(&Lock);
+    return FreeBuffers.Num();
+}
+
+void FPacketBufferPool::ReturnToPool(FPacketBuffer* Buffer)
+{
+    {
+        FScopeLock ScopeLock(&Lock);
+        if (FreeBuffers.Num() < MaxPooledBuffers)
+        {
+            FreeBuffers.Add(Buffer);
+            return;
+        }
+    }
+
+    // 풀이 가득 찬 경우에만 해제
+    delete Buffer;
+}
@@ -0,0 +1,179 @@
+﻿// FPeerRegistry.cpp
+#include "FPeerRegistry.h"
+
+FPeerRegistry::FPeerRegistry()
+    : LastLookupKey(MAX_uint64)
+    , LastLookupPeer(INVALID_PEER_ID)
+{
+}
+
+FPeerId FPeerRegistry::FindOrAdd(const FIPv4Endpoint& Endpoint)
+{
+    const FPeerId ExistingPeer = Find(Endpoint);
+    if (ExistingPeer != INVALID_PEER_ID)
+    {
+        return ExistingPeer;
+    }
+
+    // 제거된 인덱스를 먼저 재사용하여 배열을 조밀하게 유지
+    FPeerId PeerId = INVALID_PEER_ID;
+    if (FreePeerIds.Num() > 0)
+    {
+        PeerId = FreePeerIds.Pop(EAllowShrinking::No);
+    }
+    else if (Flags.Num() < MAX_PEERS)
+    {
+        PeerId = static_cast<FPeerId>(Flags.Num());
+        Flags.Add(0);
+        Endpoints.AddDefaulted();
+        DisplayIds.AddDefaulted();
+        LastSeenTimes.Add(0.0);
+        LatencyStats.AddDefaulted();
+        for (TArray<FMessageSequenceTracker>& ChannelTrackers : SequenceTrackers)
+        {
+            ChannelTrackers.AddDefaulted();
+        }
+        LastReliableSequences.Add(0);
+        PendingAckSequences.AddDefaulted();
+        CongestionControllers.AddDefaulted();
+        UnsentAcks.AddDefaulted();
+    }
+    else
+    {
+        return INVALID_PEER_ID;
+    }
+
+    const uint64 Key = MakeKey(Endpoint);
+    Flags[PeerId] = PEER_FLAG_IN_USE;
+    Endpoints[PeerId] = Endpoint;
+    DisplayIds[PeerId] = Endpoint.ToString(); // 등록 시 한 번만 생성
+    LastSeenTimes[PeerId] = 0.0;
+    KeyToPeer.Add(Key, PeerId);
+
+    LastLookupKey = Key;
+    LastLookupPeer = PeerId;
+    return PeerId;
+}
+
+FPeerId FPeerRegistry::Find(const FIPv4Endpoint& Endpoint) const
+{
+    const uint64 Key = MakeKey(Endpoint);
+    if (Key == LastLookupKey)
+    {
+        return LastLookupPeer;
+    }
+
+    const FPeerId* FoundPeer = KeyToPeer.Find(Key);
+    if (!FoundPeer)
+    {
+        return INVALID_PEER_ID;
+    }
+
+    LastLookupKey = Key;
+    LastLookupPeer = *FoundPeer;
+    return *FoundPeer;
+}
+
+void FPeerRegistry::Remove(FPeerId PeerId)
+{
+    if (!IsValid(PeerId))
+    {
+        return;
+    }
+
+    const uint64 Key = MakeKey(Endpoints[PeerId]);
+    KeyToPeer.Remove(Key);
+    if (LastLookupKey == Key)
+    {
+        LastLookupKey = MAX_uint64;
+        LastLookupPeer = INVALID_PEER_ID;
+    }
+
+    // 다음 피어가 이전 상태를 물려받지 않도록 초기화
+    Flags[PeerId] = 0;
+    DisplayIds[PeerId].Empty();
+    LatencyStats[PeerId] = FNetworkLatencyStats();
+    for (TArray<FMessageSequenceTracker>& ChannelTrackers : SequenceTrackers)
+    {
+        ChannelTrackers[PeerId] = FMessageSequenceTracker();
+    }
+    LastReliableSequences[PeerId] = 0;
+    PendingAckSequences[PeerId].Reset();
+    CongestionControllers[PeerId] = FCongestionController();
+    UnsentAcks[PeerId].Reset();
+
+    FreePeerIds.Add(PeerId);
+}
+
+void FPeerRegistry::Reset()
+{
+    KeyToPeer.Empty();
+    FreePeerIds.Empty();
+    AddressProtocolVersions.Empty();
+    Flags.Empty();
+    Endpoints.Empty();
+    DisplayIds.Empty();
+    LastSeenTimes.Empty();
+    LatencyStats.Empty();
+    for (TArray<FMessageSequenceTracker>& ChannelTrackers : SequenceTrackers)
+    {
+        ChannelTrackers.Empty();
+    }
+    LastReliableSequences.Empty();
+    PendingAckSequences.Empty();
+    CongestionControllers.Empty();
+    UnsentAcks.Empty();
+
+    LastLookupKey = MAX_uint64;
+    LastLookupPeer = INVALID_PEER_ID;
+}
+
+void FPeerRegistry::SetServerId(FPeerId PeerId, const FString& ServerId)
+{
+    if (!IsValid(PeerId))
+    {
+        return;
+    }
+
+    DisplayIds[PeerId] = ServerId.IsEmpty() ? Endpoints[PeerId].ToString() : ServerId;
+}
+
+FNetworkLatencyStats* FPeerRegistry::FindLatencyStats(FPeerId PeerId)
+{
+    return IsValid(PeerId) && (Flags[PeerId] & PEER_FLAG_HAS_LATENCY_STATS) ? &LatencyStats[PeerId] : nullptr;
+}
+
+const FNetworkLatencyStats* FPeerRegistry::FindLatencyStats(FPeerId PeerId) const
+{
+    return IsValid(PeerId) && (Flags[PeerId] & PEER_FLAG_HAS_LATENCY_STATS) ? &LatencyStats[PeerId] : nullptr;
+}
+
+FNetworkLatencyStats& FPeerRegistry::FindOrAddLatencyStats(FPeerId PeerId)
+{
+    check(IsValid(PeerId));
+    Flags[PeerId] |= PEER_FLAG_HAS_LATENCY_STATS;
+    return LatencyStats[PeerId];
+}
+
+FMessageSequenceTracker* FPeerRegistry::FindSequenceTracker(FPeerId PeerId, ESequenceChannel Channel)
+{
+    return IsValid(PeerId) && (Flags[PeerId] & GetSequenceTrackerFlag(Channel)) ? &SequenceTrackers[static_cast<int32>(Channel)][PeerId] : nullptr;
+}
+
+const FMessageSequenceTracker* FPeerRegistry::FindSequenceTracker(FPeerId PeerId, ESequenceChannel Channel) const
+{
+    return IsValid(PeerId) && (Flags[PeerId] & GetSequenceTrackerFlag(Channel)) ? &SequenceTrackers[static_cast<int32>(Channel)][PeerId] : nullptr;
+}
+
+FMessageSequenceTracker& FPeerRegistry::FindOrAddSequenceTracker(FPeerId PeerId, ESequenceChannel Channel, bool bOrderGuaranteed)
+{
+    check(IsValid(PeerId));
+    FMessageSequenceTracker& Tracker = SequenceTrackers[static_cast<int32>(Channel)][PeerId];
+    if (!(Flags[PeerId] & GetSequenceTrackerFlag(Channel)))
+    {
+        Flags[PeerId] |= GetSequenceTrackerFlag(Channel);
+        Tracker = FMessageSequenceTracker();
+        Tracker.bOrderGuaranteed = bOrderGuaranteed;
+    }
+    return Tracker;
+}
@@ -20,6 +20,9 @@ FProjectSettings::FProjectSettings()
     , NetworkPort(7000)
     , bEnableBroadcast(true)
     , PreferredNetworkInterface(TEXT("Default"))
+    , ReceiverThreadProfile(EReceiverThreadProfile::Standard)
+    , ReceiverCpuCore(INDEX_NONE)
+    , ReceiveInboxCapacity(0)
 {
 }
 
@@ -43,6 +46,12 @@ void FProjectSettings::Serialize(FArchive& Ar)
     Ar << NetworkPort;
     Ar << bEnableBroadcast;
     Ar << PreferredNetworkInterface;
+
+    uint8 ProfileValue = static_cast<uint8>(ReceiverThreadProfile);
+    Ar << ProfileValue;
+    ReceiverThreadProfile = static_cast<EReceiverThreadProfile>(ProfileValue);
+    Ar << ReceiverCpuCore;
+    Ar << ReceiveInboxCapacity;
 }
 
 void FProjectSettings::Serialize(FStructuredArchive::FRecord Record)
@@ -65,6 +74,12 @@ void FProjectSettings::Serialize(FStructuredArchive::FRecord Record)
     Record << SA_VALUE(TEXT("NetworkPort"), NetworkPort);
     Record << SA_VALUE(TEXT("EnableBroadcast"), bEnableBroadcast);
     Record << SA_VALUE(TEXT("PreferredNetworkInterface"), PreferredNetworkInterface);
+
+    uint8 ProfileValue = static_cast<uint8>(ReceiverThreadProfile);
+    Record << SA_VALUE(TEXT("ReceiverThreadProfile"), ProfileValue);
+    ReceiverThreadProfile = static_cast<EReceiverThreadProfile>(ProfileValue);
+    Record << SA_VALUE(TEXT("ReceiverCpuCore"), ReceiverCpuCore);
+    Record << SA_VALUE(TEXT("ReceiveInboxCapacity"), ReceiveInboxCapacity);
 }
 
 TArray<uint8> FProjectSettings::ToBytes() const
@@ -107,7 +122,10 @@ bool FProjectSettings::operator==(const FProjectSettings& Other) const
         && MaxFrameDelayTolerance == Other.MaxFrameDelayTolerance
         && NetworkPort == Other.NetworkPort
         && bEnableBroadcast == Other.bEnableBroadcast
-        && PreferredNetworkInterface == Other.PreferredNetworkInterface;
+        && PreferredNetworkInterface == Other.PreferredNetworkInterface
+        && ReceiverThreadProfile == Other.ReceiverThreadProfile
+        && ReceiverCpuCore == Other.ReceiverCpuCore
+        && ReceiveInboxCapacity == Other.ReceiveInboxCapacity;
 }
 
 bool FProjectSettings::operator!=(const FProjectSettings& Other) const
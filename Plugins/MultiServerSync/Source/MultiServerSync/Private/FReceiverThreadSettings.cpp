@@ -0,0 +1,18 @@
+﻿// FReceiverThreadSettings.cpp
+#include "FReceiverThreadSettings.h"
+
+FReceiverThreadSettings FReceiverThreadSettings::FromProfile(EReceiverThreadProfile Profile, int32 InCpuCore)
+{
+    FReceiverThreadSettings Settings;
+
+    if (Profile == EReceiverThreadProfile::LowLatency)
+    {
+        // PTP Sync 다음의 Follow_Up처럼 연달아 오는 메시지를 블로킹 없이 받을 수 있는 정도만 스핀
+        Settings.BusyPollMicroseconds = 50;
+        Settings.SpinMicroseconds = 200;
+        Settings.CpuCore = InCpuCore;
+        Settings.RealtimePriority = 50;
+    }
+
+    return Settings;
+}
@@ -0,0 +1,161 @@
+﻿// FSelectiveAck.cpp
+#include "FSelectiveAck.h"
+
+void FSelectiveAck::Build(TArray<uint16>& Sequences)
+{
+    Blocks.Reset();
+    bHasCumulativeAck = false;
+    if (Sequences.Num() == 0)
+    {
+        return;
+    }
+
+    // uint16 순환 순서로 정렬 (차이를 부호 있는 값으로 비교)
+    Sequences.Sort([](uint16 A, uint16 B) { return static_cast<int16>(A - B) < 0; });
+
+    FSackBlock* Current = nullptr;
+    for (const uint16 Sequence : Sequences)
+    {
+        if (Current)
+        {
+            const uint16 Offset = static_cast<uint16>(Sequence - Current->BaseSequence);
+            if (Offset == 0)
+            {
+                continue;
+            }
+
+            if (Offset <= BITMAP_BITS)
+            {
+                Current->Bitmap |= uint64(1) << (Offset - 1);
+                continue;
+            }
+        }
+
+        Current = &Blocks.AddDefaulted_GetRef();
+        Current->BaseSequence = Sequence;
+        Current->Bitmap = 0;
+    }
+}
+
+void FSelectiveAck::SetCumulativeAck(uint16 Sequence)
+{
+    FSackBlock Point;
+    Point.BaseSequence = Sequence;
+    Point.Bitmap = 0;
+
+    // 지점 비트맵에 들어가지 않는 번호만 남겨 다시 블록으로 구성 (지점 앞의 번호는 이전 빌드를 위해 남김)
+    TArray<uint16> Remaining;
+    ForEachSequence([Sequence, &Point, &Remaining](uint16 Received)
+        {
+            const int16 Offset = static_cast<int16>(Received - Sequence);
+            if (Offset > 0 && Offset <= BITMAP_BITS)
+            {
+                Point.Bitmap |= uint64(1) << (Offset - 1);
+            }
+            else if (Offset != 0)
+            {
+                Remaining.Add(Received);
+            }
+        });
+
+    Build(Remaining);
+    Blocks.Insert(Point, 0);
+    CumulativeSequence = Sequence;
+    bHasCumulativeAck = true;
+}
+
+bool FSelectiveAck::Contains(uint16 Sequence) const
+{
+    if (IsCumulativelyAcked(Sequence))
+    {
+        return true;
+    }
+
+    for (const FSackBlock& Block : Blocks)
+    {
+        if (Block.Contains(Sequence))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+int32 FSelectiveAck::GetSequenceCount() const
+{
+    int32 Count = 0;
+    for (const FSackBlock& Block : Blocks)
+    {
+        Count += 1 + FMath::CountBits(Block.Bitmap);
+    }
+    return Count;
+}
+
+TArray<uint8> FSelectiveAck::Serialize(int32 FirstBlock, int32 Count) const
+{
+    Count = FMath::Clamp(Count, 0, Blocks.Num() - FirstBlock);
+
+    TArray<uint8> Result;
+    Result.SetNumUninitialized(Count * BLOCK_SIZE);
+    FMemory::Memcpy(Result.GetData(), Blocks.GetData() + FirstBlock, Count * BLOCK_SIZE);
+    return Result;
+}
+
+void FSelectiveAck::AppendTrailer(TArray<uint8>& Payload, int32 FirstBlock, int32 Count) const
+{
+    Count = FMath::Clamp(Count, 0, FMath::Min(Blocks.Num() - FirstBlock, static_cast<int32>(MAX_uint8)));
+
+    const int32 Offset = Payload.Num();
+    Payload.AddUninitialized(GetTrailerSize(Count));
+    FMemory::Memcpy(Payload.GetData() + Offset, Blocks.GetData() + FirstBlock, Count * BLOCK_SIZE);
+    Payload.Last() = static_cast<uint8>(Count);
+}
+
+bool FSelectiveAck::ReadTrailer(TArrayView<const uint8> Payload, int32& OutPayloadSize, bool bCumulative)
+{
+    Blocks.Reset();
+    bHasCumulativeAck = false;
+    if (Payload.Num() == 0)
+    {
+        return false;
+    }
+
+    const int32 Count = Payload.Last();
+    OutPayloadSize = Payload.Num() - GetTrailerSize(Count);
+    if (Count == 0 || OutPayloadSize < 0)
+    {
+        return false;
+    }
+
+    Blocks.SetNumUninitialized(Count);
+    FMemory::Memcpy(Blocks.GetData(), Payload.GetData() + OutPayloadSize, Count * BLOCK_SIZE);
+    CumulativeSequence = Blocks[0].BaseSequence;
+    bHasCumulativeAck = bCumulative;
+    return true;
+}
+
+bool FSelectiveAck::Deserialize(TArrayView<const uint8> Bytes, bool bCumulative)
+{
+    Blocks.Reset();
+    bHasCumulativeAck = false;
+
+    // 이전 형식: 시퀀스 번호 하나
+    if (Bytes.Num() == sizeof(uint16))
+    {
+        FSackBlock& Block = Blocks.AddDefaulted_GetRef();
+        FMemory::Memcpy(&Block.BaseSequence, Bytes.GetData(), sizeof(uint16));
+        Block.Bitmap = 0;
+        return true;
+    }
+
+    if (Bytes.Num() == 0 || Bytes.Num() % BLOCK_SIZE != 0)
+    {
+        return false;
+    }
+
+    Blocks.SetNumUninitialized(Bytes.Num() / BLOCK_SIZE);
+    FMemory::Memcpy(Blocks.GetData(), Bytes.GetData(), Bytes.Num());
+    CumulativeSequence = Blocks[0].BaseSequence;
+    bHasCumulativeAck = bCumulative;
+    return true;
+}
@@ -184,6 +184,9 @@ bool FSettingsManager::SaveSettingsToFile(const FString& FilePath)
     JsonObject->SetBoolField(TEXT("EnableBroadcast"), CurrentSettings.bEnableBroadcast);
     JsonObject->SetStringField(TEXT("PreferredNetworkInterface"), CurrentSettings.PreferredNetworkInterface);
 
+    JsonObject->SetNumberField(TEXT("ReceiverThreadProfile"), static_cast<uint8>(CurrentSettings.ReceiverThreadProfile));
+    JsonObject->SetNumberField(TEXT("ReceiverCpuCore"), CurrentSettings.ReceiverCpuCore);
+
     // JSON 문자열로 직렬화
     FString JsonString;
     TSharedRef<TJsonWriter<>> JsonWriter = TJsonWriterFactory<>::Create(&JsonString);
@@ -307,6 +310,17 @@ bool FSettingsManager::LoadSettingsFromFile(const FString& FilePath)
         LoadedSettings.PreferredNetworkInterface = JsonObject->GetStringField(TEXT("PreferredNetworkInterface"));
     }
 
+    // 수신 스레드 설정 로드
+    if (JsonObject->HasField(TEXT("ReceiverThreadProfile")))
+    {
+        LoadedSettings.ReceiverThreadProfile = static_cast<EReceiverThreadProfile>(JsonObject->GetIntegerField(TEXT("ReceiverThreadProfile")));
+    }
+
+    if (JsonObject->HasField(TEXT("ReceiverCpuCore")))
+    {
+        LoadedSettings.ReceiverCpuCore = JsonObject->GetIntegerField(TEXT("ReceiverCpuCore"));
+    }
+
     // 유효성 검사 및 설정 업데이트
     if (!ValidateSettings(LoadedSettings))
     {
@@ -377,6 +391,19 @@ bool FSettingsManager::ValidateSettings(const FProjectSettings& Settings)
         return false;
     }
 
+    // 수신 스레드 설정 유효성 검사
+    if (Settings.ReceiverThreadProfile != EReceiverThreadProfile::Standard && Settings.ReceiverThreadProfile != EReceiverThreadProfile::LowLatency)
+    {
+        UE_LOG(LogMultiServerSync, Warning, TEXT("Invalid receiver thread profile: %d"), static_cast<int32>(Settings.ReceiverThreadProfile));
+        return false;
+    }
+
+    if (Settings.ReceiverCpuCore < INDEX_NONE || Settings.ReceiverCpuCore >= 64)
+    {
+        UE_LOG(LogMultiServerSync, Warning, TEXT("Invalid receiver CPU core: %d"), Settings.ReceiverCpuCore);
+        return false;
+    }
+
     // 기타 필요한 유효성 검사 추가
 
     return true;
@@ -48,7 +48,27 @@ bool FSyncFrameworkManager::Initialize()
     }
 
     // Create network manager
-    NetworkManager = MakeShared<FNetworkManager>();
+    TSharedPtr<FNetworkManager> NetworkManagerImpl = MakeShared<FNetworkManager>();
+
+    // 멀티캐스트를 지원하는 인터페이스가 있으면 클러스터 전체 메시지를 그 인터페이스의 멀티캐스트 그룹으로 전송
+    FNetworkInterfaceInfo MulticastInterface;
+    if (static_cast<FEnvironmentDetector*>(EnvironmentDetector.Get())->GetFirstMulticastInterface(MulticastInterface))
+    {
+        FMulticastSettings MulticastSettings = NetworkManagerImpl->GetMulticastSettings();
+        MulticastSettings.bEnabled = true;
+        MulticastSettings.InterfaceAddress = MulticastInterface.GetIPv4Address();
+        NetworkManagerImpl->SetMulticastSettings(MulticastSettings);
+
+        UE_LOG(LogMultiServerSync, Display, TEXT("Using multicast interface %s (%s)"), *MulticastInterface.Name, *MulticastInterface.IPAddress);
+    }
+
+    // 시간 동기화 수신 스레드 프로필 (스레드 생성 시 적용되므로 Initialize 이전에 설정)
+    const FProjectSettings& ProjectSettings = SettingsManager->GetSettings();
+    NetworkManagerImpl->SetReceiverThreadSettings(
+        FReceiverThreadSettings::FromProfile(ProjectSettings.ReceiverThreadProfile, ProjectSettings.ReceiverCpuCore));
+    NetworkManagerImpl->SetInboxCapacity(ProjectSettings.ReceiveInboxCapacity);
+
+    NetworkManager = NetworkManagerImpl;
     if (!NetworkManager->Initialize())
     {
         UE_LOG(LogMultiServerSync, Error, TEXT("Failed to initialize NetworkManager"));
@@ -71,25 +91,6 @@ bool FSyncFrameworkManager::Initialize()
         return false;
     }
 
-    // 모듈 간 연결 - 메시지 핸들러 설정
-    // NetworkManager에 TimeSync 메시지 핸들러 등록
-    if (NetworkManager.IsValid() && TimeSync.IsValid())
-    {
-        // 네트워크 매니저 구현체 가져오기
-        FNetworkManager* NetworkManagerImpl = static_cast<FNetworkManager*>(NetworkManager.Get());
-        // 시간 동기화 구현체 가져오기
-        FTimeSync* TimeSyncImpl = static_cast<FTimeSync*>(TimeSync.Get());
-
-        // 메시지 핸들러 등록
-        NetworkManagerImpl->RegisterMessageHandler(
-            [TimeSyncImpl](const FString& SenderId, const TArray<uint8>& Data)
-            {
-                // 시간 동기화 메시지만 처리
-                TimeSyncImpl->ProcessPTPMessage(Data);
-            }
-        );
-    }
-
     // 모듈 간 연결 - 메시지 핸들러 설정
     SetupMessageHandlers();
 
@@ -125,6 +126,14 @@ void FSyncFrameworkManager::Shutdown()
     // Shutdown network manager
     if (NetworkManager.IsValid())
     {
+        // 메시지 구독 해제
+        FNetworkManager* NetworkManagerImpl = static_cast<FNetworkManager*>(NetworkManager.Get());
+        for (const TPair<ENetworkMessageType, FDelegateHandle>& Subscription : MessageSubscriptions)
+        {
+            NetworkManagerImpl->UnsubscribeMessage(Subscription.Key, Subscription.Value);
+        }
+        MessageSubscriptions.Empty();
+
         NetworkManager->Shutdown();
         NetworkManager.Reset();
     }
@@ -186,44 +195,52 @@ void FSyncFrameworkManager::SetupMessageHandlers()
     // 네트워크 매니저 구현체 가져오기
     FNetworkManager* NetworkManagerImpl = static_cast<FNetworkManager*>(NetworkManager.Get());
 
-    // 메시지 핸들러 등록
-    NetworkManagerImpl->RegisterMessageHandler(
-        [this](const FString& SenderId, const TArray<uint8>& Data)
+    // 메시지 유형별 구독 - 각 모듈은 필요한 유형의 페이로드만 받음
+    auto Subscribe = [this, NetworkManagerImpl](ENetworkMessageType Type, TFunction<void(const FReceivedNetworkMessage&)> Handler)
         {
-            // 데이터가 비어있으면 무시
-            if (Data.Num() == 0)
-            {
-                return;
-            }
+            FDelegateHandle Handle = NetworkManagerImpl->SubscribeMessage(Type,
+                FOnNetworkMessageReceived::FDelegate::CreateLambda(MoveTemp(Handler)));
+            MessageSubscriptions.Add(TPair<ENetworkMessageType, FDelegateHandle>(Type, Handle));
+        };
 
-            // 메시지 유형에 따라 처리
-            uint8 FirstByte = Data[0];
+    // 시간 동기화 메시지 처리
+    if (TimeSync.IsValid())
+    {
+        FTimeSync* TimeSyncImpl = static_cast<FTimeSync*>(TimeSync.Get());
+        Subscribe(ENetworkMessageType::TimeSync, [TimeSyncImpl](const FReceivedNetworkMessage& Received)
+            {
+                // 처리 시각이 아닌 소켓 도착 시각으로 T2/T4를 기록하도록 도착 후 경과 시간을 함께 전달
+                TimeSyncImpl->ProcessPTPMessage(TArray<uint8>(Received.Payload.GetData(), Received.Payload.Num()),
+                    Received.Message.GetReceiveAgeMicroseconds());
+            });
+    }
 
-            // 시간 동기화 메시지 처리
-            if (TimeSync.IsValid() && FirstByte == static_cast<uint8>(ENetworkMessageType::TimeSync))
+    // 프레임 동기화 메시지 처리
+    if (FrameSyncController.IsValid())
+    {
+        FFrameSyncController* FrameSyncImpl = static_cast<FFrameSyncController*>(FrameSyncController.Get());
+        Subscribe(ENetworkMessageType::FrameSync, [FrameSyncImpl](const FReceivedNetworkMessage& Received)
             {
-                // 시간 동기화 모듈에 데이터 전달
-                FTimeSync* TimeSyncImpl = static_cast<FTimeSync*>(TimeSync.Get());
-                TimeSyncImpl->ProcessPTPMessage(Data);
-            }
-            // 설정 동기화 메시지 처리
-            else if (SettingsManager.IsValid() && FirstByte == static_cast<uint8>(ENetworkMessageType::SettingsSync))
+                FrameSyncImpl->ProcessFrameSyncMessage(Received.Payload);
+            });
+    }
+
+    // 설정 동기화/응답 메시지 처리
+    if (SettingsManager.IsValid())
+    {
+        auto HandleSettings = [this](const FReceivedNetworkMessage& Received)
             {
-                // 설정 데이터를 첫 바이트를 제외하고 전달
-                TArray<uint8> SettingsData;
-                if (Data.Num() > 1)
-                {
-                    SettingsData.Append(Data.GetData() + 1, Data.Num() - 1);
-                }
-                ProcessNetworkSettings(SettingsData);
-            }
-            // 설정 요청 메시지 처리
-            else if (SettingsManager.IsValid() && FirstByte == static_cast<uint8>(ENetworkMessageType::SettingsRequest))
+                ProcessNetworkSettings(TArray<uint8>(Received.Payload.GetData(), Received.Payload.Num()));
+            };
+        Subscribe(ENetworkMessageType::SettingsSync, HandleSettings);
+        Subscribe(ENetworkMessageType::SettingsResponse, HandleSettings);
+
+        // 설정 요청 메시지 처리 (마스터 여부는 RespondToSettingsRequest에서 확인)
+        Subscribe(ENetworkMessageType::SettingsRequest, [this](const FReceivedNetworkMessage& Received)
             {
                 RespondToSettingsRequest();
-            }
-        }
-    );
+            });
+    }
 
     // 설정 변경 이벤트 등록
     if (SettingsManager.IsValid())
@@ -268,6 +285,19 @@ void FSyncFrameworkManager::ApplySettingsToModules(const FProjectSettings& Setti
                 UE_LOG(LogMultiServerSync, Warning, TEXT("Network port change requires restart"));
             }
         }
+
+        // 수신 스레드 프로필은 스레드 생성 시에만 적용
+        const FReceiverThreadSettings RequestedThreadSettings = FReceiverThreadSettings::FromProfile(Settings.ReceiverThreadProfile, Settings.ReceiverCpuCore);
+        if (RequestedThreadSettings != NetworkManagerImpl->GetReceiverThreadSettings())
+        {
+            UE_LOG(LogMultiServerSync, Warning, TEXT("Receiver thread profile change requires restart"));
+        }
+
+        // 인박스 용량은 수신 샤드 생성 시에만 적용
+        if (FNetworkManager::ResolveInboxCapacity(Settings.ReceiveInboxCapacity) != NetworkManagerImpl->GetInboxCapacity())
+        {
+            UE_LOG(LogMultiServerSync, Warning, TEXT("Receive inbox capacity change requires restart"));
+        }
     }
 
     // TimeSync 설정 적용
@@ -146,7 +146,7 @@ bool FTimeSync::IsMasterMode() const
     return bIsMaster;
 }
 
-void FTimeSync::ProcessPTPMessage(const TArray<uint8>& Message)
+void FTimeSync::ProcessPTPMessage(const TArray<uint8>& Message, int64 ReceiveAgeMicroseconds)
 {
     if (!bIsInitialized || !PTPClient.IsValid())
     {
@@ -154,7 +154,7 @@ void FTimeSync::ProcessPTPMessage(const TArray<uint8>& Message)
     }
 
     // PTP 클라이언트에 메시지 전달
-    PTPClient->ProcessMessage(Message);
+    PTPClient->ProcessMessage(Message, ReceiveAgeMicroseconds);
 
     // PTP 상태 업데이트
     UpdateTimeSync();
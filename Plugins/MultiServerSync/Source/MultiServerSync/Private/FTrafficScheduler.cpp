@@ -0,0 +1,320 @@
+﻿// FTrafficScheduler.cpp
+#include "FTrafficScheduler.h"
+#include "FNetworkTransport.h"
+#include "FSyncLog.h"
+
+const TCHAR* GetTrafficClassName(ETrafficClass Class)
+{
+    switch (Class)
+    {
+    case ETrafficClass::Clock:
+        return TEXT("Clock");
+    case ETrafficClass::Frame:
+        return TEXT("Frame");
+    case ETrafficClass::Control:
+        return TEXT("Control");
+    case ETrafficClass::Bulk:
+        return TEXT("Bulk");
+    default:
+        return TEXT("Unknown");
+    }
+}
+
+FTrafficClassConfig FTrafficClassConfig::GetDefault(ETrafficClass Class)
+{
+    switch (Class)
+    {
+    case ETrafficClass::Control:
+        // 4MB/s, 한 번에 64KB까지 몰아서 보냄
+        return FTrafficClassConfig(4 * 1024 * 1024, 64 * 1024, 1024, 0);
+
+    case ETrafficClass::Bulk:
+        // 피어당 100Mbps로 제한하여 조각 메시지 폭주가 스위치 큐를 채우지 않도록 함
+        return FTrafficClassConfig(12500000, 256 * 1024, 4096, 0);
+
+    default:
+        return FTrafficClassConfig();
+    }
+}
+
+FTrafficScheduler::FTrafficScheduler()
+    : LastPruneTime(0.0)
+{
+    for (int32 Index = 0; Index < NUM_TRAFFIC_CLASSES; ++Index)
+    {
+        Configs[Index] = FTrafficClassConfig::GetDefault(static_cast<ETrafficClass>(Index));
+    }
+}
+
+void FTrafficScheduler::SetClassConfig(ETrafficClass Class, const FTrafficClassConfig& InConfig)
+{
+    FTrafficClassConfig& Config = Configs[static_cast<int32>(Class)];
+    Config = InConfig;
+    Config.RateBytesPerSecond = FMath::Max<int64>(Config.RateBytesPerSecond, 0);
+    Config.BurstBytes = FMath::Max(Config.BurstBytes, 0);
+    Config.MaxQueueDepth = FMath::Max(Config.MaxQueueDepth, 0);
+    Config.Dscp = FMath::Min<uint8>(Config.Dscp, 63);
+
+    // 줄어든 버킷을 넘는 토큰은 버림
+    for (TPair<FIPv4Address, FPeerState>& Pair : Peers)
+    {
+        FClassState& State = Pair.Value.Classes[static_cast<int32>(Class)];
+        State.Tokens = FMath::Min(State.Tokens, static_cast<double>(Config.BurstBytes));
+    }
+}
+
+void FTrafficScheduler::SetPeerRateLimit(const FIPv4Address& Address, ETrafficClass Class, int64 RateBytesPerSecond, double Now)
+{
+    FClassState& State = FindOrAddClassState(Address, Class, Now);
+
+    // 바뀌기 전 속도로 지금까지의 토큰을 충전
+    Refill(State, Configs[static_cast<int32>(Class)], Now);
+    State.RateLimit = FMath::Max<int64>(RateBytesPerSecond, 0);
+}
+
+int64 FTrafficScheduler::GetPeerRateLimit(const FIPv4Address& Address, ETrafficClass Class) const
+{
+    const FPeerState* Peer = Peers.Find(Address);
+    return Peer ? Peer->Classes[static_cast<int32>(Class)].RateLimit : 0;
+}
+
+bool FTrafficScheduler::Send(ETrafficClass Class, INetworkTransport* Transport, const uint8* Data, int32 Size, const FIPv4Endpoint& Target, double Now)
+{
+    if (!Transport)
+    {
+        return false;
+    }
+
+    const int32 ClassIndex = static_cast<int32>(Class);
+    const FTrafficClassConfig& Config = Configs[ClassIndex];
+    if (!Config.IsPaced())
+    {
+        return Transmit(nullptr, Class, Transport, Data, Size, Target);
+    }
+
+    FClassState& State = FindOrAddClassState(Target.Address, Class, Now);
+    Refill(State, Config, Now);
+    Drain(State, Class);
+
+    // 같은 피어의 더 높은 우선순위 대기열이 밀려 있으면 앞지르지 않음
+    bool bHigherBacklog = false;
+    const FPeerState& Peer = Peers.FindChecked(Target.Address);
+    for (int32 Index = 0; Index < ClassIndex; ++Index)
+    {
+        bHigherBacklog |= Peer.Classes[Index].GetQueueDepth() > 0;
+    }
+
+    // 버킷보다 큰 데이터그램은 버킷이 가득 찼을 때 보내고 토큰을 빚으로 남김
+    if (!bHigherBacklog && State.GetQueueDepth() == 0 && State.Tokens >= FMath::Min<double>(Size, Config.BurstBytes))
+    {
+        return Transmit(&State, Class, Transport, Data, Size, Target);
+    }
+
+    FTrafficClassStats& ClassStats = Stats[ClassIndex];
+    if (State.GetQueueDepth() >= Config.MaxQueueDepth)
+    {
+        ++ClassStats.DroppedDatagrams;
+        UE_LOG(LogMultiServerSync, Verbose, TEXT("%s queue to %s is full (%d datagrams), dropping %d bytes"),
+            GetTrafficClassName(Class), *Target.Address.ToString(), State.GetQueueDepth(), Size);
+        return false;
+    }
+
+    FQueuedDatagram& Queued = State.Queue.AddDefaulted_GetRef();
+    Queued.Transport = Transport;
+    Queued.Target = Target;
+    Queued.Data.Append(Data, Size);
+
+    ++ClassStats.PacedDatagrams;
+    ++ClassStats.QueueDepth;
+    ClassStats.PeakQueueDepth = FMath::Max(ClassStats.PeakQueueDepth, ClassStats.QueueDepth);
+    return true;
+}
+
+int32 FTrafficScheduler::SendToMany(ETrafficClass Class, INetworkTransport* Transport, const uint8* Data, int32 Size, const FIPv4Endpoint* Targets, int32 TargetCount, double Now)
+{
+    if (!Transport || TargetCount <= 0)
+    {
+        return 0;
+    }
+
+    if (!Configs[static_cast<int32>(Class)].IsPaced())
+    {
+        const int32 SentCount = TargetCount == 1
+            ? (Transport->SendTo(Data, Size, Targets[0]) ? 1 : 0)
+            : Transport->SendToMany(Data, Size, Targets, TargetCount);
+
+        FTrafficClassStats& ClassStats = Stats[static_cast<int32>(Class)];
+        ClassStats.SentDatagrams += SentCount;
+        ClassStats.SentBytes += static_cast<uint64>(SentCount) * Size;
+        return SentCount;
+    }
+
+    int32 AcceptedCount = 0;
+    for (int32 Index = 0; Index < TargetCount; ++Index)
+    {
+        AcceptedCount += Send(Class, Transport, Data, Size, Targets[Index], Now) ? 1 : 0;
+    }
+    return AcceptedCount;
+}
+
+void FTrafficScheduler::Pump(double Now)
+{
+    for (auto It = Peers.CreateIterator(); It; ++It)
+    {
+        FPeerState& Peer = It.Value();
+
+        // 엄격한 우선순위: 앞 클래스가 토큰이 모자라 밀려 있으면 뒤 클래스는 이번 틱에 보내지 않음
+        bool bHigherBacklog = false;
+        int32 QueuedCount = 0;
+        for (int32 Index = 0; Index < NUM_TRAFFIC_CLASSES; ++Index)
+        {
+            FClassState& State = Peer.Classes[Index];
+            Refill(State, Configs[Index], Now);
+
+            if (!bHigherBacklog && State.GetQueueDepth() > 0)
+            {
+                Drain(State, static_cast<ETrafficClass>(Index));
+            }
+
+            bHigherBacklog |= State.GetQueueDepth() > 0;
+            QueuedCount += State.GetQueueDepth();
+        }
+
+        if (QueuedCount > 0)
+        {
+            Peer.LastActiveTime = Now;
+        }
+    }
+
+    // 보낼 것이 없는 피어의 상태는 주기적으로 정리 (다시 보내면 버킷을 가득 채워 새로 만듦)
+    if (Now - LastPruneTime >= 1.0)
+    {
+        LastPruneTime = Now;
+        for (auto It = Peers.CreateIterator(); It; ++It)
+        {
+            bool bHasRateLimit = false;
+            for (const FClassState& State : It.Value().Classes)
+            {
+                bHasRateLimit |= State.RateLimit > 0;
+            }
+
+            if (!bHasRateLimit && Now - It.Value().LastActiveTime > IDLE_PEER_TIMEOUT_SECONDS)
+            {
+                It.RemoveCurrent();
+            }
+        }
+    }
+}
+
+void FTrafficScheduler::Reset()
+{
+    Peers.Reset();
+
+    for (int32 Index = 0; Index < NUM_TRAFFIC_CLASSES; ++Index)
+    {
+        Stats[Index].QueueDepth = 0;
+    }
+}
+
+int32 FTrafficScheduler::GetTotalQueueDepth() const
+{
+    int32 Total = 0;
+    for (int32 Index = 0; Index < NUM_TRAFFIC_CLASSES; ++Index)
+    {
+        Total += Stats[Index].QueueDepth;
+    }
+    return Total;
+}
+
+void FTrafficScheduler::ResetStats()
+{
+    for (int32 Index = 0; Index < NUM_TRAFFIC_CLASSES; ++Index)
+    {
+        const int32 QueueDepth = Stats[Index].QueueDepth;
+        Stats[Index] = FTrafficClassStats();
+        Stats[Index].QueueDepth = QueueDepth;
+        Stats[Index].PeakQueueDepth = QueueDepth;
+    }
+}
+
+FTrafficScheduler::FClassState& FTrafficScheduler::FindOrAddClassState(const FIPv4Address& Address, ETrafficClass Class, double Now)
+{
+    FPeerState* Peer = Peers.Find(Address);
+    if (!Peer)
+    {
+        Peer = &Peers.Add(Address);
+        for (int32 Index = 0; Index < NUM_TRAFFIC_CLASSES; ++Index)
+        {
+            Peer->Classes[Index].Tokens = Configs[Index].BurstBytes;
+            Peer->Classes[Index].LastRefillTime = Now;
+        }
+    }
+
+    Peer->LastActiveTime = Now;
+    return Peer->Classes[static_cast<int32>(Class)];
+}
+
+void FTrafficScheduler::Refill(FClassState& State, const FTrafficClassConfig& Config, double Now) const
+{
+    if (Now > State.LastRefillTime)
+    {
+        const int64 Rate = State.RateLimit > 0 ? FMath::Min(State.RateLimit, Config.RateBytesPerSecond) : Config.RateBytesPerSecond;
+        State.Tokens = FMath::Min(State.Tokens + (Now - State.LastRefillTime) * Rate, static_cast<double>(Config.BurstBytes));
+        State.LastRefillTime = Now;
+    }
+}
+
+void FTrafficScheduler::Drain(FClassState& State, ETrafficClass Class)
+{
+    const FTrafficClassConfig& Config = Configs[static_cast<int32>(Class)];
+    FTrafficClassStats& ClassStats = Stats[static_cast<int32>(Class)];
+
+    // 페이싱을 끈 클래스는 남은 대기열을 한 번에 보냄
+    while (State.GetQueueDepth() > 0)
+    {
+        FQueuedDatagram& Queued = State.Queue[State.QueueHead];
+        if (Config.IsPaced() && State.Tokens < FMath::Min<double>(Queued.Data.Num(), Config.BurstBytes))
+        {
+            break;
+        }
+
+        if (!Transmit(&State, Class, Queued.Transport, Queued.Data.GetData(), Queued.Data.Num(), Queued.Target))
+        {
+            UE_LOG(LogMultiServerSync, Warning, TEXT("Failed to send paced %s datagram to %s: %d bytes"),
+                GetTrafficClassName(Class), *Queued.Target.ToString(), Queued.Data.Num());
+        }
+
+        ++State.QueueHead;
+        --ClassStats.QueueDepth;
+    }
+
+    // 앞쪽의 보낸 항목을 정리 (다 보냈으면 할당을 유지한 채 비움)
+    if (State.QueueHead == State.Queue.Num())
+    {
+        State.Queue.Reset();
+        State.QueueHead = 0;
+    }
+    else if (State.QueueHead >= 64 && State.QueueHead * 2 >= State.Queue.Num())
+    {
+        State.Queue.RemoveAt(0, State.QueueHead, EAllowShrinking::No);
+        State.QueueHead = 0;
+    }
+}
+
+bool FTrafficScheduler::Transmit(FClassState* State, ETrafficClass Class, INetworkTransport* Transport, const uint8* Data, int32 Size, const FIPv4Endpoint& Target)
+{
+    if (!Transport->SendTo(Data, Size, Target))
+    {
+        return false;
+    }
+
+    FTrafficClassStats& ClassStats = Stats[static_cast<int32>(Class)];
+    ++ClassStats.SentDatagrams;
+    ClassStats.SentBytes += Size;
+
+    if (State)
+    {
+        State->Tokens -= Size;
+    }
+    return true;
+}
@@ -5,6 +5,19 @@
 
 void FNetworkLatencyStats::AddRTTSample(double RTT)
 {
+    // 재전송 타임아웃 추정 (RFC 6298 2.2~2.3절)
+    // 튀는 샘플을 평균으로 바꾸면 실제 지연 증가를 놓쳐 타임아웃이 너무 짧아지므로 원래 값을 사용
+    if (SampleCount == 0)
+    {
+        SmoothedRTT = RTT;
+        RTTVariation = RTT / 2.0;
+    }
+    else
+    {
+        RTTVariation = 0.75 * RTTVariation + 0.25 * FMath::Abs(SmoothedRTT - RTT);
+        SmoothedRTT = 0.875 * SmoothedRTT + 0.125 * RTT;
+    }
+
     // 이상치 감지 및 필터링
     if (SampleCount > 5 && bFilterOutliers)  // 최소 5개 샘플이 있을 때만 이상치 감지
     {
@@ -493,4 +506,187 @@ ENetworkEventType FNetworkLatencyStats::GetLatestEvent() const
     }
 
     return ENetworkEventType::None;
-}
\ No newline at end of file
+}
+
+// 새 메시지 추가 및 누락 메시지 감지
+ESequenceAddResult FMessageSequenceTracker::AddSequence(uint32 Sequence)
+{
+    // 첫 메시지가 시작 윈도우 밖이면 (보내는 쪽이 먼저 시작했으면) 그 번호부터 추적
+    if (!bSynchronized)
+    {
+        bSynchronized = true;
+        const int32 Offset = FSequenceNumber::Diff(Sequence, LastProcessedSequence);
+        if (Offset <= 0 || Offset > GetWindowSize())
+        {
+            LastProcessedSequence = Sequence - 1;
+            NextExpectedSequence = Sequence;
+            HighestReceivedSequence = Sequence;
+        }
+    }
+
+    // 이미 처리된 메시지는 무시
+    if (IsSequenceAlreadyProcessed(Sequence))
+        return ESequenceAddResult::Duplicate;
+
+    // 윈도우보다 멀리 앞선 번호
+    if (FSequenceNumber::Diff(Sequence, LastProcessedSequence) > GetWindowSize())
+    {
+        if (BufferedCount == 0)
+        {
+            // 보관 중인 메시지가 없으면 그 사이 번호를 포기하고 그 번호부터 다시 시작
+            LastProcessedSequence = Sequence - 1;
+            NextExpectedSequence = Sequence;
+        }
+        else
+        {
+            // 그 번호가 윈도우 끝에 오도록 밀어 오래된 빈 번호를 포기 (순서 보장 여부와 관계없이 영구히 유실된 번호에 윈도우가 멈추지 않음)
+            SlideWindow(Sequence - GetWindowSize());
+        }
+    }
+
+    // 기다리던 번호면 비트맵에 넣지 않고 바로 처리 (보관 중인 연속 메시지가 있으면 함께 처리)
+    if (Sequence == NextExpectedSequence)
+    {
+        LastProcessedSequence = Sequence;
+        NextExpectedSequence = Sequence + 1;
+        if (BufferedCount > 0)
+        {
+            ProcessNextSequentialMessages();
+        }
+        return ESequenceAddResult::InOrder;
+    }
+
+    // 이미 수신된 시퀀스면 중복으로 처리
+    if (TestBit(Sequence))
+        return ESequenceAddResult::Duplicate;
+
+    // 순서를 앞질러 받은 번호 보관 (그 앞의 빈 비트가 누락된 번호)
+    const int32 Index = GetBitIndex(Sequence);
+    ReceivedBits[Index >> 6] |= uint64(1) << (Index & 63);
+    if (++BufferedCount == 1 || FSequenceNumber::IsAfter(Sequence, HighestBufferedSequence))
+    {
+        HighestBufferedSequence = Sequence;
+    }
+
+    // 순서 보장이 필요하면 순서 어긋난 메시지가 너무 많을 때 이전 메시지를 포기
+    if (bOrderGuaranteed && BufferedCount > MaxOutOfOrderMessages)
+    {
+        SkipMissingSequences();
+    }
+
+    return ESequenceAddResult::OutOfOrder;
+}
+
+// 연속된 메시지 처리 (마지막 처리 번호 다음부터 연속으로 켜진 비트를 지우며 진행)
+void FMessageSequenceTracker::ProcessNextSequentialMessages()
+{
+    while (BufferedCount > 0)
+    {
+        const int32 Index = GetBitIndex(LastProcessedSequence + 1);
+        uint64& Word = ReceivedBits[Index >> 6];
+        const uint64 Mask = uint64(1) << (Index & 63);
+        if ((Word & Mask) == 0)
+        {
+            break;
+        }
+
+        Word &= ~Mask;
+        ++LastProcessedSequence;
+        --BufferedCount;
+    }
+
+    NextExpectedSequence = LastProcessedSequence + 1;
+}
+
+// 마지막 처리 번호를 NewLastProcessed로 옮김 (그때까지 보관 중인 번호는 지우고 빈 번호는 포기)
+void FMessageSequenceTracker::SlideWindow(uint32 NewLastProcessed)
+{
+    if (!FSequenceNumber::IsAfter(HighestBufferedSequence, NewLastProcessed))
+    {
+        // 보관 중인 번호가 모두 새 기준 이하
+        FMemory::Memzero(ReceivedBits);
+        BufferedCount = 0;
+    }
+    else
+    {
+        // 지울 범위는 보관 중인 가장 앞선 번호 전에서 끝나므로 윈도우 크기를 넘지 않음
+        const uint32 End = NewLastProcessed + 1;
+        uint32 Sequence = FindNextBit(LastProcessedSequence + 1, End, true);
+        while (Sequence != End)
+        {
+            const int32 Index = GetBitIndex(Sequence);
+            ReceivedBits[Index >> 6] &= ~(uint64(1) << (Index & 63));
+            --BufferedCount;
+            Sequence = FindNextBit(Sequence + 1, End, true);
+        }
+    }
+
+    LastProcessedSequence = NewLastProcessed;
+    ProcessNextSequentialMessages();
+}
+
+// 누락된 번호를 포기하고 보관 중인 가장 오래된 번호부터 처리
+void FMessageSequenceTracker::SkipMissingSequences()
+{
+    if (BufferedCount == 0)
+    {
+        return;
+    }
+
+    LastProcessedSequence = FindNextBit(LastProcessedSequence + 1, HighestBufferedSequence, true) - 1;
+    ProcessNextSequentialMessages();
+}
+
+// From부터 End 전까지에서 비트가 bSet인 첫 번호 (워드 단위로 건너뜀)
+uint32 FMessageSequenceTracker::FindNextBit(uint32 From, uint32 End, bool bSet) const
+{
+    uint32 Sequence = From;
+    while (Sequence != End)
+    {
+        const int32 Index = GetBitIndex(Sequence);
+        const int32 Shift = Index & 63;
+        const uint64 Word = (bSet ? ReceivedBits[Index >> 6] : ~ReceivedBits[Index >> 6]) >> Shift;
+        const uint32 Remaining = End - Sequence;
+
+        if (Word != 0)
+        {
+            const uint32 Offset = static_cast<uint32>(FMath::CountTrailingZeros64(Word));
+            return Offset < Remaining ? Sequence + Offset : End;
+        }
+
+        // 이 워드의 남은 비트에는 없으므로 다음 워드로
+        const uint32 Step = static_cast<uint32>(64 - Shift);
+        if (Step >= Remaining)
+        {
+            return End;
+        }
+        Sequence += Step;
+    }
+
+    return End;
+}
+
+// 누락된 메시지 조회
+TArray<uint32> FMessageSequenceTracker::GetMissingSequences(int32 MaxCount) const
+{
+    TArray<uint32> Result;
+    ForEachMissingRange([&Result, MaxCount](uint32 FirstSequence, uint32 Count)
+        {
+            for (uint32 Offset = 0; Offset < Count && Result.Num() < MaxCount; ++Offset)
+            {
+                Result.Add(FirstSequence + Offset);
+            }
+        });
+    return Result;
+}
+
+// 누락된 메시지 수
+int32 FMessageSequenceTracker::GetMissingCount() const
+{
+    int32 Count = 0;
+    ForEachMissingRange([&Count](uint32 FirstSequence, uint32 RangeCount)
+        {
+            Count += static_cast<int32>(RangeCount);
+        });
+    return Count;
+}
@@ -0,0 +1,133 @@
+﻿// Copyright Your Company. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * 혼잡 제어 설정
+ */
+struct FCongestionControlConfig
+{
+    double TargetDelayMs;                       // 시간 동기화 RTT가 기준 RTT보다 이만큼 넘게 늘면 감속 (밀리초)
+    double InitialRateBytesPerSecond;           // 피어별 시작 송신 속도
+    double MinRateBytesPerSecond;               // 감속 하한
+    double MaxRateBytesPerSecond;               // 증속 상한
+    double AdditiveIncreaseBytesPerSecond;      // 목표 지연 아래에서 1초마다 늘리는 송신 속도
+    double DelayDecreaseFactor;                 // 지연이 목표를 넘었을 때 곱하는 값
+    double LossDecreaseFactor;                  // ACK 시간 초과 시 곱하는 값
+    int32 MinWindowBytes;                       // 신뢰성 메시지 최소 윈도우 (ACK 왕복이 느려도 이만큼은 보냄)
+
+    FCongestionControlConfig()
+        : TargetDelayMs(2.0)
+        , InitialRateBytesPerSecond(12500000.0)
+        , MinRateBytesPerSecond(64.0 * 1024.0)
+        , MaxRateBytesPerSecond(125000000.0)
+        , AdditiveIncreaseBytesPerSecond(2.0 * 1024.0 * 1024.0)
+        , DelayDecreaseFactor(0.7)
+        , LossDecreaseFactor(0.5)
+        , MinWindowBytes(4 * 1500)
+    {
+    }
+};
+
+/**
+ * 피어별 지연 기반 혼잡 제어기
+ * 시간 동기화 RTT(핑)가 관측된 최소 RTT보다 목표 지연 이상 늘면 송신 속도를 곱셈 감소시키고,
+ * 목표 아래에서는 시간에 비례해 덧셈 증가시킴 (AIMD, 감소는 RTT마다 최대 한 번)
+ * 대량 전송 클래스는 이 속도로 페이싱하고, 신뢰성 메시지 윈도우는 속도 x ACK RTT(대역폭-지연 곱)로 제한
+ * FNetworkManager의 소유 스레드(게임 스레드)에서만 접근해야 함
+ */
+class MULTISERVERSYNC_API FCongestionController
+{
+public:
+    /** 생성자 */
+    FCongestionController();
+
+    /**
+     * 시간 동기화 RTT 샘플을 반영합니다.
+     * 최근 샘플의 최솟값에서 기준 RTT를 뺀 값을 대기열 지연으로 보고 목표 지연과 비교합니다.
+     * @param RttMs 핑 RTT (밀리초, 이상치 필터를 거치지 않은 값)
+     */
+    void OnClockRttSample(const FCongestionControlConfig& Config, double RttMs, double Now);
+
+    /** 신뢰성 메시지를 보낼 때 호출 (재전송은 제외) */
+    void OnSend(int32 Bytes) { BytesInFlight += Bytes; }
+
+    /**
+     * 신뢰성 메시지 ACK를 반영합니다.
+     * @param RttSeconds 첫 전송의 ACK 왕복 시간 (재전송한 메시지는 어느 전송의 ACK인지 모르므로 음수)
+     */
+    void OnAck(const FCongestionControlConfig& Config, int32 Bytes, double RttSeconds, double Now);
+
+    /** ACK 시간 초과 (재전송 또는 포기) 시 호출 */
+    void OnLoss(const FCongestionControlConfig& Config, double Now);
+
+    /** 포기한 메시지를 윈도우에서 뺌 */
+    void OnDiscard(int32 Bytes) { BytesInFlight = FMath::Max<int64>(BytesInFlight - Bytes, 0); }
+
+    /** 윈도우에 Bytes만큼 자리가 있는지 여부 (보낸 것이 없으면 크기와 관계없이 true) */
+    bool CanSend(const FCongestionControlConfig& Config, int32 Bytes) const
+    {
+        return BytesInFlight == 0 || BytesInFlight + Bytes <= GetWindowBytes(Config);
+    }
+
+    /** 신뢰성 메시지 윈도우 (바이트) */
+    int64 GetWindowBytes(const FCongestionControlConfig& Config) const;
+
+    /** 현재 송신 속도 (바이트/초, 첫 샘플 전이면 시작 속도) */
+    double GetRate(const FCongestionControlConfig& Config) const { return Rate > 0.0 ? Rate : Config.InitialRateBytesPerSecond; }
+
+    /** ACK를 기다리는 바이트 수 */
+    int64 GetBytesInFlight() const { return BytesInFlight; }
+
+    /** 기준 RTT (관측된 최소 시간 동기화 RTT, 밀리초, 샘플이 없으면 0) */
+    double GetBaseRttMs() const { return BaseRttMs; }
+
+    /** 현재 대기열 지연 추정값 (밀리초) */
+    double GetQueuingDelayMs() const { return QueuingDelayMs; }
+
+    /** 평활 ACK RTT (초, 샘플이 없으면 0) */
+    double GetSmoothedAckRtt() const { return SmoothedAckRtt; }
+
+    /** 지연 증가로 감속한 횟수 */
+    uint32 GetDelayBackoffCount() const { return DelayBackoffCount; }
+
+    /** 손실로 감속한 횟수 */
+    uint32 GetLossBackoffCount() const { return LossBackoffCount; }
+
+private:
+    /** 목표 지연 아래에서 지난 시간만큼 속도를 늘림 */
+    void Increase(const FCongestionControlConfig& Config, double Now);
+
+    /** RTT마다 최대 한 번 속도를 Factor배로 줄임 (줄였으면 true) */
+    bool Decrease(const FCongestionControlConfig& Config, double Factor, double Now);
+
+    /** 대기열 지연을 추정할 최근 샘플 수 (응답 측 처리 지연으로 생긴 튀는 값을 걸러냄) */
+    static constexpr int32 RECENT_RTT_SAMPLES = 4;
+
+    /** 기준 RTT를 다시 구하는 주기 (경로가 바뀌어 최소 RTT가 늘어도 따라가도록 두 구간의 최솟값 사용) */
+    static constexpr double BASE_RTT_WINDOW_SECONDS = 30.0;
+
+    /** 연속 감속 사이의 최소 간격 (RTT가 아주 짧아도 감속 효과가 RTT 샘플에 나타날 시간을 줌) */
+    static constexpr double MIN_DECREASE_INTERVAL_SECONDS = 0.02;
+
+    /** ACK RTT 샘플이 없을 때 윈도우 계산에 쓰는 RTT (인박스 틱 몇 번 정도) */
+    static constexpr double INITIAL_ACK_RTT_SECONDS = 0.05;
+
+    double Rate;                                // 송신 속도 (0이면 아직 시작 전)
+    int64 BytesInFlight;                        // ACK 대기 바이트
+    double BaseRttMs;                           // 기준 RTT
+    double CurrentWindowMinRttMs;               // 이번 구간의 최소 RTT
+    double PreviousWindowMinRttMs;              // 지난 구간의 최소 RTT
+    double BaseWindowStartTime;                 // 이번 구간 시작 시간
+    double RecentRttsMs[RECENT_RTT_SAMPLES];    // 최근 RTT 샘플 (원형 버퍼)
+    int32 RecentRttCount;                       // 받은 샘플 수
+    double QueuingDelayMs;                      // 대기열 지연 추정값
+    bool bAboveTarget;                          // 마지막 추정값이 목표 지연을 넘었는지 여부
+    double SmoothedAckRtt;                      // 평활 ACK RTT (초)
+    double LastIncreaseTime;                    // 마지막 증속 시간
+    double LastDecreaseTime;                    // 마지막 감속 시간
+    uint32 DelayBackoffCount;                   // 지연 감속 횟수
+    uint32 LossBackoffCount;                    // 손실 감속 횟수
+};
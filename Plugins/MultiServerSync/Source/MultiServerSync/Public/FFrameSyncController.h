@@ -46,7 +46,7 @@ public:
     void SendFrameSyncMessage();
 
     /** Process a received frame sync message */
-    void ProcessFrameSyncMessage(const TArray<uint8>& Message);
+    void ProcessFrameSyncMessage(TArrayView<const uint8> Message);
 
     /** Get the current frame timing adjustment in milliseconds */
     float GetFrameTimingAdjustmentMs() const;
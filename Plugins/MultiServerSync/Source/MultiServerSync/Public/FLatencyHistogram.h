@@ -0,0 +1,45 @@
+﻿// Copyright Your Company. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * 지연 시간 히스토그램
+ * 버킷 0은 1us 미만, 버킷 i는 [2^(i-1), 2^i) 마이크로초 구간이며 마지막 버킷은 그 이상을 모두 포함
+ * 로그 구간이라 백분위수는 버킷 상한으로 근사함
+ */
+struct MULTISERVERSYNC_API FLatencyHistogram
+{
+    /** 버킷 수 (마지막 버킷 하한 2^(NUM_BUCKETS-2) us = 약 262ms) */
+    static constexpr int32 NUM_BUCKETS = 20;
+
+    /** 버킷별 샘플 수 */
+    uint64 Buckets[NUM_BUCKETS];
+
+    FLatencyHistogram()
+    {
+        FMemory::Memzero(Buckets);
+    }
+
+    /** 지연 시간이 속한 버킷 인덱스 반환 */
+    static int32 GetBucketIndex(double Microseconds);
+
+    /** 버킷 상한 반환 (마이크로초, 마지막 버킷은 하한의 두 배로 표시) */
+    static double GetBucketUpperBound(int32 BucketIndex);
+
+    /** 샘플 추가 */
+    void Add(double Microseconds) { Buckets[GetBucketIndex(Microseconds)]++; }
+
+    /** 다른 히스토그램을 합산 */
+    void Merge(const FLatencyHistogram& Other);
+
+    /** 전체 샘플 수 */
+    uint64 GetCount() const;
+
+    /** 백분위수 근사값 (해당 샘플이 속한 버킷 상한, 마이크로초, 샘플이 없으면 0) */
+    double GetPercentile(double Percentile) const;
+
+    /** 비어 있지 않은 버킷을 문자열로 변환 */
+    FString ToString() const;
+};
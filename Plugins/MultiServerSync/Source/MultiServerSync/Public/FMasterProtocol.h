@@ -0,0 +1,197 @@
+﻿// Copyright Your Company. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Interfaces/IPv4/IPv4Address.h"
+#include "FMessageSchema.h"
+
+/**
+ * 마스터-슬레이브 프로토콜 페이로드
+ * 모든 페이로드는 FSchema(TMessageSchema)에 선언한 필드를 순서대로 패딩 없이 리틀 엔디언으로 기록하는 고정 길이 바이너리이며,
+ * 서버 ID 문자열 대신 서버 ID 해시를 담음 (해시를 서버 ID로 되돌리는 것은 FNetworkManager가 담당)
+ * Deserialize는 SERIALIZED_SIZE보다 짧은 데이터를 거부하고, 뒤에 붙은 바이트는 이후 버전의 확장 필드로 보고 무시
+ */
+
+/** 서버 ID 해시 (서버 ID 문자열의 CRC32) */
+typedef uint32 FServerIdHash;
+
+/** 서버 ID 해시 계산 */
+inline FServerIdHash HashServerId(const FString& ServerId)
+{
+    return FCrc::StrCrc32(*ServerId);
+}
+
+/**
+ * 마스터 정보 페이로드 (MasterAnnouncement, MasterResponse)
+ */
+struct FMasterInfoPayload
+{
+    FServerIdHash ServerIdHash;   // 마스터 서버 ID 해시
+    FIPv4Address IPAddress;       // 마스터 IP 주소
+    uint16 Port;                  // 마스터 데이터 포트
+    float Priority;               // 마스터 우선순위
+    int32 ElectionTerm;           // 선출 기간
+
+    FMasterInfoPayload()
+        : ServerIdHash(0)
+        , Port(0)
+        , Priority(0.0f)
+        , ElectionTerm(0)
+    {
+    }
+
+    /** 와이어 스키마 */
+    using FSchema = TMessageSchema<FMasterInfoPayload,
+        MSYNC_SCHEMA_FIELD(FMasterInfoPayload, ServerIdHash),
+        MSYNC_SCHEMA_FIELD(FMasterInfoPayload, IPAddress),
+        MSYNC_SCHEMA_FIELD(FMasterInfoPayload, Port),
+        MSYNC_SCHEMA_FIELD(FMasterInfoPayload, Priority),
+        MSYNC_SCHEMA_FIELD(FMasterInfoPayload, ElectionTerm)>;
+
+    /** 직렬화된 크기 (해시 4 + 주소 4 + 포트 2 + 우선순위 4 + 선출 기간 4) */
+    static constexpr int32 SERIALIZED_SIZE = FSchema::EncodedSize;
+
+    /** 직렬화 */
+    TArray<uint8> Serialize() const { return FSchema::Encode(*this); }
+
+    /** 역직렬화 (크기가 부족하면 false) */
+    bool Deserialize(TArrayView<const uint8> Bytes) { return FSchema::Decode(Bytes, *this); }
+};
+
+/**
+ * 마스터 선출 페이로드 (MasterElection)
+ */
+struct FMasterElectionPayload
+{
+    FServerIdHash CandidateIdHash;  // 후보 서버 ID 해시
+    int32 ElectionTerm;             // 선출 기간
+    float Priority;                 // 후보 우선순위
+
+    FMasterElectionPayload()
+        : CandidateIdHash(0)
+        , ElectionTerm(0)
+        , Priority(0.0f)
+    {
+    }
+
+    /** 와이어 스키마 */
+    using FSchema = TMessageSchema<FMasterElectionPayload,
+        MSYNC_SCHEMA_FIELD(FMasterElectionPayload, CandidateIdHash),
+        MSYNC_SCHEMA_FIELD(FMasterElectionPayload, ElectionTerm),
+        MSYNC_SCHEMA_FIELD(FMasterElectionPayload, Priority)>;
+
+    /** 직렬화된 크기 (해시 4 + 선출 기간 4 + 우선순위 4) */
+    static constexpr int32 SERIALIZED_SIZE = FSchema::EncodedSize;
+
+    /** 직렬화 */
+    TArray<uint8> Serialize() const { return FSchema::Encode(*this); }
+
+    /** 역직렬화 (크기가 부족하면 false) */
+    bool Deserialize(TArrayView<const uint8> Bytes) { return FSchema::Decode(Bytes, *this); }
+};
+
+/**
+ * 마스터 투표 페이로드 (MasterVote)
+ */
+struct FMasterVotePayload
+{
+    FServerIdHash VoterIdHash;      // 투표한 서버 ID 해시
+    FServerIdHash CandidateIdHash;  // 후보 서버 ID 해시
+    int32 ElectionTerm;             // 선출 기간
+    float VoterPriority;            // 투표한 서버의 우선순위
+
+    FMasterVotePayload()
+        : VoterIdHash(0)
+        , CandidateIdHash(0)
+        , ElectionTerm(0)
+        , VoterPriority(0.0f)
+    {
+    }
+
+    /** 와이어 스키마 */
+    using FSchema = TMessageSchema<FMasterVotePayload,
+        MSYNC_SCHEMA_FIELD(FMasterVotePayload, VoterIdHash),
+        MSYNC_SCHEMA_FIELD(FMasterVotePayload, CandidateIdHash),
+        MSYNC_SCHEMA_FIELD(FMasterVotePayload, ElectionTerm),
+        MSYNC_SCHEMA_FIELD(FMasterVotePayload, VoterPriority)>;
+
+    /** 직렬화된 크기 (해시 4 + 해시 4 + 선출 기간 4 + 우선순위 4) */
+    static constexpr int32 SERIALIZED_SIZE = FSchema::EncodedSize;
+
+    /** 직렬화 */
+    TArray<uint8> Serialize() const { return FSchema::Encode(*this); }
+
+    /** 역직렬화 (크기가 부족하면 false) */
+    bool Deserialize(TArrayView<const uint8> Bytes) { return FSchema::Decode(Bytes, *this); }
+};
+
+/**
+ * 역할 변경 페이로드 (RoleChange)
+ */
+struct FRoleChangePayload
+{
+    FServerIdHash ServerIdHash;   // 역할이 바뀐 서버 ID 해시
+    int32 ElectionTerm;           // 선출 기간
+    bool bIsMaster;               // 마스터가 되었는지 여부
+
+    FRoleChangePayload()
+        : ServerIdHash(0)
+        , ElectionTerm(0)
+        , bIsMaster(false)
+    {
+    }
+
+    /** 와이어 스키마 */
+    using FSchema = TMessageSchema<FRoleChangePayload,
+        MSYNC_SCHEMA_FIELD(FRoleChangePayload, ServerIdHash),
+        MSYNC_SCHEMA_FIELD(FRoleChangePayload, ElectionTerm),
+        MSYNC_SCHEMA_FIELD(FRoleChangePayload, bIsMaster)>;
+
+    /** 직렬화된 크기 (해시 4 + 선출 기간 4 + 마스터 여부 1) */
+    static constexpr int32 SERIALIZED_SIZE = FSchema::EncodedSize;
+
+    /** 직렬화 */
+    TArray<uint8> Serialize() const { return FSchema::Encode(*this); }
+
+    /** 역직렬화 (크기가 부족하면 false) */
+    bool Deserialize(TArrayView<const uint8> Bytes) { return FSchema::Decode(Bytes, *this); }
+};
+
+/**
+ * 서버 ID 페이로드 (MasterQuery, MasterResign)
+ */
+struct FServerIdPayload
+{
+    FServerIdHash ServerIdHash;   // 요청하거나 사임한 서버 ID 해시
+
+    FServerIdPayload()
+        : ServerIdHash(0)
+    {
+    }
+
+    explicit FServerIdPayload(FServerIdHash InServerIdHash)
+        : ServerIdHash(InServerIdHash)
+    {
+    }
+
+    /** 와이어 스키마 */
+    using FSchema = TMessageSchema<FServerIdPayload,
+        MSYNC_SCHEMA_FIELD(FServerIdPayload, ServerIdHash)>;
+
+    /** 직렬화된 크기 (해시 4) */
+    static constexpr int32 SERIALIZED_SIZE = FSchema::EncodedSize;
+
+    /** 직렬화 */
+    TArray<uint8> Serialize() const { return FSchema::Encode(*this); }
+
+    /** 역직렬화 (크기가 부족하면 false) */
+    bool Deserialize(TArrayView<const uint8> Bytes) { return FSchema::Decode(Bytes, *this); }
+};
+
+// 와이어 형식 고정 (필드를 바꾸면 프로토콜 버전과 함께 갱신해야 함)
+static_assert(FMasterInfoPayload::SERIALIZED_SIZE == 18, "FMasterInfoPayload wire size changed");
+static_assert(FMasterElectionPayload::SERIALIZED_SIZE == 12, "FMasterElectionPayload wire size changed");
+static_assert(FMasterVotePayload::SERIALIZED_SIZE == 16, "FMasterVotePayload wire size changed");
+static_assert(FRoleChangePayload::SERIALIZED_SIZE == 9, "FRoleChangePayload wire size changed");
+static_assert(FServerIdPayload::SERIALIZED_SIZE == 4, "FServerIdPayload wire size changed");
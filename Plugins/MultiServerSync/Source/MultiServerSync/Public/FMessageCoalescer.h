@@ -0,0 +1,128 @@
+﻿// Copyright Your Company. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Interfaces/IPv4/IPv4Endpoint.h"
+#include "FTrafficScheduler.h"
+
+class INetworkTransport;
+
+/**
+ * 송신 메시지 병합 통계
+ */
+struct FCoalescingStats
+{
+    uint64 CoalescedMessages;   // 묶음 버퍼에 넣은 메시지 수
+    uint64 BypassedMessages;    // 시간에 민감하거나 너무 커서 묶지 않고 바로 보낸 메시지 수
+    uint64 SentDatagrams;       // 묶음 버퍼를 비우며 보낸 데이터그램 수
+
+    FCoalescingStats()
+        : CoalescedMessages(0)
+        , BypassedMessages(0)
+        , SentDatagrams(0)
+    {
+    }
+};
+
+/**
+ * 송신 메시지 병합기
+ * 대상마다 작은 메시지를 묶음 데이터그램(유형 Batch) 하나에 모으고, 최대 데이터그램 크기나 지연 기한에 도달하면 전송
+ * 묶음 데이터그램은 공통 헤더 뒤에 직렬화된 메시지를 헤더째 이어 붙인 형태이며, 메시지가 하나뿐이면 묶지 않고 그대로 보냄
+ * 송신 스케줄러를 설정하면 데이터그램을 전송 계층 대신 스케줄러로 넘김 (묶음의 트래픽 클래스는 담긴 메시지 중 가장 높은 우선순위)
+ * FNetworkManager의 소유 스레드(게임 스레드)에서만 접근해야 함
+ */
+class MULTISERVERSYNC_API FMessageCoalescer
+{
+public:
+    /** 생성자 */
+    FMessageCoalescer();
+
+    /** 묶음 데이터그램 최대 크기 설정 (경로 MTU에서 IP/UDP 헤더를 뺀 값) */
+    void SetMaxDatagramSize(int32 InMaxDatagramSize) { MaxDatagramSize = InMaxDatagramSize; }
+
+    /** 묶음 헤더에 기록할 프로젝트 ID와 세션 토큰 설정 */
+    void SetProjectId(const FGuid& InProjectId);
+
+    /** 첫 메시지를 넣은 뒤 이 시간이 지나면 묶음을 보냄 (0이면 다음 틱에 보냄) */
+    void SetFlushDeadline(double InSeconds) { FlushDeadlineSeconds = FMath::Max(0.0, InSeconds); }
+    double GetFlushDeadline() const { return FlushDeadlineSeconds; }
+
+    /** 송신 스케줄러 설정 (nullptr이면 전송 계층으로 바로 보냄) */
+    void SetScheduler(FTrafficScheduler* InScheduler) { Scheduler = InScheduler; }
+
+    /**
+     * 직렬화된 메시지를 대상의 묶음 버퍼에 추가합니다.
+     * 버퍼에 자리가 없거나 다른 전송 계층 또는 다른 헤더 형식으로 보내던 묶음이 있으면 먼저 그 묶음을 보냅니다.
+     * 압축 헤더 메시지를 담은 묶음은 묶음 헤더도 압축 헤더로 보냅니다.
+     * @return 메시지를 넣었거나 바로 보냈으면 true
+     */
+    bool Enqueue(INetworkTransport* Transport, const FIPv4Endpoint& Target, const uint8* Data, int32 Size, double Now, ETrafficClass Class = ETrafficClass::Control);
+
+    /**
+     * 묶지 않고 여러 대상에 바로 전송합니다.
+     * 같은 전송 계층으로 대상에게 보내려고 모아둔 묶음이 있으면 순서가 바뀌지 않도록 먼저 보냅니다.
+     * @return 전송에 성공한 대상 수
+     */
+    int32 SendImmediately(INetworkTransport* Transport, const uint8* Data, int32 Size, const FIPv4Endpoint* Targets, int32 TargetCount, ETrafficClass Class = ETrafficClass::Control);
+
+    /** 대상에게 보내려고 모아둔 묶음이 있으면 바로 보냄 */
+    void Flush(const FIPv4Endpoint& Target);
+
+    /** 지연 기한이 된 묶음을 모두 보냄 */
+    void FlushDue(double Now);
+
+    /** 대기 중인 묶음을 모두 보냄 */
+    void FlushAll();
+
+    /** 대기 중인 묶음을 보내지 않고 버림 (전송 계층을 닫기 전에 호출) */
+    void Reset();
+
+    /** 통계 반환 */
+    const FCoalescingStats& GetStats() const { return Stats; }
+
+private:
+    /** 대상별 묶음 버퍼 */
+    struct FPendingDatagram
+    {
+        INetworkTransport* Transport;  // 보낼 전송 계층
+        TArray<uint8> Buffer;          // 묶음 헤더 자리 + 이어 붙인 메시지 (보낸 뒤에도 할당을 유지하여 재사용)
+        int32 MessageCount;            // 담긴 메시지 수
+        double FirstEnqueueTime;       // 첫 메시지를 넣은 시간
+        bool bCompact;                 // 담긴 메시지가 v2 압축 헤더인지 여부
+        ETrafficClass Class;           // 담긴 메시지 중 가장 높은 우선순위의 트래픽 클래스
+
+        FPendingDatagram()
+            : Transport(nullptr)
+            , MessageCount(0)
+            , FirstEnqueueTime(0.0)
+            , bCompact(false)
+            , Class(ETrafficClass::Bulk)
+        {
+        }
+    };
+
+    /** 묶음 하나를 보내고 버퍼를 비움 */
+    void Flush(const FIPv4Endpoint& Target, FPendingDatagram& Pending);
+
+    /** 대상별 묶음 버퍼 */
+    TMap<FIPv4Endpoint, FPendingDatagram> PendingDatagrams;
+
+    /** v1 묶음 헤더에 기록할 프로젝트 ID */
+    FGuid ProjectId;
+
+    /** 압축 묶음 헤더에 기록할 세션 토큰 */
+    uint32 SessionToken;
+
+    /** 묶음 데이터그램 최대 크기 */
+    int32 MaxDatagramSize;
+
+    /** 지연 기한 (초) */
+    double FlushDeadlineSeconds;
+
+    /** 송신 스케줄러 (소유하지 않음) */
+    FTrafficScheduler* Scheduler;
+
+    /** 통계 */
+    FCoalescingStats Stats;
+};
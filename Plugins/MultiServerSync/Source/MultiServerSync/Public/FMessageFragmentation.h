@@ -0,0 +1,256 @@
+﻿// Copyright Your Company. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/BitArray.h"
+#include "Interfaces/IPv4/IPv4Endpoint.h"
+
+/**
+ * 조각 헤더
+ * 조각 데이터그램은 공통 메시지 헤더(유형 Fragment) 뒤에 이 헤더와 원본 페이로드의 일부를 담음
+ */
+#pragma pack(push, 1)
+struct FFragmentHeader
+{
+    uint32 MessageId;       // 조각난 메시지 ID (발신자 단위로 고유)
+    uint32 TotalSize;       // 원본 페이로드 전체 크기 (바이트)
+    uint32 Offset;          // 이 조각이 담은 페이로드의 시작 위치
+    uint16 FragmentIndex;   // 조각 번호 (0부터)
+    uint16 FragmentCount;   // 전체 조각 수
+    uint8 OriginalType;     // 원본 메시지 유형 (ENetworkMessageType)
+};
+#pragma pack(pop)
+
+/**
+ * 누락 조각 재전송 요청
+ * 재조립이 멈춘 메시지의 누락 조각 번호만 발신자에게 요청
+ */
+struct MULTISERVERSYNC_API FFragmentNack
+{
+    uint32 MessageId;                  // 재조립 중인 메시지 ID
+    TArray<uint16> MissingFragments;   // 누락된 조각 번호
+
+    FFragmentNack()
+        : MessageId(0)
+    {
+    }
+
+    /** 직렬화 (메시지 ID 4 + 개수 2 + 조각 번호 2 * 개수) */
+    TArray<uint8> Serialize() const;
+
+    /** 바이트 뷰에서 역직렬화 (크기가 맞지 않으면 false) */
+    bool Deserialize(TArrayView<const uint8> Bytes);
+
+    /** 조각 번호를 제외한 직렬화 크기 */
+    static constexpr int32 FIXED_SIZE = sizeof(uint32) + sizeof(uint16);
+};
+
+/**
+ * 조각화/재조립 통계
+ */
+struct FFragmentationStats
+{
+    uint64 CompletedMessages;    // 재조립을 마친 메시지 수
+    uint64 ExpiredMessages;      // 재조립 시간 초과로 버린 메시지 수
+    uint64 EvictedMessages;      // 재조립 메모리 한도 때문에 버린 메시지 수
+    uint64 DuplicateFragments;   // 이미 받은 조각 수
+    uint64 RejectedFragments;    // 헤더가 잘못되었거나 한도를 넘어 버린 조각 수
+    uint64 NacksSent;            // 보낸 재전송 요청 수
+    uint64 RetransmittedFragments; // 재전송 요청을 받아 다시 보낸 조각 수
+    int32 PendingMessages;       // 재조립 중인 메시지 수
+    int64 BufferedBytes;         // 재조립 중인 메시지가 차지하는 메모리 (바이트)
+
+    FFragmentationStats()
+        : CompletedMessages(0)
+        , ExpiredMessages(0)
+        , EvictedMessages(0)
+        , DuplicateFragments(0)
+        , RejectedFragments(0)
+        , NacksSent(0)
+        , RetransmittedFragments(0)
+        , PendingMessages(0)
+        , BufferedBytes(0)
+    {
+    }
+};
+
+/** 조각 추가 결과 */
+enum class EFragmentResult : uint8
+{
+    Incomplete = 0, // 아직 누락된 조각이 있음
+    Complete = 1,   // 마지막 조각이 도착하여 페이로드가 완성됨
+    Duplicate = 2,  // 이미 받은 조각이거나 이미 완성된 메시지의 조각
+    Rejected = 3    // 헤더가 잘못되었거나 메시지가 재조립 메모리 한도보다 큼
+};
+
+/**
+ * 조각 재조립기
+ * 메시지마다 페이로드 전체 크기의 버퍼와 조각 수신 비트맵을 두고, 조각 순서와 무관하게 제자리에 복사
+ * 재조립 중인 메시지 전체가 차지하는 메모리에 상한을 두고, 넘치면 가장 오래된 메시지부터 버림
+ * FNetworkManager의 소유 스레드(게임 스레드)에서만 접근해야 함
+ */
+class MULTISERVERSYNC_API FFragmentReassembler
+{
+public:
+    /**
+     * 생성자
+     * @param InMaxBufferedBytes 재조립 중인 메시지 전체가 차지할 수 있는 최대 메모리 (바이트)
+     * @param InTimeoutSeconds 마지막 조각 이후 이 시간 동안 진척이 없으면 메시지를 버림
+     */
+    FFragmentReassembler(int64 InMaxBufferedBytes = DEFAULT_MAX_BUFFERED_BYTES, double InTimeoutSeconds = DEFAULT_TIMEOUT_SECONDS);
+
+    /** 기본 재조립 메모리 한도 */
+    static constexpr int64 DEFAULT_MAX_BUFFERED_BYTES = 16 * 1024 * 1024;
+
+    /** 기본 재조립 시간 제한 (초) */
+    static constexpr double DEFAULT_TIMEOUT_SECONDS = 5.0;
+
+    /** 늦게 도착한 중복 조각을 걸러내기 위해 기억할 최근 완성 메시지 수 */
+    static constexpr int32 RECENTLY_COMPLETED_CAPACITY = 256;
+
+    /**
+     * 조각을 추가합니다.
+     * @param SourceId 발신자 식별자 (피어 인덱스)
+     * @param Sender 발신자 엔드포인트 (재전송 요청 대상)
+     * @param Header 조각 헤더
+     * @param Chunk 조각이 담은 페이로드
+     * @param Now 현재 시간 (초)
+     * @param OutPayload Complete이면 완성된 페이로드
+     */
+    EFragmentResult AddFragment(uint32 SourceId, const FIPv4Endpoint& Sender, const FFragmentHeader& Header,
+        TArrayView<const uint8> Chunk, double Now, TArray<uint8>& OutPayload);
+
+    /** 시간 제한을 넘긴 메시지를 버리고 버린 개수 반환 */
+    int32 ExpireStale(double Now);
+
+    /** 재조립이 멈춘 메시지 */
+    struct FStalledMessage
+    {
+        FIPv4Endpoint Sender;              // 발신자 엔드포인트
+        FFragmentNack Nack;                // 보낼 재전송 요청
+    };
+
+    /**
+     * 마지막 조각 이후 NackDelay 이상 지난 메시지의 누락 조각 목록을 모읍니다.
+     * 같은 메시지에 대해 NackDelay마다 한 번씩만 반환합니다.
+     * @param MaxMissingPerMessage 메시지 하나의 재전송 요청에 담을 최대 조각 수
+     */
+    void CollectStalled(double Now, double NackDelay, int32 MaxMissingPerMessage, TArray<FStalledMessage>& OutStalled);
+
+    /** 재조립 중인 메시지를 모두 버림 */
+    void Reset();
+
+    /** 통계 반환 */
+    FFragmentationStats GetStats() const;
+
+    /** 통계에 재전송 요청/재전송 수 반영 (FNetworkManager에서 호출) */
+    void AddNacksSent(int32 Count) { Stats.NacksSent += Count; }
+    void AddRetransmittedFragments(int32 Count) { Stats.RetransmittedFragments += Count; }
+
+private:
+    /** 재조립 중인 메시지 */
+    struct FPartialMessage
+    {
+        FIPv4Endpoint Sender;              // 발신자 엔드포인트
+        TArray<uint8> Payload;             // 페이로드 전체 크기로 미리 할당한 버퍼
+        uint32 TotalSize;                  // 페이로드 전체 크기 (재조립 메모리 사용량)
+        TBitArray<> ReceivedFragments;     // 조각별 수신 여부
+        int32 ReceivedCount;               // 받은 조각 수
+        uint16 FragmentCount;              // 전체 조각 수
+        uint8 OriginalType;                // 원본 메시지 유형
+        double FirstFragmentTime;          // 첫 조각 수신 시간
+        double LastFragmentTime;           // 마지막 조각 수신 시간
+        double LastNackTime;               // 마지막 재전송 요청 시간
+    };
+
+    /** 발신자와 메시지 ID로 만든 키 */
+    static uint64 MakeKey(uint32 SourceId, uint32 MessageId)
+    {
+        return (static_cast<uint64>(SourceId) << 32) | static_cast<uint64>(MessageId);
+    }
+
+    /** 새 메시지를 위해 가장 오래된 메시지부터 버려 Bytes만큼 공간 확보 */
+    void EvictFor(int64 Bytes);
+
+    /** 메시지를 제거하고 메모리 사용량 갱신 */
+    void RemovePartial(uint64 Key);
+
+    /** 최근 완성 메시지인지 여부 */
+    bool WasRecentlyCompleted(uint64 Key) const;
+
+    /** 재조립 중인 메시지 */
+    TMap<uint64, FPartialMessage> PartialMessages;
+
+    /** 최근 완성 메시지 키 링 */
+    TArray<uint64> RecentlyCompleted;
+    int32 RecentlyCompletedNext;
+
+    /** 재조립 메모리 한도 */
+    int64 MaxBufferedBytes;
+
+    /** 재조립 시간 제한 */
+    double TimeoutSeconds;
+
+    /** 현재 재조립 메모리 사용량 */
+    int64 BufferedBytes;
+
+    /** 통계 */
+    FFragmentationStats Stats;
+};
+
+/**
+ * 보낸 조각 보관소
+ * 수신 측의 재전송 요청에 누락 조각만 다시 보낼 수 있도록 최근에 보낸 조각 데이터그램을 보관
+ * 보관 메모리와 보관 시간에 상한을 두며, 넘치면 가장 오래된 메시지부터 버림
+ */
+class MULTISERVERSYNC_API FFragmentSendCache
+{
+public:
+    /**
+     * 생성자
+     * @param InMaxCachedBytes 보관할 최대 메모리 (바이트)
+     * @param InRetentionSeconds 보관 시간 (초, 수신 측 재조립 시간 제한과 같게 유지)
+     */
+    FFragmentSendCache(int64 InMaxCachedBytes = DEFAULT_MAX_CACHED_BYTES, double InRetentionSeconds = FFragmentReassembler::DEFAULT_TIMEOUT_SECONDS);
+
+    /** 기본 보관 메모리 한도 */
+    static constexpr int64 DEFAULT_MAX_CACHED_BYTES = 16 * 1024 * 1024;
+
+    /** 보낸 메시지의 조각 데이터그램 보관 */
+    void Add(uint32 MessageId, TArray<TArray<uint8>>&& Datagrams, double Now);
+
+    /** 메시지의 조각 데이터그램 조회 (없으면 nullptr) */
+    const TArray<TArray<uint8>>* Find(uint32 MessageId) const;
+
+    /** 보관 시간이 지난 메시지 제거 */
+    void Expire(double Now);
+
+    /** 모두 제거 */
+    void Reset();
+
+    /** 현재 보관 중인 메모리 (바이트) */
+    int64 GetCachedBytes() const { return CachedBytes; }
+
+private:
+    /** 보낸 메시지 */
+    struct FSentMessage
+    {
+        uint32 MessageId;
+        TArray<TArray<uint8>> Datagrams;
+        int64 Bytes;
+        double SendTime;
+    };
+
+    /** 보낸 순서대로 보관 (오래된 것부터) */
+    TArray<FSentMessage> Messages;
+
+    /** 보관 메모리 한도 */
+    int64 MaxCachedBytes;
+
+    /** 보관 시간 */
+    double RetentionSeconds;
+
+    /** 현재 보관 메모리 */
+    int64 CachedBytes;
+};
@@ -0,0 +1,221 @@
+﻿// Copyright Your Company. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Interfaces/IPv4/IPv4Address.h"
+#include <type_traits>
+
+/**
+ * 컴파일 타임 메시지 스키마
+ * 고정 길이 페이로드 구조체가 필드 목록을 TMessageSchema로 선언하면 인코딩/디코딩 코드와 인코딩 크기가 컴파일 타임에 생성됨
+ * 필드는 선언 순서대로 패딩 없이 리틀 엔디언으로 기록하며, 필드 오프셋과 크기가 모두 상수라 분기 없는 복사로 풀림
+ *
+ * 사용 예:
+ *   struct FExamplePayload
+ *   {
+ *       uint32 Id;
+ *       float Value;
+ *
+ *       using FSchema = TMessageSchema<FExamplePayload,
+ *           MSYNC_SCHEMA_FIELD(FExamplePayload, Id),
+ *           MSYNC_SCHEMA_FIELD(FExamplePayload, Value)>;
+ *   };
+ */
+
+/**
+ * 필드 타입별 와이어 형식 특성
+ * Size(인코딩 크기), Encode, Decode를 제공해야 하며, 지원하지 않는 타입은 정의되지 않아 컴파일 오류가 남
+ */
+template <typename ValueType, typename Enable = void>
+struct TWireTraits;
+
+/** 정수와 부동소수점: sizeof 그대로 리틀 엔디언 기록 */
+template <typename ValueType>
+struct TWireTraits<ValueType, std::enable_if_t<std::is_arithmetic_v<ValueType> && !std::is_same_v<ValueType, bool>>>
+{
+    static constexpr int32 Size = sizeof(ValueType);
+
+    static FORCEINLINE void Encode(uint8* Out, const ValueType& Value)
+    {
+#if PLATFORM_LITTLE_ENDIAN
+        FMemory::Memcpy(Out, &Value, Size);
+#else
+        const uint8* Source = reinterpret_cast<const uint8*>(&Value);
+        for (int32 Index = 0; Index < Size; ++Index)
+        {
+            Out[Index] = Source[Size - 1 - Index];
+        }
+#endif
+    }
+
+    static FORCEINLINE void Decode(const uint8* In, ValueType& OutValue)
+    {
+#if PLATFORM_LITTLE_ENDIAN
+        FMemory::Memcpy(&OutValue, In, Size);
+#else
+        uint8* Target = reinterpret_cast<uint8*>(&OutValue);
+        for (int32 Index = 0; Index < Size; ++Index)
+        {
+            Target[Index] = In[Size - 1 - Index];
+        }
+#endif
+    }
+};
+
+/** 열거형: 기반 정수 타입으로 기록 */
+template <typename ValueType>
+struct TWireTraits<ValueType, std::enable_if_t<std::is_enum_v<ValueType>>>
+{
+    using FUnderlyingType = std::underlying_type_t<ValueType>;
+    using FUnderlyingTraits = TWireTraits<FUnderlyingType>;
+
+    static constexpr int32 Size = FUnderlyingTraits::Size;
+
+    static FORCEINLINE void Encode(uint8* Out, const ValueType& Value)
+    {
+        FUnderlyingTraits::Encode(Out, static_cast<FUnderlyingType>(Value));
+    }
+
+    static FORCEINLINE void Decode(const uint8* In, ValueType& OutValue)
+    {
+        FUnderlyingType Raw;
+        FUnderlyingTraits::Decode(In, Raw);
+        OutValue = static_cast<ValueType>(Raw);
+    }
+};
+
+/** bool: 1바이트 (0이 아니면 true) */
+template <>
+struct TWireTraits<bool>
+{
+    static constexpr int32 Size = 1;
+
+    static FORCEINLINE void Encode(uint8* Out, const bool& Value)
+    {
+        *Out = static_cast<uint8>(Value);
+    }
+
+    static FORCEINLINE void Decode(const uint8* In, bool& OutValue)
+    {
+        OutValue = *In != 0;
+    }
+};
+
+/** IPv4 주소: 32비트 값으로 기록 */
+template <>
+struct TWireTraits<FIPv4Address>
+{
+    static constexpr int32 Size = TWireTraits<uint32>::Size;
+
+    static FORCEINLINE void Encode(uint8* Out, const FIPv4Address& Value)
+    {
+        TWireTraits<uint32>::Encode(Out, Value.Value);
+    }
+
+    static FORCEINLINE void Decode(const uint8* In, FIPv4Address& OutValue)
+    {
+        TWireTraits<uint32>::Decode(In, OutValue.Value);
+    }
+};
+
+/** 고정 길이 바이트 배열: 그대로 복사 */
+template <SIZE_T Count>
+struct TWireTraits<uint8[Count], void>
+{
+    static constexpr int32 Size = static_cast<int32>(Count);
+
+    static FORCEINLINE void Encode(uint8* Out, const uint8 (&Value)[Count])
+    {
+        FMemory::Memcpy(Out, Value, Count);
+    }
+
+    static FORCEINLINE void Decode(const uint8* In, uint8 (&OutValue)[Count])
+    {
+        FMemory::Memcpy(OutValue, In, Count);
+    }
+};
+
+/**
+ * 스키마 필드 서술자
+ * 구조체 멤버 포인터를 템플릿 인자로 받아 해당 멤버의 인코딩 크기와 인코딩/디코딩 함수를 제공
+ */
+template <typename StructType, typename FieldType, FieldType StructType::*Member>
+struct TSchemaField
+{
+    using FStructType = StructType;
+    using FTraits = TWireTraits<FieldType>;
+
+    static constexpr int32 Size = FTraits::Size;
+
+    static FORCEINLINE void Encode(uint8*& Cursor, const StructType& Source)
+    {
+        FTraits::Encode(Cursor, Source.*Member);
+        Cursor += Size;
+    }
+
+    static FORCEINLINE void Decode(const uint8*& Cursor, StructType& Target)
+    {
+        FTraits::Decode(Cursor, Target.*Member);
+        Cursor += Size;
+    }
+};
+
+/** 구조체 멤버로 스키마 필드 서술자 생성 */
+#define MSYNC_SCHEMA_FIELD(StructType, Member) TSchemaField<StructType, decltype(StructType::Member), &StructType::Member>
+
+/**
+ * 메시지 스키마
+ * 필드 서술자 목록으로부터 인코딩 크기(EncodedSize)와 인코딩/디코딩 함수를 생성
+ */
+template <typename StructType, typename... FieldTypes>
+struct TMessageSchema
+{
+    static_assert(sizeof...(FieldTypes) > 0, "Message schema must declare at least one field");
+    static_assert((std::is_same_v<typename FieldTypes::FStructType, StructType> && ...), "Schema fields must belong to the schema struct");
+
+    /** 인코딩 크기 (모든 필드 크기의 합) */
+    static constexpr int32 EncodedSize = (FieldTypes::Size + ...);
+
+    /** Out에 EncodedSize 바이트를 기록 (호출자가 공간을 보장해야 함) */
+    static FORCEINLINE void EncodeTo(uint8* Out, const StructType& Source)
+    {
+        uint8* Cursor = Out;
+        (FieldTypes::Encode(Cursor, Source), ...);
+    }
+
+    /** In에서 EncodedSize 바이트를 읽음 (호출자가 크기를 확인해야 함) */
+    static FORCEINLINE void DecodeFrom(const uint8* In, StructType& Target)
+    {
+        const uint8* Cursor = In;
+        (FieldTypes::Decode(Cursor, Target), ...);
+    }
+
+    /** 새 바이트 배열로 인코딩 */
+    static TArray<uint8> Encode(const StructType& Source)
+    {
+        TArray<uint8> Result;
+        Result.SetNumUninitialized(EncodedSize);
+        EncodeTo(Result.GetData(), Source);
+        return Result;
+    }
+
+    /** 바이트 배열 끝에 이어서 인코딩 */
+    static void Append(TArray<uint8>& Out, const StructType& Source)
+    {
+        const int32 Offset = Out.AddUninitialized(EncodedSize);
+        EncodeTo(Out.GetData() + Offset, Source);
+    }
+
+    /** 바이트 뷰에서 디코딩 (EncodedSize보다 짧으면 false, 뒤에 붙은 바이트는 무시) */
+    static bool Decode(TArrayView<const uint8> Bytes, StructType& Target)
+    {
+        if (Bytes.Num() < EncodedSize)
+        {
+            return false;
+        }
+
+        DecodeFrom(Bytes.GetData(), Target);
+        return true;
+    }
+};
@@ -4,6 +4,19 @@
 
 #include "CoreMinimal.h"
 #include "ModuleInterfaces.h"
+#include "FNetworkTransport.h"
+#include "FNetworkReactor.h"
+#include "FPeerRegistry.h"
+#include "FTrafficScheduler.h"
+#include "FMessageCoalescer.h"
+#include "FReceiverThreadSettings.h"
+#include "FLatencyHistogram.h"
+#include "FSelectiveAck.h"
+#include "FMessageFragmentation.h"
+#include "FMasterProtocol.h"
+#include "FMessageSchema.h"
+#include "FProjectSettings.h"
+#include "SpscBoundedQueue.h"
 #include "Common/UdpSocketBuilder.h"
 #include "Sockets.h"
 #include "SocketSubsystem.h"
@@ -22,6 +35,8 @@ enum class ENetworkMessageType : uint8
     FrameSync = 3,    // 프레임 동기화 메시지
     Command = 4,      // 일반 명령 메시지
     Data = 5,         // 데이터 전송 메시지
+    Fragment = 6,     // 한 데이터그램에 담기지 않는 메시지의 조각 (FFragmentHeader + 페이로드 일부)
+    Batch = 7,        // 여러 메시지를 묶은 데이터그램 (직렬화된 메시지를 헤더째 이어 붙임)
 
     // 마스터-슬레이브 프로토콜 관련 메시지
     MasterAnnouncement = 10,  // 마스터가 자신의 상태를 알림
@@ -44,6 +59,7 @@ enum class ENetworkMessageType : uint8
     // 메시지 확인 관련 메시지
     MessageAck = 40,         // 메시지 확인 응답
     MessageRetry = 41,       // 메시지 재전송 요청
+    FragmentNack = 42,       // 누락 조각 재전송 요청
 
     Custom = 255      // 사용자 정의 메시지
 };
@@ -64,30 +80,97 @@ struct FNetworkMessageHeader
     uint16 Size;               // 메시지 크기 (헤더 포함)
     uint16 SequenceNumber;     // 시퀀스 번호
     FGuid ProjectId;           // 프로젝트 ID
-    uint8 Version;             // 프로토콜 버전
+    uint8 Version;             // 프로토콜 버전 (v1 헤더에서는 송신 노드가 지원하는 최고 버전)
     uint8 Flags;               // 플래그
 };
 #pragma pack(pop)
 
 // 핑 메시지 구조체
-struct FPingMessage
+struct MULTISERVERSYNC_API FPingMessage
 {
     EPingMessageType Type;      // 메시지 타입
     uint64 Timestamp;           // 발신 타임스탬프
     uint32 SequenceNumber;      // 시퀀스 번호
+    uint32 HoldTimeMicroseconds = 0; // 응답 측이 요청 도착부터 응답 송신까지 붙잡고 있던 시간 (요청은 0)
 
     // 직렬화 함수
     void Serialize(FMemoryWriter& Writer) const;
 
     // 역직렬화 함수
     void Deserialize(FMemoryReader& Reader);
+
+    // 와이어 스키마 (FMemoryWriter 경로와 같은 바이트열을 생성)
+    using FSchema = TMessageSchema<FPingMessage,
+        MSYNC_SCHEMA_FIELD(FPingMessage, Type),
+        MSYNC_SCHEMA_FIELD(FPingMessage, Timestamp),
+        MSYNC_SCHEMA_FIELD(FPingMessage, SequenceNumber),
+        MSYNC_SCHEMA_FIELD(FPingMessage, HoldTimeMicroseconds)>;
+
+    // 보류 시간 필드가 없던 이전 버전의 스키마 (이전 버전 노드의 응답 수신용)
+    using FLegacySchema = TMessageSchema<FPingMessage,
+        MSYNC_SCHEMA_FIELD(FPingMessage, Type),
+        MSYNC_SCHEMA_FIELD(FPingMessage, Timestamp),
+        MSYNC_SCHEMA_FIELD(FPingMessage, SequenceNumber)>;
+
+    // 스키마로 직렬화
+    TArray<uint8> Serialize() const { return FSchema::Encode(*this); }
+
+    // 바이트 뷰에서 복사 없이 역직렬화 (이전 버전 페이로드는 보류 시간 0으로 읽음, 크기가 부족하면 false)
+    bool Deserialize(TArrayView<const uint8> Bytes)
+    {
+        HoldTimeMicroseconds = 0;
+        return Bytes.Num() >= FSchema::EncodedSize ? FSchema::Decode(Bytes, *this) : FLegacySchema::Decode(Bytes, *this);
+    }
+
+    // 직렬화된 크기 (타입 1 + 타임스탬프 8 + 시퀀스 4 + 보류 시간 4)
+    static constexpr int32 SERIALIZED_SIZE = FSchema::EncodedSize;
+
+    // 이전 버전의 직렬화된 크기 (보류 시간 없음)
+    static constexpr int32 LEGACY_SERIALIZED_SIZE = FLegacySchema::EncodedSize;
 };
 
+static_assert(FPingMessage::SERIALIZED_SIZE == 17, "FPingMessage wire size changed");
+static_assert(FPingMessage::LEGACY_SERIALIZED_SIZE == 13, "FPingMessage legacy wire size changed");
+
+/**
+ * 메시지 유형별 페이로드 구조체 바인딩
+ * 고정 길이 스키마 페이로드를 쓰는 메시지 유형만 특수화하며, 나머지 유형의 Type은 void
+ * FNetworkMessage::MakePayloadMessage와 FNetworkMessageView::ReadPayload가 이 바인딩으로 페이로드 타입을 컴파일 타임에 검사
+ */
+template <ENetworkMessageType MessageType>
+struct TMessagePayload
+{
+    using Type = void;
+};
+
+/** 메시지 유형에 페이로드 구조체를 바인딩 (구조체에 스키마가 없거나 크기가 어긋나면 컴파일 오류) */
+#define MSYNC_BIND_MESSAGE_PAYLOAD(MessageType, PayloadType) \
+    template <> \
+    struct TMessagePayload<ENetworkMessageType::MessageType> \
+    { \
+        using Type = PayloadType; \
+    }; \
+    static_assert(PayloadType::FSchema::EncodedSize == PayloadType::SERIALIZED_SIZE, #PayloadType " schema does not match its serialized size")
+
+MSYNC_BIND_MESSAGE_PAYLOAD(MasterAnnouncement, FMasterInfoPayload);
+MSYNC_BIND_MESSAGE_PAYLOAD(MasterQuery, FServerIdPayload);
+MSYNC_BIND_MESSAGE_PAYLOAD(MasterResponse, FMasterInfoPayload);
+MSYNC_BIND_MESSAGE_PAYLOAD(MasterElection, FMasterElectionPayload);
+MSYNC_BIND_MESSAGE_PAYLOAD(MasterVote, FMasterVotePayload);
+MSYNC_BIND_MESSAGE_PAYLOAD(MasterResign, FServerIdPayload);
+MSYNC_BIND_MESSAGE_PAYLOAD(RoleChange, FRoleChangePayload);
+MSYNC_BIND_MESSAGE_PAYLOAD(PingRequest, FPingMessage);
+MSYNC_BIND_MESSAGE_PAYLOAD(PingResponse, FPingMessage);
+
+/** 메시지 유형에 바인딩된 페이로드 구조체 */
+template <ENetworkMessageType MessageType>
+using TMessagePayloadType = typename TMessagePayload<MessageType>::Type;
+
 /**
  * 네트워크 메시지 클래스
  * 네트워크를 통해 전송되는 메시지를 표현
  */
-class FNetworkMessage
+class MULTISERVERSYNC_API FNetworkMessage
 {
 public:
     /** 기본 생성자 */
@@ -99,9 +182,52 @@ public:
     /** 원시 데이터에서 메시지를 파싱하는 생성자 */
     FNetworkMessage(const TArray<uint8>& RawData);
 
+    /**
+     * 메시지 유형에 바인딩된 페이로드 구조체를 스키마로 인코딩해 메시지를 만듭니다.
+     * 페이로드 타입이 TMessagePayload 바인딩과 다르면 컴파일 오류
+     */
+    template <ENetworkMessageType MessageType, typename PayloadType>
+    static FNetworkMessage MakePayloadMessage(const PayloadType& Payload)
+    {
+        static_assert(std::is_same_v<PayloadType, TMessagePayloadType<MessageType>>, "Payload struct is not bound to this message type");
+        return FNetworkMessage(MessageType, PayloadType::FSchema::Encode(Payload));
+    }
+
     /** 메시지 직렬화 */
     TArray<uint8> Serialize() const;
 
+    /**
+     * v2 압축 헤더로 직렬화합니다.
+     * 프로젝트 ID와 매직 넘버 대신 세션 토큰을 쓰고 크기와 시퀀스 번호를 가변 길이로 기록하므로,
+     * 탐색으로 v2 지원을 확인한 피어에게만 보내야 함
+     * @param SessionToken 프로젝트 ID로 만든 세션 토큰 (MakeSessionToken)
+     */
+    TArray<uint8> SerializeCompact(uint32 SessionToken) const;
+
+    /**
+     * v2 압축 헤더를 기록합니다.
+     * @param Out 최소 MAX_COMPACT_HEADER_SIZE 바이트의 버퍼
+     * @param PayloadSize 헤더 뒤에 이어지는 페이로드 크기
+     * @return 기록한 헤더 크기
+     */
+    static int32 WriteCompactHeader(uint8* Out, ENetworkMessageType Type, uint8 Flags, uint16 SequenceNumber, uint32 SessionToken, int32 PayloadSize);
+
+    /** 프로젝트 ID로 세션 토큰 생성 (같은 프로젝트의 노드는 같은 토큰을 가짐) */
+    static uint32 MakeSessionToken(const FGuid& ProjectId);
+
+    /** 직렬화된 크기 (헤더 포함, 헤더의 uint16 Size로 표현할 수 없는 크기일 수 있음) */
+    int32 GetSerializedSize() const { return sizeof(FNetworkMessageHeader) + Data.Num(); }
+
+    /**
+     * 페이로드를 MaxDatagramSize 이하의 조각 데이터그램으로 나눠 직렬화합니다.
+     * 각 조각은 유형이 Fragment인 독립 메시지로, 원본 헤더의 시퀀스 번호/프로젝트 ID/플래그를 그대로 가짐
+     * @param MessageId 발신자 단위로 고유한 메시지 ID
+     * @param MaxDatagramSize 조각 데이터그램 최대 크기 (경로 MTU에서 IP/UDP 헤더를 뺀 값)
+     * @param OutDatagrams 조각 데이터그램 (조각 번호 순)
+     * @return 조각 수가 uint16 범위를 넘거나 MaxDatagramSize가 너무 작으면 false
+     */
+    bool SerializeFragments(uint32 MessageId, int32 MaxDatagramSize, TArray<TArray<uint8>>& OutDatagrams) const;
+
     /** 메시지 역직렬화 */
     bool Deserialize(const TArray<uint8>& RawData);
 
@@ -129,7 +255,45 @@ public:
     /** 플래그 설정하기 */
     void SetFlags(uint8 InFlags) { Header.Flags = InFlags; }
 
+    /** 헤더 가져오기 */
+    const FNetworkMessageHeader& GetHeader() const { return Header; }
+
+    /** 플래그: 받는 쪽이 ACK를 보내야 함 (시퀀스 번호는 대상 피어의 신뢰성 공간) */
+    static constexpr uint8 FLAG_ACK_REQUIRED = 1 << 0;
+
+    /** 플래그: 묶지 않고 즉시 전송 */
+    static constexpr uint8 FLAG_BYPASS_COALESCING = 1 << 1;
+
+    /** 플래그: 페이로드 끝에 같은 피어에게 보내는 선택적 ACK 블록이 실려 있음 (수신 측이 떼어내고 처리) */
+    static constexpr uint8 FLAG_HAS_ACK = 1 << 2;
+
+    /** 플래그: 선택적 ACK의 첫 블록이 누적 ACK 지점 (MessageAck 메시지 또는 FLAG_HAS_ACK와 함께 사용) */
+    static constexpr uint8 FLAG_CUMULATIVE_ACK = 1 << 3;
+
+    /** 플래그로 시퀀스 공간 구분 */
+    static ESequenceChannel GetSequenceChannel(uint8 Flags)
+    {
+        return (Flags & FLAG_ACK_REQUIRED) ? ESequenceChannel::Reliable : ESequenceChannel::Unreliable;
+    }
+
+    /** v2 압축 헤더를 사용하는 프로토콜 버전 */
+    static constexpr uint8 COMPACT_HEADER_VERSION = 2;
+
+    /** 묶음(Batch) 데이터그램을 풀 수 있는 프로토콜 버전 (v1 노드는 알 수 없는 유형으로 버림) */
+    static constexpr uint8 BATCH_MESSAGE_VERSION = 2;
+
+    /** FLAG_HAS_ACK로 실린 ACK를 떼어낼 수 있는 프로토콜 버전 (v1 노드는 ACK 블록을 페이로드로 읽음) */
+    static constexpr uint8 PIGGYBACK_ACK_VERSION = 2;
+
+    /** 압축 헤더 첫 바이트 (상위 4비트 0xB와 버전, v1 매직 넘버의 첫 바이트 0x4E와 겹치지 않음) */
+    static constexpr uint8 COMPACT_HEADER_MARKER = 0xB0 | COMPACT_HEADER_VERSION;
+
+    /** 압축 헤더 최대 크기 (표식 1 + 유형 1 + 플래그 1 + 세션 토큰 4 + 페이로드 크기 최대 3 + 시퀀스 번호 최대 3) */
+    static constexpr int32 MAX_COMPACT_HEADER_SIZE = 13;
+
 private:
+    friend class FNetworkMessageView;
+
     /** 메시지 헤더 */
     FNetworkMessageHeader Header;
 
@@ -139,10 +303,150 @@ private:
     /** 매직 넘버 - "MSYN" */
     static const uint32 MESSAGE_MAGIC = 0x4D53594E;
 
-    /** 프로토콜 버전 */
-    static const uint8 PROTOCOL_VERSION = 1;
+    /** 프로토콜 버전 (v1 헤더의 Version에 기록하여 탐색 시 지원하는 최고 버전을 알림) */
+    static const uint8 PROTOCOL_VERSION = COMPACT_HEADER_VERSION;
+};
+
+/**
+ * 네트워크 메시지 뷰
+ * 수신 버퍼를 복사하지 않고 헤더와 페이로드를 가리키는 비소유 뷰
+ * 가리키는 버퍼(FPacketBuffer 또는 TArray)보다 오래 사용하면 안 됨
+ */
+class MULTISERVERSYNC_API FNetworkMessageView
+{
+public:
+    /** 기본 생성자 (빈 뷰) */
+    FNetworkMessageView();
+
+    /** 기존 메시지를 가리키는 뷰 생성 */
+    explicit FNetworkMessageView(const FNetworkMessage& Message);
+
+    /** 헤더와 별도 페이로드로 뷰 생성 (재조립한 메시지 용, 헤더의 Size는 검사하지 않음) */
+    FNetworkMessageView(const FNetworkMessageHeader& InHeader, TArrayView<const uint8> InPayload);
+
+    /**
+     * 원시 데이터그램을 복사 없이 파싱합니다.
+     * v1 헤더와 v2 압축 헤더를 모두 받으며, 압축 헤더는 v1 헤더 구조체로 풀어 보관합니다 (프로젝트 ID는 비어 있음).
+     * @return 매직 넘버(압축 헤더는 표식)와 크기가 올바르면 true
+     */
+    bool Parse(TArrayView<const uint8> RawData);
+
+    /** v2 압축 헤더로 받은 메시지인지 여부 */
+    bool IsCompact() const { return bCompact; }
+
+    /** 압축 헤더의 세션 토큰 (v1 메시지면 0) */
+    uint32 GetSessionToken() const { return SessionToken; }
+
+    /** 메시지 유형 가져오기 */
+    ENetworkMessageType GetType() const { return Header.Type; }
+
+    /** 메시지 데이터(페이로드) 가져오기 */
+    TArrayView<const uint8> GetData() const { return Payload; }
+
+    /** 페이로드를 소유 배열로 복사 (TArray를 요구하는 기존 API 용) */
+    TArray<uint8> CopyData() const { return TArray<uint8>(Payload.GetData(), Payload.Num()); }
+
+    /**
+     * 메시지 유형에 바인딩된 페이로드 구조체로 페이로드를 디코딩합니다.
+     * @return 페이로드가 스키마 크기보다 짧으면 false
+     */
+    template <ENetworkMessageType MessageType>
+    bool ReadPayload(TMessagePayloadType<MessageType>& OutPayload) const
+    {
+        using FPayloadType = TMessagePayloadType<MessageType>;
+        static_assert(!std::is_void_v<FPayloadType>, "Message type has no bound payload struct");
+        return FPayloadType::FSchema::Decode(Payload, OutPayload);
+    }
+
+    /** 프로젝트 ID 가져오기 */
+    FGuid GetProjectId() const { return Header.ProjectId; }
+
+    /** 시퀀스 번호 가져오기 */
+    uint16 GetSequenceNumber() const { return Header.SequenceNumber; }
+
+    /** 플래그 가져오기 */
+    uint8 GetFlags() const { return Header.Flags; }
+
+    /** 프로토콜 버전 가져오기 */
+    uint8 GetVersion() const { return Header.Version; }
+
+    /** 헤더 가져오기 */
+    const FNetworkMessageHeader& GetHeader() const { return Header; }
+
+    /**
+     * FLAG_HAS_ACK 메시지의 페이로드 끝에 실린 선택적 ACK를 떼어냅니다.
+     * 성공하면 페이로드에서 ACK 블록을 빼고 플래그를 지우므로, 이후 핸들러는 ACK 없이 보낸 메시지와 같은 뷰를 받음
+     * @return 플래그가 없거나 블록이 잘못되었으면 false
+     */
+    bool DetachPiggybackAck(FSelectiveAck& OutAck);
+
+    /** 원시 데이터 앞부분의 헤더에 기록된 메시지 크기 (헤더보다 짧으면 0, 묶음 데이터그램을 나눌 때 사용) */
+    static int32 PeekMessageSize(TArrayView<const uint8> RawData);
+
+    /** 데이터그램 도착 시각 (FPlatformTime::Cycles64 기준, 소켓에서 받은 메시지가 아니면 0) */
+    uint64 GetReceiveCycles() const { return ReceiveCycles; }
+
+    /** 데이터그램 도착 시각 설정 (FReceivedDatagram::ReceiveCycles) */
+    void SetReceiveCycles(uint64 InReceiveCycles) { ReceiveCycles = InReceiveCycles; }
+
+    /**
+     * 도착 후 지금까지 지난 시간(마이크로초)을 반환합니다.
+     * 핸들러는 자기 시계의 현재 시각에서 이 값을 빼 처리 시각 대신 도착 시각을 얻음 (도착 시각이 없으면 0)
+     */
+    int64 GetReceiveAgeMicroseconds() const;
+
+private:
+    /**
+     * v2 압축 헤더를 파싱합니다.
+     * @param OutHeaderSize 압축 헤더 크기
+     * @param OutPayloadSize 헤더에 기록된 페이로드 크기 (RawData 범위를 넘는지는 검사하지 않음)
+     * @return 표식과 가변 길이 필드가 올바르면 true
+     */
+    static bool ParseCompactHeader(TArrayView<const uint8> RawData, FNetworkMessageHeader& OutHeader, uint32& OutSessionToken, int32& OutHeaderSize, int32& OutPayloadSize);
+
+    /** 메시지 헤더 (패킹된 구조체의 비정렬 접근을 피하기 위해 27바이트만 복사) */
+    FNetworkMessageHeader Header;
+
+    /** 페이로드 뷰 */
+    TArrayView<const uint8> Payload;
+
+    /** 압축 헤더의 세션 토큰 */
+    uint32 SessionToken;
+
+    /** v2 압축 헤더로 받은 메시지인지 여부 */
+    bool bCompact;
+
+    /** 데이터그램 도착 시각 (FPlatformTime::Cycles64 기준) */
+    uint64 ReceiveCycles;
 };
 
+/**
+ * 메시지 구독자에게 전달되는 수신 메시지
+ * 수신 버퍼와 피어 레지스트리를 직접 가리키므로 핸들러 호출 중에만 유효 (보관하려면 페이로드와 SenderId를 복사해야 함)
+ */
+struct FReceivedNetworkMessage
+{
+    ENetworkMessageType Type;              // 메시지 유형
+    TArrayView<const uint8> Payload;       // 헤더를 제외한 페이로드
+    const FNetworkMessageView& Message;    // 헤더를 포함한 메시지 뷰 (시퀀스 번호, 플래그 등)
+    FIPv4Endpoint Sender;                  // 발신자 엔드포인트
+    FPeerId SenderPeerId;                  // 발신자 피어 ID (피어 레지스트리가 가득 차 등록되지 않았으면 INVALID_PEER_ID)
+    const FString& SenderId;               // 발신자 서버 ID (발견되지 않은 서버면 엔드포인트 문자열)
+
+    FReceivedNetworkMessage(const FNetworkMessageView& InMessage, const FIPv4Endpoint& InSender, FPeerId InSenderPeerId, const FString& InSenderId)
+        : Type(InMessage.GetType())
+        , Payload(InMessage.GetData())
+        , Message(InMessage)
+        , Sender(InSender)
+        , SenderPeerId(InSenderPeerId)
+        , SenderId(InSenderId)
+    {
+    }
+};
+
+/** 메시지 유형별 구독 델리게이트 */
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnNetworkMessageReceived, const FReceivedNetworkMessage&);
+
 /**
  * 서버 엔드포인트 정보 구조체
  * 발견된 각 서버의 정보를 저장
@@ -167,12 +471,16 @@ struct FServerEndpoint
     /** 프로젝트 버전 */
     FString ProjectVersion;
 
+    /** 탐색 메시지로 알려온 지원 프로토콜 버전 */
+    uint8 ProtocolVersion;
+
     /** 마지막 통신 시간 */
     double LastCommunicationTime;
 
     /** 생성자 */
     FServerEndpoint()
         : Port(0)
+        , ProtocolVersion(1)
         , LastCommunicationTime(0.0)
     {
     }
@@ -196,7 +504,8 @@ struct FServerEndpoint
  */
 struct FMasterInfo
 {
-    FString ServerId;             // 서버 고유 ID
+    FString ServerId;             // 서버 고유 ID (표시용, 탐색 전이면 해시 문자열)
+    FServerIdHash ServerIdHash;   // 서버 ID 해시 (마스터 식별은 이 값으로 함)
     FIPv4Address IPAddress;       // IP 주소
     uint16 Port;                  // 포트 번호
     float Priority;               // 마스터 우선순위 (높을수록 우선순위 높음)
@@ -204,7 +513,8 @@ struct FMasterInfo
     int32 ElectionTerm;           // 선출 기간 (선출될 때마다 증가)
 
     FMasterInfo()
-        : Port(0)
+        : ServerIdHash(0)
+        , Port(0)
         , Priority(0.0f)
         , LastUpdateTime(0.0)
         , ElectionTerm(0)
@@ -214,7 +524,7 @@ struct FMasterInfo
     // 두 마스터 정보가 동일한지 비교
     bool operator==(const FMasterInfo& Other) const
     {
-        return ServerId == Other.ServerId;
+        return ServerIdHash == Other.ServerIdHash;
     }
 
     // 마스터 정보를 문자열로 변환
@@ -225,31 +535,97 @@ struct FMasterInfo
     }
 };
 
+/**
+ * 수신 스레드 대기 방식
+ */
+enum class EReceiverWaitMode : uint8
+{
+    SleepPolling = 0, // 논블로킹 RecvFrom + 1ms 슬립 반복 (이전 방식)
+    EventDriven = 1   // 소켓 읽기 가능 상태까지 대기 후 큐에 쌓인 데이터그램을 모두 처리
+};
+
+/** 수신 데이터그램 처리 함수 */
+typedef TFunction<void(const TArray<uint8>&, const FIPv4Endpoint&)> FDatagramHandler;
+
+/** 수신 데이터그램 배치 처리 함수 (데이터그램은 호출 중에만 유효) */
+typedef TFunction<void(const FReceivedDatagram*, int32)> FDatagramBatchHandler;
+
 /**
  * 수신 스레드 클래스
- * 별도의 스레드에서 메시지 수신을 담당
+ * 별도의 스레드에서 메시지 수신을 담당하며, 여러 전송 계층을 리액터 하나로 함께 감시할 수 있음
  */
-class FNetworkReceiverWorker : public FRunnable
+class MULTISERVERSYNC_API FNetworkReceiverWorker : public FRunnable
 {
 public:
-    /** 생성자 */
-    FNetworkReceiverWorker(class FNetworkManager* InOwner, FSocket* InSocket);
+    /** 생성자 (FSocket을 감싸고 데이터그램을 하나씩 임의의 핸들러로 전달) */
+    FNetworkReceiverWorker(FSocket* InSocket, FDatagramHandler InHandler, EReceiverWaitMode InWaitMode = EReceiverWaitMode::EventDriven);
+
+    /** 생성자 (데이터그램을 배치 단위로 임의의 핸들러로 전달) */
+    FNetworkReceiverWorker(INetworkTransport* InTransport, FDatagramBatchHandler InHandler, EReceiverWaitMode InWaitMode = EReceiverWaitMode::EventDriven);
 
     /** 소멸자 */
     virtual ~FNetworkReceiverWorker();
 
+    /**
+     * 같은 스레드에서 감시할 전송 계층을 추가합니다 (스레드 시작 전에만 호출).
+     * 여러 전송 계층이 동시에 준비되면 추가한 순서대로 처리하므로 지연에 민감한 전송 계층을 먼저 추가합니다.
+     */
+    bool AddTransport(INetworkTransport* InTransport, FDatagramBatchHandler InHandler);
+
     // FRunnable 인터페이스 구현
     virtual bool Init() override;
     virtual uint32 Run() override;
     virtual void Stop() override;
     virtual void Exit() override;
 
+    /** 대기 방식 반환 */
+    EReceiverWaitMode GetWaitMode() const { return WaitMode; }
+
+    /** 스레드 실행 설정 지정 (스레드 시작 전에만 호출, Init에서 수신 스레드 자신에게 적용) */
+    void SetThreadSettings(const FReceiverThreadSettings& InSettings) { ThreadSettings = InSettings; }
+
+    /** 스레드 실행 설정 반환 */
+    const FReceiverThreadSettings& GetThreadSettings() const { return ThreadSettings; }
+
+    /**
+     * 웨이크업 지연 히스토그램 반환
+     * 데이터그램 도착 시각(ReceiveCycles)부터 수신 스레드가 그 데이터그램을 읽을 때까지의 시간
+     */
+    FLatencyHistogram GetWakeupHistogram() const;
+
+    /** 이벤트 기반 모드의 최대 대기 시간 (밀리초) - 웨이크업이 전달되지 않아도 이 시간 내에 종료 */
+    static constexpr int32 RECEIVE_WAIT_TIMEOUT_MS = 100;
+
 private:
-    /** 소유자 */
-    class FNetworkManager* Owner;
+    /** 전송 계층에 대기 중인 데이터그램을 모두 읽어 배치 단위로 처리, 처리한 개수 반환 */
+    int32 DrainPendingDatagrams(int32 TransportIndex, FReceivedDatagram* Batch);
+
+    /** 리액터에 웨이크업 디스크립터가 없을 때 대기를 깨우기 위해 첫 번째 전송 계층으로 자기 자신에게 빈 데이터그램 전송 */
+    void SendWakeUpDatagram();
+
+    /** 스레드 실행 설정을 현재 스레드와 전송 계층에 적용 (수신 스레드에서 호출) */
+    void ApplyThreadSettings();
+
+    /** 도착 시각이 있는 데이터그램의 웨이크업 지연을 히스토그램에 기록 */
+    void RecordWakeupLatency(const FReceivedDatagram* Batch, int32 Count);
+
+    /** 감시 중인 전송 계층 */
+    FNetworkReactor Reactor;
+
+    /** FSocket 생성자로 만든 경우 소유하는 전송 계층 */
+    TUniquePtr<INetworkTransport> OwnedTransport;
 
-    /** 소켓 */
-    FSocket* Socket;
+    /** 전송 계층별 수신 데이터그램 배치 처리 함수 (리액터 등록 인덱스 순) */
+    TArray<FDatagramBatchHandler> BatchHandlers;
+
+    /** 대기 방식 */
+    EReceiverWaitMode WaitMode;
+
+    /** 스레드 실행 설정 */
+    FReceiverThreadSettings ThreadSettings;
+
+    /** 웨이크업 지연 버킷 (수신 스레드만 증가시키고 다른 스레드는 읽기만 함) */
+    std::atomic<uint64> WakeupBuckets[FLatencyHistogram::NUM_BUCKETS];
 
     /** 중지 요청 플래그 */
     FThreadSafeBool bStopRequested;
@@ -258,11 +634,90 @@ private:
     FEvent* StopEvent;
 };
 
+/**
+ * 수신 채널 (데이터그램이 들어온 소켓)
+ */
+enum class ENetworkChannel : uint8
+{
+    Discovery = 0, // 브로드캐스트 탐색 소켓 (BROADCAST_PORT)
+    Data = 1,      // 유니캐스트 데이터 소켓 (Port)
+    TimeSync = 2,  // 시간 동기화/지연 측정 전용 저지연 소켓 (TIME_SYNC_PORT)
+    Multicast = 3  // 클러스터 전체 메시지 멀티캐스트 소켓 (MulticastSettings.Port)
+};
+
+/**
+ * 수신 인박스 항목
+ * 수신 스레드가 파싱한 메시지 뷰와 그 뷰가 가리키는 풀 버퍼를 함께 보관하여 복사 없이 소유 스레드로 전달
+ */
+struct FInboxPacket
+{
+    FPacketBufferRef Buffer;        // 메시지 데이터를 담고 있는 풀 버퍼
+    FNetworkMessageView Message;    // Buffer를 가리키는 메시지 뷰
+    FIPv4Endpoint Sender;           // 발신자 엔드포인트
+    double EnqueueTime;             // 인박스에 넣은 시간 (FPlatformTime::Seconds)
+
+    FInboxPacket()
+        : EnqueueTime(0.0)
+    {
+    }
+};
+
+/**
+ * 수신 인박스 통계
+ */
+struct FNetworkInboxStats
+{
+    int32 Depth;                        // 현재 대기 중인 패킷 수
+    int32 Capacity;                     // 인박스 용량
+    uint64 EnqueuedPackets;             // 인박스에 넣은 패킷 수
+    uint64 DroppedPackets;              // 인박스가 가득 차서 버린 패킷 수
+    uint64 DispatchedPackets;           // 소유 스레드에서 처리한 패킷 수
+    double LastDispatchLatencyMs;       // 마지막 패킷의 인박스 대기 시간 (밀리초)
+    double AverageDispatchLatencyMs;    // 평균 인박스 대기 시간 (밀리초)
+    double MaxDispatchLatencyMs;        // 최대 인박스 대기 시간 (밀리초)
+
+    FNetworkInboxStats()
+        : Depth(0)
+        , Capacity(0)
+        , EnqueuedPackets(0)
+        , DroppedPackets(0)
+        , DispatchedPackets(0)
+        , LastDispatchLatencyMs(0.0)
+        , AverageDispatchLatencyMs(0.0)
+        , MaxDispatchLatencyMs(0.0)
+    {
+    }
+};
+
+/**
+ * 멀티캐스트 전송 설정
+ * 활성화하면 탐색, 마스터 공지, 시간 동기화, 프레임 동기화 메시지를 서버마다 유니캐스트하지 않고 그룹으로 한 번만 전송
+ */
+struct FMulticastSettings
+{
+    bool bEnabled;                    // 멀티캐스트 전송 사용 여부
+    FIPv4Address GroupAddress;        // 멀티캐스트 그룹 주소 (관리 범위 239.0.0.0/8 권장)
+    uint16 Port;                      // 그룹 포트
+    FIPv4Address InterfaceAddress;    // 가입/송신 인터페이스 주소 (Any면 커널이 선택)
+    uint8 TimeToLive;                 // 송신 TTL (1이면 로컬 서브넷 한정)
+    bool bLoopback;                   // 같은 호스트의 가입 소켓에도 전달할지 여부 (한 호스트에서 여러 노드를 띄울 때 필요)
+
+    FMulticastSettings()
+        : bEnabled(false)
+        , GroupAddress(239, 255, 77, 1)
+        , Port(7003)
+        , InterfaceAddress(FIPv4Address::Any)
+        , TimeToLive(1)
+        , bLoopback(false)
+    {
+    }
+};
+
 /**
  * Network manager class that implements the INetworkManager interface
  * Handles all network communication between servers
  */
-class FNetworkManager : public INetworkManager
+class MULTISERVERSYNC_API FNetworkManager : public INetworkManager
 {
 public:
     /** Constructor */
@@ -338,6 +793,15 @@ public:
     /** 메시지 수신 처리 함수 (수신 스레드에서 호출) */
     void ProcessReceivedData(const TArray<uint8>& Data, const FIPv4Endpoint& Sender);
 
+    /** 수신 스레드가 한 번에 읽은 데이터그램 배치를 파싱하여 해당 샤드의 인박스에 넣음 (그 샤드의 수신 스레드에서 호출) */
+    void ProcessReceivedBatch(int32 ShardIndex, ENetworkChannel Channel, const FReceivedDatagram* Datagrams, int32 Count);
+
+    /** 모든 샤드의 인박스에 쌓인 메시지를 처리 (인박스 틱에서 호출, 처리한 개수 반환) */
+    int32 DrainInbox();
+
+    /** 파싱된 메시지 뷰 처리 - 수신 버퍼를 복사하지 않고 핸들러로 전달 */
+    void ProcessReceivedMessage(const FNetworkMessageView& Message, const FIPv4Endpoint& Sender);
+
     /** 서버 탐색 메시지 전송 */
     bool SendDiscoveryMessage();
 
@@ -350,7 +814,7 @@ public:
     /** 특정 서버로 메시지 전송 */
     bool SendMessageToEndpoint(const FIPv4Endpoint& Endpoint, const FNetworkMessage& Message);
 
-    /** 모든 발견된 서버로 메시지 브로드캐스트 */
+    /** 모든 발견된 서버로 메시지 브로드캐스트 (한 번만 직렬화하여 모든 서버로 팬아웃) */
     bool BroadcastMessageToServers(const FNetworkMessage& Message);
 
     /** 기본 포트 번호 */
@@ -359,12 +823,271 @@ public:
     /** 브로드캐스트 포트 번호 */
     static const int32 BROADCAST_PORT = 7001;
 
+    /** 시간 동기화 포트 번호 (PTP, 핑 요청/응답 전용) */
+    static const int32 TIME_SYNC_PORT = 7002;
+
+    /** 메시지 유형을 보낼 채널 반환 (시간 동기화와 지연 측정은 전용 소켓 사용) */
+    static ENetworkChannel GetChannelForMessageType(ENetworkMessageType Type);
+
+    /**
+     * 멀티캐스트가 활성화되었을 때 그룹으로 한 번만 보내는 클러스터 전체 메시지 유형인지 여부
+     * (탐색, 마스터 공지, 시간 동기화, 프레임 동기화)
+     */
+    static bool IsClusterWideMessageType(ENetworkMessageType Type);
+
     /** 시간 동기화 메시지 전송 */
     bool SendTimeSyncMessage(const TArray<uint8>& PTPMessage);
 
+    /** 프레임 동기화 메시지 전송 */
+    bool SendFrameSyncMessage(const TArray<uint8>& FrameSyncData);
+
+    /** 멀티캐스트 전송 설정 (Initialize 이전에 호출해야 적용됨) */
+    void SetMulticastSettings(const FMulticastSettings& InSettings) { MulticastSettings = InSettings; }
+
+    /** 멀티캐스트 전송 설정 반환 */
+    const FMulticastSettings& GetMulticastSettings() const { return MulticastSettings; }
+
+    /** 멀티캐스트 그룹에 가입하여 클러스터 전체 메시지를 그룹으로 보내고 있는지 여부 */
+    bool IsMulticastActive() const { return MulticastTransport.IsValid(); }
+
+    /** 멀티캐스트 전송 계층 통계 반환 (비활성 상태면 빈 통계) */
+    FTransportStats GetMulticastTransportStats() const { return MulticastTransport ? MulticastTransport->GetStats() : FTransportStats(); }
+
+    /** 수신 스레드 대기 방식 설정 (Initialize 이전에 호출해야 적용됨) */
+    void SetReceiverWaitMode(EReceiverWaitMode InWaitMode) { ReceiverWaitMode = InWaitMode; }
+
+    /** 수신 스레드 대기 방식 반환 */
+    EReceiverWaitMode GetReceiverWaitMode() const { return ReceiverWaitMode; }
+
+    /**
+     * 시간 동기화 수신 스레드(샤드 0) 실행 설정 (Initialize 이전에 호출해야 적용됨)
+     * 다른 샤드는 일반 스케줄링으로 동작하여 저지연 설정이 코어 하나만 점유하도록 함
+     */
+    void SetReceiverThreadSettings(const FReceiverThreadSettings& InSettings) { ReceiverThreadSettings = InSettings; }
+
+    /** 시간 동기화 수신 스레드 실행 설정 반환 */
+    const FReceiverThreadSettings& GetReceiverThreadSettings() const { return ReceiverThreadSettings; }
+
+    /** 수신 샤드의 웨이크업 지연 히스토그램 반환 (샤드가 없으면 빈 히스토그램) */
+    FLatencyHistogram GetReceiverWakeupHistogram(int32 ShardIndex = 0) const;
+
+    /** 수신 백엔드 설정 (Initialize 이전에 호출해야 적용됨) */
+    void SetReceiveBackend(EReceiveBackend InBackend) { ReceiveBackend = InBackend; }
+
+    /** 수신 백엔드 반환 */
+    EReceiveBackend GetReceiveBackend() const { return ReceiveBackend; }
+
+    /**
+     * 수신 샤드 수를 설정합니다 (Initialize 이전에 호출해야 적용됨).
+     * 2 이상이면 SO_REUSEPORT로 같은 포트에 샤드 수만큼 소켓을 열고 샤드마다 수신 스레드를 둡니다.
+     * 커널이 발신자 주소/포트 해시로 샤드를 고르므로 같은 피어의 패킷은 항상 한 샤드에서 순서대로 처리됩니다.
+     * SO_REUSEPORT를 지원하지 않는 플랫폼에서는 1로 동작합니다.
+     */
+    void SetReceiveShardCount(int32 InShardCount) { ReceiveShardCount = FMath::Clamp(InShardCount, 1, MAX_RECEIVE_SHARDS); }
+
+    /** 설정된 수신 샤드 수 반환 */
+    int32 GetReceiveShardCount() const { return ReceiveShardCount; }
+
+    /** 실제로 동작 중인 수신 샤드 수 반환 */
+    int32 GetActiveReceiveShardCount() const { return ReceiveShards.Num(); }
+
+    /** 최대 수신 샤드 수 */
+    static constexpr int32 MAX_RECEIVE_SHARDS = 16;
+
+    /**
+     * 경로 MTU를 설정합니다.
+     * 직렬화 크기가 MTU에서 IP/UDP 헤더를 뺀 값보다 큰 메시지는 조각으로 나눠 보내므로 IP 단편화가 일어나지 않습니다.
+     */
+    void SetPathMtu(int32 InPathMtu)
+    {
+        PathMtu = FMath::Clamp(InPathMtu, MIN_PATH_MTU, MAX_PATH_MTU);
+        MessageCoalescer.SetMaxDatagramSize(GetMaxDatagramSize());
+    }
+
+    /** 경로 MTU 반환 */
+    int32 GetPathMtu() const { return PathMtu; }
+
+    /** 조각으로 나누지 않고 보낼 수 있는 최대 데이터그램 크기 */
+    int32 GetMaxDatagramSize() const { return PathMtu - IPV4_UDP_HEADER_SIZE; }
+
+    /**
+     * 송신 메시지 병합을 켜거나 끕니다.
+     * 켜면 같은 대상으로 가는 작은 메시지를 틱마다(또는 지연 기한까지) 묶음 데이터그램 하나로 모아 보냅니다.
+     * 시간 동기화/핑 메시지와 FLAG_BYPASS_COALESCING 플래그가 있는 메시지는 항상 바로 보냅니다.
+     */
+    void SetCoalescingEnabled(bool bEnable);
+
+    /** 송신 메시지 병합 사용 여부 */
+    bool IsCoalescingEnabled() const { return bCoalescingEnabled; }
+
+    /** 묶음 지연 기한 설정 (초, 0이면 다음 인박스 틱에 보냄) */
+    void SetCoalescingDeadline(double Seconds) { MessageCoalescer.SetFlushDeadline(Seconds); }
+
+    /**
+     * v2 압축 헤더 사용 여부를 설정합니다.
+     * 켜면 탐색으로 v2 지원을 확인한 서버에게 프로젝트 ID 대신 세션 토큰을 쓰는 압축 헤더로 보냅니다.
+     * 탐색 메시지와 멀티캐스트 그룹으로 보내는 메시지는 v1 노드도 받을 수 있도록 항상 v1 헤더를 씁니다.
+     */
+    void SetCompactHeadersEnabled(bool bEnable);
+
+    /** v2 압축 헤더 사용 여부 */
+    bool IsCompactHeadersEnabled() const { return bCompactHeadersEnabled; }
+
+    /** 엔드포인트로 압축 헤더를 보낼 수 있는지 여부 (탐색으로 v2 지원을 확인한 서버의 주소면 포트와 무관) */
+    bool IsCompactHeaderPeer(const FIPv4Endpoint& Endpoint) const;
+
+    /** 엔드포인트로 묶음 데이터그램을 보낼 수 있는지 여부 (합의한 버전이 BATCH_MESSAGE_VERSION 이상인 주소) */
+    bool IsBatchCapablePeer(const FIPv4Endpoint& Endpoint) const;
+
+    /** 송신 메시지 병합 통계 반환 */
+    const FCoalescingStats& GetCoalescingStats() const { return MessageCoalescer.GetStats(); }
+
+    /** 묶지 않고 바로 보내야 하는 시간에 민감한 메시지 유형인지 여부 (PTP, 핑) */
+    static bool IsTimeCriticalMessageType(ENetworkMessageType Type);
+
+    /** 메시지 유형의 송신 트래픽 클래스 (PTP/핑은 Clock, 프레임 동기화는 Frame, 설정/데이터/조각은 Bulk, 나머지는 Control) */
+    static ETrafficClass GetTrafficClassForMessageType(ENetworkMessageType Type);
+
+    /**
+     * 트래픽 클래스의 페이싱과 DSCP 설정을 바꿉니다.
+     * DSCP는 소켓 단위로 표시하므로 각 소켓에는 그 소켓으로 나가는 클래스 중 DSCP를 지정한 가장 높은 우선순위 클래스의 값을 씁니다
+     * (시간 동기화 소켓은 Clock, 멀티캐스트 소켓은 Clock~Control, 데이터 소켓은 Frame~Bulk).
+     */
+    void SetTrafficClassConfig(ETrafficClass Class, const FTrafficClassConfig& Config);
+
+    /** 트래픽 클래스 설정 반환 */
+    const FTrafficClassConfig& GetTrafficClassConfig(ETrafficClass Class) const { return TrafficScheduler.GetClassConfig(Class); }
+
+    /** 트래픽 클래스별 송신 통계 반환 (대기열 깊이와 버린 데이터그램 수 포함) */
+    const FTrafficClassStats& GetTrafficClassStats(ETrafficClass Class) const { return TrafficScheduler.GetStats(Class); }
+
+    /**
+     * 지연 기반 혼잡 제어를 켜거나 끕니다.
+     * 켜면 피어별로 핑 RTT가 기준 RTT보다 목표 지연 이상 늘지 않도록 송신 속도를 조절하고,
+     * 대량 전송 클래스를 그 속도로 페이싱하며 ACK 대기 바이트가 윈도우를 넘는 신뢰성 메시지는 ACK가 올 때까지 보관합니다.
+     * 끄면 보관 중인 신뢰성 메시지를 바로 보내고 피어별 속도 제한을 해제합니다.
+     */
+    void SetCongestionControlEnabled(bool bEnable);
+
+    /** 혼잡 제어 사용 여부 */
+    bool IsCongestionControlEnabled() const { return bCongestionControlEnabled; }
+
+    /** 혼잡 제어 설정 (목표 지연 등, 다음 샘플부터 적용) */
+    void SetCongestionControlConfig(const FCongestionControlConfig& InConfig) { CongestionConfig = InConfig; }
+    const FCongestionControlConfig& GetCongestionControlConfig() const { return CongestionConfig; }
+
+    /** 엔드포인트의 혼잡 제어 상태 (등록되지 않은 피어면 nullptr) */
+    const FCongestionController* FindCongestionController(const FIPv4Endpoint& Endpoint) const;
+
+    /**
+     * 선택적 ACK 사용 여부를 설정합니다.
+     * 켜면 인박스 틱 동안 받은 신뢰성 메시지를 발신자별로 모아 틱 끝에 ACK 하나로 확인하고 (블록 하나가 최대 65개 메시지),
+     * 끄면 이전처럼 메시지마다 ACK를 바로 보냅니다. 받는 쪽은 두 형식을 모두 읽습니다.
+     */
+    void SetSelectiveAckEnabled(bool bEnable);
+    bool IsSelectiveAckEnabled() const { return bSelectiveAckEnabled; }
+
+    /**
+     * ACK를 다른 메시지에 실어 보낼지 설정합니다.
+     * 켜면 같은 피어에게 데이터 소켓으로 가는 유니캐스트 메시지(명령, 데이터 등, 시간 동기화 소켓으로 가는 핑은 제외) 끝에 밀린 ACK를 FLAG_HAS_ACK로 덧붙이고,
+     * ACK 지연 시간 안에 실어 보낼 메시지가 없을 때만 ACK 전용 메시지를 보냅니다.
+     * 탐색으로 PIGGYBACK_ACK_VERSION 이상을 합의한 서버에만 실으며, 그 외 노드에는 항상 ACK 전용 메시지를 보냅니다.
+     */
+    void SetPiggybackAcksEnabled(bool bEnable);
+    bool IsPiggybackAcksEnabled() const { return bPiggybackAcksEnabled; }
+
+    /** 엔드포인트로 보내는 메시지에 ACK를 실을 수 있는지 여부 (설정이 켜져 있고 합의한 버전이 PIGGYBACK_ACK_VERSION 이상) */
+    bool IsPiggybackAckPeer(const FIPv4Endpoint& Endpoint) const;
+
+    /** ACK 전용 메시지를 보내기 전 다른 메시지에 실리기를 기다리는 최대 시간 (초, 인박스 틱 단위로 반올림됨) */
+    void SetAckDelay(double Seconds) { AckDelaySeconds = FMath::Max(0.0, Seconds); }
+    double GetAckDelay() const { return AckDelaySeconds; }
+
+    /**
+     * 신뢰성 메시지 재전송 타임아웃의 범위를 설정합니다.
+     * 타임아웃은 피어별 핑 RTT의 평활값과 변동으로 구하고 (RFC 6298), 재전송할 때마다 두 배로 늘린 뒤 이 범위로 제한합니다.
+     * 최솟값은 받는 쪽의 프레임 지연과 ACK 지연보다 충분히 커야 불필요한 재전송이 생기지 않습니다.
+     */
+    void SetRetransmissionTimeoutBounds(double MinSeconds, double MaxSeconds);
+    double GetMinRetransmissionTimeout() const { return MinRetransmissionTimeout; }
+    double GetMaxRetransmissionTimeout() const { return MaxRetransmissionTimeout; }
+
+    /**
+     * 엔드포인트로 보낸 신뢰성 메시지의 재전송 타임아웃 (초)
+     * @param AttemptCount 지금까지 보낸 횟수 (1이면 첫 전송, 이후 한 번마다 두 배)
+     * 핑 RTT 샘플이 없는 피어는 MESSAGE_TIMEOUT_SECONDS를 범위로 제한한 값을 사용
+     */
+    double GetRetransmissionTimeout(const FIPv4Endpoint& Endpoint, int32 AttemptCount = 1) const;
+
+    /** ACK 통계 (받은 신뢰성 메시지 하나당 보낸 ACK 패킷 수 등) */
+    const FAckStats& GetAckStats() const { return AckStats; }
+    void ResetAckStats() { AckStats = FAckStats(); }
+
+    /** 조각화/재조립 통계 반환 */
+    FFragmentationStats GetFragmentationStats() const { return FragmentReassembler.GetStats(); }
+
+    /** 기본 경로 MTU (이더넷) */
+    static constexpr int32 DEFAULT_PATH_MTU = 1500;
+
+    /** 설정 가능한 경로 MTU 범위 (IPv4 최소 MTU ~ 점보 프레임) */
+    static constexpr int32 MIN_PATH_MTU = 576;
+    static constexpr int32 MAX_PATH_MTU = 9000;
+
+    /** IPv4 헤더(20) + UDP 헤더(8) */
+    static constexpr int32 IPV4_UDP_HEADER_SIZE = 28;
+
+    /** 마지막 조각 이후 이 시간 동안 진척이 없으면 누락 조각 재전송 요청 (초) */
+    static constexpr double FRAGMENT_NACK_DELAY_SECONDS = 0.1;
+
+    /**
+     * 메시지 유형별 구독자를 등록합니다.
+     * 같은 유형에 여러 구독자를 등록할 수 있으며, 구독자는 게임 스레드에서 내부 처리 이후 호출됩니다.
+     * @param Type 구독할 메시지 유형
+     * @param Delegate 호출할 델리게이트
+     * @return 구독 해제에 사용할 핸들
+     */
+    FDelegateHandle SubscribeMessage(ENetworkMessageType Type, const FOnNetworkMessageReceived::FDelegate& Delegate);
+
+    /** 메시지 구독 해제 */
+    void UnsubscribeMessage(ENetworkMessageType Type, FDelegateHandle Handle);
+
+    /** 해당 유형에 구독자가 있는지 여부 */
+    bool HasMessageSubscribers(ENetworkMessageType Type) const;
+
+    /** 수신 인박스 통계 반환 (모든 샤드와 우선 인박스 합계) */
+    FNetworkInboxStats GetInboxStats() const;
+
+    /** 기본 인박스 용량이 담을 수 있는 수신 배치 수 (인박스 틱 사이에 수신 스레드가 이만큼 배치를 받아도 버리지 않음) */
+    static constexpr int32 DEFAULT_INBOX_BATCHES = 8;
+
+    /** 샤드별 수신 인박스 기본 용량 */
+    static constexpr int32 DEFAULT_INBOX_CAPACITY = INetworkTransport::MAX_RECEIVE_BATCH * DEFAULT_INBOX_BATCHES;
+
+    /** 샤드별 수신 인박스 최대 용량 */
+    static constexpr int32 MAX_INBOX_CAPACITY = 65536;
+
+    /**
+     * 샤드별 수신 인박스 용량을 설정합니다 (Initialize 이전에 호출해야 적용됨).
+     * 0 이하면 기본값을 사용하고, 수신 배치 하나 이상 최대 용량 이하의 2의 거듭제곱으로 올립니다.
+     * 일반 인박스와 우선 인박스에 각각 적용됩니다.
+     */
+    void SetInboxCapacity(int32 InCapacity) { InboxCapacity = ResolveInboxCapacity(InCapacity); }
+
+    /** 요청한 인박스 용량에 SetInboxCapacity가 실제로 적용할 용량 */
+    static int32 ResolveInboxCapacity(int32 InCapacity);
+
+    /** 샤드별 수신 인박스 용량 반환 */
+    int32 GetInboxCapacity() const { return InboxCapacity; }
+
+    /** 인박스가 가득 차서 버린 패킷 경고를 남기는 최소 간격 (초, 간격마다 첫 번째 버림만 기록) */
+    static constexpr double INBOX_DROP_LOG_INTERVAL_SECONDS = 1.0;
+
     /** 시퀀스 번호 접근자 (FSyncFrameworkManager에서 사용) */
     uint16 GetNextSequenceId() { return GetNextSequenceNumber(); }
 
+    /** 고정밀 타임스탬프 (마이크로초, 핑 메시지의 타임스탬프와 보류 시간에 쓰는 시계) */
+    uint64 GetHighPrecisionTimestamp() const;
+
     /**
      * 특정 서버에 핑 요청을 보냅니다.
      * @param ServerEndpoint 핑을 보낼 서버의 엔드포인트
@@ -376,8 +1099,9 @@ public:
      * 핑 요청에 대한 응답을 보냅니다.
      * @param RequestMessage 수신한 핑 요청 메시지
      * @param SourceEndpoint 요청을 보낸 엔드포인트
+     * @param RequestArrivalTime 요청 데이터그램이 소켓에 도착한 시각 (GetHighPrecisionTimestamp 기준, 응답에 보류 시간으로 실림)
      */
-    void SendPingResponse(const FPingMessage& RequestMessage, const FIPv4Endpoint& SourceEndpoint);
+    void SendPingResponse(const FPingMessage& RequestMessage, const FIPv4Endpoint& SourceEndpoint, uint64 RequestArrivalTime);
 
     /**
      * 지연 시간 측정을 위한 주기적인 핑 요청을 활성화합니다.
@@ -407,29 +1131,156 @@ public:
     virtual TMap<FString, TArray<int32>> GetMissingSequences() const override;
 
 private:
-    /** Broadcast socket for server discovery */
-    FSocket* BroadcastSocket;
+    /** 브로드캐스트 탐색 소켓 (BROADCAST_PORT, 탐색 메시지 송수신) */
+    TUniquePtr<INetworkTransport> DiscoveryTransport;
 
-    /** Receiving socket for messages */
-    FSocket* ReceiveSocket;
+    /** 시간 동기화 전용 소켓 (TIME_SYNC_PORT, 탐색/데이터 폭주와 소켓 버퍼를 공유하지 않음) */
+    TUniquePtr<INetworkTransport> TimeSyncTransport;
 
-    /** Thread for receiving messages */
-    FRunnableThread* ReceiverThread;
+    /** 멀티캐스트 그룹 소켓 (멀티캐스트를 사용하지 않거나 가입에 실패하면 nullptr) */
+    TUniquePtr<INetworkTransport> MulticastTransport;
 
-    /** Message handler callback */
-    TFunction<void(const FString&, const TArray<uint8>&)> MessageHandler;
+    /** 멀티캐스트 전송 설정 */
+    FMulticastSettings MulticastSettings;
+
+    /**
+     * 수신 샤드
+     * 데이터 소켓 하나와 그 소켓 전용 수신 스레드, 인박스를 묶어 인박스마다 생산자가 하나뿐이도록 함
+     * 샤드 0의 수신 스레드는 리액터로 탐색, 시간 동기화, 멀티캐스트 소켓도 함께 감시
+     */
+    struct FReceiveShard
+    {
+        TUniquePtr<INetworkTransport> Transport;        // 데이터 전송 계층 (인박스의 풀 버퍼를 소유하므로 인박스보다 오래 살아야 함)
+        FNetworkReceiverWorker* Worker;                 // 수신 작업자
+        FRunnableThread* Thread;                        // 수신 스레드
+        TSpscBoundedQueue<FInboxPacket> Inbox;          // 수신 인박스 (이 샤드의 수신 스레드가 유일한 생산자, 인박스 틱이 유일한 소비자)
+        TSpscBoundedQueue<FInboxPacket> PriorityInbox;  // 시간 동기화/멀티캐스트 채널 인박스 (일반 인박스보다 먼저 처리)
+
+        explicit FReceiveShard(int32 InboxCapacity)
+            : Worker(nullptr)
+            , Thread(nullptr)
+            , Inbox(InboxCapacity)
+            , PriorityInbox(InboxCapacity)
+        {
+        }
+    };
+
+    /** 수신 샤드 목록 (샤드 0은 항상 존재하며 유니캐스트 송신에도 사용) */
+    TArray<TUniquePtr<FReceiveShard>> ReceiveShards;
+
+    /** 유니캐스트 데이터 소켓 (샤드 0의 전송 계층, Port) */
+    INetworkTransport* DataTransport;
+
+    /** 채널별 송신 전송 계층 반환 */
+    INetworkTransport* GetChannelTransport(ENetworkChannel Channel) const;
+
+    /** 메시지 유형 수 (ENetworkMessageType은 uint8) */
+    static constexpr int32 MESSAGE_TYPE_COUNT = 256;
+
+    /** 내부 메시지 처리 함수 */
+    typedef void (FNetworkManager::*FInternalMessageHandler)(const FNetworkMessageView&, const FIPv4Endpoint&);
+
+    /** 메시지 유형별 내부 처리 함수 테이블 (생성 시 구성, 유형 값으로 바로 조회) */
+    FInternalMessageHandler InternalMessageHandlers[MESSAGE_TYPE_COUNT];
+
+    /** 메시지 유형별 구독자 테이블 */
+    FOnNetworkMessageReceived MessageSubscribers[MESSAGE_TYPE_COUNT];
+
+    /** RegisterMessageHandler로 등록한 기존 단일 핸들러의 구독 목록 */
+    TArray<TPair<ENetworkMessageType, FDelegateHandle>> LegacyHandlerSubscriptions;
+
+    /** 내부 처리 함수 테이블 구성 */
+    void RegisterInternalMessageHandlers();
+
+    /** 엔드포인트에 해당하는 서버 ID 반환 (발견되지 않은 서버면 엔드포인트 문자열) */
+    FString FindServerIdForEndpoint(const FIPv4Endpoint& Endpoint) const;
 
     /** 발견된 서버 목록 */
     TMap<FString, FServerEndpoint> DiscoveredServers;
 
+    /** 팬아웃 전송 대상 (DiscoveredServers의 엔드포인트 캐시) */
+    TArray<FIPv4Endpoint> FanOutTargets;
+
+    /** 시간 동기화 채널 팬아웃 전송 대상 (FanOutTargets와 같은 서버의 TIME_SYNC_PORT) */
+    TArray<FIPv4Endpoint> TimeSyncFanOutTargets;
+
+    /** DiscoveredServers가 변경되어 FanOutTargets 재구성이 필요한지 여부 */
+    bool bFanOutTargetsDirty;
+
+    /** 모든 팬아웃 대상이 v2 압축 헤더를 지원하는지 여부 (팬아웃은 한 번만 직렬화하므로 모두 지원할 때만 사용) */
+    bool bFanOutCompact;
+
+    /** 모든 팬아웃 대상이 묶음 데이터그램을 풀 수 있는지 여부 (아니면 대상마다 확인) */
+    bool bFanOutBatch;
+
+    /** DiscoveredServers로부터 팬아웃 대상 재구성 */
+    void RebuildFanOutTargets();
+
+    /** 경로 MTU */
+    int32 PathMtu;
+
+    /** 다음 조각 메시지 ID */
+    uint32 NextFragmentMessageId;
+
+    /** 수신 조각 재조립기 */
+    FFragmentReassembler FragmentReassembler;
+
+    /** 재전송 요청에 대비해 보관하는 보낸 조각 */
+    FFragmentSendCache FragmentSendCache;
+
+    /** 조각 재조립 틱 핸들 (시간 초과 정리와 누락 조각 재전송 요청) */
+    FTSTicker::FDelegateHandle FragmentTickHandle;
+
+    /** 송신 메시지 병합기 */
+    FMessageCoalescer MessageCoalescer;
+
+    /** 송신 메시지 병합 사용 여부 */
+    bool bCoalescingEnabled;
+
+    /** 송신 스케줄러 (병합기와 조각 전송이 보내는 데이터그램을 클래스별로 페이싱) */
+    FTrafficScheduler TrafficScheduler;
+
+    /** 트래픽 클래스 설정의 DSCP 값을 각 소켓에 표시 */
+    void ApplyTrafficClassDscp();
+
+    /** 묶음 버퍼에 모아 보낼 메시지인지 여부 (병합이 꺼져 있거나 바로 보내야 하는 메시지면 false) */
+    bool ShouldCoalesce(const FNetworkMessage& Message) const;
+
+    /** v2 압축 헤더 사용 여부 */
+    bool bCompactHeadersEnabled;
+
+    /** 프로젝트 ID로 만든 세션 토큰 (압축 헤더 수신 시 프로젝트 ID 비교 대신 사용) */
+    uint32 SessionToken;
+
+    /** 압축 헤더를 쓰지 않는 메시지 유형인지 여부 (프로젝트 ID 전체와 지원 버전을 교환하는 탐색 메시지) */
+    static bool RequiresFullHeader(ENetworkMessageType Type);
+
+    /** 주소에 있는 탐색된 서버들의 지원 버전으로 그 주소와 합의한 프로토콜 버전을 갱신 (서버 목록이 바뀔 때 호출) */
+    void UpdateAddressProtocolVersion(const FIPv4Address& Address);
+
+    /** 압축 헤더 사용 여부에 따라 메시지 직렬화 */
+    TArray<uint8> SerializeForWire(const FNetworkMessage& Message, bool bCompact) const
+    {
+        return bCompact ? Message.SerializeCompact(SessionToken) : Message.Serialize();
+    }
+
+    /** 메시지를 조각으로 나눠 데이터 소켓으로 대상들에게 전송 */
+    bool SendFragmentedMessage(const FNetworkMessage& Message, const FIPv4Endpoint* Targets, int32 TargetCount);
+
+    /** 조각 재조립 틱 */
+    bool TickFragmentReassembly(float DeltaTime);
+
+    /** 엔드포인트별 피어 인덱스와 피어별 상태 (지연 통계, 수신 시퀀스 추적기, ACK 대기 목록, 마지막 수신 시간) */
+    FPeerRegistry PeerRegistry;
+
     /** Project unique identifier */
     FGuid ProjectId;
 
     /** Is the network manager initialized */
     bool bIsInitialized;
 
-    /** 현재 시퀀스 번호 */
-    uint16 CurrentSequenceNumber;
+    /** 현재 시퀀스 번호 (신뢰성 메시지를 뺀 나머지 메시지의 발신자 전체 공간) */
+    uint32 CurrentSequenceNumber;
 
     /** 프로젝트 버전 */
     FString ProjectVersion;
@@ -440,8 +1291,50 @@ private:
     /** 포트 번호 */
     uint16 Port;
 
-    /** 수신 스레드 작업자 */
-    FNetworkReceiverWorker* ReceiverWorker;
+    /** 수신 스레드 대기 방식 */
+    EReceiverWaitMode ReceiverWaitMode;
+
+    /** 수신 백엔드 */
+    EReceiveBackend ReceiveBackend;
+
+    /** 설정된 수신 샤드 수 */
+    int32 ReceiveShardCount;
+
+    /** 샤드별 수신 인박스 용량 */
+    int32 InboxCapacity;
+
+    /** 시간 동기화 수신 스레드 실행 설정 */
+    FReceiverThreadSettings ReceiverThreadSettings;
+
+    /**
+     * 인박스 처리 틱 핸들
+     * 서버 목록, 지연 통계, 확인 대기 목록 등 모든 상태는 인박스 틱과 다른 FTSTicker 콜백에서만 변경됨
+     */
+    FTSTicker::FDelegateHandle InboxTickHandle;
+
+    /** 인박스에 넣은 패킷 수 (모든 수신 스레드에서 갱신) */
+    std::atomic<uint64> InboxEnqueuedPackets;
+
+    /** 인박스가 가득 차서 버린 패킷 수 (모든 수신 스레드에서 갱신) */
+    std::atomic<uint64> InboxDroppedPackets;
+
+    /** 마지막으로 버림 경고를 남긴 시각 (Cycles64)과 그때까지 버린 패킷 수 (모든 수신 스레드에서 갱신) */
+    std::atomic<uint64> InboxDropLogCycles;
+    std::atomic<uint64> InboxDroppedAtLastLog;
+
+    /** 처리한 패킷 수 (게임 스레드에서 갱신) */
+    std::atomic<uint64> InboxDispatchedPackets;
+
+    /** 인박스 대기 시간 합계/마지막/최대 (밀리초, 게임 스레드에서 갱신) */
+    double InboxLatencySumMs;
+    double InboxLastLatencyMs;
+    double InboxMaxLatencyMs;
+
+    /** 인박스 처리 틱 */
+    bool TickInbox(float DeltaTime);
+
+    /** 인박스 하나를 비우며 메시지 처리 (처리한 개수 반환) */
+    int32 DrainInboxQueue(TSpscBoundedQueue<FInboxPacket>& Queue);
 
     // 마스터-슬레이브 관련 멤버 변수
     bool bIsMaster;                       // 현재 노드가 마스터인지 여부
@@ -449,15 +1342,19 @@ private:
     float MasterPriority;                 // 이 서버의 마스터 우선순위
     bool bElectionInProgress;             // 선출 진행중 여부
     int32 CurrentElectionTerm;            // 현재 선출 기간
-    TMap<FString, float> ElectionVotes;   // 선출 투표 결과
+    TMap<FServerIdHash, float> ElectionVotes; // 선출 투표 결과 (키: 서버 ID 해시)
+    FServerIdHash LocalServerIdHash;      // 이 서버 ID(호스트 이름)의 해시
+    TMap<FServerIdHash, FString> KnownServerIds; // 탐색으로 알게 된 서버 ID 해시 -> 서버 ID
     double LastMasterAnnouncementTime;    // 마지막 마스터 공지 시간
     double LastElectionStartTime;         // 마지막 선출 시작 시간
     TFunction<void(const FString&, bool)> MasterChangeHandler; // 마스터 변경 핸들러
     const float MASTER_TIMEOUT_SECONDS = 5.0f;    // 마스터 타임아웃 시간
     const float ELECTION_TIMEOUT_SECONDS = 3.0f;  // 선출 타임아웃 시간
 
+    /** 마스터-슬레이브 페이로드의 서버 ID 해시를 표시용 서버 ID로 변환 (알 수 없는 해시면 해시 문자열, 비교나 키로 쓰지 않음) */
+    FString ResolveServerId(FServerIdHash ServerIdHash) const;
+
     // 네트워크 지연 측정 관련 멤버 변수
-    TMap<FString, FNetworkLatencyStats> ServerLatencyStats;    // 서버별 지연 통계
     uint32 NextPingSequenceNumber;                            // 다음 핑 시퀀스 번호
     TMap<uint32, TPair<FIPv4Endpoint, double>> PendingPingRequests;  // 대기 중인 핑 요청
     FTSTicker::FDelegateHandle LatencyMeasurementTickHandle;  // 지연 측정 틱 핸들
@@ -502,13 +1399,19 @@ private:
     /** 소켓 초기화 */
     bool InitializeSockets();
 
-    /** 브로드캐스트 소켓 생성 */
+    /** 브로드캐스트 탐색 소켓 생성 */
     bool CreateBroadcastSocket();
 
-    /** 수신 소켓 생성 */
+    /** 유니캐스트 데이터 소켓 생성 (샤드 수만큼) */
     bool CreateReceiveSocket();
 
-    /** 수신 스레드 시작 */
+    /** 시간 동기화 소켓 생성 */
+    bool CreateTimeSyncSocket();
+
+    /** 멀티캐스트 그룹 소켓 생성 (실패하면 유니캐스트 팬아웃과 브로드캐스트 탐색으로 동작) */
+    bool CreateMulticastSocket();
+
+    /** 샤드마다 수신 스레드 시작 */
     bool StartReceiverThread();
 
     /** 현재 서버의 엔드포인트 정보 생성 */
@@ -518,36 +1421,36 @@ private:
     void CleanupServerList();
 
     /** 메시지 유형에 따른 처리 함수 */
-    void HandleDiscoveryMessage(const FNetworkMessage& Message, const FIPv4Endpoint& Sender);
-    void HandleDiscoveryResponseMessage(const FNetworkMessage& Message, const FIPv4Endpoint& Sender);
-    void HandleTimeSyncMessage(const FNetworkMessage& Message, const FIPv4Endpoint& Sender);
-    void HandleFrameSyncMessage(const FNetworkMessage& Message, const FIPv4Endpoint& Sender);
-    void HandleCommandMessage(const FNetworkMessage& Message, const FIPv4Endpoint& Sender);
-    void HandleDataMessage(const FNetworkMessage& Message, const FIPv4Endpoint& Sender);
-    void HandleCustomMessage(const FNetworkMessage& Message, const FIPv4Endpoint& Sender);
+    void HandleDiscoveryMessage(const FNetworkMessageView& Message, const FIPv4Endpoint& Sender);
+    void HandleDiscoveryResponseMessage(const FNetworkMessageView& Message, const FIPv4Endpoint& Sender);
+    void HandleTimeSyncMessage(const FNetworkMessageView& Message, const FIPv4Endpoint& Sender);
+    void HandleFrameSyncMessage(const FNetworkMessageView& Message, const FIPv4Endpoint& Sender);
+    void HandleCommandMessage(const FNetworkMessageView& Message, const FIPv4Endpoint& Sender);
+    void HandleDataMessage(const FNetworkMessageView& Message, const FIPv4Endpoint& Sender);
+    void HandleCustomMessage(const FNetworkMessageView& Message, const FIPv4Endpoint& Sender);
 
     // 마스터-슬레이브 메시지 처리 메서드
-    void HandleMasterAnnouncement(const FNetworkMessage& Message, const FIPv4Endpoint& Sender);
-    void HandleMasterQuery(const FNetworkMessage& Message, const FIPv4Endpoint& Sender);
-    void HandleMasterResponse(const FNetworkMessage& Message, const FIPv4Endpoint& Sender);
-    void HandleMasterElection(const FNetworkMessage& Message, const FIPv4Endpoint& Sender);
-    void HandleMasterVote(const FNetworkMessage& Message, const FIPv4Endpoint& Sender);
-    void HandleMasterResign(const FNetworkMessage& Message, const FIPv4Endpoint& Sender);
-    void HandleRoleChange(const FNetworkMessage& Message, const FIPv4Endpoint& Sender);
+    void HandleMasterAnnouncement(const FNetworkMessageView& Message, const FIPv4Endpoint& Sender);
+    void HandleMasterQuery(const FNetworkMessageView& Message, const FIPv4Endpoint& Sender);
+    void HandleMasterResponse(const FNetworkMessageView& Message, const FIPv4Endpoint& Sender);
+    void HandleMasterElection(const FNetworkMessageView& Message, const FIPv4Endpoint& Sender);
+    void HandleMasterVote(const FNetworkMessageView& Message, const FIPv4Endpoint& Sender);
+    void HandleMasterResign(const FNetworkMessageView& Message, const FIPv4Endpoint& Sender);
+    void HandleRoleChange(const FNetworkMessageView& Message, const FIPv4Endpoint& Sender);
 
     // 설정 관련 메시지 처리 메서드
-    void HandleSettingsSyncMessage(const FNetworkMessage& Message, const FIPv4Endpoint& Sender);
-    void HandleSettingsRequestMessage(const FNetworkMessage& Message, const FIPv4Endpoint& Sender);
-    void HandleSettingsResponseMessage(const FNetworkMessage& Message, const FIPv4Endpoint& Sender);
+    void HandleSettingsSyncMessage(const FNetworkMessageView& Message, const FIPv4Endpoint& Sender);
+    void HandleSettingsRequestMessage(const FNetworkMessageView& Message, const FIPv4Endpoint& Sender);
+    void HandleSettingsResponseMessage(const FNetworkMessageView& Message, const FIPv4Endpoint& Sender);
 
     // 핑 메시지 처리 메서드
-    void HandlePingRequest(const TSharedPtr<FMemoryReader>& ReaderPtr, const FIPv4Endpoint& SourceEndpoint);
-    void HandlePingResponse(const TSharedPtr<FMemoryReader>& ReaderPtr, const FIPv4Endpoint& SourceEndpoint);
+    void HandlePingRequest(const FNetworkMessageView& Message, const FIPv4Endpoint& SourceEndpoint);
+    void HandlePingResponse(const FNetworkMessageView& Message, const FIPv4Endpoint& SourceEndpoint);
 
     // 마스터 선출 관련 메서드
-    void SendElectionVote(const FString& CandidateId);
+    void SendElectionVote(FServerIdHash CandidateIdHash);
     bool TryBecomeMaster();
-    void EndElection(const FString& WinnerId, int32 ElectionTerm);
+    void EndElection(FServerIdHash WinnerIdHash, int32 ElectionTerm);
     void CheckMasterTimeout();
     float CalculateVotePriority();
     void UpdateMasterStatus(const FString& NewMasterId, bool bLocalServerIsMaster);
@@ -566,7 +1469,7 @@ private:
     void ProcessNetworkStateChange(const FIPv4Endpoint& ServerEndpoint, ENetworkEventType EventType, const FNetworkQualityAssessment& Quality);
     bool CheckQualityAssessments(float DeltaTime);
 
-    /** 다음 시퀀스 번호 생성 */
+    /** 다음 시퀀스 번호 생성 (헤더에 싣는 하위 16비트, 신뢰성 메시지는 보낼 때 피어별 번호로 바뀜) */
     uint16 GetNextSequenceNumber();
 
     /** 이벤트 간 충분한 시간이 지났는지 확인 (속도 제한) */
@@ -581,9 +1484,6 @@ private:
     /** 마스터-슬레이브 프로토콜 틱 콜백 */
     bool MasterSlaveProtocolTick(float DeltaTime);
 
-    // 고정밀 타임스탬프 생성 메서드
-    uint64 GetHighPrecisionTimestamp() const;
-
     // 하드웨어 타이머 초기화 시간 (마이크로초)
     uint64 HardwareTimerInitTime;
 
@@ -600,7 +1500,7 @@ private:
     float CalculateDynamicSamplingRate(const FPeriodicPingState& PingState) const;
 
     // 네트워크 품질 계수 업데이트
-    void UpdateNetworkQualityFactor(FPeriodicPingState& PingState, const FString& ServerID);
+    void UpdateNetworkQualityFactor(FPeriodicPingState& PingState, const FIPv4Endpoint& ServerEndpoint);
 
     // 연속 타임아웃 증가
     void IncrementConsecutiveTimeouts(const FIPv4Endpoint& ServerEndpoint);
@@ -609,31 +1509,69 @@ private:
     void ResetConsecutiveTimeouts(const FIPv4Endpoint& ServerEndpoint);
 
     // 메시지 확인 관련 멤버 변수
-    TMap<uint16, FMessageAckData> PendingAcknowledgements;  // 확인 대기 중인 메시지들
-    TMap<FString, TArray<uint16>> EndpointSequenceMap;     // 엔드포인트별 전송 시퀀스 번호 리스트
+    TMap<uint64, FMessageAckData> PendingAcknowledgements;  // 확인 대기 중인 메시지들 (키: FPeerRegistry::MakeSequenceKey)
     double LastRetryCheckTime;                            // 마지막 재전송 체크 시간
+    double NextRetryDeadline;                             // 대기 중인 메시지의 가장 이른 재전송 기한 (그 전의 틱은 목록을 훑지 않음)
     FTSTicker::FDelegateHandle MessageRetryTickHandle;     // 메시지 재전송 틱 핸들
-    const float MESSAGE_RETRY_INTERVAL = 0.5f;             // 재전송 체크 간격 (초)
-    const float MESSAGE_TIMEOUT_SECONDS = 3.0f;            // 메시지 타임아웃 시간 (초)
+    const float MESSAGE_RETRY_INTERVAL = 0.01f;            // 재전송 체크 간격 (초, 재전송 타임아웃의 시계 단위)
+    const float MESSAGE_TIMEOUT_SECONDS = 3.0f;            // RTT 샘플이 없는 피어의 재전송 타임아웃 (초)
     const int32 MAX_RETRY_ATTEMPTS = 3;                   // 최대 재전송 시도 횟수
+    double MinRetransmissionTimeout;                      // 재전송 타임아웃 하한 (초)
+    double MaxRetransmissionTimeout;                      // 재전송 타임아웃 상한 (초, 백오프 후에도 적용)
+    static constexpr double DEFAULT_MIN_RETRANSMISSION_TIMEOUT = 0.1;  // 기본 하한 (30fps 프레임 지연과 ACK 지연을 넉넉히 덮음)
+    static constexpr double DEFAULT_MAX_RETRANSMISSION_TIMEOUT = 3.0;  // 기본 상한 (이전의 고정 타임아웃)
+
+    // 혼잡 제어 관련 멤버 변수
+    bool bCongestionControlEnabled;                                 // 혼잡 제어 사용 여부
+    FCongestionControlConfig CongestionConfig;                      // 혼잡 제어 설정
+    TMap<FIPv4Endpoint, TArray<FNetworkMessage>> ReliableBacklog;   // 윈도우가 가득 차 보내지 못한 신뢰성 메시지 (피어별 전송 순서)
+    static constexpr int32 MAX_RELIABLE_BACKLOG = 1024;             // 피어별 최대 보관 메시지 수
+
+    // 선택적 ACK 관련 멤버 변수
+    bool bSelectiveAckEnabled;                  // 선택적 ACK 사용 여부
+    bool bPiggybackAcksEnabled;                 // ACK를 다른 메시지에 실어 보낼지 여부
+    double AckDelaySeconds;                     // ACK 전용 메시지를 보내기 전 기다리는 시간
+    TArray<TPair<FPeerId, double>> PeersWithUnsentAcks; // 보내지 않은 ACK가 있는 피어와 첫 ACK를 예약한 시간
+    static constexpr double DEFAULT_ACK_DELAY_SECONDS = 0.01; // 기본 ACK 지연 (재전송 타임아웃보다 충분히 짧게)
+    FAckStats AckStats;                         // ACK 통계
 
     // 메시지 확인 관련 메서드
-    bool SendMessageWithAck(const FIPv4Endpoint& Endpoint, const FNetworkMessage& Message);
-    void HandleMessageAck(const FNetworkMessage& Message, const FIPv4Endpoint& Sender);
+    bool SendMessageWithAck(const FIPv4Endpoint& Endpoint, FNetworkMessage Message);
+    void HandleMessageAck(const FNetworkMessageView& Message, const FIPv4Endpoint& Sender);
     bool CheckMessageRetries(float DeltaTime);
-    void RetryMessage(uint16 SequenceNumber);
+    void RemovePendingAckSequence(FPeerId PeerId, uint32 SequenceNumber);
+    void DiscardPendingAcks(FPeerId PeerId);
+    void RetryMessage(uint64 PendingKey);
+
+    // 선택적 ACK 관련 메서드
+    void QueueAck(const FIPv4Endpoint& Sender, uint16 SequenceNumber);
+    void FlushPendingAcks(double Now, double Delay);
+    void ProcessSelectiveAck(const FSelectiveAck& Ack, const FIPv4Endpoint& Sender);
+    void AddCumulativeAck(FPeerId PeerId, FSelectiveAck& Ack) const;
+    bool AttachPiggybackAck(const FIPv4Endpoint& Endpoint, const FNetworkMessage& Message, FNetworkMessage& OutMessage);
+
+    // 혼잡 제어 관련 메서드
+    bool CanTransmitReliable(FPeerId PeerId, int32 Bytes) const;
+    bool TransmitReliableMessage(const FIPv4Endpoint& Endpoint, FPeerId PeerId, FNetworkMessage& Message);
+    void ReleaseReliableBacklog(const FIPv4Endpoint& Endpoint);
+    void ApplyCongestionRate(const FIPv4Endpoint& Endpoint, FPeerId PeerId, double Now);
+
+    // 조각 관련 메시지 처리 메서드
+    void HandleFragment(const FNetworkMessageView& Message, const FIPv4Endpoint& Sender);
+    void HandleFragmentNack(const FNetworkMessageView& Message, const FIPv4Endpoint& Sender);
 
     // 시퀀스 관리 관련 멤버 변수
-    TMap<FString, FMessageSequenceTracker> EndpointSequenceTrackers;  // 엔드포인트별 시퀀스 추적기
-    bool bOrderGuaranteedEnabled;                                   // 순서 보장 활성화 여부
-    FTSTicker::FDelegateHandle SequenceManagementTickHandle;         // 시퀀스 관리 틱 핸들
-    const float SEQUENCE_MANAGEMENT_INTERVAL = 1.0f;                // 시퀀스 관리 틱 간격 (초)
+    bool bOrderGuaranteedEnabled;                                   // 순서 보장 활성화 여부 (신뢰성 공간에만 적용)
 
     // 시퀀스 관리 관련 메서드
-    bool TrackReceivedSequence(const FIPv4Endpoint& Sender, uint16 SequenceNumber);
+    ESequenceAddResult TrackReceivedSequence(const FIPv4Endpoint& Sender, ESequenceChannel Channel, uint16 SequenceNumber);
     bool IsMessageInOrder(const FIPv4Endpoint& Sender, uint16 SequenceNumber);
-    void RequestMissingMessages(const FIPv4Endpoint& Endpoint);
-    void HandleMessageRetryRequest(const FNetworkMessage& Message, const FIPv4Endpoint& Sender);
-    bool CheckSequenceManagement(float DeltaTime);
-    bool ShouldProcessMessage(const FIPv4Endpoint& Sender, uint16 SequenceNumber);
+    void HandleMessageRetryRequest(const FNetworkMessageView& Message, const FIPv4Endpoint& Sender);
+    bool ShouldProcessMessage(const FIPv4Endpoint& Sender, ESequenceChannel Channel, uint16 SequenceNumber);
+
+    /** 순서 보장을 적용할 시퀀스 공간인지 여부 (비신뢰성 공간은 발신자 전체 번호라 피어마다 빈 번호가 생기므로 제외) */
+    bool IsOrderGuaranteedChannel(ESequenceChannel Channel) const
+    {
+        return bOrderGuaranteedEnabled && Channel == ESequenceChannel::Reliable;
+    }
 };
\ No newline at end of file
@@ -0,0 +1,73 @@
+﻿// Copyright Your Company. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "FNetworkTransport.h"
+
+/**
+ * 여러 전송 계층을 한 스레드에서 감시하는 리액터
+ * Linux에서는 epoll로 모든 소켓과 웨이크업 eventfd를 한 번에 기다리고, 네이티브 핸들이 없는 전송 계층이 섞이면
+ * 단일 전송 계층은 WaitForRead로, 여러 전송 계층은 짧은 간격의 폴링으로 대체
+ */
+class MULTISERVERSYNC_API FNetworkReactor
+{
+public:
+    /** 등록할 수 있는 최대 전송 계층 수 (Wait 결과 비트마스크 크기) */
+    static constexpr int32 MAX_TRANSPORTS = 32;
+
+    /** 생성자 */
+    FNetworkReactor();
+
+    /** 소멸자 */
+    ~FNetworkReactor();
+
+    FNetworkReactor(const FNetworkReactor&) = delete;
+    FNetworkReactor& operator=(const FNetworkReactor&) = delete;
+
+    /**
+     * 감시할 전송 계층을 등록합니다 (감시 스레드 시작 전에만 호출).
+     * @return 등록 인덱스 (Wait 결과의 비트 위치, 실패 시 INDEX_NONE)
+     */
+    int32 Add(INetworkTransport* Transport);
+
+    /** 등록된 전송 계층 수 */
+    int32 Num() const { return Transports.Num(); }
+
+    /** 등록된 전송 계층 반환 */
+    INetworkTransport* Get(int32 Index) const { return Transports[Index]; }
+
+    /**
+     * 등록된 전송 계층 중 하나 이상이 읽기 가능해질 때까지 최대 Timeout 동안 대기합니다.
+     * @return 읽기 가능한 전송 계층의 비트마스크 (비트 위치 = 등록 인덱스, 타임아웃이면 0)
+     */
+    uint32 Wait(const FTimespan& Timeout);
+
+    /**
+     * 대기하지 않고 지금 읽기 가능한 전송 계층을 확인합니다 (스핀 대기용).
+     * @return 읽기 가능한 전송 계층의 비트마스크
+     */
+    uint32 Poll();
+
+    /**
+     * 다른 스레드에서 Wait 중인 리액터를 즉시 깨웁니다 (Wait는 0을 반환).
+     * @return 웨이크업 디스크립터로 깨웠으면 true (epoll을 쓰지 않으면 false - 호출자가 다른 방법으로 깨워야 함)
+     */
+    bool Wake();
+
+    /** 다중화 방식 이름 반환 */
+    const TCHAR* GetMultiplexerName() const;
+
+private:
+    /** 등록된 전송 계층 */
+    TArray<INetworkTransport*> Transports;
+
+    /** epoll 디스크립터 (사용하지 않으면 -1) */
+    int32 EpollFd;
+
+    /** epoll에 함께 등록한 웨이크업 eventfd (사용하지 않으면 -1) */
+    int32 WakeFd;
+
+    /** 모든 전송 계층이 epoll에 등록되었는지 여부 */
+    bool bUseEpoll;
+};
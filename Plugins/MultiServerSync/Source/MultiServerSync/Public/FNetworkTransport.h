@@ -0,0 +1,239 @@
+﻿// Copyright Your Company. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Sockets.h"
+#include "Interfaces/IPv4/IPv4Address.h"
+#include "Interfaces/IPv4/IPv4Endpoint.h"
+#include "FPacketBuffer.h"
+
+/**
+ * 수신 백엔드 종류
+ */
+enum class EReceiveBackend : uint8
+{
+    SingleRead = 0,    // 시스템 콜 한 번에 데이터그램 하나씩 수신 (Linux는 네이티브 소켓, 그 외 플랫폼은 FSocket::RecvFrom)
+    BatchRecvMmsg = 1, // Linux recvmmsg로 시스템 콜 한 번에 여러 데이터그램 수신 (다른 플랫폼에서는 SingleRead로 대체)
+    IoUring = 2        // Linux io_uring 멀티샷 recvmsg와 제공 버퍼 링으로 완료 큐에서 수신 (커널 6.0 미만이면 BatchRecvMmsg로 대체)
+};
+
+/**
+ * 수신된 데이터그램
+ * 소켓이 직접 수신한 풀 버퍼를 가리키며, Buffer 참조를 유지하는 동안 복사 없이 데이터가 유효
+ */
+struct FReceivedDatagram
+{
+    const uint8* Data;       // 데이터 시작 주소
+    int32 Size;              // 데이터 크기 (바이트)
+    FIPv4Endpoint Sender;    // 발신자 엔드포인트
+    FPacketBufferRef Buffer; // 데이터를 담고 있는 풀 버퍼
+    uint64 ReceiveCycles;    // 도착 시각 (FPlatformTime::Cycles64 기준, 커널 수신 타임스탬프가 있으면 그 시각으로 환산)
+
+    FReceivedDatagram()
+        : Data(nullptr)
+        , Size(0)
+        , ReceiveCycles(0)
+    {
+    }
+};
+
+/**
+ * 전송 계층 통계
+ */
+struct FTransportStats
+{
+    uint64 ReceiveSyscalls;    // 수신 시스템 콜 횟수 (빈 결과 포함)
+    uint64 ReceivedDatagrams;  // 수신한 데이터그램 수
+    uint64 SendSyscalls;       // 송신 시스템 콜 횟수
+    uint64 SentDatagrams;      // 송신한 데이터그램 수
+    uint64 KernelTimestampedDatagrams; // 커널 수신 타임스탬프(SO_TIMESTAMPNS)가 붙어 온 데이터그램 수
+    uint64 TruncatedDatagrams; // 수신 버퍼보다 커서 잘린 채 도착해 버린 데이터그램 수 (MSG_TRUNC)
+
+    FTransportStats()
+        : ReceiveSyscalls(0)
+        , ReceivedDatagrams(0)
+        , SendSyscalls(0)
+        , SentDatagrams(0)
+        , KernelTimestampedDatagrams(0)
+        , TruncatedDatagrams(0)
+    {
+    }
+};
+
+/**
+ * UDP 전송 계층 인터페이스
+ * 수신 스레드와 FNetworkManager가 특정 소켓 구현(FSocket, Linux 네이티브 소켓)에 의존하지 않도록 분리
+ */
+class MULTISERVERSYNC_API INetworkTransport
+{
+public:
+    virtual ~INetworkTransport() {}
+
+    /** 한 번의 ReceiveBatch 호출로 반환할 수 있는 최대 데이터그램 수 */
+    static constexpr int32 MAX_RECEIVE_BATCH = 32;
+
+    /** UDP 데이터그램 최대 크기 */
+    static constexpr int32 MAX_DATAGRAM_SIZE = 65507;
+
+    /** 패킷 버퍼 풀에 보관할 최대 여유 버퍼 수 */
+    static constexpr int32 MAX_POOLED_PACKET_BUFFERS = 256;
+
+    /**
+     * 지정한 백엔드로 UDP 전송 계층을 생성합니다.
+     * 요청한 백엔드를 사용할 수 없으면 FSocket 기반 단일 수신 백엔드로 대체합니다.
+     * @param Backend 수신 백엔드
+     * @param BindAddress 바인딩할 주소
+     * @param Port 바인딩할 포트 (0이면 임의 포트)
+     * @param Description 디버깅용 소켓 이름
+     * @param bReusePort true면 SO_REUSEPORT로 같은 포트의 다른 소켓과 수신을 나눠 받음 (Linux 전용으로 항상 네이티브 소켓을 사용, 사용할 수 없으면 실패)
+     * @return 생성된 전송 계층 (실패 시 nullptr)
+     */
+    static TUniquePtr<INetworkTransport> Create(EReceiveBackend Backend, const FIPv4Address& BindAddress, uint16 Port, const FString& Description, bool bReusePort = false);
+
+    /** 현재 플랫폼에서 SO_REUSEPORT 수신 분산을 지원하는지 여부 */
+    static bool SupportsReusePort();
+
+    /** 백엔드 이름 반환 */
+    virtual const TCHAR* GetBackendName() const = 0;
+
+    /** 바인딩된 로컬 포트 반환 */
+    virtual uint16 GetLocalPort() const = 0;
+
+    /** 데이터그램 하나 전송 */
+    virtual bool SendTo(const uint8* Data, int32 Size, const FIPv4Endpoint& Target) = 0;
+
+    /**
+     * 같은 데이터그램을 여러 대상에 전송합니다 (팬아웃).
+     * 기본 구현은 대상마다 SendTo를 호출합니다.
+     * @return 전송에 성공한 대상 수
+     */
+    virtual int32 SendToMany(const uint8* Data, int32 Size, const FIPv4Endpoint* Targets, int32 TargetCount);
+
+    /** 읽을 데이터가 생길 때까지 최대 Timeout 동안 대기 */
+    virtual bool WaitForRead(const FTimespan& Timeout) = 0;
+
+    /**
+     * 멀티캐스트 그룹에 가입하고 이 소켓의 멀티캐스트 송신 옵션을 설정합니다.
+     * 그룹으로 보낸 데이터그램 하나가 그룹에 가입한 모든 노드에 전달되므로 송신 비용이 노드 수와 무관합니다.
+     * @param GroupAddress 가입할 멀티캐스트 그룹 주소 (224.0.0.0/4)
+     * @param InterfaceAddress 가입과 송신에 사용할 인터페이스 주소 (Any면 커널이 선택)
+     * @param TimeToLive 송신 TTL (1이면 로컬 서브넷을 벗어나지 않음)
+     * @param bLoopback true면 같은 호스트의 가입 소켓에도 송신한 데이터그램을 전달
+     * @return 가입과 옵션 설정에 모두 성공하면 true
+     */
+    virtual bool EnableMulticast(const FIPv4Address& GroupAddress, const FIPv4Address& InterfaceAddress, uint8 TimeToLive, bool bLoopback) { return false; }
+
+    /**
+     * 소켓 비지 폴링(SO_BUSY_POLL)을 설정합니다.
+     * 수신 큐가 비어 있을 때 커널이 인터럽트를 기다리지 않고 최대 Microseconds 동안 장치 큐를 직접 폴링하므로
+     * CPU를 더 쓰는 대신 웨이크업 지연이 줄어듭니다. 0이면 해제합니다.
+     * @return 설정에 성공하면 true (지원하지 않거나 권한이 없으면 false)
+     */
+    virtual bool SetBusyPoll(int32 Microseconds) { return false; }
+
+    /**
+     * 이 소켓으로 보내는 데이터그램의 DSCP 값(IP_TOS 상위 6비트)을 설정합니다.
+     * 스위치가 DSCP 큐를 나눠 쓰는 네트워크에서 시간 동기화 트래픽이 대량 전송 뒤에 줄서지 않게 할 때 사용합니다.
+     * @param Dscp 0~63 (0이면 기본 서비스)
+     * @return 설정에 성공하면 true (지원하지 않으면 false)
+     */
+    virtual bool SetDscp(uint8 Dscp) { return false; }
+
+    /** epoll 등으로 여러 소켓을 한 스레드에서 감시할 때 사용할 네이티브 소켓 핸들 (없으면 INDEX_NONE) */
+    virtual int32 GetNativeHandle() const { return INDEX_NONE; }
+
+    /**
+     * 대기 중인 데이터그램을 최대 MaxCount개까지 읽습니다 (블로킹하지 않음).
+     * 각 데이터그램은 풀 버퍼에 직접 수신되며, 호출자가 Buffer 참조를 해제하면 풀로 반환됩니다.
+     * 도착 시각(ReceiveCycles)은 커널 수신 타임스탬프를 지원하면 그 값, 아니면 시스템 콜이 반환된 시각입니다.
+     * @return 읽은 데이터그램 수 (대기 중인 데이터가 없으면 0)
+     */
+    virtual int32 ReceiveBatch(FReceivedDatagram* OutDatagrams, int32 MaxCount) = 0;
+
+    /** 소켓 닫기 */
+    virtual void Close() = 0;
+
+    /** 통계 반환 */
+    const FTransportStats& GetStats() const { return Stats; }
+
+    /** 통계 초기화 */
+    void ResetStats() { Stats = FTransportStats(); }
+
+    /** 수신 패킷 버퍼 풀 반환 */
+    const FPacketBufferPool& GetPacketPool() const { return PacketPool; }
+
+protected:
+    INetworkTransport()
+        : PacketPool(MAX_DATAGRAM_SIZE, MAX_POOLED_PACKET_BUFFERS)
+    {
+    }
+
+    /** 수신 결과 헤더 등을 데이터그램과 같은 버퍼에 받는 구현용 (버퍼 용량은 MAX_DATAGRAM_SIZE 이상이어야 함) */
+    explicit INetworkTransport(int32 InPacketBufferCapacity)
+        : PacketPool(FMath::Max(InPacketBufferCapacity, MAX_DATAGRAM_SIZE), MAX_POOLED_PACKET_BUFFERS)
+    {
+    }
+
+    /** 통계 (수신 스레드에서 갱신) */
+    FTransportStats Stats;
+
+    /** 수신 패킷 버퍼 풀 (수신한 데이터그램이 모두 해제될 때까지 전송 계층이 살아있어야 함) */
+    FPacketBufferPool PacketPool;
+};
+
+/**
+ * FSocket 기반 전송 계층
+ * Linux 외 플랫폼의 기본 구현이자 네이티브 소켓을 열 수 없을 때의 대체 구현으로, 시스템 콜 한 번에 데이터그램 하나를 수신
+ */
+class MULTISERVERSYNC_API FSocketTransport : public INetworkTransport
+{
+public:
+    /**
+     * 생성자
+     * @param InSocket 감쌀 소켓
+     * @param bInOwnsSocket true면 소멸 시 소켓을 파괴
+     */
+    FSocketTransport(FSocket* InSocket, bool bInOwnsSocket);
+
+    /** 소멸자 */
+    virtual ~FSocketTransport();
+
+    // INetworkTransport 인터페이스 구현
+    virtual const TCHAR* GetBackendName() const override { return TEXT("FSocket"); }
+    virtual uint16 GetLocalPort() const override;
+    virtual bool SendTo(const uint8* Data, int32 Size, const FIPv4Endpoint& Target) override;
+    virtual int32 SendToMany(const uint8* Data, int32 Size, const FIPv4Endpoint* Targets, int32 TargetCount) override;
+    virtual bool WaitForRead(const FTimespan& Timeout) override;
+    virtual bool EnableMulticast(const FIPv4Address& GroupAddress, const FIPv4Address& InterfaceAddress, uint8 TimeToLive, bool bLoopback) override;
+    virtual int32 ReceiveBatch(FReceivedDatagram* OutDatagrams, int32 MaxCount) override;
+    virtual void Close() override;
+
+    /** 감싼 소켓 반환 */
+    FSocket* GetSocket() const { return Socket; }
+
+private:
+    /** 대상의 캐시된 송신 주소 반환 (없으면 생성하여 캐시) */
+    TSharedPtr<FInternetAddr> FindOrCreateTargetAddr(const FIPv4Endpoint& Target);
+
+    /** 소켓 */
+    FSocket* Socket;
+
+    /** 소켓 소유 여부 */
+    bool bOwnsSocket;
+
+    /** 다음 데이터그램을 수신할 풀 버퍼 */
+    FPacketBufferRef ReceiveBuffer;
+
+    /** 수신 주소 (수신 스레드에서만 재사용) */
+    TSharedPtr<FInternetAddr> SenderAddr;
+
+    /** 대상별 캐시된 송신 주소 (SendTo와 SendToMany가 공유) */
+    TMap<FIPv4Endpoint, TSharedPtr<FInternetAddr>> CachedTargetAddrs;
+
+    /** 송신 주소 캐시 보호 (송신은 게임 스레드 외에 수신 스레드 등에서도 호출될 수 있음) */
+    FCriticalSection TargetAddrLock;
+
+    /** 캐시할 최대 대상 주소 수 */
+    static constexpr int32 MAX_CACHED_TARGET_ADDRS = 1024;
+};
@@ -31,8 +31,11 @@ public:
     /** Send a sync message (only in master mode) */
     void SendSyncMessage();
 
-    /** Process a received PTP message */
-    void ProcessMessage(const TArray<uint8>& Message);
+    /**
+     * Process a received PTP message
+     * @param ReceiveAgeMicroseconds Time since the datagram reached the socket, so that T2/T4 use the arrival time rather than the handling time
+     */
+    void ProcessMessage(const TArray<uint8>& Message, int64 ReceiveAgeMicroseconds = 0);
 
     /** Get the current time offset in microseconds */
     int64 GetTimeOffsetMicroseconds() const;
@@ -111,11 +114,11 @@ private:
     /** Parse a PTP message and extract its type */
     EPTPMessageType ParsePTPMessageType(const TArray<uint8>& Message);
 
-    /** Process a sync message */
-    void ProcessSyncMessage(const TArray<uint8>& Message);
+    /** Process a sync message (ArrivalTime: local arrival timestamp in microseconds) */
+    void ProcessSyncMessage(const TArray<uint8>& Message, int64 ArrivalTime);
 
-    /** Process a delay request message */
-    void ProcessDelayReqMessage(const TArray<uint8>& Message);
+    /** Process a delay request message (ArrivalTime: local arrival timestamp in microseconds) */
+    void ProcessDelayReqMessage(const TArray<uint8>& Message, int64 ArrivalTime);
 
     /** Process a delay response message */
     void ProcessDelayRespMessage(const TArray<uint8>& Message);
@@ -0,0 +1,119 @@
+﻿// Copyright Your Company. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/ThreadSafeCounter.h"
+#include "HAL/ThreadSafeCounter64.h"
+#include "Misc/ScopeLock.h"
+#include "Templates/RefCounting.h"
+#include "Interfaces/IPv4/IPv4Endpoint.h"
+
+class FPacketBufferPool;
+
+/**
+ * 풀링되는 참조 카운트 패킷 버퍼
+ * 전송 계층이 소켓에서 직접 이 버퍼로 수신하며, 마지막 참조가 해제되면 할당 해제 없이 풀로 반환됨
+ */
+class MULTISERVERSYNC_API FPacketBuffer
+{
+public:
+    /** 버퍼 시작 주소 */
+    uint8* GetData() { return Storage.GetData(); }
+    const uint8* GetData() const { return Storage.GetData(); }
+
+    /** 버퍼 용량 (바이트) */
+    int32 GetCapacity() const { return Storage.Num(); }
+
+    /** 유효한 데이터 크기 (바이트) */
+    int32 GetSize() const { return Size; }
+    void SetSize(int32 InSize) { Size = FMath::Clamp(InSize, 0, Storage.Num()); }
+
+    /** 발신자 엔드포인트 */
+    const FIPv4Endpoint& GetSender() const { return Sender; }
+    void SetSender(const FIPv4Endpoint& InSender) { Sender = InSender; }
+
+    /** 유효한 데이터에 대한 뷰 */
+    TArrayView<const uint8> GetView() const { return TArrayView<const uint8>(Storage.GetData(), Size); }
+
+    // TRefCountPtr 지원
+    uint32 AddRef() const;
+    uint32 Release() const;
+    uint32 GetRefCount() const { return static_cast<uint32>(RefCount.GetValue()); }
+
+private:
+    friend class FPacketBufferPool;
+
+    /** 풀에서만 생성 */
+    FPacketBuffer(FPacketBufferPool* InPool, int32 InCapacity);
+
+    /** 데이터 저장소 (생성 시 한 번만 할당) */
+    TArray<uint8> Storage;
+
+    /** 유효한 데이터 크기 */
+    int32 Size;
+
+    /** 발신자 */
+    FIPv4Endpoint Sender;
+
+    /** 참조 카운트 */
+    mutable FThreadSafeCounter RefCount;
+
+    /** 반환될 풀 */
+    FPacketBufferPool* Pool;
+};
+
+/** 패킷 버퍼 참조 */
+typedef TRefCountPtr<FPacketBuffer> FPacketBufferRef;
+
+/**
+ * 패킷 버퍼 풀
+ * 정상 상태에서는 반환된 버퍼만 재사용하므로 패킷당 힙 할당이 없음
+ * 풀은 자신이 만든 모든 버퍼보다 오래 살아있어야 함
+ */
+class MULTISERVERSYNC_API FPacketBufferPool
+{
+public:
+    /**
+     * 생성자
+     * @param InBufferCapacity 버퍼 하나의 용량 (바이트)
+     * @param InMaxPooledBuffers 풀에 보관할 최대 여유 버퍼 수 (초과분은 해제)
+     */
+    FPacketBufferPool(int32 InBufferCapacity, int32 InMaxPooledBuffers);
+
+    /** 소멸자 */
+    ~FPacketBufferPool();
+
+    /** 버퍼 획득 (여유 버퍼가 없을 때만 새로 할당) */
+    FPacketBufferRef Acquire();
+
+    /** 버퍼 하나의 용량 */
+    int32 GetBufferCapacity() const { return BufferCapacity; }
+
+    /** 지금까지 새로 할당한 버퍼 수 (정상 상태에서는 증가하지 않아야 함) */
+    uint64 GetAllocationCount() const { return static_cast<uint64>(AllocationCount.GetValue()); }
+
+    /** 현재 풀에 있는 여유 버퍼 수 */
+    int32 GetFreeCount() const;
+
+private:
+    friend class FPacketBuffer;
+
+    /** 참조가 모두 해제된 버퍼를 풀로 반환 */
+    void ReturnToPool(FPacketBuffer* Buffer);
+
+    /** 여유 버퍼 목록 보호용 락 */
+    mutable FCriticalSection Lock;
+
+    /** 여유 버퍼 목록 (MaxPooledBuffers만큼 미리 예약) */
+    TArray<FPacketBuffer*> FreeBuffers;
+
+    /** 버퍼 하나의 용량 */
+    int32 BufferCapacity;
+
+    /** 보관할 최대 여유 버퍼 수 */
+    int32 MaxPooledBuffers;
+
+    /** 할당 횟수 */
+    FThreadSafeCounter64 AllocationCount;
+};
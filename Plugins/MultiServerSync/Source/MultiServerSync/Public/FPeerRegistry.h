@@ -0,0 +1,207 @@
+﻿// Copyright Your Company. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Interfaces/IPv4/IPv4Endpoint.h"
+#include "NetworkTypes.h"
+#include "FCongestionController.h"
+
+/** 조밀한 피어 인덱스 (0부터 할당되며 제거된 인덱스는 재사용됨) */
+typedef uint16 FPeerId;
+
+/** 유효하지 않은 피어 인덱스 */
+static constexpr FPeerId INVALID_PEER_ID = MAX_uint16;
+
+/**
+ * 피어 레지스트리
+ * 각 FIPv4Endpoint에 조밀한 uint16 피어 인덱스를 할당하고, 피어별 상태를 인덱스로 접근하는 연속 배열(SoA)에 보관
+ * 패킷 처리 경로에서 Endpoint.ToString() 같은 문자열 생성이나 문자열 해시 없이 피어 상태에 접근하기 위해 사용
+ * FNetworkManager의 소유 스레드(게임 스레드)에서만 접근해야 함
+ */
+class MULTISERVERSYNC_API FPeerRegistry
+{
+public:
+    /** 생성자 */
+    FPeerRegistry();
+
+    /** 등록 가능한 최대 피어 수 */
+    static constexpr int32 MAX_PEERS = INVALID_PEER_ID;
+
+    /** 엔드포인트의 피어 인덱스 반환, 없으면 새로 할당 (레지스트리가 가득 차면 INVALID_PEER_ID) */
+    FPeerId FindOrAdd(const FIPv4Endpoint& Endpoint);
+
+    /** 엔드포인트의 피어 인덱스 반환 (없으면 INVALID_PEER_ID) */
+    FPeerId Find(const FIPv4Endpoint& Endpoint) const;
+
+    /** 피어 제거 (피어 상태는 초기화되고 인덱스는 재사용됨) */
+    void Remove(FPeerId PeerId);
+
+    /** 모든 피어 제거 */
+    void Reset();
+
+    /** 등록된 피어 인덱스인지 여부 */
+    bool IsValid(FPeerId PeerId) const
+    {
+        return PeerId < Flags.Num() && (Flags[PeerId] & PEER_FLAG_IN_USE) != 0;
+    }
+
+    /** 등록된 피어 수 */
+    int32 Num() const { return KeyToPeer.Num(); }
+
+    /** 순회용 인덱스 상한 (0 이상 이 값 미만의 인덱스 중 IsValid인 것만 사용) */
+    int32 GetPeerIdLimit() const { return Flags.Num(); }
+
+    /** 피어 엔드포인트 */
+    const FIPv4Endpoint& GetEndpoint(FPeerId PeerId) const { return Endpoints[PeerId]; }
+
+    /** 표시용 피어 ID (발견된 서버면 서버 ID, 아니면 등록 시 한 번 만든 엔드포인트 문자열) */
+    const FString& GetDisplayId(FPeerId PeerId) const { return DisplayIds[PeerId]; }
+
+    /** 발견된 서버 ID 설정 (빈 문자열이면 엔드포인트 문자열로 되돌림) */
+    void SetServerId(FPeerId PeerId, const FString& ServerId);
+
+    /**
+     * 주소와 합의한 프로토콜 버전 (탐색 전에는 1)
+     * 한 서버의 데이터/시간 동기화/탐색 소켓은 포트만 다르므로 버전은 엔드포인트가 아니라 주소 단위로 보관
+     */
+    uint8 GetProtocolVersion(const FIPv4Address& Address) const
+    {
+        const uint8* Version = AddressProtocolVersions.Find(Address.Value);
+        return Version ? *Version : 1;
+    }
+
+    /** 주소와 합의한 프로토콜 버전 설정 (1이면 기록을 지움) */
+    void SetProtocolVersion(const FIPv4Address& Address, uint8 Version)
+    {
+        if (Version > 1)
+        {
+            AddressProtocolVersions.Add(Address.Value, Version);
+        }
+        else
+        {
+            AddressProtocolVersions.Remove(Address.Value);
+        }
+    }
+
+    /** 마지막으로 패킷을 받은 시간 */
+    double GetLastSeenTime(FPeerId PeerId) const { return LastSeenTimes[PeerId]; }
+    void SetLastSeenTime(FPeerId PeerId, double Time) { LastSeenTimes[PeerId] = Time; }
+
+    /** 지연 통계 (아직 RTT 샘플이 없으면 nullptr) */
+    FNetworkLatencyStats* FindLatencyStats(FPeerId PeerId);
+    const FNetworkLatencyStats* FindLatencyStats(FPeerId PeerId) const;
+
+    /** 지연 통계 (없으면 생성) */
+    FNetworkLatencyStats& FindOrAddLatencyStats(FPeerId PeerId);
+
+    /** 시퀀스 공간별 수신 시퀀스 추적기 (아직 그 공간의 메시지를 받지 않았으면 nullptr) */
+    FMessageSequenceTracker* FindSequenceTracker(FPeerId PeerId, ESequenceChannel Channel);
+    const FMessageSequenceTracker* FindSequenceTracker(FPeerId PeerId, ESequenceChannel Channel) const;
+
+    /** 시퀀스 공간별 수신 시퀀스 추적기 (없으면 생성) */
+    FMessageSequenceTracker& FindOrAddSequenceTracker(FPeerId PeerId, ESequenceChannel Channel, bool bOrderGuaranteed);
+
+    /**
+     * 이 피어로 보낼 다음 신뢰성 시퀀스 번호를 할당합니다 (1부터 시작하는 피어별 32비트 번호).
+     * 호출하기 전에 CanSendReliable로 시퀀스 윈도우를 확인해야 함
+     */
+    uint32 AllocateReliableSequence(FPeerId PeerId) { return ++LastReliableSequences[PeerId]; }
+
+    /** 이 피어로 마지막으로 보낸 신뢰성 시퀀스 번호 (받은 ACK의 16비트 번호 복원 기준) */
+    uint32 GetLastReliableSequence(FPeerId PeerId) const { return LastReliableSequences[PeerId]; }
+
+    /**
+     * 마지막으로 보낸 신뢰성 시퀀스 번호를 바꿉니다 (ACK 대기 메시지가 없을 때만 가능).
+     * 받는 쪽 추적기는 1부터 기대하므로 랩어라운드 검증처럼 양쪽을 함께 맞출 때만 사용
+     * @return 바꿨으면 true
+     */
+    bool SetLastReliableSequence(FPeerId PeerId, uint32 Sequence)
+    {
+        if (!IsValid(PeerId) || PendingAckSequences[PeerId].Num() > 0)
+        {
+            return false;
+        }
+        LastReliableSequences[PeerId] = Sequence;
+        return true;
+    }
+
+    /**
+     * 다음 신뢰성 메시지를 보내도 시퀀스 윈도우를 넘지 않는지 여부
+     * ACK를 기다리는 가장 오래된 번호와 새 번호의 차이가 16비트 공간의 절반 미만이어야 ACK의 16비트 번호를 하나의 메시지로 복원할 수 있음
+     */
+    bool CanSendReliable(FPeerId PeerId) const
+    {
+        const TArray<uint32>& Pending = PendingAckSequences[PeerId];
+        return Pending.Num() == 0 || FSequenceNumber::Diff(LastReliableSequences[PeerId] + 1, Pending[0]) < MAX_RELIABLE_SEQUENCE_WINDOW;
+    }
+
+    /** 이 피어로 보낸 뒤 ACK를 기다리는 신뢰성 시퀀스 번호 목록 (보낸 순서, 제거할 때도 순서 유지) */
+    TArray<uint32>& GetPendingAckSequences(FPeerId PeerId) { return PendingAckSequences[PeerId]; }
+    const TArray<uint32>& GetPendingAckSequences(FPeerId PeerId) const { return PendingAckSequences[PeerId]; }
+
+    /** ACK 대기 메시지 키 (피어 인덱스 + 피어별 32비트 시퀀스) */
+    static uint64 MakeSequenceKey(FPeerId PeerId, uint32 Sequence)
+    {
+        return (static_cast<uint64>(PeerId) << 32) | static_cast<uint64>(Sequence);
+    }
+    static FPeerId GetSequenceKeyPeer(uint64 Key) { return static_cast<FPeerId>(Key >> 32); }
+    static uint32 GetSequenceKeySequence(uint64 Key) { return static_cast<uint32>(Key); }
+
+    /** ACK를 기다릴 수 있는 가장 오래된 신뢰성 메시지와 새 메시지의 최대 번호 차이 (16비트 공간의 절반) */
+    static constexpr int32 MAX_RELIABLE_SEQUENCE_WINDOW = 32768;
+
+    /** 이 피어로 보내는 신뢰성/대량 전송 트래픽의 혼잡 제어기 */
+    FCongestionController& GetCongestionController(FPeerId PeerId) { return CongestionControllers[PeerId]; }
+    const FCongestionController& GetCongestionController(FPeerId PeerId) const { return CongestionControllers[PeerId]; }
+
+    /** 이 피어에게서 받았지만 아직 ACK를 보내지 않은 시퀀스 번호 (인박스 틱 끝에 선택적 ACK로 묶어 보냄) */
+    TArray<uint16>& GetUnsentAcks(FPeerId PeerId) { return UnsentAcks[PeerId]; }
+
+    /** 엔드포인트로 지연 통계 조회 (설정/조회 API용) */
+    FNetworkLatencyStats* FindLatencyStats(const FIPv4Endpoint& Endpoint) { return FindLatencyStats(Find(Endpoint)); }
+    const FNetworkLatencyStats* FindLatencyStats(const FIPv4Endpoint& Endpoint) const { return FindLatencyStats(Find(Endpoint)); }
+
+private:
+    /** 피어 플래그 */
+    static constexpr uint8 PEER_FLAG_IN_USE = 1 << 0;
+    static constexpr uint8 PEER_FLAG_HAS_LATENCY_STATS = 1 << 1;
+    static constexpr uint8 PEER_FLAG_HAS_SEQUENCE_TRACKER = 1 << 2;   // 시퀀스 공간마다 한 비트씩 (1 << 2, 1 << 3)
+
+    /** 시퀀스 공간의 추적기 플래그 */
+    static uint8 GetSequenceTrackerFlag(ESequenceChannel Channel)
+    {
+        return static_cast<uint8>(PEER_FLAG_HAS_SEQUENCE_TRACKER << static_cast<uint8>(Channel));
+    }
+
+    /** 엔드포인트를 정수 키로 변환 (주소 32비트 + 포트 16비트) */
+    static uint64 MakeKey(const FIPv4Endpoint& Endpoint)
+    {
+        return (static_cast<uint64>(Endpoint.Address.Value) << 16) | static_cast<uint64>(Endpoint.Port);
+    }
+
+    /** 엔드포인트 키 -> 피어 인덱스 */
+    TMap<uint64, FPeerId> KeyToPeer;
+
+    /** 마지막 조회 결과 (같은 패킷 처리 중 반복 조회 시 해시 생략) */
+    mutable uint64 LastLookupKey;
+    mutable FPeerId LastLookupPeer;
+
+    /** 재사용 가능한 피어 인덱스 */
+    TArray<FPeerId> FreePeerIds;
+
+    /** 주소 -> 합의한 프로토콜 버전 (피어를 제거해도 유지, 서버 목록이 바뀔 때 갱신) */
+    TMap<uint32, uint8> AddressProtocolVersions;
+
+    // 피어 인덱스로 접근하는 피어별 상태 배열
+    TArray<uint8> Flags;                                   // 피어 플래그
+    TArray<FIPv4Endpoint> Endpoints;                       // 엔드포인트
+    TArray<FString> DisplayIds;                            // 표시용 ID
+    TArray<double> LastSeenTimes;                          // 마지막 수신 시간
+    TArray<FNetworkLatencyStats> LatencyStats;             // 지연 통계
+    TArray<FMessageSequenceTracker> SequenceTrackers[NUM_SEQUENCE_CHANNELS]; // 시퀀스 공간별 수신 시퀀스 추적기
+    TArray<uint32> LastReliableSequences;                  // 마지막으로 보낸 신뢰성 시퀀스 번호
+    TArray<TArray<uint32>> PendingAckSequences;            // ACK 대기 시퀀스 번호
+    TArray<FCongestionController> CongestionControllers;   // 혼잡 제어기
+    TArray<TArray<uint16>> UnsentAcks;                     // 보내지 않은 ACK 시퀀스 번호
+};
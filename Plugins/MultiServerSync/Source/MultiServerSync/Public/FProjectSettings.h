@@ -5,6 +5,15 @@
 #include "CoreMinimal.h"
 #include "Serialization/StructuredArchive.h"
 
+/**
+ * 수신 스레드 프로필
+ */
+enum class EReceiverThreadProfile : uint8
+{
+    Standard = 0,    // 일반 스케줄링, 소켓 대기만 사용
+    LowLatency = 1   // 비지 폴링, 대기 전 스핀, 코어 고정, SCHED_FIFO (권한이 없으면 가능한 항목만 적용)
+};
+
 /**
  * 다중 서버 간에 공유되는 프로젝트 설정 구조체
  * 모든 서버가 일관된 설정으로 작동하도록 함
@@ -37,6 +46,11 @@ struct MULTISERVERSYNC_API FProjectSettings
     bool bEnableBroadcast;
     FString PreferredNetworkInterface;
 
+    /** 수신 스레드 설정 (시간 동기화 소켓을 감시하는 수신 스레드에 적용, 재시작 필요) */
+    EReceiverThreadProfile ReceiverThreadProfile;
+    int32 ReceiverCpuCore;    // 저지연 프로필에서 고정할 코어 (INDEX_NONE이면 고정하지 않음)
+    int32 ReceiveInboxCapacity; // 수신 샤드별 인박스 용량 (0이면 기본값, 2의 거듭제곱으로 올림)
+
     /** 기본 생성자 - 기본값 설정 */
     FProjectSettings();
 
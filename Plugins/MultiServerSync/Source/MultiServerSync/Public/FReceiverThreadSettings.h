@@ -0,0 +1,51 @@
+﻿// Copyright Your Company. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "FProjectSettings.h"
+
+/**
+ * 수신 스레드 실행 설정
+ * 저지연 프로필은 웨이크업 지연을 줄이는 대신 코어 하나를 사실상 전담으로 사용하며,
+ * 권한이 없어 적용하지 못한 항목은 경고만 남기고 나머지 항목으로 계속 동작
+ */
+struct MULTISERVERSYNC_API FReceiverThreadSettings
+{
+    int32 BusyPollMicroseconds;   // 소켓 SO_BUSY_POLL 시간 (0이면 사용 안 함, Linux 전용)
+    int32 SpinMicroseconds;       // 블로킹 대기 전에 논블로킹 확인을 반복하는 시간 (0이면 바로 대기, 이벤트 기반 모드 전용)
+    int32 CpuCore;                // 수신 스레드를 고정할 코어 (INDEX_NONE이면 고정 안 함)
+    int32 RealtimePriority;       // SCHED_FIFO 우선순위 1~99 (0이면 일반 스케줄링, Linux 전용)
+
+    FReceiverThreadSettings()
+        : BusyPollMicroseconds(0)
+        , SpinMicroseconds(0)
+        , CpuCore(INDEX_NONE)
+        , RealtimePriority(0)
+    {
+    }
+
+    /** 프로필 기본값으로 설정 생성 */
+    static FReceiverThreadSettings FromProfile(EReceiverThreadProfile Profile, int32 InCpuCore = INDEX_NONE);
+
+    /** 기본 스케줄링 외의 항목이 하나라도 켜져 있는지 여부 */
+    bool IsLowLatency() const
+    {
+        return BusyPollMicroseconds > 0 || SpinMicroseconds > 0 || CpuCore != INDEX_NONE || RealtimePriority > 0;
+    }
+
+    bool operator==(const FReceiverThreadSettings& Other) const
+    {
+        return BusyPollMicroseconds == Other.BusyPollMicroseconds && SpinMicroseconds == Other.SpinMicroseconds
+            && CpuCore == Other.CpuCore && RealtimePriority == Other.RealtimePriority;
+    }
+
+    bool operator!=(const FReceiverThreadSettings& Other) const { return !(*this == Other); }
+
+    /** 설정을 문자열로 변환 */
+    FString ToString() const
+    {
+        return FString::Printf(TEXT("BusyPoll=%dus, Spin=%dus, Core=%d, FifoPriority=%d"),
+            BusyPollMicroseconds, SpinMicroseconds, CpuCore, RealtimePriority);
+    }
+};
@@ -0,0 +1,146 @@
+﻿// Copyright Your Company. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * 선택적 ACK 블록
+ * BaseSequence와, 그 뒤 64개 시퀀스 중 받은 것을 비트로 표시 (비트 i는 BaseSequence + 1 + i)
+ */
+#pragma pack(push, 1)
+struct FSackBlock
+{
+    uint16 BaseSequence;    // 받은 시퀀스 번호 (블록의 시작)
+    uint64 Bitmap;          // BaseSequence 뒤 시퀀스들의 수신 여부
+
+    /** 블록이 시퀀스를 포함하는지 여부 (uint16 순환 고려) */
+    bool Contains(uint16 Sequence) const
+    {
+        const uint16 Offset = static_cast<uint16>(Sequence - BaseSequence);
+        return Offset == 0 || (Offset <= 64 && ((Bitmap >> (Offset - 1)) & 1) != 0);
+    }
+};
+#pragma pack(pop)
+
+/**
+ * 선택적 ACK (MessageAck 페이로드)
+ * 받은 시퀀스 번호 목록을 블록 단위로 압축하여, 블록 하나(10바이트)가 최대 65개 메시지를 확인
+ * 누적 ACK 지점이 있으면 첫 블록이 그 지점이고 (FNetworkMessage::FLAG_CUMULATIVE_ACK), 지점과 그 앞의 번호를 모두 확인
+ * 지점 앞에서 받은 번호도 뒤 블록에 그대로 남기므로, 플래그를 모르는 이전 빌드도 전과 같이 확인함
+ * 이전 형식(시퀀스 번호 하나, 2바이트)도 읽을 수 있음
+ */
+struct MULTISERVERSYNC_API FSelectiveAck
+{
+    TArray<FSackBlock> Blocks;
+
+    /** 누적 ACK 지점 (이 번호까지는 순서대로 받았거나 받는 쪽이 더 기다리지 않음, bHasCumulativeAck일 때만 유효) */
+    uint16 CumulativeSequence = 0;
+
+    /** 첫 블록이 누적 ACK 지점인지 여부 */
+    bool bHasCumulativeAck = false;
+
+    /** 블록 하나가 비트맵으로 덮는 시퀀스 수 */
+    static constexpr int32 BITMAP_BITS = 64;
+
+    /** 직렬화한 블록 크기 */
+    static constexpr int32 BLOCK_SIZE = sizeof(FSackBlock);
+
+    /** ACK 메시지 하나에 담는 최대 블록 수 (묶음 데이터그램 하나에 들어가도록 제한) */
+    static constexpr int32 MAX_BLOCKS_PER_MESSAGE = 64;
+
+    /**
+     * 받은 시퀀스 번호 목록으로 블록을 만듭니다.
+     * Sequences는 uint16 순환 순서로 정렬되고 중복이 제거됩니다 (한 번에 받는 범위는 32768보다 좁다고 가정).
+     */
+    void Build(TArray<uint16>& Sequences);
+
+    /**
+     * 누적 ACK 지점을 첫 블록으로 넣습니다 (Build 뒤에 호출).
+     * 지점 뒤 64개 안의 번호는 지점 블록의 비트맵으로 옮기고, 나머지 번호는 뒤 블록에 남깁니다.
+     */
+    void SetCumulativeAck(uint16 Sequence);
+
+    /** 시퀀스가 누적 ACK 지점 이하인지 여부 (uint16 순환 고려) */
+    bool IsCumulativelyAcked(uint16 Sequence) const
+    {
+        return bHasCumulativeAck && static_cast<int16>(Sequence - CumulativeSequence) <= 0;
+    }
+
+    /** 시퀀스가 누적 ACK 지점 이하이거나 어느 블록에든 포함되는지 여부 */
+    bool Contains(uint16 Sequence) const;
+
+    /** 블록들이 확인하는 시퀀스 수 (누적 ACK 지점 앞의 번호는 세지 않음) */
+    int32 GetSequenceCount() const;
+
+    /** 확인하는 시퀀스마다 Func(uint16) 호출 */
+    template <typename FunctorType>
+    void ForEachSequence(FunctorType&& Func) const
+    {
+        for (const FSackBlock& Block : Blocks)
+        {
+            Func(Block.BaseSequence);
+            for (uint64 Remaining = Block.Bitmap; Remaining != 0; Remaining &= Remaining - 1)
+            {
+                Func(static_cast<uint16>(Block.BaseSequence + 1 + FMath::CountTrailingZeros64(Remaining)));
+            }
+        }
+    }
+
+    /** FirstBlock부터 Count개 블록 직렬화 */
+    TArray<uint8> Serialize(int32 FirstBlock, int32 Count) const;
+
+    /**
+     * 바이트 뷰에서 역직렬화 (이전 형식의 2바이트 ACK도 블록 하나로 읽음, 크기가 맞지 않으면 false)
+     * @param bCumulative 첫 블록을 누적 ACK 지점으로 읽을지 여부 (FLAG_CUMULATIVE_ACK)
+     */
+    bool Deserialize(TArrayView<const uint8> Bytes, bool bCumulative = false);
+
+    /** 다른 메시지에 실을 때 최대 블록 수 */
+    static constexpr int32 MAX_PIGGYBACK_BLOCKS = 8;
+
+    /** Count개 블록을 실었을 때 늘어나는 페이로드 크기 (블록 + 블록 수 1바이트) */
+    static constexpr int32 GetTrailerSize(int32 Count) { return Count * BLOCK_SIZE + 1; }
+
+    /** 페이로드 끝에 FirstBlock부터 Count개 블록과 블록 수를 덧붙임 (FNetworkMessage::FLAG_HAS_ACK와 함께 사용) */
+    void AppendTrailer(TArray<uint8>& Payload, int32 FirstBlock, int32 Count) const;
+
+    /**
+     * 페이로드 끝의 블록을 읽습니다.
+     * @param OutPayloadSize 블록을 뗀 원래 페이로드 크기
+     * @param bCumulative 첫 블록을 누적 ACK 지점으로 읽을지 여부 (FLAG_CUMULATIVE_ACK)
+     * @return 블록 수가 0이거나 페이로드보다 길면 false
+     */
+    bool ReadTrailer(TArrayView<const uint8> Payload, int32& OutPayloadSize, bool bCumulative = false);
+};
+
+/**
+ * ACK 통계 (ACK 패킷 수 대비 확인한 메시지 수)
+ */
+struct FAckStats
+{
+    uint64 AckMessagesSent;         // 보낸 ACK 메시지 수
+    uint64 AckedSequencesSent;      // 보낸 ACK에 담은 시퀀스 수 (받은 신뢰성 메시지 수)
+    uint64 AckMessagesReceived;     // 받은 ACK 메시지 수
+    uint64 MessagesAcknowledged;    // 받은 ACK로 확인이 끝난 보낸 메시지 수
+    uint64 PiggybackedAcksSent;     // 다른 메시지에 실어 보낸 ACK 수 (AckMessagesSent에는 포함되지 않음)
+    uint64 PiggybackedAcksReceived; // 다른 메시지에 실려 온 ACK 수
+    uint64 CumulativelyAcknowledged; // 블록에 없이 누적 ACK 지점으로만 확인된 보낸 메시지 수 (앞서 보낸 ACK가 유실된 경우)
+
+    FAckStats()
+        : AckMessagesSent(0)
+        , AckedSequencesSent(0)
+        , AckMessagesReceived(0)
+        , MessagesAcknowledged(0)
+        , PiggybackedAcksSent(0)
+        , PiggybackedAcksReceived(0)
+        , CumulativelyAcknowledged(0)
+    {
+    }
+
+    /** 받은 신뢰성 메시지 하나당 보낸 ACK 전용 패킷 수 (개별 ACK면 1, 실어 보낸 ACK는 패킷을 늘리지 않음) */
+    double GetAcksPerDeliveredMessage() const
+    {
+        return AckedSequencesSent > 0 ? static_cast<double>(AckMessagesSent) / AckedSequencesSent : 0.0;
+    }
+};
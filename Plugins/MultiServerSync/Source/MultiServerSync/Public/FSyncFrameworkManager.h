@@ -4,6 +4,8 @@
 #include "ISyncFrameworkManager.h"
 #include "FProjectSettings.h" // 전방 선언 대신 직접 헤더를 포함
 
+enum class ENetworkMessageType : uint8;
+
 /**
  * Implementation of the synchronization framework manager
  * Manages all subsystems of the Multi-Server Sync Framework
@@ -51,6 +53,9 @@ private:
     /** Indicates if the manager has been initialized */
     bool bIsInitialized;
 
+    /** 네트워크 매니저에 등록한 메시지 구독 목록 */
+    TArray<TPair<ENetworkMessageType, FDelegateHandle>> MessageSubscriptions;
+
     /** 설정을 모든 모듈에 적용 */
     void ApplySettingsToModules(const FProjectSettings& Settings);
 
@@ -37,8 +37,8 @@ public:
     /** Check if operating in master mode */
     bool IsMasterMode() const;
 
-    /** Process a received PTP message */
-    void ProcessPTPMessage(const TArray<uint8>& Message);
+    /** Process a received PTP message (ReceiveAgeMicroseconds: time since the datagram reached the socket) */
+    void ProcessPTPMessage(const TArray<uint8>& Message, int64 ReceiveAgeMicroseconds = 0);
 
     /** Get local time in microseconds */
     int64 GetLocalTimeMicroseconds() const;
@@ -0,0 +1,206 @@
+﻿// Copyright Your Company. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Interfaces/IPv4/IPv4Address.h"
+#include "Interfaces/IPv4/IPv4Endpoint.h"
+
+class INetworkTransport;
+
+/**
+ * 송신 트래픽 클래스 (값이 작을수록 우선순위가 높음)
+ */
+enum class ETrafficClass : uint8
+{
+    Clock = 0,      // PTP, 핑 (타임스탬프가 담겨 지연이 곧 측정 오차)
+    Frame = 1,      // 프레임 동기화
+    Control = 2,    // 마스터 선출, ACK, 재전송 요청 등 제어 메시지
+    Bulk = 3        // 설정, 데이터, 조각 메시지 같은 대량 전송
+};
+
+/** 트래픽 클래스 수 */
+static constexpr int32 NUM_TRAFFIC_CLASSES = 4;
+
+/** 트래픽 클래스 이름 (로그용) */
+MULTISERVERSYNC_API const TCHAR* GetTrafficClassName(ETrafficClass Class);
+
+/**
+ * 트래픽 클래스별 페이싱 설정
+ */
+struct FTrafficClassConfig
+{
+    int64 RateBytesPerSecond;   // 피어별 토큰 충전 속도 (0이면 페이싱하지 않음)
+    int32 BurstBytes;           // 피어별 토큰 버킷 크기 (한 번에 몰아서 보낼 수 있는 양)
+    int32 MaxQueueDepth;        // 피어별 대기열 최대 데이터그램 수 (넘으면 새 데이터그램을 버림)
+    uint8 Dscp;                 // 이 클래스를 보내는 소켓에 표시할 DSCP 값 (0이면 표시하지 않음)
+
+    FTrafficClassConfig()
+        : RateBytesPerSecond(0)
+        , BurstBytes(0)
+        , MaxQueueDepth(0)
+        , Dscp(0)
+    {
+    }
+
+    FTrafficClassConfig(int64 InRateBytesPerSecond, int32 InBurstBytes, int32 InMaxQueueDepth, uint8 InDscp)
+        : RateBytesPerSecond(InRateBytesPerSecond)
+        , BurstBytes(InBurstBytes)
+        , MaxQueueDepth(InMaxQueueDepth)
+        , Dscp(InDscp)
+    {
+    }
+
+    /** 페이싱하는 클래스인지 여부 */
+    bool IsPaced() const { return RateBytesPerSecond > 0; }
+
+    /** 클래스별 기본 설정 (시간/프레임 클래스는 페이싱하지 않음) */
+    static FTrafficClassConfig GetDefault(ETrafficClass Class);
+};
+
+/**
+ * 트래픽 클래스별 송신 통계
+ */
+struct FTrafficClassStats
+{
+    uint64 SentDatagrams;       // 전송 계층으로 넘긴 데이터그램 수
+    uint64 SentBytes;           // 전송 계층으로 넘긴 바이트 수
+    uint64 PacedDatagrams;      // 토큰이 모자라 대기열을 거쳐 보낸 데이터그램 수
+    uint64 DroppedDatagrams;    // 대기열이 가득 차 버린 데이터그램 수
+    int32 QueueDepth;           // 모든 피어의 대기열에 남은 데이터그램 수
+    int32 PeakQueueDepth;       // QueueDepth의 최댓값
+
+    FTrafficClassStats()
+        : SentDatagrams(0)
+        , SentBytes(0)
+        , PacedDatagrams(0)
+        , DroppedDatagrams(0)
+        , QueueDepth(0)
+        , PeakQueueDepth(0)
+    {
+    }
+};
+
+/**
+ * 송신 스케줄러
+ * 모든 송신 데이터그램을 트래픽 클래스로 나누고, 피어(대상 주소)와 클래스마다 토큰 버킷으로 송신 속도를 제한
+ * 토큰이 모자라면 데이터그램을 복사해 피어별 클래스 대기열에 넣고, Pump에서 우선순위가 높은 클래스부터 엄격한 우선순위로 보냄
+ * 페이싱하지 않는 클래스(기본값은 시간/프레임)는 대기열 없이 바로 보내므로 대량 전송이 밀려 있어도 뒤에 줄서지 않음
+ * FNetworkManager의 소유 스레드(게임 스레드)에서만 접근해야 함
+ */
+class MULTISERVERSYNC_API FTrafficScheduler
+{
+public:
+    /** 생성자 */
+    FTrafficScheduler();
+
+    /** 클래스 설정 (대기 중인 데이터그램은 새 속도로 보냄) */
+    void SetClassConfig(ETrafficClass Class, const FTrafficClassConfig& InConfig);
+    const FTrafficClassConfig& GetClassConfig(ETrafficClass Class) const { return Configs[static_cast<int32>(Class)]; }
+
+    /**
+     * 피어 하나의 클래스 송신 속도를 클래스 설정보다 낮게 제한합니다 (혼잡 제어기가 사용).
+     * 페이싱하는 클래스에만 적용되며, 0이면 제한을 해제합니다. 제한이 걸린 피어 상태는 유휴 정리에서 제외됩니다.
+     */
+    void SetPeerRateLimit(const FIPv4Address& Address, ETrafficClass Class, int64 RateBytesPerSecond, double Now);
+
+    /** 피어의 클래스 속도 제한 (없으면 0) */
+    int64 GetPeerRateLimit(const FIPv4Address& Address, ETrafficClass Class) const;
+
+    /**
+     * 데이터그램을 보내거나 대기열에 넣습니다.
+     * 같은 피어와 클래스의 대기열이 비어 있고 토큰이 충분하면 바로 보내고, 아니면 복사하여 대기열 끝에 넣습니다.
+     * @return 보냈거나 대기열에 넣었으면 true (대기열이 가득 찼거나 전송에 실패하면 false)
+     */
+    bool Send(ETrafficClass Class, INetworkTransport* Transport, const uint8* Data, int32 Size, const FIPv4Endpoint& Target, double Now);
+
+    /**
+     * 같은 데이터그램을 여러 대상에 보냅니다.
+     * 페이싱하지 않는 클래스는 INetworkTransport::SendToMany로 한 번에 보냅니다.
+     * @return 보냈거나 대기열에 넣은 대상 수
+     */
+    int32 SendToMany(ETrafficClass Class, INetworkTransport* Transport, const uint8* Data, int32 Size, const FIPv4Endpoint* Targets, int32 TargetCount, double Now);
+
+    /** 토큰을 충전하고 대기열을 우선순위가 높은 클래스부터 보냄 (매 인박스 틱마다 호출) */
+    void Pump(double Now);
+
+    /** 대기 중인 데이터그램을 보내지 않고 버림 (전송 계층을 닫기 전에 호출) */
+    void Reset();
+
+    /** 클래스별 통계 */
+    const FTrafficClassStats& GetStats(ETrafficClass Class) const { return Stats[static_cast<int32>(Class)]; }
+
+    /** 모든 클래스의 대기열에 남은 데이터그램 수 */
+    int32 GetTotalQueueDepth() const;
+
+    /** 통계 초기화 (현재 대기열 깊이는 유지) */
+    void ResetStats();
+
+private:
+    /** 대기 중인 데이터그램 */
+    struct FQueuedDatagram
+    {
+        INetworkTransport* Transport;
+        FIPv4Endpoint Target;
+        TArray<uint8> Data;
+    };
+
+    /** 피어 하나의 클래스별 토큰 버킷과 대기열 */
+    struct FClassState
+    {
+        double Tokens;                      // 남은 토큰 (바이트, 버킷보다 큰 데이터그램을 보내면 음수가 될 수 있음)
+        double LastRefillTime;              // 마지막으로 토큰을 충전한 시간
+        int64 RateLimit;                    // 피어별 속도 제한 (0이면 클래스 설정을 따름)
+        TArray<FQueuedDatagram> Queue;      // 대기열 (QueueHead부터 유효)
+        int32 QueueHead;                    // 다음에 보낼 데이터그램 위치
+
+        FClassState()
+            : Tokens(0.0)
+            , LastRefillTime(0.0)
+            , RateLimit(0)
+            , QueueHead(0)
+        {
+        }
+
+        int32 GetQueueDepth() const { return Queue.Num() - QueueHead; }
+    };
+
+    /** 피어 상태 */
+    struct FPeerState
+    {
+        FClassState Classes[NUM_TRAFFIC_CLASSES];
+        double LastActiveTime;
+
+        FPeerState()
+            : LastActiveTime(0.0)
+        {
+        }
+    };
+
+    /** 피어의 클래스 상태 반환 (처음 보는 피어는 버킷을 가득 채워 생성) */
+    FClassState& FindOrAddClassState(const FIPv4Address& Address, ETrafficClass Class, double Now);
+
+    /** 경과 시간만큼 토큰 충전 */
+    void Refill(FClassState& State, const FTrafficClassConfig& Config, double Now) const;
+
+    /** 토큰이 남아 있는 동안 대기열 앞에서부터 보냄 */
+    void Drain(FClassState& State, ETrafficClass Class);
+
+    /** 전송 계층으로 넘기고 통계와 토큰 갱신 */
+    bool Transmit(FClassState* State, ETrafficClass Class, INetworkTransport* Transport, const uint8* Data, int32 Size, const FIPv4Endpoint& Target);
+
+    /** 이 시간 동안 아무것도 보내지 않고 대기열도 빈 피어의 상태는 정리 */
+    static constexpr double IDLE_PEER_TIMEOUT_SECONDS = 10.0;
+
+    /** 클래스별 설정 */
+    FTrafficClassConfig Configs[NUM_TRAFFIC_CLASSES];
+
+    /** 클래스별 통계 */
+    FTrafficClassStats Stats[NUM_TRAFFIC_CLASSES];
+
+    /** 대상 주소별 상태 (같은 호스트의 데이터/시간 동기화 포트는 한 피어로 봄) */
+    TMap<FIPv4Address, FPeerState> Peers;
+
+    /** 마지막으로 유휴 피어를 정리한 시간 */
+    double LastPruneTime;
+};
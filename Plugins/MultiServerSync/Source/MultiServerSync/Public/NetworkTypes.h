@@ -70,6 +70,62 @@ enum class ENetworkEventType : uint8
     Stabilized          // 네트워크 안정화
 };
 
+/**
+ * 시퀀스 공간
+ * 신뢰성 메시지는 피어마다 따로 번호를 매겨 ACK 대기 상태가 대상 간에 충돌하지 않게 하고,
+ * 나머지 메시지는 브로드캐스트가 모든 대상에 같은 버퍼를 보내므로 발신자 전체에서 하나의 번호를 씀
+ * 수신 측은 ACK 필요 플래그로 구분하여 공간마다 따로 추적
+ */
+enum class ESequenceChannel : uint8
+{
+    Unreliable = 0, // 일반 메시지 (발신자 전체 공간, 다른 피어에게 간 번호가 빈 번호로 보이므로 중복 확인에만 사용)
+    Reliable = 1    // ACK가 필요한 메시지 (피어별 공간)
+};
+
+/** 시퀀스 공간 수 */
+static constexpr int32 NUM_SEQUENCE_CHANNELS = 2;
+
+/**
+ * 시퀀스 번호 유틸리티
+ * 시퀀스는 32비트로 세고 헤더에는 하위 16비트만 실으며, 받을 때 기준값으로 32비트를 복원
+ * 비교는 모두 순환 산술(차이를 부호 있는 정수로 해석)이므로 32비트가 넘어가도 동작함
+ */
+struct FSequenceNumber
+{
+    /** 헤더에 싣는 하위 16비트 */
+    static uint16 Truncate(uint32 Sequence) { return static_cast<uint16>(Sequence); }
+
+    /** 기준값에 가장 가까운 32비트 시퀀스로 복원 (기준값과 32768 이상 떨어진 번호는 구분할 수 없음) */
+    static uint32 Extend(uint16 WireSequence, uint32 Reference)
+    {
+        const int16 Delta = static_cast<int16>(static_cast<uint16>(WireSequence - Truncate(Reference)));
+        return Reference + static_cast<uint32>(static_cast<int32>(Delta));
+    }
+
+    /** Latest 이하에서 가장 가까운 32비트 시퀀스로 복원 (보낸 번호에 대한 ACK용) */
+    static uint32 ExtendBefore(uint16 WireSequence, uint32 Latest)
+    {
+        return Latest - static_cast<uint16>(Truncate(Latest) - WireSequence);
+    }
+
+    /** A - B (순환 산술) */
+    static int32 Diff(uint32 A, uint32 B) { return static_cast<int32>(A - B); }
+
+    /** A가 B보다 뒤인지 여부 */
+    static bool IsAfter(uint32 A, uint32 B) { return Diff(A, B) > 0; }
+};
+
+/**
+ * 시퀀스 추적기에 번호를 추가한 결과
+ * 중복은 순서 보장 여부와 관계없이 버리고, 앞질러 받은 번호는 순서 보장일 때만 보류
+ */
+enum class ESequenceAddResult : uint8
+{
+    InOrder,    // 기다리던 번호 (처리)
+    OutOfOrder, // 앞의 번호보다 먼저 받은 번호 (순서 보장이면 보류, 아니면 처리)
+    Duplicate   // 이미 처리했거나 보관 중인 번호 (버림)
+};
+
 /**
  * 메시지 확인 상태 열거형
  * 메시지의 전송/수신 상태를 표현합니다.
@@ -90,12 +146,17 @@ enum class EMessageAckStatus : uint8
  */
 struct MULTISERVERSYNC_API FMessageAckData
 {
-    uint16 SequenceNumber;          // 메시지 시퀀스 번호
+    uint32 SequenceNumber;          // 메시지 시퀀스 번호 (대상 피어의 신뢰성 공간, 헤더에는 하위 16비트)
     EMessageAckStatus Status;       // 메시지 상태
     double SentTime;                // 전송 시간
     double LastAttemptTime;         // 마지막 시도 시간
+    double RetryDeadline;           // 재전송 기한 (마지막 시도 시점의 재전송 타임아웃으로 계산)
     int32 AttemptCount;             // 시도 횟수
     FIPv4Endpoint TargetEndpoint;   // 대상 엔드포인트
+    uint8 MessageType;              // 재전송할 메시지 유형 (ENetworkMessageType)
+    uint8 MessageFlags;             // 재전송할 메시지 플래그
+    TArray<uint8> Payload;          // 재전송할 메시지 페이로드
+    int32 MessageSize;              // 직렬화 크기 (혼잡 윈도우 계산용)
 
     // 기본 생성자
     FMessageAckData()
@@ -103,18 +164,26 @@ struct MULTISERVERSYNC_API FMessageAckData
         , Status(EMessageAckStatus::None)
         , SentTime(0.0)
         , LastAttemptTime(0.0)
+        , RetryDeadline(0.0)
         , AttemptCount(0)
+        , MessageType(0)
+        , MessageFlags(0)
+        , MessageSize(0)
     {
     }
 
     // 시퀀스 번호 및 대상으로 초기화하는 생성자
-    FMessageAckData(uint16 InSequenceNumber, const FIPv4Endpoint& InTargetEndpoint)
+    FMessageAckData(uint32 InSequenceNumber, const FIPv4Endpoint& InTargetEndpoint)
         : SequenceNumber(InSequenceNumber)
         , Status(EMessageAckStatus::None)
         , SentTime(0.0)
         , LastAttemptTime(0.0)
+        , RetryDeadline(0.0)
         , AttemptCount(0)
         , TargetEndpoint(InTargetEndpoint)
+        , MessageType(0)
+        , MessageFlags(0)
+        , MessageSize(0)
     {
     }
 
@@ -136,179 +205,146 @@ struct MULTISERVERSYNC_API FMessageAckData
 
 /**
  * 메시지 시퀀스 관리 구조체
- * 각 엔드포인트별 메시지 시퀀스 관리를 위한 구조체
+ * 각 엔드포인트의 시퀀스 공간별 메시지 시퀀스 관리를 위한 구조체
+ * 헤더의 16비트 번호를 받은 것 중 가장 앞선 번호 기준으로 32비트로 복원하여 추적
+ * 마지막으로 처리한 번호 뒤의 번호는 원형 비트맵으로 추적 (중복/윈도우 확인 O(1), 누락 범위 조회는 비트맵 워드 수 + 누락 범위 수에 비례)
  */
 struct MULTISERVERSYNC_API FMessageSequenceTracker
 {
-    uint16 LastProcessedSequence;    // 마지막으로 처리된 시퀀스 번호
-    uint16 NextExpectedSequence;     // 다음에 기대되는 시퀀스 번호
-    TArray<uint16> ReceivedSequences; // 수신된 시퀀스 번호 목록
-    TSet<uint16> MissingSequences;    // 누락된 시퀀스 번호 목록
-    uint16 SequenceWindowSize;        // 시퀀스 윈도우 크기
+    /** 원형 비트맵 크기 (마지막 처리 번호보다 이만큼 앞선 번호까지 추적할 수 있음) */
+    static constexpr int32 WINDOW_CAPACITY = 1024;
+
+    uint32 LastProcessedSequence;    // 마지막으로 처리된 시퀀스 번호 (이 번호까지는 받았거나 포기함)
+    uint32 NextExpectedSequence;     // 다음에 기대되는 시퀀스 번호
+    uint32 HighestReceivedSequence;  // 받은 것 중 가장 앞선 시퀀스 번호 (16비트 번호 복원 기준)
+    uint16 SequenceWindowSize;        // 시퀀스 윈도우 크기 (WINDOW_CAPACITY 이하)
     bool bOrderGuaranteed;           // 순서 보장 여부
+    bool bSynchronized;              // 첫 메시지를 받아 시작 번호를 맞췄는지 여부
     int32 MaxOutOfOrderMessages;      // 최대 순서 어긋난 메시지 수
 
     // 기본 생성자
     FMessageSequenceTracker()
         : LastProcessedSequence(0)
         , NextExpectedSequence(1)
-        , SequenceWindowSize(100)
+        , HighestReceivedSequence(0)
+        , SequenceWindowSize(WINDOW_CAPACITY)
         , bOrderGuaranteed(false)
+        , bSynchronized(false)
         , MaxOutOfOrderMessages(10)
+        , HighestBufferedSequence(0)
+        , BufferedCount(0)
     {
+        FMemory::Memzero(ReceivedBits);
     }
 
-    // 시퀀스 번호가 윈도우 내에 있는지 확인
-    bool IsSequenceInWindow(uint16 Sequence) const
+    // 헤더의 16비트 번호를 32비트로 복원하고 가장 앞선 번호 갱신
+    uint32 ExtendSequence(uint16 WireSequence)
     {
-        // 빈 윈도우인 경우
-        if (ReceivedSequences.Num() == 0)
-            return true;
-
-        // 윈도우 범위 계산
-        uint16 WindowStart = LastProcessedSequence;
-        uint16 WindowEnd = (uint16)(WindowStart + SequenceWindowSize);
-
-        // 윈도우가 랩어라운드되는 경우 처리
-        if (WindowEnd < WindowStart)
+        const uint32 Sequence = FSequenceNumber::Extend(WireSequence, HighestReceivedSequence);
+        if (FSequenceNumber::IsAfter(Sequence, HighestReceivedSequence))
         {
-            return (Sequence >= WindowStart) || (Sequence <= WindowEnd);
-        }
-        else
-        {
-            return (Sequence >= WindowStart) && (Sequence <= WindowEnd);
+            HighestReceivedSequence = Sequence;
         }
+        return Sequence;
     }
 
-    // 시퀀스 번호가 이미 처리되었는지 확인
-    bool IsSequenceAlreadyProcessed(uint16 Sequence) const
+    // 실제로 쓰는 윈도우 크기
+    int32 GetWindowSize() const
     {
-        // 처음 받는 메시지인 경우
-        if (ReceivedSequences.Num() == 0)
-            return false;
+        return FMath::Clamp<int32>(SequenceWindowSize, 1, WINDOW_CAPACITY);
+    }
 
-        // 마지막 처리 시퀀스보다 작은 경우
-        // 랩어라운드 상황을 고려 (uint16 범위: 0-65535)
-        if (LastProcessedSequence > 0xF000 && Sequence < 0x1000)
-        {
-            // 랩어라운드 케이스 (65530 -> 5)
-            return false;
-        }
-        else if (LastProcessedSequence < 0x1000 && Sequence > 0xF000)
-        {
-            // 랩어라운드 케이스 (5 <- 65530)
+    // 시퀀스 번호가 윈도우 내에 있는지 확인
+    bool IsSequenceInWindow(uint32 Sequence) const
+    {
+        // 빈 윈도우인 경우 (앞선 번호를 받으면 윈도우를 그 번호까지 밀어 줌)
+        if (BufferedCount == 0)
             return true;
-        }
-        else
-        {
-            return Sequence <= LastProcessedSequence;
-        }
+
+        // 윈도우 범위 계산 (순환 산술이므로 랩어라운드를 따로 처리하지 않음)
+        const int32 Offset = FSequenceNumber::Diff(Sequence, LastProcessedSequence);
+        return Offset >= 0 && Offset <= GetWindowSize();
     }
 
-    // 새 메시지 추가 및 누락 메시지 감지
-    bool AddSequence(uint16 Sequence)
+    // 시퀀스 번호가 이미 처리되었는지 확인
+    bool IsSequenceAlreadyProcessed(uint32 Sequence) const
     {
-        // 이미 처리된 메시지는 무시
-        if (IsSequenceAlreadyProcessed(Sequence))
-            return false;
+        return !FSequenceNumber::IsAfter(Sequence, LastProcessedSequence);
+    }
 
-        // 윈도우 범위 밖이면 거부
-        if (!IsSequenceInWindow(Sequence))
-            return false;
+    // 순서를 앞질러 받아 윈도우에 보관 중인지 확인
+    bool IsSequenceBuffered(uint32 Sequence) const
+    {
+        const int32 Offset = FSequenceNumber::Diff(Sequence, LastProcessedSequence);
+        return Offset > 0 && Offset <= WINDOW_CAPACITY && TestBit(Sequence);
+    }
 
-        // 이미 수신된 시퀀스면 중복으로 처리
-        if (ReceivedSequences.Contains(Sequence))
-            return false;
+    // 새 메시지 추가 및 누락 메시지 감지
+    ESequenceAddResult AddSequence(uint32 Sequence);
 
-        // 시퀀스 추가
-        ReceivedSequences.Add(Sequence);
+    // 연속된 메시지 처리
+    void ProcessNextSequentialMessages();
 
-        // 순서가 맞지 않는 메시지 처리
-        if (Sequence != NextExpectedSequence)
+    /**
+     * 누락된 범위를 오래된 것부터 순회합니다 (마지막 처리 번호 다음부터 보관 중인 가장 앞선 번호 전까지).
+     * @param Func (uint32 FirstSequence, uint32 Count) 형식의 함수
+     */
+    template <typename FunctorType>
+    void ForEachMissingRange(FunctorType&& Func) const
+    {
+        if (BufferedCount == 0)
         {
-            // 누락된 시퀀스 감지
-            if (Sequence > NextExpectedSequence)
-            {
-                for (uint16 Missing = NextExpectedSequence; Missing < Sequence; Missing++)
-                {
-                    if (!ReceivedSequences.Contains(Missing))
-                    {
-                        MissingSequences.Add(Missing);
-                    }
-                }
-            }
-
-            // 순서 보장이 필요하면 false 반환
-            if (bOrderGuaranteed)
-            {
-                // 순서 어긋난 메시지가 너무 많으면 이전 메시지를 포기
-                if (ReceivedSequences.Num() > MaxOutOfOrderMessages)
-                {
-                    ProcessNextSequentialMessages();
-                }
-                return false;
-            }
+            return;
         }
 
-        // 연속된 메시지 처리
-        ProcessNextSequentialMessages();
-
-        return true;
+        // 마지막 처리 번호 다음 번호는 받았으면 처리되었을 것이므로 항상 누락
+        uint32 Sequence = LastProcessedSequence + 1;
+        while (Sequence != HighestBufferedSequence)
+        {
+            const uint32 RangeEnd = FindNextBit(Sequence, HighestBufferedSequence, true);
+            Func(Sequence, RangeEnd - Sequence);
+            Sequence = FindNextBit(RangeEnd, HighestBufferedSequence, false);
+        }
     }
 
-    // 연속된 메시지 처리
-    void ProcessNextSequentialMessages()
-    {
-        // 수신된 메시지를 오름차순으로 정렬
-        ReceivedSequences.Sort();
-
-        uint16 LastSequential = LastProcessedSequence;
-
-        // 연속된 메시지 찾기
-        for (int32 i = 0; i < ReceivedSequences.Num(); i++)
-        {
-            uint16 CurrentSeq = ReceivedSequences[i];
+    // 누락된 메시지 조회 (오래된 것부터 최대 MaxCount개)
+    TArray<uint32> GetMissingSequences(int32 MaxCount = MAX_int32) const;
 
-            // 연속되지 않은 메시지 발견
-            if (CurrentSeq != (uint16)(LastSequential + 1))
-                break;
+    // 누락된 메시지 수
+    int32 GetMissingCount() const;
 
-            // 연속된 메시지 업데이트
-            LastSequential = CurrentSeq;
+    // 순서를 앞질러 받아 보관 중인 메시지 수
+    int32 GetBufferedCount() const { return BufferedCount; }
 
-            // 누락 목록에서 제거
-            MissingSequences.Remove(CurrentSeq);
-        }
+    // 누락된 메시지 요청 필요 여부 (보관 중인 메시지가 있으면 그 앞에 누락이 있음)
+    bool NeedsRetransmissionRequest() const
+    {
+        return BufferedCount > 0;
+    }
 
-        // 마지막 처리 시퀀스 업데이트
-        if (LastSequential != LastProcessedSequence)
-        {
-            LastProcessedSequence = LastSequential;
-            NextExpectedSequence = (uint16)(LastProcessedSequence + 1);
+private:
+    static constexpr int32 WINDOW_WORDS = WINDOW_CAPACITY / 64;
 
-            // 처리된 메시지 제거
-            ReceivedSequences.RemoveAll([this](uint16 Seq) {
-                return Seq <= LastProcessedSequence;
-                });
-        }
-    }
+    static int32 GetBitIndex(uint32 Sequence) { return static_cast<int32>(Sequence & (WINDOW_CAPACITY - 1)); }
 
-    // 누락된 메시지 조회
-    TArray<uint16> GetMissingSequences() const
+    bool TestBit(uint32 Sequence) const
     {
-        TArray<uint16> Result;
-        for (const auto& Seq : MissingSequences)
-        {
-            Result.Add(Seq);
-        }
-        return Result;
+        const int32 Index = GetBitIndex(Sequence);
+        return ((ReceivedBits[Index >> 6] >> (Index & 63)) & 1) != 0;
     }
 
-    // 누락된 메시지 요청 필요 여부
-    bool NeedsRetransmissionRequest() const
-    {
-        return MissingSequences.Num() > 0;
-    }
+    /** From부터 End 전까지에서 비트가 bSet인 첫 번호 (없으면 End) */
+    uint32 FindNextBit(uint32 From, uint32 End, bool bSet) const;
+
+    /** 누락된 번호를 포기하고 보관 중인 가장 오래된 번호부터 처리 */
+    void SkipMissingSequences();
+
+    /** 마지막 처리 번호를 NewLastProcessed로 옮기고 그 이하의 보관 비트를 지움 (그 사이 누락된 번호는 포기) */
+    void SlideWindow(uint32 NewLastProcessed);
+
+    uint64 ReceivedBits[WINDOW_WORDS];  // 마지막 처리 번호 뒤에 받은 번호 (번호 % WINDOW_CAPACITY 위치의 비트)
+    uint32 HighestBufferedSequence;     // 보관 중인 가장 앞선 번호 (BufferedCount가 0이면 의미 없음)
+    int32 BufferedCount;                // 비트맵에 켜진 비트 수
 };
 
 /**
@@ -580,6 +616,10 @@ struct MULTISERVERSYNC_API FNetworkLatencyStats
     double OutlierThreshold;      // 이상치 임계값 (ms)
     bool bFilterOutliers;         // 이상치 필터링 활성화 여부
 
+    // 재전송 타임아웃 추정 필드 (RFC 6298, 이상치 필터를 거치지 않은 샘플로 갱신)
+    double SmoothedRTT;           // 평활 RTT (SRTT, ms)
+    double RTTVariation;          // RTT 변동 (RTTVAR, ms)
+
     // 시계열 및 추세 분석 관련 필드
     TArray<FLatencyTimeSeriesSample> TimeSeries;   // 시계열 샘플 데이터
     int32 MaxTimeSeriesSamples;                    // 최대 시계열 샘플 수
@@ -623,6 +663,8 @@ struct MULTISERVERSYNC_API FNetworkLatencyStats
         , OutliersDetected(0)
         , OutlierThreshold(0.0)
         , bFilterOutliers(true)
+        , SmoothedRTT(0.0)
+        , RTTVariation(0.0)
         , TimeSeries()
         , MaxTimeSeriesSamples(300)            // 기본값: 5분(300초)치 데이터 저장
         , TimeSeriesSampleInterval(1.0)        // 기본값: 1초마다 샘플링
@@ -658,6 +700,12 @@ struct MULTISERVERSYNC_API FNetworkLatencyStats
     // 추세 분석 수행
     void AnalyzeTrend();
 
+    // 재전송 타임아웃 (RFC 6298: SRTT + max(G, 4 * RTTVAR), ms, 샘플이 없으면 음수)
+    double GetRetransmissionTimeout(double ClockGranularityMs) const
+    {
+        return SampleCount > 0 ? SmoothedRTT + FMath::Max(ClockGranularityMs, 4.0 * RTTVariation) : -1.0;
+    }
+
     // 네트워크 품질 평가 수행 (새로 추가)
     FNetworkQualityAssessment AssessNetworkQuality();
 
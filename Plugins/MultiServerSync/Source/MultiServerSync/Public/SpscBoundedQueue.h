@@ -0,0 +1,90 @@
+﻿// Copyright Your Company. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include <atomic>
+
+/**
+ * 고정 크기 락프리 단일 생산자/단일 소비자(SPSC) 링 큐
+ * 생산자 스레드 하나만 Enqueue, 소비자 스레드 하나만 Dequeue를 호출해야 함
+ * 생성 시 슬롯을 한 번만 할당하며 이후 큐 연산에서는 할당이 없음
+ */
+template<typename ElementType>
+class TSpscBoundedQueue
+{
+public:
+    /**
+     * 생성자
+     * @param InCapacity 최소 용량 (2의 거듭제곱으로 올림)
+     */
+    explicit TSpscBoundedQueue(uint32 InCapacity)
+        : Capacity(FMath::RoundUpToPowerOfTwo(FMath::Max<uint32>(InCapacity, 2)))
+        , Mask(Capacity - 1)
+        , HeadIndex(0)
+        , TailIndex(0)
+    {
+        Slots.SetNum(Capacity);
+    }
+
+    TSpscBoundedQueue(const TSpscBoundedQueue&) = delete;
+    TSpscBoundedQueue& operator=(const TSpscBoundedQueue&) = delete;
+
+    /** 항목 추가 (생산자 전용), 큐가 가득 차면 false */
+    bool Enqueue(ElementType&& Item)
+    {
+        const uint32 Tail = TailIndex.load(std::memory_order_relaxed);
+        const uint32 Head = HeadIndex.load(std::memory_order_acquire);
+        if (Tail - Head >= Capacity)
+        {
+            return false;
+        }
+
+        Slots[Tail & Mask] = MoveTemp(Item);
+        TailIndex.store(Tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    /** 항목 꺼내기 (소비자 전용), 큐가 비어 있으면 false */
+    bool Dequeue(ElementType& OutItem)
+    {
+        const uint32 Head = HeadIndex.load(std::memory_order_relaxed);
+        const uint32 Tail = TailIndex.load(std::memory_order_acquire);
+        if (Head == Tail)
+        {
+            return false;
+        }
+
+        OutItem = MoveTemp(Slots[Head & Mask]);
+        HeadIndex.store(Head + 1, std::memory_order_release);
+        return true;
+    }
+
+    /** 현재 항목 수 (다른 스레드가 동시에 변경 중이면 근사값) */
+    uint32 Num() const
+    {
+        return TailIndex.load(std::memory_order_acquire) - HeadIndex.load(std::memory_order_acquire);
+    }
+
+    /** 비어 있는지 여부 (근사값) */
+    bool IsEmpty() const { return Num() == 0; }
+
+    /** 용량 */
+    uint32 GetCapacity() const { return Capacity; }
+
+private:
+    /** 슬롯 배열 */
+    TArray<ElementType> Slots;
+
+    /** 용량 (2의 거듭제곱) */
+    const uint32 Capacity;
+
+    /** 인덱스 마스크 */
+    const uint32 Mask;
+
+    /** 소비자 인덱스 (거짓 공유 방지를 위해 캐시 라인 분리) */
+    alignas(PLATFORM_CACHE_LINE_SIZE) std::atomic<uint32> HeadIndex;
+
+    /** 생산자 인덱스 */
+    alignas(PLATFORM_CACHE_LINE_SIZE) std::atomic<uint32> TailIndex;
+};
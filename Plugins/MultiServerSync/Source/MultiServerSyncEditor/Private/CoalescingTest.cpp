@@ -0,0 +1,196 @@
+﻿// CoalescingTest.cpp
+#include "Misc/AutomationTest.h"
+#include "FNetworkManager.h"
+#include "Serialization/MemoryWriter.h"
+
+namespace NetworkManagerTestUtils
+{
+    /** 대기 중인 데이터그램을 모두 받아 메시지 뷰로 풀어냄 (묶음 데이터그램은 담긴 메시지마다 하나씩) */
+    static int32 ReceiveAndUnpack(INetworkTransport& Transport, TArray<ENetworkMessageType>& OutTypes, TArray<uint16>& OutSequences)
+    {
+        int32 DatagramCount = 0;
+        FReceivedDatagram Batch[INetworkTransport::MAX_RECEIVE_BATCH];
+        while (Transport.WaitForRead(FTimespan::FromMilliseconds(200)))
+        {
+            const int32 Received = Transport.ReceiveBatch(Batch, INetworkTransport::MAX_RECEIVE_BATCH);
+            if (Received == 0)
+            {
+                break;
+            }
+
+            for (int32 Index = 0; Index < Received; ++Index)
+            {
+                ++DatagramCount;
+
+                FNetworkMessageView View;
+                if (View.Parse(TArrayView<const uint8>(Batch[Index].Data, Batch[Index].Size)))
+                {
+                    if (View.GetType() != ENetworkMessageType::Batch)
+                    {
+                        OutTypes.Add(View.GetType());
+                        OutSequences.Add(View.GetSequenceNumber());
+                    }
+                    else
+                    {
+                        TArrayView<const uint8> Remaining = View.GetData();
+                        while (Remaining.Num() > 0)
+                        {
+                            const int32 InnerSize = FNetworkMessageView::PeekMessageSize(Remaining);
+                            FNetworkMessageView Inner;
+                            if (InnerSize <= 0 || InnerSize > Remaining.Num() || !Inner.Parse(Remaining.Left(InnerSize)))
+                            {
+                                break;
+                            }
+
+                            OutTypes.Add(Inner.GetType());
+                            OutSequences.Add(Inner.GetSequenceNumber());
+                            Remaining = Remaining.RightChop(InnerSize);
+                        }
+                    }
+                }
+                Batch[Index].Buffer.SafeRelease();
+            }
+        }
+
+        return DatagramCount;
+    }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNetworkCoalescingTest, "MultiServerSync.NetworkManager.Coalescing", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+bool FNetworkCoalescingTest::RunTest(const FString& Parameters)
+{
+    using namespace NetworkManagerTestUtils;
+
+    const FIPv4Address Loopback(127, 0, 0, 1);
+
+    TestTrue(TEXT("PTP messages should bypass coalescing"), FNetworkManager::IsTimeCriticalMessageType(ENetworkMessageType::TimeSync));
+    TestTrue(TEXT("Pings should bypass coalescing"), FNetworkManager::IsTimeCriticalMessageType(ENetworkMessageType::PingRequest));
+    TestFalse(TEXT("Frame sync should be coalesced"), FNetworkManager::IsTimeCriticalMessageType(ENetworkMessageType::FrameSync));
+
+    TUniquePtr<INetworkTransport> Sender = INetworkTransport::Create(EReceiveBackend::SingleRead, Loopback, 0, TEXT("MultiServerSyncTest_CoalescingSender"));
+    TUniquePtr<INetworkTransport> Receiver = INetworkTransport::Create(EReceiveBackend::BatchRecvMmsg, Loopback, 0, TEXT("MultiServerSyncTest_CoalescingReceiver"));
+    if (!TestNotNull(TEXT("Sender socket should be created"), Sender.Get()) || !TestNotNull(TEXT("Receiver socket should be created"), Receiver.Get()))
+    {
+        return false;
+    }
+
+    const FIPv4Endpoint Target(Loopback, Receiver->GetLocalPort());
+    const int32 MaxDatagramSize = FNetworkManager::DEFAULT_PATH_MTU - FNetworkManager::IPV4_UDP_HEADER_SIZE;
+
+    FMessageCoalescer Coalescer;
+    Coalescer.SetMaxDatagramSize(MaxDatagramSize);
+    Coalescer.SetFlushDeadline(0.01);
+
+    // 작은 메시지 여러 개는 기한까지 모였다가 데이터그램 하나로 전송
+    TArray<uint8> SmallPayload;
+    SmallPayload.SetNumZeroed(16);
+    const int32 SmallCount = 20;
+    for (int32 Index = 0; Index < SmallCount; ++Index)
+    {
+        FNetworkMessage Message(ENetworkMessageType::FrameSync, SmallPayload);
+        Message.SetSequenceNumber(static_cast<uint16>(Index));
+        const TArray<uint8> Data = Message.Serialize();
+        TestTrue(TEXT("Small message should be queued"), Coalescer.Enqueue(Sender.Get(), Target, Data.GetData(), Data.Num(), 0.0));
+    }
+
+    Coalescer.FlushDue(0.005);
+    TestEqual(TEXT("Nothing should be sent before the deadline"), Sender->GetStats().SentDatagrams, uint64(0));
+
+    Coalescer.FlushDue(0.01);
+    TestEqual(TEXT("Queued messages should leave as one datagram"), Sender->GetStats().SentDatagrams, uint64(1));
+
+    TArray<ENetworkMessageType> Types;
+    TArray<uint16> Sequences;
+    TestEqual(TEXT("Receiver should get one datagram"), ReceiveAndUnpack(*Receiver, Types, Sequences), 1);
+    if (TestEqual(TEXT("Every coalesced message should be unpacked"), Sequences.Num(), SmallCount))
+    {
+        for (int32 Index = 0; Index < SmallCount; ++Index)
+        {
+            TestEqual(TEXT("Unpacked messages should keep their order"), Sequences[Index], static_cast<uint16>(Index));
+        }
+    }
+
+    // 최대 크기를 넘으면 모아둔 묶음을 먼저 보내고 새 묶음을 시작
+    Sender->ResetStats();
+    TArray<uint8> MediumPayload;
+    MediumPayload.SetNumZeroed(600);
+    const TArray<uint8> MediumData = FNetworkMessage(ENetworkMessageType::Custom, MediumPayload).Serialize();
+    for (int32 Index = 0; Index < 5; ++Index)
+    {
+        Coalescer.Enqueue(Sender.Get(), Target, MediumData.GetData(), MediumData.Num(), 1.0);
+    }
+    Coalescer.FlushAll();
+    TestEqual(TEXT("Five 627-byte messages should need three datagrams"), Sender->GetStats().SentDatagrams, uint64(3));
+
+    Types.Reset();
+    Sequences.Reset();
+    TestEqual(TEXT("Receiver should get three datagrams"), ReceiveAndUnpack(*Receiver, Types, Sequences), 3);
+    TestEqual(TEXT("Every split batch message should be unpacked"), Types.Num(), 5);
+
+    // 바로 보내는 메시지는 먼저 모아둔 메시지를 앞질러 도착하지 않음
+    Sender->ResetStats();
+    FNetworkMessage Queued(ENetworkMessageType::FrameSync, SmallPayload);
+    Queued.SetSequenceNumber(100);
+    const TArray<uint8> QueuedData = Queued.Serialize();
+    Coalescer.Enqueue(Sender.Get(), Target, QueuedData.GetData(), QueuedData.Num(), 2.0);
+
+    FPingMessage Ping;
+    Ping.Type = EPingMessageType::Request;
+    Ping.Timestamp = 0;
+    Ping.SequenceNumber = 0;
+    TArray<uint8> PingPayload;
+    FMemoryWriter Writer(PingPayload);
+    Ping.Serialize(Writer);
+    FNetworkMessage PingMessage(ENetworkMessageType::PingRequest, PingPayload);
+    PingMessage.SetSequenceNumber(101);
+    const TArray<uint8> PingData = PingMessage.Serialize();
+    TestEqual(TEXT("Time-critical message should be sent immediately"), Coalescer.SendImmediately(Sender.Get(), PingData.GetData(), PingData.Num(), &Target, 1), 1);
+    TestEqual(TEXT("Pending message and bypass message should both be sent"), Sender->GetStats().SentDatagrams, uint64(2));
+
+    Types.Reset();
+    Sequences.Reset();
+    ReceiveAndUnpack(*Receiver, Types, Sequences);
+    TestTrue(TEXT("Single queued message should be sent without a batch header, before the bypass message"),
+        Types == TArray<ENetworkMessageType>({ ENetworkMessageType::FrameSync, ENetworkMessageType::PingRequest }));
+
+    const FCoalescingStats& Stats = Coalescer.GetStats();
+    TestEqual(TEXT("Coalesced message count"), Stats.CoalescedMessages, uint64(SmallCount + 5 + 1));
+    TestEqual(TEXT("Bypassed message count"), Stats.BypassedMessages, uint64(1));
+
+    Sender->Close();
+    Receiver->Close();
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNetworkCoalescingNegotiationTest, "MultiServerSync.NetworkManager.CoalescingNegotiation", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+bool FNetworkCoalescingNegotiationTest::RunTest(const FString& Parameters)
+{
+    // 초기화하지 않은 매니저로 묶음 전송 가능 여부만 검사 (소켓 없음)
+    FNetworkManager Manager;
+
+    const FIPv4Address ServerAddress(10, 20, 30, 50);
+    const FIPv4Endpoint DataEndpoint(ServerAddress, FNetworkManager::DEFAULT_PORT);
+    TestFalse(TEXT("Undiscovered server should not receive batches"), Manager.IsBatchCapablePeer(DataEndpoint));
+
+    FServerEndpoint Server;
+    Server.Id = TEXT("render-node-05");
+    Server.IPAddress = ServerAddress;
+    Server.Port = FNetworkManager::DEFAULT_PORT;
+    Server.ProtocolVersion = FNetworkMessage::BATCH_MESSAGE_VERSION;
+    Manager.AddOrUpdateServer(Server);
+    TestTrue(TEXT("Server that negotiated the batch version should receive batches"), Manager.IsBatchCapablePeer(DataEndpoint));
+
+    // 압축 헤더 설정과 무관하게 합의한 버전으로만 판단
+    Manager.SetCompactHeadersEnabled(false);
+    TestTrue(TEXT("Disabling compact headers should not disable batches"), Manager.IsBatchCapablePeer(DataEndpoint));
+
+    // 같은 주소에 v1 서버가 있으면 그 주소로는 묶지 않음
+    FServerEndpoint LegacyServer = Server;
+    LegacyServer.Id = TEXT("render-node-05-legacy");
+    LegacyServer.Port = FNetworkManager::DEFAULT_PORT + 10;
+    LegacyServer.ProtocolVersion = 1;
+    Manager.AddOrUpdateServer(LegacyServer);
+    TestFalse(TEXT("A v1 server on the same address should not receive batches"), Manager.IsBatchCapablePeer(DataEndpoint));
+
+    return true;
+}
@@ -0,0 +1,266 @@
+﻿// CongestionControlTest.cpp
+#include "Misc/AutomationTest.h"
+#include "FNetworkManager.h"
+
+namespace NetworkManagerTestUtils
+{
+    /** 병목 링크 모의: 받은 데이터그램을 고정 속도로 비우는 FIFO에 넣고, 버퍼를 넘으면 버림 (가상 시간) */
+    struct FSimulatedBottleneck
+    {
+        double RateBytesPerSecond;
+        int32 BufferBytes;
+        double BusyUntil;
+        int32 QueuedBytes;
+        TArray<TPair<double, int32>> Departures;
+        int32 DroppedDatagrams;
+
+        FSimulatedBottleneck(double InRateBytesPerSecond, int32 InBufferBytes)
+            : RateBytesPerSecond(InRateBytesPerSecond)
+            , BufferBytes(InBufferBytes)
+            , BusyUntil(0.0)
+            , QueuedBytes(0)
+            , DroppedDatagrams(0)
+        {
+        }
+
+        /** 데이터그램을 링크 대기열에 넣고 대기열 지연(초)을 반환 (버렸으면 음수) */
+        double Enqueue(int32 Size, double Now)
+        {
+            while (Departures.Num() > 0 && Departures[0].Key <= Now)
+            {
+                QueuedBytes -= Departures[0].Value;
+                Departures.RemoveAt(0, 1, EAllowShrinking::No);
+            }
+
+            if (QueuedBytes + Size > BufferBytes)
+            {
+                ++DroppedDatagrams;
+                return -1.0;
+            }
+
+            BusyUntil = FMath::Max(BusyUntil, Now) + Size / RateBytesPerSecond;
+            QueuedBytes += Size;
+            Departures.Emplace(BusyUntil, Size);
+            return BusyUntil - Now;
+        }
+    };
+
+    /** 병목 링크 시뮬레이션 결과 */
+    struct FBottleneckResult
+    {
+        double MeanProbeDelayMs = 0.0;
+        double MaxProbeDelayMs = 0.0;
+        int32 LostProbes = 0;
+        double FinalRate = 0.0;
+        uint32 DelayBackoffs = 0;
+    };
+
+    /**
+     * 대량 전송을 쉬지 않고 보내면서 5ms마다 시간 동기화 프로브를 같은 병목 링크로 보냄
+     * 송신은 루프백 소켓을 거쳐 중계 소켓에 도착하고, 중계 측에서 링크 대기열을 모의함 (1ms 단위 가상 시간)
+     * 결과는 수렴 구간을 뺀 뒤쪽 절반의 프로브 지연
+     */
+    static FBottleneckResult RunBottleneckSimulation(bool bCongestionControl, double LinkRateBytesPerSecond, const FCongestionControlConfig& Config)
+    {
+        FBottleneckResult Result;
+
+        const FIPv4Address Loopback(127, 0, 0, 1);
+        TUniquePtr<INetworkTransport> Sender = INetworkTransport::Create(EReceiveBackend::SingleRead, Loopback, 0, TEXT("MultiServerSyncTest_CongestionSender"));
+        TUniquePtr<INetworkTransport> Relay = INetworkTransport::Create(EReceiveBackend::BatchRecvMmsg, Loopback, 0, TEXT("MultiServerSyncTest_CongestionRelay"));
+        if (!Sender || !Relay)
+        {
+            Result.LostProbes = -1;
+            return Result;
+        }
+
+        const FIPv4Endpoint Target(Loopback, Relay->GetLocalPort());
+        FSimulatedBottleneck Link(LinkRateBytesPerSecond, 256 * 1024);
+        FTrafficScheduler Scheduler;
+        FCongestionController Controller;
+
+        const int32 BulkSize = 1200;
+        uint8 BulkData[BulkSize];
+        FMemory::Memset(BulkData, 'B', BulkSize);
+        uint8 ProbeData[64];
+        FMemory::Memset(ProbeData, 'C', sizeof(ProbeData));
+
+        const double BaseRttMs = 0.1;
+        const int32 StepCount = 2000;
+        double DelaySumMs = 0.0;
+        int32 DelayCount = 0;
+        FReceivedDatagram Batch[INetworkTransport::MAX_RECEIVE_BATCH];
+
+        for (int32 Step = 0; Step < StepCount; ++Step)
+        {
+            const double Now = Step / 1000.0;
+
+            // 대량 전송은 대기열이 비지 않도록 계속 채움
+            while (Scheduler.GetStats(ETrafficClass::Bulk).QueueDepth < 32)
+            {
+                Scheduler.Send(ETrafficClass::Bulk, Sender.Get(), BulkData, BulkSize, Target, Now);
+            }
+            Scheduler.Pump(Now);
+
+            const bool bProbe = Step % 5 == 0;
+            if (bProbe)
+            {
+                Scheduler.Send(ETrafficClass::Clock, Sender.Get(), ProbeData, sizeof(ProbeData), Target, Now);
+            }
+
+            // 중계 측: 도착한 순서대로 링크 대기열에 넣음
+            double ProbeDelay = -1.0;
+            int32 Received = 0;
+            do
+            {
+                Received = Relay->ReceiveBatch(Batch, INetworkTransport::MAX_RECEIVE_BATCH);
+                for (int32 Index = 0; Index < Received; ++Index)
+                {
+                    const double Delay = Link.Enqueue(Batch[Index].Size, Now);
+                    if (Batch[Index].Size > 0 && Batch[Index].Data[0] == 'C')
+                    {
+                        ProbeDelay = Delay;
+                    }
+                    Batch[Index].Buffer.SafeRelease();
+                }
+            } while (Received > 0);
+
+            if (!bProbe)
+            {
+                continue;
+            }
+
+            const bool bLate = Step >= StepCount / 2;
+            if (ProbeDelay < 0.0)
+            {
+                Result.LostProbes += bLate ? 1 : 0;
+                continue;
+            }
+
+            const double ProbeDelayMs = ProbeDelay * 1000.0;
+            if (bLate)
+            {
+                DelaySumMs += ProbeDelayMs;
+                ++DelayCount;
+                Result.MaxProbeDelayMs = FMath::Max(Result.MaxProbeDelayMs, ProbeDelayMs);
+            }
+
+            if (bCongestionControl)
+            {
+                Controller.OnClockRttSample(Config, BaseRttMs + ProbeDelayMs, Now);
+                Scheduler.SetPeerRateLimit(Target.Address, ETrafficClass::Bulk, static_cast<int64>(Controller.GetRate(Config)), Now);
+            }
+        }
+
+        Result.MeanProbeDelayMs = DelayCount > 0 ? DelaySumMs / DelayCount : 0.0;
+        Result.FinalRate = Controller.GetRate(Config);
+        Result.DelayBackoffs = Controller.GetDelayBackoffCount();
+
+        Sender->Close();
+        Relay->Close();
+        return Result;
+    }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNetworkCongestionControlTest, "MultiServerSync.NetworkManager.CongestionControl", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+bool FNetworkCongestionControlTest::RunTest(const FString& Parameters)
+{
+    using namespace NetworkManagerTestUtils;
+
+    FCongestionControlConfig Config;
+
+    // 신뢰성 메시지 윈도우: 손실로 최소 속도까지 줄이면 최소 윈도우만 남음
+    FCongestionController Controller;
+    TestTrue(TEXT("Empty window should accept any size"), Controller.CanSend(Config, 1024 * 1024));
+    for (int32 Index = 0; Index < 20; ++Index)
+    {
+        Controller.OnLoss(Config, 1.0 + Index * 0.1);
+    }
+    TestEqual(TEXT("Loss backoff should stop at the minimum rate"), Controller.GetRate(Config), Config.MinRateBytesPerSecond);
+    TestEqual(TEXT("Every spaced loss should back off"), Controller.GetLossBackoffCount(), uint32(20));
+    TestEqual(TEXT("Window should fall back to the minimum"), Controller.GetWindowBytes(Config), int64(Config.MinWindowBytes));
+
+    Controller.OnSend(Config.MinWindowBytes);
+    TestFalse(TEXT("Full window should hold further messages"), Controller.CanSend(Config, 100));
+
+    Controller.OnAck(Config, Config.MinWindowBytes, -1.0, 3.0);
+    TestTrue(TEXT("ACK should reopen the window"), Controller.CanSend(Config, 100));
+    TestEqual(TEXT("Retransmitted ACKs should not be RTT samples"), Controller.GetSmoothedAckRtt(), 0.0);
+
+    Controller.OnSend(1000);
+    Controller.OnAck(Config, 1000, 0.004, 3.1);
+    TestEqual(TEXT("First ACK RTT sample"), Controller.GetSmoothedAckRtt(), 0.004);
+    TestTrue(TEXT("Rate should grow again below the target delay"), Controller.GetRate(Config) > Config.MinRateBytesPerSecond);
+
+    // 5MB/s 병목 링크에서 대량 전송(기본 12.5MB/s 페이싱)이 시간 동기화 프로브를 얼마나 지연시키는지 비교
+    const double LinkRate = 5000000.0;
+    const FBottleneckResult Uncontrolled = RunBottleneckSimulation(false, LinkRate, Config);
+    const FBottleneckResult Controlled = RunBottleneckSimulation(true, LinkRate, Config);
+    if (!TestTrue(TEXT("Loopback sockets should be created"), Uncontrolled.LostProbes >= 0 && Controlled.LostProbes >= 0))
+    {
+        return false;
+    }
+
+    AddInfo(FString::Printf(TEXT("Without congestion control: probe delay mean %.2f ms, max %.2f ms, %d probes lost"),
+        Uncontrolled.MeanProbeDelayMs, Uncontrolled.MaxProbeDelayMs, Uncontrolled.LostProbes));
+    AddInfo(FString::Printf(TEXT("With congestion control: probe delay mean %.2f ms, max %.2f ms, %d probes lost, rate %.2f MB/s after %u delay backoffs"),
+        Controlled.MeanProbeDelayMs, Controlled.MaxProbeDelayMs, Controlled.LostProbes, Controlled.FinalRate / 1000000.0, Controlled.DelayBackoffs));
+
+    TestTrue(TEXT("Uncontrolled bulk traffic should push probe delay past the target"), Uncontrolled.MeanProbeDelayMs > Config.TargetDelayMs * 4.0);
+    TestTrue(TEXT("Controlled probe delay should stay under the target"), Controlled.MeanProbeDelayMs <= Config.TargetDelayMs);
+    TestEqual(TEXT("Controlled bulk traffic should not overflow the bottleneck buffer"), Controlled.LostProbes, 0);
+    TestTrue(TEXT("Controller should have backed off on delay"), Controlled.DelayBackoffs > 0);
+    TestTrue(TEXT("Controller should converge near the bottleneck rate"), Controlled.FinalRate > LinkRate * 0.5 && Controlled.FinalRate < LinkRate * 1.5);
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNetworkCongestionPingPathTest, "MultiServerSync.NetworkManager.CongestionControlPingPath", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+bool FNetworkCongestionPingPathTest::RunTest(const FString& Parameters)
+{
+    // 초기화하지 않은 매니저로 핑 응답 처리 경로만 검사 (요청 송신은 실패하지만 대기 목록에는 기록됨)
+    FNetworkManager Manager;
+    Manager.SetOrderGuaranteed(false);
+
+    const FIPv4Endpoint Peer(FIPv4Address(127, 0, 0, 1), 7000);
+    const FCongestionControlConfig& Config = Manager.GetCongestionControlConfig();
+
+    // 네트워크 왕복은 0.5ms로 일정하지만, 응답 측이 요청을 다음 인박스 틱까지 2~15ms 붙잡고 있는 상황
+    const uint64 NetworkRttMicroseconds = 500;
+    FRandomStream Random(7);
+    for (int32 Index = 0; Index < 32; ++Index)
+    {
+        const uint32 PingSequence = Manager.SendPingRequest(Peer);
+        const uint32 HoldMicroseconds = static_cast<uint32>(Random.RandRange(2000, 15000));
+
+        FPingMessage Response;
+        Response.Type = EPingMessageType::Response;
+        Response.Timestamp = Manager.GetHighPrecisionTimestamp() - NetworkRttMicroseconds - HoldMicroseconds;
+        Response.SequenceNumber = PingSequence;
+        Response.HoldTimeMicroseconds = HoldMicroseconds;
+
+        FNetworkMessage Message = FNetworkMessage::MakePayloadMessage<ENetworkMessageType::PingResponse>(Response);
+        Message.SetProjectId(Manager.GetProjectId());
+        Message.SetSequenceNumber(static_cast<uint16>(Index + 1));
+        Manager.ProcessReceivedData(Message.Serialize(), Peer);
+    }
+
+    // 보류 시간을 뺀 RTT만 통계와 혼잡 제어기에 들어가야 함
+    const FNetworkLatencyStats Stats = Manager.GetLatencyStats(Peer);
+    TestEqual(TEXT("Every response should be an RTT sample"), Stats.SampleCount, 32);
+    TestTrue(TEXT("RTT samples should exclude the responder hold time"), Stats.MaxRTT < 2.0);
+
+    const FCongestionController* Controller = Manager.FindCongestionController(Peer);
+    if (!TestNotNull(TEXT("Ping responses should create the peer's controller"), Controller))
+    {
+        return false;
+    }
+
+    AddInfo(FString::Printf(TEXT("Base RTT %.3f ms, queuing delay %.3f ms, %u delay backoffs"),
+        Controller->GetBaseRttMs(), Controller->GetQueuingDelayMs(), Controller->GetDelayBackoffCount()));
+
+    TestTrue(TEXT("Controller should see the network RTT as its base"), Controller->GetBaseRttMs() < 2.0);
+    TestTrue(TEXT("Responder tick jitter should not look like queuing delay"), Controller->GetQueuingDelayMs() < Config.TargetDelayMs);
+    TestEqual(TEXT("Controller should not back off on responder tick jitter"), Controller->GetDelayBackoffCount(), 0u);
+
+    return true;
+}
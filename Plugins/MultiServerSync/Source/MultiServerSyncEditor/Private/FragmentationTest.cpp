@@ -0,0 +1,108 @@
+﻿// FragmentationTest.cpp
+#include "Misc/AutomationTest.h"
+#include "FNetworkManager.h"
+
+namespace NetworkManagerTestUtils
+{
+    /** 조각 데이터그램을 파싱하여 재조립기에 추가 */
+    static EFragmentResult AddFragmentDatagram(FFragmentReassembler& Reassembler, const TArray<uint8>& Datagram, double Now, TArray<uint8>& OutPayload)
+    {
+        FNetworkMessageView View;
+        if (!View.Parse(Datagram) || View.GetType() != ENetworkMessageType::Fragment)
+        {
+            return EFragmentResult::Rejected;
+        }
+
+        FFragmentHeader Header;
+        FMemory::Memcpy(&Header, View.GetData().GetData(), sizeof(FFragmentHeader));
+        return Reassembler.AddFragment(0, FIPv4Endpoint(FIPv4Address(127, 0, 0, 1), 7000), Header,
+            View.GetData().RightChop(sizeof(FFragmentHeader)), Now, OutPayload);
+    }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNetworkFragmentationTest, "MultiServerSync.NetworkManager.Fragmentation", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+bool FNetworkFragmentationTest::RunTest(const FString& Parameters)
+{
+    using namespace NetworkManagerTestUtils;
+
+    const int32 MaxDatagramSize = FNetworkManager::DEFAULT_PATH_MTU - FNetworkManager::IPV4_UDP_HEADER_SIZE;
+
+    // uint16 헤더 크기로 표현할 수 없는 200KB 페이로드
+    TArray<uint8> LargePayload;
+    LargePayload.SetNumUninitialized(200000);
+    for (int32 Index = 0; Index < LargePayload.Num(); ++Index)
+    {
+        LargePayload[Index] = static_cast<uint8>(Index * 31 + 7);
+    }
+
+    FNetworkMessage Message(ENetworkMessageType::Custom, LargePayload);
+    Message.SetSequenceNumber(1234);
+
+    TArray<TArray<uint8>> Datagrams;
+    TestTrue(TEXT("Large message should be fragmented"), Message.SerializeFragments(7, MaxDatagramSize, Datagrams));
+    TestTrue(TEXT("Large message should need several fragments"), Datagrams.Num() > 100);
+    for (const TArray<uint8>& Datagram : Datagrams)
+    {
+        if (Datagram.Num() > MaxDatagramSize)
+        {
+            AddError(FString::Printf(TEXT("Fragment of %d bytes exceeds the %d byte datagram limit"), Datagram.Num(), MaxDatagramSize));
+            break;
+        }
+    }
+
+    // 역순으로 도착하고 한 조각은 유실
+    const int32 LostIndex = 3;
+    FFragmentReassembler Reassembler;
+    TArray<uint8> Reassembled;
+    for (int32 Index = Datagrams.Num() - 1; Index >= 0; --Index)
+    {
+        if (Index != LostIndex)
+        {
+            TestTrue(TEXT("Partial message should stay incomplete"), AddFragmentDatagram(Reassembler, Datagrams[Index], 0.0, Reassembled) == EFragmentResult::Incomplete);
+        }
+    }
+
+    TestTrue(TEXT("Repeated fragment should be a duplicate"), AddFragmentDatagram(Reassembler, Datagrams[0], 0.0, Reassembled) == EFragmentResult::Duplicate);
+
+    // 진척이 멈추면 유실된 조각만 요청
+    TArray<FFragmentReassembler::FStalledMessage> Stalled;
+    Reassembler.CollectStalled(0.05, FNetworkManager::FRAGMENT_NACK_DELAY_SECONDS, 64, Stalled);
+    TestEqual(TEXT("No NACK before the delay"), Stalled.Num(), 0);
+
+    Reassembler.CollectStalled(0.2, FNetworkManager::FRAGMENT_NACK_DELAY_SECONDS, 64, Stalled);
+    if (TestEqual(TEXT("Stalled message should be reported once"), Stalled.Num(), 1))
+    {
+        TestEqual(TEXT("NACK should carry the message id"), Stalled[0].Nack.MessageId, 7u);
+        TestTrue(TEXT("NACK should list only the lost fragment"), Stalled[0].Nack.MissingFragments == TArray<uint16>({ static_cast<uint16>(LostIndex) }));
+
+        FFragmentNack Parsed;
+        TestTrue(TEXT("NACK should round-trip"), Parsed.Deserialize(Stalled[0].Nack.Serialize()));
+        TestTrue(TEXT("NACK round-trip should keep missing fragments"), Parsed.MissingFragments == Stalled[0].Nack.MissingFragments);
+    }
+
+    // 재전송된 조각으로 완성
+    TestTrue(TEXT("Retransmitted fragment should complete the message"), AddFragmentDatagram(Reassembler, Datagrams[LostIndex], 0.3, Reassembled) == EFragmentResult::Complete);
+    TestTrue(TEXT("Reassembled payload should match"), Reassembled == LargePayload);
+    TestEqual(TEXT("Completed message should release reassembly memory"), Reassembler.GetStats().BufferedBytes, int64(0));
+    TestTrue(TEXT("Late fragment of a completed message should be a duplicate"), AddFragmentDatagram(Reassembler, Datagrams[0], 0.3, Reassembled) == EFragmentResult::Duplicate);
+
+    // 재조립 메모리 한도: 새 메시지가 들어오면 가장 오래된 미완성 메시지를 버림
+    FFragmentReassembler BoundedReassembler(300000, 1.0);
+    TArray<TArray<uint8>> SecondDatagrams;
+    Message.SerializeFragments(8, MaxDatagramSize, SecondDatagrams);
+
+    AddFragmentDatagram(BoundedReassembler, Datagrams[0], 0.0, Reassembled);
+    AddFragmentDatagram(BoundedReassembler, SecondDatagrams[0], 0.1, Reassembled);
+    FFragmentationStats BoundedStats = BoundedReassembler.GetStats();
+    TestEqual(TEXT("Oldest message should be evicted at the memory limit"), BoundedStats.EvictedMessages, uint64(1));
+    TestTrue(TEXT("Buffered bytes should stay within the limit"), BoundedStats.BufferedBytes <= 300000);
+
+    FFragmentReassembler TinyReassembler(1024, 1.0);
+    TestTrue(TEXT("Message larger than the memory limit should be rejected"), AddFragmentDatagram(TinyReassembler, Datagrams[0], 0.0, Reassembled) == EFragmentResult::Rejected);
+
+    // 재조립 시간 제한
+    TestEqual(TEXT("Stale message should expire"), BoundedReassembler.ExpireStale(2.0), 1);
+    TestEqual(TEXT("Expired message should release reassembly memory"), BoundedReassembler.GetStats().BufferedBytes, int64(0));
+
+    return true;
+}
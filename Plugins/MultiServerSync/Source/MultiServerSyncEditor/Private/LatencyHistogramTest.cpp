@@ -0,0 +1,46 @@
+﻿// LatencyHistogramTest.cpp
+#include "Misc/AutomationTest.h"
+#include "FNetworkManager.h"
+#include "NetworkTestUtils.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNetworkLatencyHistogramTest, "MultiServerSync.NetworkManager.LatencyHistogram", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+bool FNetworkLatencyHistogramTest::RunTest(const FString& Parameters)
+{
+    TestEqual(TEXT("Sub-microsecond samples go to bucket 0"), FLatencyHistogram::GetBucketIndex(0.4), 0);
+    TestEqual(TEXT("1us goes to bucket 1"), FLatencyHistogram::GetBucketIndex(1.0), 1);
+    TestEqual(TEXT("3us goes to bucket 2"), FLatencyHistogram::GetBucketIndex(3.0), 2);
+    TestEqual(TEXT("100us goes to bucket 7"), FLatencyHistogram::GetBucketIndex(100.0), 7);
+    TestEqual(TEXT("Huge samples go to the last bucket"), FLatencyHistogram::GetBucketIndex(1.0e9), FLatencyHistogram::NUM_BUCKETS - 1);
+
+    FLatencyHistogram Histogram;
+    TestEqual(TEXT("Empty histogram percentile is zero"), Histogram.GetPercentile(0.5), 0.0);
+
+    for (int32 Index = 0; Index < 90; ++Index)
+    {
+        Histogram.Add(10.0);
+    }
+    for (int32 Index = 0; Index < 10; ++Index)
+    {
+        Histogram.Add(1000.0);
+    }
+
+    TestEqual(TEXT("Sample count"), Histogram.GetCount(), uint64(100));
+    TestEqual(TEXT("Median is the upper bound of the 10us bucket"), Histogram.GetPercentile(0.5), 16.0);
+    TestEqual(TEXT("p90 stays in the 10us bucket"), Histogram.GetPercentile(0.9), 16.0);
+    TestEqual(TEXT("p99 is the upper bound of the 1000us bucket"), Histogram.GetPercentile(0.99), 1024.0);
+
+    FLatencyHistogram Other;
+    Other.Add(10.0);
+    Histogram.Merge(Other);
+    TestEqual(TEXT("Merged sample count"), Histogram.GetCount(), uint64(101));
+
+    // 프로필 기본값
+    const FReceiverThreadSettings Standard = FReceiverThreadSettings::FromProfile(EReceiverThreadProfile::Standard, 3);
+    const FReceiverThreadSettings LowLatency = FReceiverThreadSettings::FromProfile(EReceiverThreadProfile::LowLatency, 3);
+    TestFalse(TEXT("Standard profile uses normal scheduling"), Standard.IsLowLatency());
+    TestEqual(TEXT("Standard profile does not pin"), Standard.CpuCore, int32(INDEX_NONE));
+    TestTrue(TEXT("Low-latency profile spins before blocking"), LowLatency.SpinMicroseconds > 0);
+    TestEqual(TEXT("Low-latency profile pins to the configured core"), LowLatency.CpuCore, 3);
+
+    return true;
+}
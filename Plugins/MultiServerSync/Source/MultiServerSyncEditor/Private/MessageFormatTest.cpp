@@ -0,0 +1,389 @@
+﻿// MessageFormatTest.cpp
+#include "Misc/AutomationTest.h"
+#include "FNetworkManager.h"
+#include "HAL/PlatformTime.h"
+#include "Serialization/MemoryWriter.h"
+#include "Serialization/MemoryReader.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNetworkCompactHeaderTest, "MultiServerSync.NetworkManager.CompactHeader", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+bool FNetworkCompactHeaderTest::RunTest(const FString& Parameters)
+{
+    const FGuid ProjectId = FGuid::NewGuid();
+    const uint32 SessionToken = FNetworkMessage::MakeSessionToken(ProjectId);
+    TestEqual(TEXT("Session token should be stable for a project"), FNetworkMessage::MakeSessionToken(ProjectId), SessionToken);
+    TestNotEqual(TEXT("Different projects should get different tokens"), FNetworkMessage::MakeSessionToken(FGuid::NewGuid()), SessionToken);
+
+    // 핑 메시지: 헤더 오버헤드가 절반 이하로 줄어야 함
+    TArray<uint8> PingPayload;
+    PingPayload.SetNumZeroed(FPingMessage::SERIALIZED_SIZE);
+    FNetworkMessage Ping(ENetworkMessageType::PingRequest, PingPayload);
+    Ping.SetProjectId(ProjectId);
+    Ping.SetSequenceNumber(MAX_uint16);
+    Ping.SetFlags(1);
+
+    const TArray<uint8> FullData = Ping.Serialize();
+    const TArray<uint8> CompactData = Ping.SerializeCompact(SessionToken);
+    const int32 CompactHeaderSize = CompactData.Num() - PingPayload.Num();
+    TestTrue(TEXT("Compact header should be less than half of the v1 header"), CompactHeaderSize * 2 < static_cast<int32>(sizeof(FNetworkMessageHeader)));
+    TestTrue(TEXT("Compact header should fit the maximum size"), CompactHeaderSize <= FNetworkMessage::MAX_COMPACT_HEADER_SIZE);
+    TestEqual(TEXT("v1 header size should be unchanged"), FullData.Num() - PingPayload.Num(), static_cast<int32>(sizeof(FNetworkMessageHeader)));
+
+    FNetworkMessageView View;
+    if (TestTrue(TEXT("Compact message should parse"), View.Parse(CompactData)))
+    {
+        TestTrue(TEXT("View should report the compact header"), View.IsCompact());
+        TestEqual(TEXT("Session token should round-trip"), View.GetSessionToken(), SessionToken);
+        TestTrue(TEXT("Type should round-trip"), View.GetType() == ENetworkMessageType::PingRequest);
+        TestEqual(TEXT("Sequence should round-trip"), View.GetSequenceNumber(), static_cast<uint16>(MAX_uint16));
+        TestEqual(TEXT("Flags should round-trip"), View.GetFlags(), static_cast<uint8>(1));
+        TestEqual(TEXT("Payload size should round-trip"), View.GetData().Num(), PingPayload.Num());
+        TestEqual(TEXT("Compact messages should identify as version 2"), View.GetVersion(), FNetworkMessage::COMPACT_HEADER_VERSION);
+    }
+
+    TestEqual(TEXT("Peeked size should cover the compact message"), FNetworkMessageView::PeekMessageSize(CompactData), CompactData.Num());
+
+    // v1 메시지는 지원하는 최고 버전을 알려 탐색 중에 협상할 수 있어야 함
+    if (TestTrue(TEXT("v1 message should still parse"), View.Parse(FullData)))
+    {
+        TestFalse(TEXT("v1 message should not be compact"), View.IsCompact());
+        TestEqual(TEXT("v1 header should advertise compact header support"), View.GetVersion(), FNetworkMessage::COMPACT_HEADER_VERSION);
+        TestTrue(TEXT("v1 header should keep the project id"), View.GetProjectId() == ProjectId);
+    }
+
+    // v1 디코더는 매직 넘버가 없는 압축 헤더를 버림
+    FNetworkMessage LegacyDecoder;
+    TestFalse(TEXT("v1 decoder should reject compact datagrams"), LegacyDecoder.Deserialize(CompactData));
+
+    // 잘린 데이터그램과 크기가 맞지 않는 데이터그램은 거부
+    TestFalse(TEXT("Truncated compact message should be rejected"), View.Parse(TArrayView<const uint8>(CompactData.GetData(), CompactData.Num() - 1)));
+    TestFalse(TEXT("Header-only fragment should be rejected"), View.Parse(TArrayView<const uint8>(CompactData.GetData(), 5)));
+
+    // 가변 길이 시퀀스 번호 경계값
+    const uint16 SequenceSamples[] = { 0, 127, 128, 16383, 16384, MAX_uint16 };
+    for (uint16 Sequence : SequenceSamples)
+    {
+        FNetworkMessage Ack(ENetworkMessageType::MessageAck, TArray<uint8>());
+        Ack.SetSequenceNumber(Sequence);
+        FNetworkMessageView AckView;
+        TestTrue(FString::Printf(TEXT("Sequence %u should round-trip"), Sequence),
+            AckView.Parse(Ack.SerializeCompact(SessionToken)) && AckView.GetSequenceNumber() == Sequence);
+    }
+
+    // 압축 헤더 메시지는 압축 묶음 헤더로 묶임
+    const FIPv4Address Loopback(127, 0, 0, 1);
+    TUniquePtr<INetworkTransport> Sender = INetworkTransport::Create(EReceiveBackend::SingleRead, Loopback, 0, TEXT("MultiServerSyncTest_CompactSender"));
+    TUniquePtr<INetworkTransport> Receiver = INetworkTransport::Create(EReceiveBackend::SingleRead, Loopback, 0, TEXT("MultiServerSyncTest_CompactReceiver"));
+    if (!TestNotNull(TEXT("Sender socket should be created"), Sender.Get()) || !TestNotNull(TEXT("Receiver socket should be created"), Receiver.Get()))
+    {
+        return false;
+    }
+
+    const FIPv4Endpoint Target(Loopback, Receiver->GetLocalPort());
+    FMessageCoalescer Coalescer;
+    Coalescer.SetProjectId(ProjectId);
+    Coalescer.SetMaxDatagramSize(FNetworkManager::DEFAULT_PATH_MTU - FNetworkManager::IPV4_UDP_HEADER_SIZE);
+
+    int32 PackedBytes = 0;
+    for (uint16 Sequence = 0; Sequence < 3; ++Sequence)
+    {
+        FNetworkMessage Message(ENetworkMessageType::FrameSync, PingPayload);
+        Message.SetSequenceNumber(Sequence);
+        const TArray<uint8> Data = Message.SerializeCompact(SessionToken);
+        Coalescer.Enqueue(Sender.Get(), Target, Data.GetData(), Data.Num(), 0.0);
+        PackedBytes += Data.Num();
+    }
+    Coalescer.FlushAll();
+
+    FReceivedDatagram Batch[INetworkTransport::MAX_RECEIVE_BATCH];
+    int32 Received = 0;
+    if (Receiver->WaitForRead(FTimespan::FromMilliseconds(500)))
+    {
+        Received = Receiver->ReceiveBatch(Batch, INetworkTransport::MAX_RECEIVE_BATCH);
+    }
+
+    if (TestEqual(TEXT("Compact batch should arrive as one datagram"), Received, 1))
+    {
+        FNetworkMessageView BatchView;
+        TestTrue(TEXT("Compact batch should parse"), BatchView.Parse(TArrayView<const uint8>(Batch[0].Data, Batch[0].Size)));
+        TestTrue(TEXT("Batch header should be compact"), BatchView.IsCompact() && BatchView.GetType() == ENetworkMessageType::Batch);
+        TestEqual(TEXT("Batch header should carry the session token"), BatchView.GetSessionToken(), SessionToken);
+        TestTrue(TEXT("Compact batch header should be small"), Batch[0].Size - PackedBytes <= FNetworkMessage::MAX_COMPACT_HEADER_SIZE);
+        TestEqual(TEXT("Batch payload should hold all packed messages"), BatchView.GetData().Num(), PackedBytes);
+    }
+    Batch[0].Buffer.SafeRelease();
+
+    Sender->Close();
+    Receiver->Close();
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNetworkCompactHeaderNegotiationTest, "MultiServerSync.NetworkManager.CompactHeaderNegotiation", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+bool FNetworkCompactHeaderNegotiationTest::RunTest(const FString& Parameters)
+{
+    // 초기화하지 않은 매니저로 헤더 형식 합의만 검사 (소켓 없음)
+    FNetworkManager Manager;
+
+    const FIPv4Address ServerAddress(10, 20, 30, 40);
+    const FIPv4Endpoint DataEndpoint(ServerAddress, FNetworkManager::DEFAULT_PORT);
+
+    // 핑 요청은 상대의 시간 동기화 소켓에서 오므로 핑 응답은 데이터 엔드포인트가 아닌 그 엔드포인트로 나감
+    const FIPv4Endpoint PingSource(ServerAddress, FNetworkManager::TIME_SYNC_PORT);
+    TestTrue(TEXT("Ping responses should use the time sync channel"),
+        FNetworkManager::GetChannelForMessageType(ENetworkMessageType::PingResponse) == ENetworkChannel::TimeSync);
+    TestFalse(TEXT("Undiscovered server should get the v1 header"), Manager.IsCompactHeaderPeer(PingSource));
+
+    FServerEndpoint Server;
+    Server.Id = TEXT("render-node-02");
+    Server.IPAddress = ServerAddress;
+    Server.Port = FNetworkManager::DEFAULT_PORT;
+    Server.ProtocolVersion = FNetworkMessage::COMPACT_HEADER_VERSION;
+    Manager.AddOrUpdateServer(Server);
+
+    TestTrue(TEXT("Data messages to a v2 server should use the compact header"), Manager.IsCompactHeaderPeer(DataEndpoint));
+    TestTrue(TEXT("Ping responses to a v2 server's time sync socket should use the compact header"), Manager.IsCompactHeaderPeer(PingSource));
+    TestFalse(TEXT("Other addresses should keep the v1 header"),
+        Manager.IsCompactHeaderPeer(FIPv4Endpoint(FIPv4Address(10, 20, 30, 41), FNetworkManager::TIME_SYNC_PORT)));
+
+    // 같은 주소에 v1 서버가 함께 있으면 그 주소로는 모두 v1 헤더
+    FServerEndpoint LegacyServer = Server;
+    LegacyServer.Id = TEXT("render-node-02-legacy");
+    LegacyServer.Port = FNetworkManager::DEFAULT_PORT + 10;
+    LegacyServer.ProtocolVersion = 1;
+    Manager.AddOrUpdateServer(LegacyServer);
+    TestFalse(TEXT("A v1 server on the same address should force the v1 header"), Manager.IsCompactHeaderPeer(PingSource));
+
+    LegacyServer.ProtocolVersion = FNetworkMessage::COMPACT_HEADER_VERSION;
+    Manager.AddOrUpdateServer(LegacyServer);
+    TestTrue(TEXT("Upgraded server should restore the compact header"), Manager.IsCompactHeaderPeer(PingSource));
+
+    Manager.SetCompactHeadersEnabled(false);
+    TestFalse(TEXT("Disabled compact headers should not be negotiated"), Manager.IsCompactHeaderPeer(PingSource));
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNetworkMasterProtocolPayloadTest, "MultiServerSync.NetworkManager.MasterProtocolPayloads", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+bool FNetworkMasterProtocolPayloadTest::RunTest(const FString& Parameters)
+{
+    const FString ServerId = TEXT("render-node-01");
+    TestEqual(TEXT("Server ID hash should be stable"), HashServerId(ServerId), HashServerId(FString(TEXT("render-node-01"))));
+    TestNotEqual(TEXT("Different server IDs should hash differently"), HashServerId(ServerId), HashServerId(TEXT("render-node-02")));
+
+    // 마스터 공지: 이전 문자열 형식보다 훨씬 작아야 함
+    FMasterInfoPayload Announcement;
+    Announcement.ServerIdHash = HashServerId(ServerId);
+    Announcement.IPAddress = FIPv4Address(192, 168, 10, 21);
+    Announcement.Port = 7000;
+    Announcement.Priority = 0.734512f;
+    Announcement.ElectionTerm = 12;
+
+    const TArray<uint8> AnnouncementBytes = Announcement.Serialize();
+    const FString LegacyAnnouncement = FString::Printf(TEXT("%s:%s:%d:%f:%d"), *ServerId, TEXT("192.168.10.21"), 7000, 0.734512f, 12);
+    const int32 LegacySize = LegacyAnnouncement.Len() * sizeof(TCHAR);
+    TestEqual(TEXT("Announcement should have a fixed size"), AnnouncementBytes.Num(), FMasterInfoPayload::SERIALIZED_SIZE);
+    TestTrue(FString::Printf(TEXT("Binary announcement (%d bytes) should be far smaller than the string form (%d bytes)"), AnnouncementBytes.Num(), LegacySize),
+        AnnouncementBytes.Num() * 4 < LegacySize);
+
+    FMasterInfoPayload ParsedAnnouncement;
+    if (TestTrue(TEXT("Announcement should round-trip"), ParsedAnnouncement.Deserialize(AnnouncementBytes)))
+    {
+        TestEqual(TEXT("Server ID hash"), ParsedAnnouncement.ServerIdHash, Announcement.ServerIdHash);
+        TestTrue(TEXT("IP address"), ParsedAnnouncement.IPAddress == Announcement.IPAddress);
+        TestEqual(TEXT("Port"), ParsedAnnouncement.Port, Announcement.Port);
+        TestEqual(TEXT("Priority"), ParsedAnnouncement.Priority, Announcement.Priority);
+        TestEqual(TEXT("Election term"), ParsedAnnouncement.ElectionTerm, Announcement.ElectionTerm);
+    }
+
+    // 잘린 페이로드는 거부하고, 뒤에 붙은 확장 바이트는 무시
+    TestFalse(TEXT("Truncated announcement should be rejected"),
+        ParsedAnnouncement.Deserialize(TArrayView<const uint8>(AnnouncementBytes.GetData(), AnnouncementBytes.Num() - 1)));
+    TArray<uint8> ExtendedBytes = AnnouncementBytes;
+    ExtendedBytes.Add(0xFF);
+    TestTrue(TEXT("Trailing extension bytes should be ignored"), ParsedAnnouncement.Deserialize(ExtendedBytes));
+    TestFalse(TEXT("Legacy string payload of the wrong shape should not crash"), FServerIdPayload().Deserialize(TArrayView<const uint8>()));
+
+    FMasterVotePayload Vote;
+    Vote.VoterIdHash = HashServerId(TEXT("render-node-02"));
+    Vote.CandidateIdHash = Announcement.ServerIdHash;
+    Vote.ElectionTerm = 13;
+    Vote.VoterPriority = 0.25f;
+
+    FMasterVotePayload ParsedVote;
+    if (TestTrue(TEXT("Vote should round-trip"), ParsedVote.Deserialize(Vote.Serialize())))
+    {
+        TestEqual(TEXT("Voter"), ParsedVote.VoterIdHash, Vote.VoterIdHash);
+        TestEqual(TEXT("Candidate"), ParsedVote.CandidateIdHash, Vote.CandidateIdHash);
+        TestEqual(TEXT("Vote term"), ParsedVote.ElectionTerm, Vote.ElectionTerm);
+        TestEqual(TEXT("Voter priority"), ParsedVote.VoterPriority, Vote.VoterPriority);
+    }
+
+    FMasterElectionPayload Election;
+    Election.CandidateIdHash = Announcement.ServerIdHash;
+    Election.ElectionTerm = 14;
+    Election.Priority = 0.5f;
+
+    FMasterElectionPayload ParsedElection;
+    TestTrue(TEXT("Election should round-trip"), ParsedElection.Deserialize(Election.Serialize()) &&
+        ParsedElection.CandidateIdHash == Election.CandidateIdHash && ParsedElection.ElectionTerm == 14 && ParsedElection.Priority == 0.5f);
+
+    FRoleChangePayload Role;
+    Role.ServerIdHash = Announcement.ServerIdHash;
+    Role.ElectionTerm = 15;
+    Role.bIsMaster = true;
+
+    FRoleChangePayload ParsedRole;
+    TestTrue(TEXT("Role change should round-trip"), ParsedRole.Deserialize(Role.Serialize()) &&
+        ParsedRole.ServerIdHash == Role.ServerIdHash && ParsedRole.ElectionTerm == 15 && ParsedRole.bIsMaster);
+
+    FServerIdPayload ParsedQuery;
+    TestTrue(TEXT("Server ID payload should round-trip"), ParsedQuery.Deserialize(FServerIdPayload(Announcement.ServerIdHash).Serialize()) &&
+        ParsedQuery.ServerIdHash == Announcement.ServerIdHash);
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNetworkMessageSchemaTest, "MultiServerSync.NetworkManager.MessageSchema", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+bool FNetworkMessageSchemaTest::RunTest(const FString& Parameters)
+{
+    // 스키마 인코딩은 기존 FMemoryWriter 경로와 바이트 단위로 같아야 함
+    FPingMessage Ping;
+    Ping.Type = EPingMessageType::Response;
+    Ping.Timestamp = 0x0102030405060708ull;
+    Ping.SequenceNumber = 0xA1B2C3D4u;
+    Ping.HoldTimeMicroseconds = 1500;
+
+    TArray<uint8> ArchiveBytes;
+    FMemoryWriter Writer(ArchiveBytes);
+    Ping.Serialize(Writer);
+
+    const TArray<uint8> SchemaBytes = Ping.Serialize();
+    TestEqual(TEXT("Schema size should be computed at compile time"), SchemaBytes.Num(), FPingMessage::SERIALIZED_SIZE);
+    TestTrue(TEXT("Schema bytes should match the archive bytes"), SchemaBytes == ArchiveBytes);
+
+    // 필드는 선언 순서대로 패딩 없이 리틀 엔디언
+    FMasterInfoPayload Info;
+    Info.ServerIdHash = 0x11223344u;
+    Info.IPAddress = FIPv4Address(10, 0, 0, 7);
+    Info.Port = 0x1F40;
+    Info.Priority = 1.0f;
+    Info.ElectionTerm = -2;
+
+    const TArray<uint8> InfoBytes = Info.Serialize();
+    const uint8 ExpectedInfo[] = {
+        0x44, 0x33, 0x22, 0x11,         // ServerIdHash
+        0x07, 0x00, 0x00, 0x0A,         // IPAddress.Value
+        0x40, 0x1F,                     // Port
+        0x00, 0x00, 0x80, 0x3F,         // Priority (1.0f)
+        0xFE, 0xFF, 0xFF, 0xFF          // ElectionTerm (-2)
+    };
+    TestTrue(TEXT("Master info layout should be little-endian and packed"),
+        InfoBytes.Num() == UE_ARRAY_COUNT(ExpectedInfo) && FMemory::Memcmp(InfoBytes.GetData(), ExpectedInfo, InfoBytes.Num()) == 0);
+
+    // 메시지 유형에 바인딩된 페이로드로 메시지 생성과 디코딩
+    FNetworkMessage PingMessage = FNetworkMessage::MakePayloadMessage<ENetworkMessageType::PingResponse>(Ping);
+    TestTrue(TEXT("Payload message should carry the bound type"), PingMessage.GetType() == ENetworkMessageType::PingResponse);
+
+    FPingMessage ParsedPing;
+    if (TestTrue(TEXT("Bound payload should be readable from a view"), FNetworkMessageView(PingMessage).ReadPayload<ENetworkMessageType::PingResponse>(ParsedPing)))
+    {
+        TestTrue(TEXT("Ping type"), ParsedPing.Type == Ping.Type);
+        TestEqual(TEXT("Ping timestamp"), ParsedPing.Timestamp, Ping.Timestamp);
+        TestEqual(TEXT("Ping sequence"), ParsedPing.SequenceNumber, Ping.SequenceNumber);
+        TestEqual(TEXT("Ping hold time"), ParsedPing.HoldTimeMicroseconds, Ping.HoldTimeMicroseconds);
+    }
+
+    // 보류 시간이 없는 이전 버전 핑도 받아야 함 (보류 시간 0)
+    const TArray<uint8> LegacyBytes = FPingMessage::FLegacySchema::Encode(Ping);
+    TestEqual(TEXT("Legacy ping size"), LegacyBytes.Num(), FPingMessage::LEGACY_SERIALIZED_SIZE);
+
+    FPingMessage LegacyPing;
+    LegacyPing.HoldTimeMicroseconds = 99;
+    if (TestTrue(TEXT("Legacy ping payload should be readable"), LegacyPing.Deserialize(LegacyBytes)))
+    {
+        TestEqual(TEXT("Legacy ping sequence"), LegacyPing.SequenceNumber, Ping.SequenceNumber);
+        TestEqual(TEXT("Legacy ping should carry no hold time"), LegacyPing.HoldTimeMicroseconds, 0u);
+    }
+
+    TArray<uint8> LegacyArchive(LegacyBytes);
+    FMemoryReader LegacyReader(LegacyArchive);
+    LegacyPing.HoldTimeMicroseconds = 99;
+    LegacyPing.Deserialize(LegacyReader);
+    TestEqual(TEXT("Legacy archive ping should carry no hold time"), LegacyPing.HoldTimeMicroseconds, 0u);
+    TestFalse(TEXT("Truncated ping should be rejected"),
+        LegacyPing.Deserialize(TArrayView<const uint8>(LegacyBytes.GetData(), LegacyBytes.Num() - 1)));
+
+    FNetworkMessage RoleMessage = FNetworkMessage::MakePayloadMessage<ENetworkMessageType::RoleChange>(FRoleChangePayload());
+    FMasterVotePayload WrongShape;
+    TestFalse(TEXT("Short payload should be rejected by a larger schema"),
+        FNetworkMessageView(RoleMessage).ReadPayload<ENetworkMessageType::MasterVote>(WrongShape));
+
+    static_assert(std::is_same_v<TMessagePayloadType<ENetworkMessageType::MasterResign>, FServerIdPayload>, "MasterResign should carry a server ID payload");
+    static_assert(std::is_void_v<TMessagePayloadType<ENetworkMessageType::Data>>, "Data messages have no fixed payload schema");
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNetworkSchemaSerializationBenchmark, "MultiServerSync.NetworkManager.Benchmark.SchemaSerialization", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+bool FNetworkSchemaSerializationBenchmark::RunTest(const FString& Parameters)
+{
+    const int32 Iterations = 1000000;
+
+    FPingMessage Ping;
+    Ping.Type = EPingMessageType::Request;
+    Ping.Timestamp = 123456789012345ull;
+    Ping.SequenceNumber = 42;
+
+    TArray<uint8> Buffer;
+    Buffer.Reserve(64);
+    uint64 Checksum = 0;
+
+    // 이전 방식: FMemoryWriter로 필드마다 아카이브 호출
+    const double ArchiveEncodeStart = FPlatformTime::Seconds();
+    for (int32 Index = 0; Index < Iterations; ++Index)
+    {
+        Ping.SequenceNumber = Index;
+        Buffer.Reset();
+        FMemoryWriter Writer(Buffer);
+        Ping.Serialize(Writer);
+        Checksum += Buffer[FPingMessage::SERIALIZED_SIZE - 1];
+    }
+    const double ArchiveEncodeSeconds = FPlatformTime::Seconds() - ArchiveEncodeStart;
+
+    // 스키마 방식: 컴파일 타임 크기로 한 번 확보 후 분기 없이 복사
+    const double SchemaEncodeStart = FPlatformTime::Seconds();
+    for (int32 Index = 0; Index < Iterations; ++Index)
+    {
+        Ping.SequenceNumber = Index;
+        Buffer.Reset();
+        FPingMessage::FSchema::Append(Buffer, Ping);
+        Checksum += Buffer[FPingMessage::SERIALIZED_SIZE - 1];
+    }
+    const double SchemaEncodeSeconds = FPlatformTime::Seconds() - SchemaEncodeStart;
+
+    FPingMessage Parsed;
+    const double ArchiveDecodeStart = FPlatformTime::Seconds();
+    for (int32 Index = 0; Index < Iterations; ++Index)
+    {
+        FMemoryReader Reader(Buffer);
+        Parsed.Deserialize(Reader);
+        Checksum += Parsed.Timestamp;
+    }
+    const double ArchiveDecodeSeconds = FPlatformTime::Seconds() - ArchiveDecodeStart;
+
+    const double SchemaDecodeStart = FPlatformTime::Seconds();
+    for (int32 Index = 0; Index < Iterations; ++Index)
+    {
+        Parsed.Deserialize(Buffer);
+        Checksum += Parsed.Timestamp;
+    }
+    const double SchemaDecodeSeconds = FPlatformTime::Seconds() - SchemaDecodeStart;
+
+    AddInfo(FString::Printf(TEXT("Encode: FMemoryWriter %.1f ns/msg, schema %.1f ns/msg"),
+        ArchiveEncodeSeconds * 1e9 / Iterations, SchemaEncodeSeconds * 1e9 / Iterations));
+    AddInfo(FString::Printf(TEXT("Decode: FMemoryReader %.1f ns/msg, schema %.1f ns/msg (checksum %llu)"),
+        ArchiveDecodeSeconds * 1e9 / Iterations, SchemaDecodeSeconds * 1e9 / Iterations, Checksum));
+
+    TestEqual(TEXT("Last decoded sequence number"), Parsed.SequenceNumber, uint32(Iterations - 1));
+
+    return true;
+}
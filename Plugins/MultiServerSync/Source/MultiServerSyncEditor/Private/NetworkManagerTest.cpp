@@ -1,9 +1,169 @@
 ﻿// NetworkManagerTest.cpp
 #include "Misc/AutomationTest.h"
+#include "FNetworkManager.h"
+#include "HAL/PlatformTime.h"
+#include "Async/Async.h"
 
 IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNetworkManagerDummyTest, "MultiServerSync.NetworkManager.Dummy", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
 bool FNetworkManagerDummyTest::RunTest(const FString& Parameters)
 {
     // 더미 테스트는 항상 성공
     return true;
-}
\ No newline at end of file
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNetworkManagerSpscInboxTest, "MultiServerSync.NetworkManager.SpscInbox", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+bool FNetworkManagerSpscInboxTest::RunTest(const FString& Parameters)
+{
+    const uint32 ItemCount = 1000000;
+
+    // 작은 용량으로 가득 찬 상태와 빈 상태를 자주 지나가도록 함
+    TSpscBoundedQueue<uint32> Queue(64);
+    TestEqual(TEXT("Capacity should be rounded up to a power of two"), Queue.GetCapacity(), 64u);
+
+    TAtomic<uint64> FullCount(0);
+
+    // 생산자 스레드
+    TFuture<void> Producer = Async(EAsyncExecution::Thread, [&Queue, &FullCount, ItemCount]()
+        {
+            for (uint32 Value = 0; Value < ItemCount; ++Value)
+            {
+                uint32 Item = Value;
+                while (!Queue.Enqueue(MoveTemp(Item)))
+                {
+                    FullCount++;
+                    FPlatformProcess::Yield();
+                }
+            }
+        });
+
+    // 소비자 (테스트 스레드) - 모든 항목이 순서대로 한 번씩 도착해야 함
+    uint32 Expected = 0;
+    uint32 OutOfOrder = 0;
+    const double StartTime = FPlatformTime::Seconds();
+    while (Expected < ItemCount && FPlatformTime::Seconds() - StartTime < 30.0)
+    {
+        uint32 Item = 0;
+        if (Queue.Dequeue(Item))
+        {
+            if (Item != Expected)
+            {
+                ++OutOfOrder;
+            }
+            ++Expected;
+        }
+    }
+
+    Producer.Wait();
+
+    AddInfo(FString::Printf(TEXT("%u items transferred, producer saw a full queue %llu times"), Expected, FullCount.Load()));
+
+    TestEqual(TEXT("All items should be dequeued"), Expected, ItemCount);
+    TestEqual(TEXT("Items should be dequeued in order"), OutOfOrder, 0u);
+    TestTrue(TEXT("Queue should be empty after draining"), Queue.IsEmpty());
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNetworkManagerInboxCapacityTest, "MultiServerSync.NetworkManager.InboxCapacity", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+bool FNetworkManagerInboxCapacityTest::RunTest(const FString& Parameters)
+{
+    FNetworkManager Manager;
+    TestEqual(TEXT("Default capacity should hold several receive batches"), Manager.GetInboxCapacity(),
+        INetworkTransport::MAX_RECEIVE_BATCH * FNetworkManager::DEFAULT_INBOX_BATCHES);
+
+    Manager.SetInboxCapacity(1000);
+    TestEqual(TEXT("Capacity should be rounded up to a power of two"), Manager.GetInboxCapacity(), 1024);
+
+    Manager.SetInboxCapacity(1);
+    TestEqual(TEXT("Capacity should hold at least one receive batch"), Manager.GetInboxCapacity(), static_cast<int32>(INetworkTransport::MAX_RECEIVE_BATCH));
+
+    Manager.SetInboxCapacity(0);
+    TestEqual(TEXT("Zero should restore the default capacity"), Manager.GetInboxCapacity(), FNetworkManager::DEFAULT_INBOX_CAPACITY);
+
+    // 프로젝트 설정으로 전달되는 값이 직렬화를 거쳐도 유지되어야 함
+    FProjectSettings Settings;
+    Settings.ReceiveInboxCapacity = 4096;
+    FProjectSettings Received;
+    TestTrue(TEXT("Settings should deserialize"), Received.FromBytes(Settings.ToBytes()));
+    TestEqual(TEXT("Inbox capacity should survive serialization"), Received.ReceiveInboxCapacity, 4096);
+    TestEqual(TEXT("Resolved capacity from settings"), FNetworkManager::ResolveInboxCapacity(Received.ReceiveInboxCapacity), 4096);
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNetworkManagerMessageDispatchTest, "MultiServerSync.NetworkManager.MessageDispatch", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+bool FNetworkManagerMessageDispatchTest::RunTest(const FString& Parameters)
+{
+    // 초기화하지 않은 매니저로 디스패치 경로만 검사 (소켓 없음)
+    FNetworkManager Manager;
+    Manager.SetOrderGuaranteed(false);
+
+    const FIPv4Endpoint Sender(FIPv4Address(127, 0, 0, 1), 7000);
+
+    auto Deliver = [&Manager, &Sender](ENetworkMessageType Type, const TArray<uint8>& Payload, uint16 SequenceNumber)
+        {
+            FNetworkMessage Message(Type, Payload);
+            Message.SetProjectId(Manager.GetProjectId());
+            Message.SetSequenceNumber(SequenceNumber);
+            Manager.ProcessReceivedData(Message.Serialize(), Sender);
+        };
+
+    const TArray<uint8> FramePayload = { 1, 2, 3, 4, 5, 6, 7, 8 };
+
+    int32 FirstCount = 0;
+    int32 SecondCount = 0;
+    int32 OtherTypeCount = 0;
+    bool bPayloadMatches = true;
+    bool bSenderMatches = true;
+
+    FDelegateHandle FirstHandle = Manager.SubscribeMessage(ENetworkMessageType::FrameSync,
+        FOnNetworkMessageReceived::FDelegate::CreateLambda([&](const FReceivedNetworkMessage& Received)
+            {
+                ++FirstCount;
+                bPayloadMatches &= Received.Type == ENetworkMessageType::FrameSync &&
+                    Received.Payload.Num() == FramePayload.Num() &&
+                    FMemory::Memcmp(Received.Payload.GetData(), FramePayload.GetData(), FramePayload.Num()) == 0;
+                bSenderMatches &= Received.SenderPeerId != INVALID_PEER_ID && Received.SenderId == Sender.ToString();
+            }));
+
+    Manager.SubscribeMessage(ENetworkMessageType::FrameSync,
+        FOnNetworkMessageReceived::FDelegate::CreateLambda([&SecondCount](const FReceivedNetworkMessage& Received)
+            {
+                ++SecondCount;
+            }));
+
+    Manager.SubscribeMessage(ENetworkMessageType::SettingsSync,
+        FOnNetworkMessageReceived::FDelegate::CreateLambda([&OtherTypeCount](const FReceivedNetworkMessage& Received)
+            {
+                ++OtherTypeCount;
+            }));
+
+    TestTrue(TEXT("FrameSync should have subscribers"), Manager.HasMessageSubscribers(ENetworkMessageType::FrameSync));
+    TestFalse(TEXT("Command should have no subscribers"), Manager.HasMessageSubscribers(ENetworkMessageType::Command));
+
+    Deliver(ENetworkMessageType::FrameSync, FramePayload, 1);
+    TestEqual(TEXT("First subscriber should receive the message"), FirstCount, 1);
+    TestEqual(TEXT("Second subscriber should receive the message"), SecondCount, 1);
+    TestEqual(TEXT("Other message types should not be dispatched"), OtherTypeCount, 0);
+    TestTrue(TEXT("Subscriber should get the payload without the header"), bPayloadMatches);
+    TestTrue(TEXT("Undiscovered sender should be identified by its registered endpoint string"), bSenderMatches);
+
+    // 구독 해제 후에는 남은 구독자만 호출됨
+    Manager.UnsubscribeMessage(ENetworkMessageType::FrameSync, FirstHandle);
+    Deliver(ENetworkMessageType::FrameSync, FramePayload, 2);
+    TestEqual(TEXT("Unsubscribed handler should not be called"), FirstCount, 1);
+    TestEqual(TEXT("Remaining subscriber should still be called"), SecondCount, 2);
+
+    // 기존 단일 핸들러 API는 페이로드 복사본을 받고, 다시 등록하면 이전 핸들러를 대체함
+    int32 LegacyFirstCount = 0;
+    int32 LegacySecondCount = 0;
+    Manager.RegisterMessageHandler([&LegacyFirstCount](const FString& SenderId, const TArray<uint8>& Data) { ++LegacyFirstCount; });
+    Manager.RegisterMessageHandler([&LegacySecondCount](const FString& SenderId, const TArray<uint8>& Data) { ++LegacySecondCount; });
+
+    Deliver(ENetworkMessageType::SettingsSync, FramePayload, 3);
+    TestEqual(TEXT("Replaced legacy handler should not be called"), LegacyFirstCount, 0);
+    TestEqual(TEXT("Legacy handler should receive settings messages"), LegacySecondCount, 1);
+    TestEqual(TEXT("Typed subscriber should also receive settings messages"), OtherTypeCount, 1);
+
+    return true;
+}
@@ -0,0 +1,51 @@
+﻿// Copyright Your Company. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Common/UdpSocketBuilder.h"
+#include "Sockets.h"
+#include "SocketSubsystem.h"
+
+/**
+ * 네트워크 테스트 공용 도우미
+ * 여러 테스트 파일이 함께 쓰는 루프백 소켓과 통계 함수만 둠 (한 파일에서만 쓰는 도우미는 해당 파일에 둠)
+ */
+namespace NetworkManagerTestUtils
+{
+    /** 루프백에 임의 포트로 바인딩된 UDP 소켓 생성 */
+    inline FSocket* CreateLoopbackSocket(const FString& Description)
+    {
+        return FUdpSocketBuilder(Description)
+            .AsNonBlocking()
+            .AsReusable()
+            .BoundToAddress(FIPv4Address(127, 0, 0, 1))
+            .BoundToPort(0)
+            .WithReceiveBufferSize(2 * 1024 * 1024)
+            .Build();
+    }
+
+    /** 소켓 파괴 */
+    inline void DestroySocket(FSocket*& Socket)
+    {
+        if (Socket)
+        {
+            Socket->Close();
+            ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->DestroySocket(Socket);
+            Socket = nullptr;
+        }
+    }
+
+    /** 정렬된 샘플에서 백분위 값 반환 (0.0 ~ 1.0) */
+    inline double GetPercentile(TArray<double> Samples, double Percentile)
+    {
+        if (Samples.Num() == 0)
+        {
+            return 0.0;
+        }
+
+        Samples.Sort();
+        const int32 Index = FMath::Clamp(FMath::CeilToInt(Percentile * Samples.Num()) - 1, 0, Samples.Num() - 1);
+        return Samples[Index];
+    }
+}
@@ -0,0 +1,48 @@
+﻿// PeerRegistryTest.cpp
+#include "Misc/AutomationTest.h"
+#include "FNetworkManager.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNetworkManagerPeerRegistryTest, "MultiServerSync.NetworkManager.PeerRegistry", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+bool FNetworkManagerPeerRegistryTest::RunTest(const FString& Parameters)
+{
+    FPeerRegistry Registry;
+
+    const FIPv4Endpoint EndpointA(FIPv4Address(10, 0, 0, 1), 7001);
+    const FIPv4Endpoint EndpointB(FIPv4Address(10, 0, 0, 2), 7001);
+    const FIPv4Endpoint EndpointC(FIPv4Address(10, 0, 0, 1), 7002);
+
+    // 인덱스는 0부터 조밀하게 할당되고 같은 엔드포인트는 같은 인덱스를 받음
+    const FPeerId PeerA = Registry.FindOrAdd(EndpointA);
+    const FPeerId PeerB = Registry.FindOrAdd(EndpointB);
+    TestEqual(TEXT("First peer should get index 0"), PeerA, static_cast<FPeerId>(0));
+    TestEqual(TEXT("Second peer should get index 1"), PeerB, static_cast<FPeerId>(1));
+    TestEqual(TEXT("Known endpoint should keep its index"), Registry.FindOrAdd(EndpointA), PeerA);
+    TestEqual(TEXT("Different port should be a different peer"), Registry.Find(EndpointC), INVALID_PEER_ID);
+    TestEqual(TEXT("Endpoint should round-trip"), Registry.GetEndpoint(PeerB), EndpointB);
+
+    // 피어별 상태는 처음 사용할 때만 생성
+    TestNull(TEXT("Latency stats should not exist before the first sample"), Registry.FindLatencyStats(PeerA));
+    Registry.FindOrAddLatencyStats(PeerA).AddRTTSample(5.0);
+    TestNotNull(TEXT("Latency stats should exist after the first sample"), Registry.FindLatencyStats(EndpointA));
+    TestNull(TEXT("Other peers should not get latency stats"), Registry.FindLatencyStats(PeerB));
+
+    Registry.FindOrAddSequenceTracker(PeerB, ESequenceChannel::Unreliable, true);
+    TestTrue(TEXT("Sequence tracker should keep the order setting"), Registry.FindSequenceTracker(PeerB, ESequenceChannel::Unreliable)->bOrderGuaranteed);
+
+    // 서버 ID가 설정되면 표시용 ID로 사용
+    Registry.SetServerId(PeerB, TEXT("HostB"));
+    TestEqual(TEXT("Display id should use the server id"), Registry.GetDisplayId(PeerB), FString(TEXT("HostB")));
+
+    // 제거된 인덱스는 상태가 초기화된 채로 재사용됨
+    Registry.Remove(PeerB);
+    TestFalse(TEXT("Removed peer should be invalid"), Registry.IsValid(PeerB));
+    TestEqual(TEXT("Removed endpoint should not be found"), Registry.Find(EndpointB), INVALID_PEER_ID);
+
+    const FPeerId PeerC = Registry.FindOrAdd(EndpointC);
+    TestEqual(TEXT("Freed index should be reused"), PeerC, PeerB);
+    TestNull(TEXT("Reused index should not inherit the sequence tracker"), Registry.FindSequenceTracker(PeerC, ESequenceChannel::Unreliable));
+    TestEqual(TEXT("Reused index should get its own display id"), Registry.GetDisplayId(PeerC), EndpointC.ToString());
+    TestEqual(TEXT("Registry should track two peers"), Registry.Num(), 2);
+
+    return true;
+}
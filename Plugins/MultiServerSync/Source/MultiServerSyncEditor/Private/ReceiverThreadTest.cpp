@@ -0,0 +1,595 @@
+﻿// ReceiverThreadTest.cpp
+#include "Misc/AutomationTest.h"
+#include "FNetworkManager.h"
+#include "NetworkTestUtils.h"
+#include "HAL/RunnableThread.h"
+#include "HAL/PlatformTime.h"
+#include "Async/Async.h"
+
+namespace NetworkManagerTestUtils
+{
+    /**
+     * 지정한 수신 대기 방식으로 루프백 에코 왕복 시간 측정
+     * 에코 측과 클라이언트 측 모두 FNetworkReceiverWorker를 사용하므로 수신 경로의 지연이 두 번 포함됨
+     */
+    static bool MeasureLoopbackRTT(EReceiverWaitMode WaitMode, int32 Iterations, TArray<double>& OutRTTMicroseconds)
+    {
+        FSocket* EchoSocket = CreateLoopbackSocket(TEXT("MultiServerSyncTest_Echo"));
+        FSocket* ClientSocket = CreateLoopbackSocket(TEXT("MultiServerSyncTest_Client"));
+        if (!EchoSocket || !ClientSocket)
+        {
+            DestroySocket(EchoSocket);
+            DestroySocket(ClientSocket);
+            return false;
+        }
+
+        FEvent* ReplyEvent = FPlatformProcess::GetSynchEventFromPool(false);
+        TAtomic<double> ReplyTime(0.0);
+
+        // 에코 측: 받은 데이터그램을 그대로 되돌려 보냄
+        FNetworkReceiverWorker* EchoWorker = new FNetworkReceiverWorker(EchoSocket,
+            [EchoSocket](const TArray<uint8>& Data, const FIPv4Endpoint& Sender)
+            {
+                int32 BytesSent = 0;
+                EchoSocket->SendTo(Data.GetData(), Data.Num(), BytesSent, *Sender.ToInternetAddr());
+            }, WaitMode);
+
+        // 클라이언트 측: 응답 도착 시각 기록
+        FNetworkReceiverWorker* ClientWorker = new FNetworkReceiverWorker(ClientSocket,
+            [&ReplyTime, ReplyEvent](const TArray<uint8>& Data, const FIPv4Endpoint& Sender)
+            {
+                ReplyTime = FPlatformTime::Seconds();
+                ReplyEvent->Trigger();
+            }, WaitMode);
+
+        FRunnableThread* EchoThread = FRunnableThread::Create(EchoWorker, TEXT("MultiServerSyncTest_EchoThread"));
+        FRunnableThread* ClientThread = FRunnableThread::Create(ClientWorker, TEXT("MultiServerSyncTest_ClientThread"));
+
+        TSharedRef<FInternetAddr> EchoAddr = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->CreateInternetAddr();
+        EchoAddr->SetIp(FIPv4Address(127, 0, 0, 1).Value);
+        EchoAddr->SetPort(EchoSocket->GetPortNo());
+
+        // 핑과 같은 크기의 페이로드
+        TArray<uint8> Payload;
+        Payload.SetNumZeroed(sizeof(FNetworkMessageHeader) + 32);
+
+        OutRTTMicroseconds.Reset(Iterations);
+        for (int32 Index = 0; Index < Iterations; ++Index)
+        {
+            int32 BytesSent = 0;
+            const double SendTime = FPlatformTime::Seconds();
+            ClientSocket->SendTo(Payload.GetData(), Payload.Num(), BytesSent, *EchoAddr);
+
+            if (ReplyEvent->Wait(1000))
+            {
+                OutRTTMicroseconds.Add((ReplyTime.Load() - SendTime) * 1000000.0);
+            }
+        }
+
+        // 스레드 종료 (Kill이 Stop()을 호출하고 종료를 기다림)
+        EchoThread->Kill(true);
+        ClientThread->Kill(true);
+        delete EchoThread;
+        delete ClientThread;
+        delete EchoWorker;
+        delete ClientWorker;
+
+        FPlatformProcess::ReturnSynchEventToPool(ReplyEvent);
+        DestroySocket(EchoSocket);
+        DestroySocket(ClientSocket);
+
+        return OutRTTMicroseconds.Num() == Iterations;
+    }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNetworkReceiverWaitModeBenchmark, "MultiServerSync.NetworkManager.Benchmark.ReceiverWaitMode", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+bool FNetworkReceiverWaitModeBenchmark::RunTest(const FString& Parameters)
+{
+    using namespace NetworkManagerTestUtils;
+
+    const int32 Iterations = 500;
+
+    TArray<double> PollingRTT;
+    TArray<double> EventDrivenRTT;
+
+    TestTrue(TEXT("SleepPolling loopback RTT measurement should complete"),
+        MeasureLoopbackRTT(EReceiverWaitMode::SleepPolling, Iterations, PollingRTT));
+    TestTrue(TEXT("EventDriven loopback RTT measurement should complete"),
+        MeasureLoopbackRTT(EReceiverWaitMode::EventDriven, Iterations, EventDrivenRTT));
+
+    AddInfo(FString::Printf(TEXT("SleepPolling: median %.1f us, p99 %.1f us (%d samples)"),
+        GetPercentile(PollingRTT, 0.5), GetPercentile(PollingRTT, 0.99), PollingRTT.Num()));
+    AddInfo(FString::Printf(TEXT("EventDriven:  median %.1f us, p99 %.1f us (%d samples)"),
+        GetPercentile(EventDrivenRTT, 0.5), GetPercentile(EventDrivenRTT, 0.99), EventDrivenRTT.Num()));
+
+    return true;
+}
+
+namespace NetworkManagerTestUtils
+{
+    /** 샤드 수신 폭주 결과 */
+    struct FShardFloodResult
+    {
+        int64 ReceivedPackets = 0;
+        int64 SentPackets = 0;
+        double PacketsPerSecond = 0.0;
+        int64 OutOfOrderPackets = 0;
+        int32 PeersSplitAcrossShards = 0;
+        TArray<int64> PacketsPerShard;
+    };
+
+    /** 샤드별 수신 상태 (해당 샤드의 수신 스레드에서만 갱신) */
+    struct FShardReceiveState
+    {
+        TMap<FIPv4Endpoint, uint16> LastSequence;
+        int64 ReceivedPackets = 0;
+        int64 OutOfOrderPackets = 0;
+        double LastReceiveTime = 0.0;
+    };
+
+    /**
+     * SO_REUSEPORT로 같은 포트에 ShardCount개의 소켓을 열고 샤드마다 수신 스레드를 둔 뒤,
+     * PeerCount개의 시뮬레이션 피어가 루프백으로 보낸 메시지를 받아 처리량과 피어별 순서 유지 여부 측정
+     */
+    static bool MeasureShardedFlood(int32 ShardCount, int32 PeerCount, int32 PacketsPerPeer, FShardFloodResult& OutResult)
+    {
+        const FIPv4Address Loopback(127, 0, 0, 1);
+
+        // 첫 샤드는 임의 포트에 바인딩하고 나머지 샤드는 같은 포트에 합류
+        TArray<TUniquePtr<INetworkTransport>> Shards;
+        for (int32 ShardIndex = 0; ShardIndex < ShardCount; ++ShardIndex)
+        {
+            const uint16 ShardPort = ShardIndex == 0 ? 0 : Shards[0]->GetLocalPort();
+            TUniquePtr<INetworkTransport> Shard = INetworkTransport::Create(EReceiveBackend::BatchRecvMmsg, Loopback, ShardPort,
+                FString::Printf(TEXT("MultiServerSyncTest_Shard_%d"), ShardIndex), true);
+            if (!Shard)
+            {
+                return false;
+            }
+            Shards.Add(MoveTemp(Shard));
+        }
+
+        const FIPv4Endpoint Target(Loopback, Shards[0]->GetLocalPort());
+
+        // 피어마다 송신 소켓을 따로 두어 발신 포트가 모두 다르도록 함
+        TArray<TUniquePtr<INetworkTransport>> Peers;
+        for (int32 PeerIndex = 0; PeerIndex < PeerCount; ++PeerIndex)
+        {
+            TUniquePtr<INetworkTransport> Peer = INetworkTransport::Create(EReceiveBackend::SingleRead, Loopback, 0,
+                FString::Printf(TEXT("MultiServerSyncTest_Peer_%d"), PeerIndex));
+            if (!Peer)
+            {
+                return false;
+            }
+            Peers.Add(MoveTemp(Peer));
+        }
+
+        TArray<FShardReceiveState> ShardStates;
+        ShardStates.SetNum(ShardCount);
+        TAtomic<int64> TotalReceived(0);
+
+        TArray<FNetworkReceiverWorker*> Workers;
+        TArray<FRunnableThread*> Threads;
+        for (int32 ShardIndex = 0; ShardIndex < ShardCount; ++ShardIndex)
+        {
+            FNetworkReceiverWorker* Worker = new FNetworkReceiverWorker(Shards[ShardIndex].Get(),
+                [&State = ShardStates[ShardIndex], &TotalReceived](const FReceivedDatagram* Datagrams, int32 Count)
+                {
+                    // 수신 스레드에서 하는 일과 같은 파싱 후 피어별 시퀀스 확인
+                    for (int32 Index = 0; Index < Count; ++Index)
+                    {
+                        FNetworkMessageView Message;
+                        if (!Message.Parse(TArrayView<const uint8>(Datagrams[Index].Data, Datagrams[Index].Size)))
+                        {
+                            continue;
+                        }
+
+                        uint16& LastSequence = State.LastSequence.FindOrAdd(Datagrams[Index].Sender, 0);
+                        if (Message.GetSequenceNumber() <= LastSequence)
+                        {
+                            State.OutOfOrderPackets++;
+                        }
+                        LastSequence = Message.GetSequenceNumber();
+                        State.ReceivedPackets++;
+                    }
+
+                    State.LastReceiveTime = FPlatformTime::Seconds();
+                    TotalReceived += Count;
+                }, EReceiverWaitMode::EventDriven);
+
+            Workers.Add(Worker);
+            Threads.Add(FRunnableThread::Create(Worker, *FString::Printf(TEXT("MultiServerSyncTest_ShardThread_%d"), ShardIndex)));
+        }
+
+        // 송신 스레드 4개가 피어를 나눠 맡아 피어별로 1부터 증가하는 시퀀스를 번갈아 전송
+        const int32 SenderThreadCount = FMath::Min(4, PeerCount);
+        TAtomic<int64> TotalSent(0);
+        const double StartTime = FPlatformTime::Seconds();
+
+        TArray<TFuture<void>> Senders;
+        for (int32 SenderIndex = 0; SenderIndex < SenderThreadCount; ++SenderIndex)
+        {
+            Senders.Add(Async(EAsyncExecution::Thread, [&Peers, &TotalSent, Target, SenderIndex, SenderThreadCount, PacketsPerPeer]()
+                {
+                    TArray<uint8> Payload;
+                    Payload.SetNumZeroed(8);
+
+                    for (int32 Sequence = 1; Sequence <= PacketsPerPeer; ++Sequence)
+                    {
+                        for (int32 PeerIndex = SenderIndex; PeerIndex < Peers.Num(); PeerIndex += SenderThreadCount)
+                        {
+                            FNetworkMessage Message(ENetworkMessageType::Data, Payload);
+                            Message.SetSequenceNumber(static_cast<uint16>(Sequence));
+                            const TArray<uint8> Data = Message.Serialize();
+
+                            if (Peers[PeerIndex]->SendTo(Data.GetData(), Data.Num(), Target))
+                            {
+                                TotalSent++;
+                            }
+                        }
+                    }
+                }));
+        }
+
+        for (TFuture<void>& Sender : Senders)
+        {
+            Sender.Wait();
+        }
+
+        // 수신이 멈출 때까지 대기
+        int64 LastCount = -1;
+        while (LastCount != TotalReceived.Load())
+        {
+            LastCount = TotalReceived.Load();
+            FPlatformProcess::Sleep(0.2f);
+        }
+
+        // 모든 샤드에 중지를 먼저 요청해 대기 시간 초과가 겹치도록 함
+        for (FNetworkReceiverWorker* Worker : Workers)
+        {
+            Worker->Stop();
+        }
+        for (int32 ShardIndex = 0; ShardIndex < ShardCount; ++ShardIndex)
+        {
+            Threads[ShardIndex]->Kill(true);
+            delete Threads[ShardIndex];
+            delete Workers[ShardIndex];
+        }
+
+        // 결과 집계 (스레드가 모두 종료된 뒤이므로 샤드 상태를 안전하게 읽을 수 있음)
+        TMap<FIPv4Endpoint, int32> PeerShards;
+        double LastReceiveTime = StartTime;
+        for (int32 ShardIndex = 0; ShardIndex < ShardCount; ++ShardIndex)
+        {
+            const FShardReceiveState& State = ShardStates[ShardIndex];
+            OutResult.ReceivedPackets += State.ReceivedPackets;
+            OutResult.OutOfOrderPackets += State.OutOfOrderPackets;
+            OutResult.PacketsPerShard.Add(State.ReceivedPackets);
+            LastReceiveTime = FMath::Max(LastReceiveTime, State.LastReceiveTime);
+
+            for (const TPair<FIPv4Endpoint, uint16>& Pair : State.LastSequence)
+            {
+                if (const int32* ExistingShard = PeerShards.Find(Pair.Key))
+                {
+                    if (*ExistingShard != ShardIndex)
+                    {
+                        OutResult.PeersSplitAcrossShards++;
+                    }
+                }
+                else
+                {
+                    PeerShards.Add(Pair.Key, ShardIndex);
+                }
+            }
+        }
+
+        const double Elapsed = LastReceiveTime - StartTime;
+        OutResult.SentPackets = TotalSent.Load();
+        OutResult.PacketsPerSecond = Elapsed > 0.0 ? OutResult.ReceivedPackets / Elapsed : 0.0;
+
+        for (TUniquePtr<INetworkTransport>& Peer : Peers)
+        {
+            Peer->Close();
+        }
+        for (TUniquePtr<INetworkTransport>& Shard : Shards)
+        {
+            Shard->Close();
+        }
+
+        return OutResult.ReceivedPackets > 0;
+    }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNetworkReceiveShardBenchmark, "MultiServerSync.NetworkManager.Benchmark.ReceiveShards", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+bool FNetworkReceiveShardBenchmark::RunTest(const FString& Parameters)
+{
+    using namespace NetworkManagerTestUtils;
+
+    if (!INetworkTransport::SupportsReusePort())
+    {
+        AddInfo(TEXT("SO_REUSEPORT is not supported on this platform, skipping shard benchmark"));
+        return true;
+    }
+
+    const int32 PeerCount = 32;
+    const int32 PacketsPerPeer = 5000;
+    const int32 ShardCounts[] = { 1, 2, 4 };
+
+    for (int32 ShardCount : ShardCounts)
+    {
+        FShardFloodResult Result;
+        TestTrue(FString::Printf(TEXT("%d-shard flood should receive packets"), ShardCount),
+            MeasureShardedFlood(ShardCount, PeerCount, PacketsPerPeer, Result));
+
+        FString Distribution;
+        for (int64 ShardPackets : Result.PacketsPerShard)
+        {
+            Distribution += FString::Printf(TEXT(" %lld"), ShardPackets);
+        }
+
+        AddInfo(FString::Printf(TEXT("%d shard(s): %lld/%lld packets, %.0f pps, per shard:%s"),
+            ShardCount, Result.ReceivedPackets, Result.SentPackets, Result.PacketsPerSecond, *Distribution));
+
+        TestEqual(FString::Printf(TEXT("%d-shard: packets from one peer should stay in order"), ShardCount), Result.OutOfOrderPackets, int64(0));
+        TestEqual(FString::Printf(TEXT("%d-shard: each peer should be received by a single shard"), ShardCount), Result.PeersSplitAcrossShards, 0);
+    }
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNetworkReactorTest, "MultiServerSync.NetworkManager.Reactor", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+bool FNetworkReactorTest::RunTest(const FString& Parameters)
+{
+    const FIPv4Address Loopback(127, 0, 0, 1);
+
+    // 탐색/데이터/시간 동기화 소켓을 흉내 낸 세 전송 계층을 한 리액터에 등록
+    TArray<TUniquePtr<INetworkTransport>> Transports;
+    FNetworkReactor Reactor;
+    for (int32 Index = 0; Index < 3; ++Index)
+    {
+        Transports.Add(INetworkTransport::Create(EReceiveBackend::SingleRead, Loopback, 0, FString::Printf(TEXT("MultiServerSyncTest_Reactor_%d"), Index)));
+        if (!TestNotNull(TEXT("Transport should be created"), Transports.Last().Get()))
+        {
+            return false;
+        }
+        TestEqual(TEXT("Reactor index should follow registration order"), Reactor.Add(Transports.Last().Get()), Index);
+    }
+
+    AddInfo(FString::Printf(TEXT("Multiplexer: %s"), Reactor.GetMultiplexerName()));
+#if PLATFORM_LINUX
+    TestEqual(TEXT("Linux reactor should multiplex with epoll"), FString(Reactor.GetMultiplexerName()), FString(TEXT("epoll")));
+#endif
+
+    TestEqual(TEXT("Idle reactor should report no ready sockets"), Reactor.Wait(FTimespan::FromMilliseconds(10)), 0u);
+
+    // 두 번째와 세 번째 전송 계층에만 데이터그램 전송
+    uint8 Payload = 42;
+    Transports[0]->SendTo(&Payload, 1, FIPv4Endpoint(Loopback, Transports[1]->GetLocalPort()));
+    Transports[0]->SendTo(&Payload, 1, FIPv4Endpoint(Loopback, Transports[2]->GetLocalPort()));
+
+    uint32 ReadyMask = 0;
+    const double Deadline = FPlatformTime::Seconds() + 1.0;
+    while (ReadyMask != 0x6u && FPlatformTime::Seconds() < Deadline)
+    {
+        ReadyMask |= Reactor.Wait(FTimespan::FromMilliseconds(100));
+    }
+
+    TestEqual(TEXT("Reactor should report exactly the sockets that received data"), ReadyMask, 0x6u);
+
+    FReceivedDatagram Batch[INetworkTransport::MAX_RECEIVE_BATCH];
+    TestEqual(TEXT("Ready socket should have one datagram"), Transports[1]->ReceiveBatch(Batch, INetworkTransport::MAX_RECEIVE_BATCH), 1);
+    TestEqual(TEXT("Ready socket should have one datagram"), Transports[2]->ReceiveBatch(Batch, INetworkTransport::MAX_RECEIVE_BATCH), 1);
+    Batch[0].Buffer.SafeRelease();
+
+#if PLATFORM_LINUX
+    // 웨이크업은 소켓을 거치지 않고 대기 중인 리액터를 바로 깨우며 준비된 전송 계층으로 보고하지 않음
+    TestTrue(TEXT("Epoll reactor should support wake-up"), Reactor.Wake());
+    const double WakeStart = FPlatformTime::Seconds();
+    TestEqual(TEXT("Wake-up should not report a ready socket"), Reactor.Wait(FTimespan::FromMilliseconds(1000)), 0u);
+    TestTrue(TEXT("Wake-up should end the wait before the timeout"), FPlatformTime::Seconds() - WakeStart < 0.5);
+    TestEqual(TEXT("Wake-up should be consumed by one wait"), Reactor.Poll(), 0u);
+#endif
+
+    for (TUniquePtr<INetworkTransport>& Transport : Transports)
+    {
+        Transport->Close();
+    }
+
+    return true;
+}
+
+namespace NetworkManagerTestUtils
+{
+    /** 폭주 트래픽과 시간 동기화 프로브를 구분하는 태그 */
+    static constexpr uint8 FLOOD_TAG = 0;
+    static constexpr uint8 PROBE_TAG = 1;
+
+    /**
+     * 탐색 폭주가 진행되는 동안 시간 동기화 프로브의 수신 지연 측정
+     * bSeparateSockets가 true면 프로브를 전용 소켓으로 보내고 수신 스레드 하나가 리액터로 두 소켓을 함께 감시,
+     * false면 폭주와 같은 소켓으로 보내 같은 수신 버퍼에서 대기
+     */
+    static bool MeasureProbeLatencyUnderFlood(bool bSeparateSockets, int32 FloodPacketCount, int32 ProbeCount, TArray<double>& OutLatencyMicroseconds)
+    {
+        const FIPv4Address Loopback(127, 0, 0, 1);
+
+        TUniquePtr<INetworkTransport> FloodSink = INetworkTransport::Create(EReceiveBackend::BatchRecvMmsg, Loopback, 0, TEXT("MultiServerSyncTest_FloodSink"));
+        TUniquePtr<INetworkTransport> ProbeSink = bSeparateSockets
+            ? INetworkTransport::Create(EReceiveBackend::BatchRecvMmsg, Loopback, 0, TEXT("MultiServerSyncTest_ProbeSink"))
+            : nullptr;
+        TUniquePtr<INetworkTransport> FloodSender = INetworkTransport::Create(EReceiveBackend::SingleRead, Loopback, 0, TEXT("MultiServerSyncTest_FloodSender"));
+        TUniquePtr<INetworkTransport> ProbeSender = INetworkTransport::Create(EReceiveBackend::SingleRead, Loopback, 0, TEXT("MultiServerSyncTest_ProbeSender"));
+        if (!FloodSink || (bSeparateSockets && !ProbeSink) || !FloodSender || !ProbeSender)
+        {
+            return false;
+        }
+
+        const FIPv4Endpoint FloodTarget(Loopback, FloodSink->GetLocalPort());
+        const FIPv4Endpoint ProbeTarget(Loopback, bSeparateSockets ? ProbeSink->GetLocalPort() : FloodSink->GetLocalPort());
+
+        // 수신 스레드에서만 갱신하고 스레드 종료 후 읽음
+        TArray<double> Latencies;
+        Latencies.Reserve(ProbeCount);
+        TAtomic<int32> ReceivedProbes(0);
+
+        FDatagramBatchHandler Handler = [&Latencies, &ReceivedProbes](const FReceivedDatagram* Datagrams, int32 Count)
+            {
+                const double Now = FPlatformTime::Seconds();
+                for (int32 Index = 0; Index < Count; ++Index)
+                {
+                    if (Datagrams[Index].Size >= 1 + int32(sizeof(double)) && Datagrams[Index].Data[0] == PROBE_TAG)
+                    {
+                        double SendTime = 0.0;
+                        FMemory::Memcpy(&SendTime, Datagrams[Index].Data + 1, sizeof(double));
+                        Latencies.Add((Now - SendTime) * 1000000.0);
+                        ReceivedProbes++;
+                    }
+                }
+            };
+
+        // 전용 소켓을 먼저 등록해 두 소켓이 함께 준비되면 프로브를 먼저 처리
+        FNetworkReceiverWorker* Worker = new FNetworkReceiverWorker(bSeparateSockets ? ProbeSink.Get() : FloodSink.Get(), Handler, EReceiverWaitMode::EventDriven);
+        if (bSeparateSockets)
+        {
+            Worker->AddTransport(FloodSink.Get(), Handler);
+        }
+
+        FRunnableThread* Thread = FRunnableThread::Create(Worker, TEXT("MultiServerSyncTest_ReactorThread"));
+
+        // 탐색 메시지 크기의 폭주 트래픽
+        TFuture<void> Flood = Async(EAsyncExecution::Thread, [&FloodSender, FloodTarget, FloodPacketCount]()
+            {
+                TArray<uint8> FloodPayload;
+                FloodPayload.SetNumZeroed(sizeof(FNetworkMessageHeader) + 64);
+                FloodPayload[0] = FLOOD_TAG;
+                for (int32 Index = 0; Index < FloodPacketCount; ++Index)
+                {
+                    FloodSender->SendTo(FloodPayload.GetData(), FloodPayload.Num(), FloodTarget);
+                }
+            });
+
+        // 폭주 중에 일정 간격으로 송신 시각을 담은 프로브 전송
+        uint8 ProbePayload[1 + sizeof(double)];
+        ProbePayload[0] = PROBE_TAG;
+        for (int32 Index = 0; Index < ProbeCount; ++Index)
+        {
+            const double SendTime = FPlatformTime::Seconds();
+            FMemory::Memcpy(ProbePayload + 1, &SendTime, sizeof(double));
+            ProbeSender->SendTo(ProbePayload, sizeof(ProbePayload), ProbeTarget);
+            FPlatformProcess::Sleep(0.0005f);
+        }
+
+        Flood.Wait();
+
+        // 남은 프로브가 도착할 때까지 잠시 대기 (수신 버퍼가 넘쳐 버려진 프로브는 제외)
+        const double Deadline = FPlatformTime::Seconds() + 2.0;
+        while (ReceivedProbes.Load() < ProbeCount && FPlatformTime::Seconds() < Deadline)
+        {
+            FPlatformProcess::Sleep(0.01f);
+        }
+
+        Thread->Kill(true);
+        delete Thread;
+        delete Worker;
+
+        OutLatencyMicroseconds = MoveTemp(Latencies);
+
+        FloodSender->Close();
+        ProbeSender->Close();
+        FloodSink->Close();
+        if (ProbeSink)
+        {
+            ProbeSink->Close();
+        }
+
+        return OutLatencyMicroseconds.Num() > 0;
+    }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNetworkReactorIsolationBenchmark, "MultiServerSync.NetworkManager.Benchmark.ReactorIsolation", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+bool FNetworkReactorIsolationBenchmark::RunTest(const FString& Parameters)
+{
+    using namespace NetworkManagerTestUtils;
+
+    const int32 FloodPacketCount = 200000;
+    const int32 ProbeCount = 500;
+
+    TArray<double> SharedLatency;
+    TArray<double> SeparateLatency;
+
+    TestTrue(TEXT("Shared-socket probes should arrive"),
+        MeasureProbeLatencyUnderFlood(false, FloodPacketCount, ProbeCount, SharedLatency));
+    TestTrue(TEXT("Dedicated-socket probes should arrive"),
+        MeasureProbeLatencyUnderFlood(true, FloodPacketCount, ProbeCount, SeparateLatency));
+
+    AddInfo(FString::Printf(TEXT("Shared socket:    %d/%d probes, median %.1f us, p99 %.1f us"),
+        SharedLatency.Num(), ProbeCount, GetPercentile(SharedLatency, 0.5), GetPercentile(SharedLatency, 0.99)));
+    AddInfo(FString::Printf(TEXT("Dedicated socket: %d/%d probes, median %.1f us, p99 %.1f us"),
+        SeparateLatency.Num(), ProbeCount, GetPercentile(SeparateLatency, 0.5), GetPercentile(SeparateLatency, 0.99)));
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNetworkReceiverProfileBenchmark, "MultiServerSync.NetworkManager.Benchmark.ReceiverProfiles", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+bool FNetworkReceiverProfileBenchmark::RunTest(const FString& Parameters)
+{
+    const int32 PacketCount = 1000;
+    const EReceiverThreadProfile Profiles[] = { EReceiverThreadProfile::Standard, EReceiverThreadProfile::LowLatency };
+
+    for (const EReceiverThreadProfile Profile : Profiles)
+    {
+        const TCHAR* ProfileName = Profile == EReceiverThreadProfile::LowLatency ? TEXT("LowLatency") : TEXT("Standard");
+
+        TUniquePtr<INetworkTransport> Receiver = INetworkTransport::Create(EReceiveBackend::BatchRecvMmsg, FIPv4Address(127, 0, 0, 1), 0, TEXT("MultiServerSyncTest_ProfileReceiver"));
+        TUniquePtr<INetworkTransport> Sender = INetworkTransport::Create(EReceiveBackend::SingleRead, FIPv4Address(127, 0, 0, 1), 0, TEXT("MultiServerSyncTest_ProfileSender"));
+        TestNotNull(TEXT("Receiver should be created"), Receiver.Get());
+        TestNotNull(TEXT("Sender should be created"), Sender.Get());
+        if (!Receiver || !Sender)
+        {
+            return false;
+        }
+
+        TAtomic<int64> ReceivedPackets(0);
+        FNetworkReceiverWorker* Worker = new FNetworkReceiverWorker(Receiver.Get(),
+            [&](const FReceivedDatagram* Datagrams, int32 Count)
+            {
+                ReceivedPackets += Count;
+            }, EReceiverWaitMode::EventDriven);
+
+        // 테스트 머신의 코어 배치를 모르므로 코어 고정은 하지 않음
+        Worker->SetThreadSettings(FReceiverThreadSettings::FromProfile(Profile));
+        FRunnableThread* Thread = FRunnableThread::Create(Worker, TEXT("MultiServerSyncTest_ProfileThread"));
+
+        // 시간 동기화 트래픽처럼 간격을 두고 하나씩 전송 (스핀 구간 안팎에 고루 도착하도록 간격을 흔듦)
+        const FIPv4Endpoint Target(FIPv4Address(127, 0, 0, 1), Receiver->GetLocalPort());
+        FRandomStream Random(4321);
+        uint8 Payload[32] = { 0 };
+        for (int32 Index = 0; Index < PacketCount; ++Index)
+        {
+            Sender->SendTo(Payload, sizeof(Payload), Target);
+            FPlatformProcess::Sleep(Random.FRandRange(0.0f, 0.0005f));
+        }
+
+        const double Deadline = FPlatformTime::Seconds() + 2.0;
+        while (ReceivedPackets.Load() < PacketCount && FPlatformTime::Seconds() < Deadline)
+        {
+            FPlatformProcess::Sleep(0.01f);
+        }
+
+        Thread->Kill(true);
+        const FLatencyHistogram Histogram = Worker->GetWakeupHistogram();
+        delete Thread;
+        delete Worker;
+
+        AddInfo(FString::Printf(TEXT("%s: wake-up p50 <%.0f us, p99 <%.0f us (%llu samples) [%s]"),
+            ProfileName, Histogram.GetPercentile(0.5), Histogram.GetPercentile(0.99), Histogram.GetCount(), *Histogram.ToString()));
+
+        TestTrue(FString::Printf(TEXT("%s: most datagrams should be received"), ProfileName), ReceivedPackets.Load() > PacketCount / 2);
+        TestTrue(FString::Printf(TEXT("%s: wake-up latency should be recorded"), ProfileName), Histogram.GetCount() > 0);
+
+        Receiver->Close();
+        Sender->Close();
+    }
+
+    return true;
+}
@@ -0,0 +1,344 @@
+﻿// ReliableDeliveryTest.cpp
+#include "Misc/AutomationTest.h"
+#include "FNetworkManager.h"
+#include "HAL/PlatformTime.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNetworkRetransmissionTimeoutTest, "MultiServerSync.NetworkManager.RetransmissionTimeout", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+bool FNetworkRetransmissionTimeoutTest::RunTest(const FString& Parameters)
+{
+    // RFC 6298: 첫 샘플은 SRTT = R, RTTVAR = R / 2, 이후 1/8, 1/4 가중치로 평활
+    FNetworkLatencyStats Stats;
+    TestTrue(TEXT("No timeout before the first sample"), Stats.GetRetransmissionTimeout(0.0) < 0.0);
+
+    Stats.AddRTTSample(10.0);
+    TestEqual(TEXT("First sample SRTT"), Stats.SmoothedRTT, 10.0);
+    TestEqual(TEXT("First sample RTTVAR"), Stats.RTTVariation, 5.0);
+    TestEqual(TEXT("First sample RTO"), Stats.GetRetransmissionTimeout(0.0), 30.0);
+
+    Stats.AddRTTSample(20.0);
+    TestEqual(TEXT("Second sample SRTT"), Stats.SmoothedRTT, 11.25);
+    TestEqual(TEXT("Second sample RTTVAR"), Stats.RTTVariation, 6.25);
+    TestEqual(TEXT("Second sample RTO"), Stats.GetRetransmissionTimeout(0.0), 36.25);
+
+    // 안정된 LAN에서는 RTT 근처로 수렴하고 시계 단위가 하한이 됨
+    for (int32 Index = 0; Index < 200; ++Index)
+    {
+        Stats.AddRTTSample(0.3);
+    }
+    TestTrue(TEXT("SRTT should converge to the LAN RTT"), FMath::IsNearlyEqual(Stats.SmoothedRTT, 0.3, 0.01));
+    TestTrue(TEXT("RTO should shrink to the clock granularity"), Stats.GetRetransmissionTimeout(10.0) < 10.5);
+
+    // 이상치 필터가 평균으로 바꾸는 지연 증가도 타임아웃에는 반영됨
+    Stats.AddRTTSample(50.0);
+    TestTrue(TEXT("RTO should cover a delay spike"), Stats.GetRetransmissionTimeout(10.0) > 50.0);
+
+    // 매니저: 샘플이 없는 피어는 이전 고정 타임아웃을 쓰고, 백오프 후에도 상한을 넘지 않음
+    FNetworkManager Manager;
+    const FIPv4Endpoint Peer(FIPv4Address(127, 0, 0, 1), 7000);
+    TestEqual(TEXT("Fallback timeout without samples"), Manager.GetRetransmissionTimeout(Peer), 3.0);
+    TestEqual(TEXT("Backoff should be capped by the maximum"), Manager.GetRetransmissionTimeout(Peer, 3), 3.0);
+
+    Manager.SetRetransmissionTimeoutBounds(0.05, 0.4);
+    TestEqual(TEXT("Fallback should be clamped to the new maximum"), Manager.GetRetransmissionTimeout(Peer), 0.4);
+
+    Manager.SetRetransmissionTimeoutBounds(0.0, 0.0);
+    TestTrue(TEXT("Minimum should not go below the retry check interval"), Manager.GetMinRetransmissionTimeout() > 0.0);
+    TestTrue(TEXT("Maximum should not go below the minimum"), Manager.GetMaxRetransmissionTimeout() >= Manager.GetMinRetransmissionTimeout());
+
+    // 재전송할 때마다 두 배로 늘림
+    Manager.SetRetransmissionTimeoutBounds(0.05, 10.0);
+    TestEqual(TEXT("First retransmission doubles the timeout"), Manager.GetRetransmissionTimeout(Peer, 2), 6.0);
+    TestEqual(TEXT("Second retransmission is capped by the maximum"), Manager.GetRetransmissionTimeout(Peer, 3), 10.0);
+
+    return true;
+}
+
+namespace NetworkManagerTestUtils
+{
+    /** 시퀀스 랩어라운드 시뮬레이션의 네트워크 패킷 */
+    struct FSequenceSimPacket
+    {
+        int32 PeerIndex;
+        uint16 WireSequence;
+        uint32 TrueSequence;        // 검증용 (받는 쪽은 WireSequence만 사용)
+        TArray<uint8> AckBytes;     // 비어 있지 않으면 ACK 패킷
+    };
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNetworkSequenceWrapAroundTest, "MultiServerSync.NetworkManager.SequenceWrapAround", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+bool FNetworkSequenceWrapAroundTest::RunTest(const FString& Parameters)
+{
+    using namespace NetworkManagerTestUtils;
+
+    // 16비트 번호 복원: 기준값에 가장 가까운 번호, 보낸 번호에 대한 ACK는 마지막 번호 이하
+    TestEqual(TEXT("Extend across the 16-bit wrap"), FSequenceNumber::Extend(2, 0x1FFFEu), 0x20002u);
+    TestEqual(TEXT("Extend a late sequence before the 16-bit wrap"), FSequenceNumber::Extend(0xFFFE, 0x20002u), 0x1FFFEu);
+    TestEqual(TEXT("Extend across the 32-bit wrap"), FSequenceNumber::Extend(3, 0xFFFFFFF0u), 3u);
+    TestEqual(TEXT("Extend a late sequence before the 32-bit wrap"), FSequenceNumber::Extend(0xFFF0, 3u), 0xFFFFFFF0u);
+    TestEqual(TEXT("ACK for the latest sequence"), FSequenceNumber::ExtendBefore(5, 0x10005u), 0x10005u);
+    TestEqual(TEXT("ACK half a space behind"), FSequenceNumber::ExtendBefore(0x8006, 0x10005u), 0x8006u);
+    TestEqual(TEXT("ACK across the 32-bit wrap"), FSequenceNumber::ExtendBefore(0xFFFF, 2u), 0xFFFFFFFFu);
+    TestTrue(TEXT("Serial order across the 32-bit wrap"), FSequenceNumber::IsAfter(1u, 0xFFFFFFFFu) && !FSequenceNumber::IsAfter(0xFFFFFFFFu, 1u));
+
+    // 피어 4개에 신뢰성 메시지를 초당 10만 개 (1ms 틱마다 100개) 3초 동안 보냄
+    // 피어별 번호는 32비트 랩어라운드 직전에서 시작하고, 메시지와 ACK는 2% 손실, 1~3틱 지연(순서 뒤섞임)
+    const int32 PeerCount = 4;
+    const int32 MessagesPerTick = 100;
+    const int32 SendTicks = 3000;
+    const int32 MaxTicks = SendTicks + 2000;
+    const int32 RetransmitTicks = 8;
+    const int32 MaxDelayTicks = 3;
+    FRandomStream Random(20240611);
+
+    FPeerRegistry Sender;
+    FMessageSequenceTracker Receivers[PeerCount];
+    TSet<uint32> Delivered[PeerCount];
+    TArray<uint16> UnsentAcks[PeerCount];
+    FPeerId PeerIds[PeerCount];
+    uint32 StartSequences[PeerCount];
+    int32 SentCounts[PeerCount] = {};
+
+    // 대기 메시지: 키 -> 마지막 전송 틱
+    TMap<uint64, int32> Pending;
+    for (int32 Peer = 0; Peer < PeerCount; ++Peer)
+    {
+        PeerIds[Peer] = Sender.FindOrAdd(FIPv4Endpoint(FIPv4Address(10, 0, 0, 1 + Peer), 7000));
+        StartSequences[Peer] = 0xFFFFFFFFu - 10000u * (Peer + 1);
+        TestTrue(TEXT("Start sequence should be settable"), Sender.SetLastReliableSequence(PeerIds[Peer], StartSequences[Peer]));
+        Receivers[Peer].LastProcessedSequence = StartSequences[Peer];
+        Receivers[Peer].NextExpectedSequence = StartSequences[Peer] + 1;
+        Receivers[Peer].HighestReceivedSequence = StartSequences[Peer];
+    }
+
+    TArray<FSequenceSimPacket> InFlight[MaxDelayTicks + 1];
+    auto Transmit = [&](int32 Peer, uint32 Sequence, int32 Tick)
+        {
+            if (Random.FRand() >= 0.02f)
+            {
+                FSequenceSimPacket& Packet = InFlight[(Tick + 1 + Random.RandHelper(MaxDelayTicks)) % (MaxDelayTicks + 1)].AddDefaulted_GetRef();
+                Packet.PeerIndex = Peer;
+                Packet.WireSequence = FSequenceNumber::Truncate(Sequence);
+                Packet.TrueSequence = Sequence;
+            }
+        };
+
+    int64 TotalSent = 0;
+    int64 Retransmissions = 0;
+    int64 WindowStalls = 0;
+    int64 ResolvedAcks = 0;
+    int64 StaleAcks = 0;
+    int64 WrongAcks = 0;
+    int64 WrongExtensions = 0;
+    int64 DuplicateDeliveries = 0;
+    int32 MaxWindowSpan = 0;
+    int32 Tick = 0;
+    const double StartTime = FPlatformTime::Seconds();
+
+    for (; Tick < MaxTicks; ++Tick)
+    {
+        // 이번 틱에 도착하는 패킷 처리
+        TArray<FSequenceSimPacket> Arrivals = MoveTemp(InFlight[Tick % (MaxDelayTicks + 1)]);
+        InFlight[Tick % (MaxDelayTicks + 1)].Reset();
+        for (int32 Swap = Arrivals.Num() - 1; Swap > 0; --Swap)
+        {
+            Arrivals.Swap(Swap, Random.RandHelper(Swap + 1));
+        }
+
+        for (const FSequenceSimPacket& Packet : Arrivals)
+        {
+            const FPeerId PeerId = PeerIds[Packet.PeerIndex];
+            if (Packet.AckBytes.Num() == 0)
+            {
+                // 받는 쪽: 16비트 번호만으로 복원한 번호가 보낸 번호와 같아야 함
+                const uint32 Extended = Receivers[Packet.PeerIndex].ExtendSequence(Packet.WireSequence);
+                WrongExtensions += Extended != Packet.TrueSequence ? 1 : 0;
+
+                bool bAlreadyDelivered = false;
+                Delivered[Packet.PeerIndex].Add(Extended, &bAlreadyDelivered);
+                DuplicateDeliveries += bAlreadyDelivered ? 1 : 0;
+                UnsentAcks[Packet.PeerIndex].Add(Packet.WireSequence);
+                continue;
+            }
+
+            // 보낸 쪽: 매니저의 ProcessSelectiveAck와 같은 방식으로 (피어, 32비트 번호) 키를 찾음
+            FSelectiveAck Ack;
+            Ack.Deserialize(Packet.AckBytes);
+            const uint32 LastSent = Sender.GetLastReliableSequence(PeerId);
+            Ack.ForEachSequence([&](uint16 AckedSequence)
+                {
+                    const uint32 Sequence = FSequenceNumber::ExtendBefore(AckedSequence, LastSent);
+                    if (Pending.Remove(FPeerRegistry::MakeSequenceKey(PeerId, Sequence)) == 0)
+                    {
+                        ++StaleAcks;
+                        return;
+                    }
+
+                    ++ResolvedAcks;
+                    WrongAcks += Delivered[Packet.PeerIndex].Contains(Sequence) ? 0 : 1;
+                });
+            Sender.GetPendingAckSequences(PeerId).RemoveAll([&Ack, &Pending, PeerId](uint32 Sequence)
+                {
+                    return Ack.Contains(FSequenceNumber::Truncate(Sequence)) && !Pending.Contains(FPeerRegistry::MakeSequenceKey(PeerId, Sequence));
+                });
+        }
+
+        // 틱 끝에 피어별 선택적 ACK를 보냄
+        for (int32 Peer = 0; Peer < PeerCount; ++Peer)
+        {
+            if (UnsentAcks[Peer].Num() == 0)
+            {
+                continue;
+            }
+
+            FSelectiveAck Ack;
+            Ack.Build(UnsentAcks[Peer]);
+            UnsentAcks[Peer].Reset();
+            for (int32 FirstBlock = 0; FirstBlock < Ack.Blocks.Num(); FirstBlock += FSelectiveAck::MAX_BLOCKS_PER_MESSAGE)
+            {
+                if (Random.FRand() >= 0.02f)
+                {
+                    const int32 Count = FMath::Min(FSelectiveAck::MAX_BLOCKS_PER_MESSAGE, Ack.Blocks.Num() - FirstBlock);
+                    FSequenceSimPacket& Packet = InFlight[(Tick + 1 + Random.RandHelper(MaxDelayTicks)) % (MaxDelayTicks + 1)].AddDefaulted_GetRef();
+                    Packet.PeerIndex = Peer;
+                    Packet.AckBytes = Ack.Serialize(FirstBlock, Count);
+                }
+            }
+        }
+
+        // 재전송 타임아웃이 지난 메시지는 같은 번호로 다시 보냄
+        for (TPair<uint64, int32>& Pair : Pending)
+        {
+            if (Tick - Pair.Value >= RetransmitTicks)
+            {
+                Pair.Value = Tick;
+                Transmit(FPeerRegistry::GetSequenceKeyPeer(Pair.Key), FPeerRegistry::GetSequenceKeySequence(Pair.Key), Tick);
+                ++Retransmissions;
+            }
+        }
+
+        // 새 메시지 전송 (시퀀스 윈도우가 차면 다음 틱으로 미룸)
+        if (Tick < SendTicks)
+        {
+            for (int32 Index = 0; Index < MessagesPerTick; ++Index)
+            {
+                const int32 Peer = Index % PeerCount;
+                const FPeerId PeerId = PeerIds[Peer];
+                if (!Sender.CanSendReliable(PeerId))
+                {
+                    ++WindowStalls;
+                    continue;
+                }
+
+                const uint32 Sequence = Sender.AllocateReliableSequence(PeerId);
+                TArray<uint32>& PendingSequences = Sender.GetPendingAckSequences(PeerId);
+                PendingSequences.Add(Sequence);
+                MaxWindowSpan = FMath::Max(MaxWindowSpan, FSequenceNumber::Diff(Sequence, PendingSequences[0]));
+                Pending.Add(FPeerRegistry::MakeSequenceKey(PeerId, Sequence), Tick);
+                Transmit(Peer, Sequence, Tick);
+                ++SentCounts[Peer];
+                ++TotalSent;
+            }
+        }
+        else if (Pending.Num() == 0)
+        {
+            break;
+        }
+    }
+
+    const double Elapsed = FPlatformTime::Seconds() - StartTime;
+    AddInfo(FString::Printf(TEXT("%lld messages over %d simulated ms (%.0f msgs/sec simulated, %.0f msgs/sec wall): %lld retransmissions, %lld ACKs resolved, %lld stale ACKs, %lld window stalls"),
+        TotalSent, Tick, TotalSent * 1000.0 / SendTicks, Elapsed > 0.0 ? TotalSent / Elapsed : 0.0, Retransmissions, ResolvedAcks, StaleAcks, WindowStalls));
+
+    TestEqual(TEXT("Every message should be sent at 100k msgs/sec"), TotalSent, static_cast<int64>(MessagesPerTick) * SendTicks);
+    TestEqual(TEXT("Every pending message should be acknowledged"), Pending.Num(), 0);
+    TestEqual(TEXT("Every ACK should resolve to the message it acknowledges"), WrongAcks, static_cast<int64>(0));
+    TestEqual(TEXT("Every message should be acknowledged exactly once"), ResolvedAcks, TotalSent);
+    TestEqual(TEXT("Receivers should extend every wire sequence correctly"), WrongExtensions, static_cast<int64>(0));
+    TestTrue(TEXT("Loss should force retransmissions and duplicate deliveries"), Retransmissions > 0 && DuplicateDeliveries > 0);
+    TestTrue(TEXT("Pending messages should stay within half the 16-bit space"), MaxWindowSpan < FPeerRegistry::MAX_RELIABLE_SEQUENCE_WINDOW);
+    for (int32 Peer = 0; Peer < PeerCount; ++Peer)
+    {
+        const uint32 LastSent = Sender.GetLastReliableSequence(PeerIds[Peer]);
+        TestTrue(TEXT("Each peer should wrap its 32-bit sequence"), LastSent < StartSequences[Peer]);
+        TestEqual(TEXT("Each peer should receive every message once"), Delivered[Peer].Num(), SentCounts[Peer]);
+        TestEqual(TEXT("Pending list should be empty"), Sender.GetPendingAckSequences(PeerIds[Peer]).Num(), 0);
+    }
+
+    // 매니저 수신 경로: 신뢰성/비신뢰성 공간은 따로 추적되고, 16비트 랩어라운드 뒤에도 중복만 버림
+    FNetworkManager Manager;
+    Manager.SetOrderGuaranteed(false);
+    int32 ReliableReceived = 0;
+    int32 UnreliableReceived = 0;
+    Manager.SubscribeMessage(ENetworkMessageType::FrameSync,
+        FOnNetworkMessageReceived::FDelegate::CreateLambda([&](const FReceivedNetworkMessage& Received)
+            {
+                ++((Received.Message.GetFlags() & FNetworkMessage::FLAG_ACK_REQUIRED) ? ReliableReceived : UnreliableReceived);
+            }));
+
+    const FIPv4Endpoint Peer(FIPv4Address(127, 0, 0, 1), 7000);
+    const int32 StreamLength = 70000;
+    int32 Duplicates = 0;
+    FNetworkMessage Message(ENetworkMessageType::FrameSync, TArray<uint8>({ 1, 2, 3, 4 }));
+    Message.SetProjectId(Manager.GetProjectId());
+    for (int32 Index = 1; Index <= StreamLength; ++Index)
+    {
+        // 같은 번호를 두 공간에 하나씩 보냄 (한 공간으로 추적하면 두 번째가 중복으로 버려짐)
+        Message.SetSequenceNumber(FSequenceNumber::Truncate(Index));
+        Message.SetFlags(FNetworkMessage::FLAG_ACK_REQUIRED);
+        Manager.ProcessReceivedData(Message.Serialize(), Peer);
+        Message.SetFlags(0);
+        Manager.ProcessReceivedData(Message.Serialize(), Peer);
+
+        // 가끔 바로 앞 신뢰성 메시지를 다시 받음 (재전송으로 생긴 중복)
+        if (Index % 997 == 0)
+        {
+            Message.SetSequenceNumber(FSequenceNumber::Truncate(Index - 1));
+            Message.SetFlags(FNetworkMessage::FLAG_ACK_REQUIRED);
+            Manager.ProcessReceivedData(Message.Serialize(), Peer);
+            ++Duplicates;
+        }
+    }
+
+    TestTrue(TEXT("Stream should cross the 16-bit wrap"), StreamLength > 65536 && Duplicates > 0);
+    TestEqual(TEXT("Every reliable message should be delivered once"), ReliableReceived, StreamLength);
+    TestEqual(TEXT("Every unreliable message should be delivered once"), UnreliableReceived, StreamLength);
+    TestEqual(TEXT("No gaps should be reported"), Manager.GetMissingSequences().Num(), 0);
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNetworkUnreliableSequenceGapTest, "MultiServerSync.NetworkManager.UnreliableSequenceGaps", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+bool FNetworkUnreliableSequenceGapTest::RunTest(const FString& Parameters)
+{
+    // 비신뢰성 번호는 발신자 전체에서 하나이므로 한 피어에게는 다른 피어에게 간 번호가 빈 번호로 보임
+    FNetworkManager Manager;
+    Manager.SetOrderGuaranteed(true);
+
+    int32 ReceivedCount = 0;
+    Manager.SubscribeMessage(ENetworkMessageType::FrameSync,
+        FOnNetworkMessageReceived::FDelegate::CreateLambda([&ReceivedCount](const FReceivedNetworkMessage& Received)
+            {
+                ++ReceivedCount;
+            }));
+
+    const FIPv4Endpoint Peer(FIPv4Address(127, 0, 0, 1), 7000);
+    FNetworkMessage Message(ENetworkMessageType::FrameSync, TArray<uint8>({ 1, 2, 3, 4 }));
+    Message.SetProjectId(Manager.GetProjectId());
+
+    // 세 피어에게 번갈아 보낸 스트림 중 이 피어 몫만 받음 (번호 사이마다 빈 번호 둘)
+    const int32 MessageCount = 100;
+    for (int32 Index = 0; Index < MessageCount; ++Index)
+    {
+        Message.SetSequenceNumber(FSequenceNumber::Truncate(1 + Index * 3));
+        Manager.ProcessReceivedData(Message.Serialize(), Peer);
+    }
+
+    TestEqual(TEXT("Unreliable messages after sender-wide gaps should not be held back"), ReceivedCount, MessageCount);
+    TestEqual(TEXT("Sender-wide gaps should not be reported as missing"), Manager.GetMissingSequences().Num(), 0);
+
+    // 같은 번호를 다시 받으면 순서 보장과 관계없이 버림
+    Manager.ProcessReceivedData(Message.Serialize(), Peer);
+    TestEqual(TEXT("Duplicate unreliable message should be dropped"), ReceivedCount, MessageCount);
+
+    return true;
+}
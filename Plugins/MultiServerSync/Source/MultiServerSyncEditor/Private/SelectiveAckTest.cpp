@@ -0,0 +1,230 @@
+﻿// SelectiveAckTest.cpp
+#include "Misc/AutomationTest.h"
+#include "FNetworkManager.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNetworkSelectiveAckTest, "MultiServerSync.NetworkManager.SelectiveAck", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+bool FNetworkSelectiveAckTest::RunTest(const FString& Parameters)
+{
+    // 블록 구성: 65개 범위 안은 한 블록, 그 밖은 새 블록 (uint16 순환 포함)
+    TArray<uint16> Sequences = { 3, 65530, 65535, 0, 1, 3, 40, 200 };
+    FSelectiveAck Ack;
+    Ack.Build(Sequences);
+    TestEqual(TEXT("Block count"), Ack.Blocks.Num(), 2);
+    TestEqual(TEXT("Duplicates should be counted once"), Ack.GetSequenceCount(), 7);
+    TestEqual(TEXT("First block should start before the wrap"), Ack.Blocks[0].BaseSequence, uint16(65530));
+    TestEqual(TEXT("Second block should start past the bitmap"), Ack.Blocks[1].BaseSequence, uint16(200));
+    TestTrue(TEXT("Wrapped sequences should be covered"), Ack.Contains(0) && Ack.Contains(1) && Ack.Contains(40));
+    TestFalse(TEXT("Unreceived sequences should not be covered"), Ack.Contains(2) || Ack.Contains(65531) || Ack.Contains(41));
+
+    FSelectiveAck Parsed;
+    TestTrue(TEXT("Selective ACK should round-trip"), Parsed.Deserialize(Ack.Serialize(0, Ack.Blocks.Num())));
+    TestEqual(TEXT("Round-tripped sequence count"), Parsed.GetSequenceCount(), 7);
+    TestTrue(TEXT("Round-tripped blocks should match"), Parsed.Contains(65535) && Parsed.Contains(200) && !Parsed.Contains(199));
+
+    const uint16 LegacySequence = 1234;
+    TArray<uint8> LegacyPayload;
+    LegacyPayload.SetNum(sizeof(uint16));
+    FMemory::Memcpy(LegacyPayload.GetData(), &LegacySequence, sizeof(uint16));
+    TestTrue(TEXT("Legacy single-sequence ACK should parse"), Parsed.Deserialize(LegacyPayload));
+    TestTrue(TEXT("Legacy ACK should cover only its sequence"), Parsed.GetSequenceCount() == 1 && Parsed.Contains(LegacySequence));
+    TestFalse(TEXT("Truncated ACK should be rejected"), Parsed.Deserialize(TArray<uint8>({ 1, 2, 3 })));
+
+    // 신뢰성 메시지 2000개 (다른 트래픽과 번갈아 시퀀스를 받으므로 번호가 띄엄띄엄함)를 5% 손실, 틱당 최대 50개로 받을 때의 ACK 패킷 수
+    FRandomStream Random(20240521);
+    const int32 MessageCount = 2000;
+    TArray<uint16> Sent;
+    uint16 NextSequence = 65000;
+    for (int32 Index = 0; Index < MessageCount; ++Index)
+    {
+        NextSequence += static_cast<uint16>(1 + Random.RandHelper(3));
+        Sent.Add(NextSequence);
+    }
+
+    int32 Delivered = 0;
+    int32 SelectiveAckPackets = 0;
+    bool bAllCovered = true;
+    bool bNoFalseAck = true;
+    TArray<uint16> TickSequences;
+    TArray<uint16> TickLost;
+    for (int32 Index = 0; Index < MessageCount;)
+    {
+        TickSequences.Reset();
+        TickLost.Reset();
+        const int32 TickCount = 1 + Random.RandHelper(50);
+        for (int32 InTick = 0; InTick < TickCount && Index < MessageCount; ++InTick, ++Index)
+        {
+            (Random.FRand() < 0.05f ? TickLost : TickSequences).Add(Sent[Index]);
+        }
+
+        // 틱 안에서는 도착 순서가 섞임
+        for (int32 Swap = TickSequences.Num() - 1; Swap > 0; --Swap)
+        {
+            TickSequences.Swap(Swap, Random.RandHelper(Swap + 1));
+        }
+
+        Delivered += TickSequences.Num();
+        const TArray<uint16> Expected = TickSequences;
+        Ack.Build(TickSequences);
+        SelectiveAckPackets += FMath::DivideAndRoundUp(Ack.Blocks.Num(), FSelectiveAck::MAX_BLOCKS_PER_MESSAGE);
+
+        Parsed.Deserialize(Ack.Serialize(0, Ack.Blocks.Num()));
+        for (const uint16 Sequence : Expected)
+        {
+            bAllCovered &= Parsed.Contains(Sequence);
+        }
+        for (const uint16 Sequence : TickLost)
+        {
+            bNoFalseAck &= !Parsed.Contains(Sequence);
+        }
+    }
+
+    const double IndividualAcksPerMessage = 1.0;
+    const double SelectiveAcksPerMessage = static_cast<double>(SelectiveAckPackets) / Delivered;
+    AddInfo(FString::Printf(TEXT("%d messages delivered: %d individual ACKs (%.3f per message) vs %d selective ACKs (%.3f per message)"),
+        Delivered, Delivered, IndividualAcksPerMessage, SelectiveAckPackets, SelectiveAcksPerMessage));
+
+    TestTrue(TEXT("Every delivered message should be acknowledged"), bAllCovered);
+    TestTrue(TEXT("Lost messages should never be acknowledged"), bNoFalseAck);
+    TestTrue(TEXT("Selective ACKs should need far fewer packets"), SelectiveAcksPerMessage < 0.1);
+
+    // 누적 ACK 지점: 지점 이하는 모두 확인, 지점 뒤 64개 안의 번호는 지점 블록 비트맵으로 합침 (uint16 순환 포함)
+    // 지점 앞에서 받은 번호는 플래그를 모르는 이전 빌드를 위해 블록에 남음
+    TArray<uint16> InOrder = { 65533, 65534, 65535, 1, 70 };
+    Ack.Build(InOrder);
+    Ack.SetCumulativeAck(65535);
+    TestEqual(TEXT("Cumulative point should be the first block"), Ack.Blocks[0].BaseSequence, uint16(65535));
+    TestEqual(TEXT("Block count with a cumulative point"), Ack.Blocks.Num(), 3);
+    TestEqual(TEXT("Cumulative point should not change the sequence count"), Ack.GetSequenceCount(), 5);
+    TestTrue(TEXT("Cumulative ACK should cover everything up to the point"), Ack.Contains(65000) && Ack.Contains(65535) && Ack.Contains(1) && Ack.Contains(70));
+    TestFalse(TEXT("Cumulative ACK should not cover gaps after the point"), Ack.Contains(0) || Ack.Contains(2) || Ack.Contains(69));
+
+    TestTrue(TEXT("Cumulative ACK should round-trip"), Parsed.Deserialize(Ack.Serialize(0, Ack.Blocks.Num()), true));
+    TestTrue(TEXT("Round-tripped cumulative point"), Parsed.bHasCumulativeAck && Parsed.CumulativeSequence == 65535 && Parsed.Contains(65100));
+    TestTrue(TEXT("Reader without the flag should only see the point block"), Parsed.Deserialize(Ack.Serialize(0, Ack.Blocks.Num())) &&
+        !Parsed.bHasCumulativeAck && Parsed.Contains(65533) && Parsed.Contains(65535) && Parsed.Contains(1) && !Parsed.Contains(65532));
+
+    TArray<uint8> TrailerPayload;
+    Ack.AppendTrailer(TrailerPayload, 0, Ack.Blocks.Num());
+    int32 TrailerPayloadSize = -1;
+    TestTrue(TEXT("Cumulative ACK trailer should be read"), Parsed.ReadTrailer(TrailerPayload, TrailerPayloadSize, true) &&
+        TrailerPayloadSize == 0 && Parsed.IsCumulativelyAcked(65400) && !Parsed.IsCumulativelyAcked(1));
+
+    // ACK 패킷의 30%가 유실될 때 보낸 쪽에 남는 미확인 메시지 (받는 쪽은 모두 순서대로 받음)
+    TArray<uint16> UnackedSelective;
+    TArray<uint16> UnackedCumulative;
+    TArray<uint16> TickReceived;
+    uint16 ReliableSequence = 65500;
+    const int32 AckTicks = 200;
+    for (int32 Tick = 0; Tick < AckTicks; ++Tick)
+    {
+        TickReceived.Reset();
+        for (int32 InTick = 0; InTick < 5; ++InTick)
+        {
+            ++ReliableSequence;
+            TickReceived.Add(ReliableSequence);
+            UnackedSelective.Add(ReliableSequence);
+            UnackedCumulative.Add(ReliableSequence);
+        }
+
+        Ack.Build(TickReceived);
+        Ack.SetCumulativeAck(ReliableSequence);
+        const TArray<uint8> AckPayload = Ack.Serialize(0, Ack.Blocks.Num());
+
+        // 마지막 ACK는 항상 도착
+        if (Tick < AckTicks - 1 && Random.FRand() < 0.3f)
+        {
+            continue;
+        }
+
+        Parsed.Deserialize(AckPayload);
+        UnackedSelective.RemoveAll([&Parsed](uint16 Sequence) { return Parsed.Contains(Sequence); });
+        Parsed.Deserialize(AckPayload, true);
+        UnackedCumulative.RemoveAll([&Parsed](uint16 Sequence) { return Parsed.Contains(Sequence); });
+    }
+
+    AddInfo(FString::Printf(TEXT("%d messages with 30%% ACK loss: %d left unacknowledged without the cumulative point, %d with it"),
+        AckTicks * 5, UnackedSelective.Num(), UnackedCumulative.Num()));
+    TestTrue(TEXT("Lost ACKs should leave messages unacknowledged without a cumulative point"), UnackedSelective.Num() > 0);
+    TestEqual(TEXT("Cumulative point should acknowledge messages whose ACK was lost"), UnackedCumulative.Num(), 0);
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNetworkPiggybackAckTest, "MultiServerSync.NetworkManager.PiggybackAck", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+bool FNetworkPiggybackAckTest::RunTest(const FString& Parameters)
+{
+    const TArray<uint8> FramePayload = { 1, 2, 3, 4 };
+    TArray<uint16> Sequences = { 10, 11, 12, 80 };
+    FSelectiveAck Ack;
+    Ack.Build(Sequences);
+
+    // 페이로드 끝에 블록을 붙인 메시지는 뷰에서 떼어내면 원래 페이로드와 같아짐
+    TArray<uint8> PayloadWithAck = FramePayload;
+    Ack.AppendTrailer(PayloadWithAck, 0, Ack.Blocks.Num());
+    TestEqual(TEXT("Trailer size"), PayloadWithAck.Num(), FramePayload.Num() + FSelectiveAck::GetTrailerSize(2));
+
+    FNetworkMessage Message(ENetworkMessageType::FrameSync, PayloadWithAck);
+    Message.SetFlags(FNetworkMessage::FLAG_HAS_ACK);
+    FNetworkMessageView View(Message);
+
+    FSelectiveAck Detached;
+    TestTrue(TEXT("Piggybacked ACK should be detached"), View.DetachPiggybackAck(Detached));
+    TestTrue(TEXT("Detached ACK should cover the queued sequences"),
+        Detached.GetSequenceCount() == 4 && Detached.Contains(10) && Detached.Contains(12) && Detached.Contains(80) && !Detached.Contains(13));
+    TestTrue(TEXT("Payload should be restored"), View.GetData().Num() == FramePayload.Num() &&
+        FMemory::Memcmp(View.GetData().GetData(), FramePayload.GetData(), FramePayload.Num()) == 0);
+    TestEqual(TEXT("ACK flag should be cleared"), View.GetFlags() & FNetworkMessage::FLAG_HAS_ACK, 0);
+    TestFalse(TEXT("Second detach should fail"), View.DetachPiggybackAck(Detached));
+
+    // 매니저 경로: 구독자는 ACK를 뗀 페이로드를 받고, 잘못된 블록이 실린 메시지는 버림
+    FNetworkManager Manager;
+    Manager.SetOrderGuaranteed(false);
+    TestTrue(TEXT("Piggybacked ACKs should be enabled by default"), Manager.IsPiggybackAcksEnabled());
+    TestTrue(TEXT("Default ACK delay should be shorter than a retry interval"), Manager.GetAckDelay() > 0.0 && Manager.GetAckDelay() < 0.5);
+
+    int32 ReceivedCount = 0;
+    bool bPayloadMatches = true;
+    Manager.SubscribeMessage(ENetworkMessageType::FrameSync,
+        FOnNetworkMessageReceived::FDelegate::CreateLambda([&](const FReceivedNetworkMessage& Received)
+            {
+                ++ReceivedCount;
+                bPayloadMatches &= Received.Payload.Num() == FramePayload.Num() &&
+                    FMemory::Memcmp(Received.Payload.GetData(), FramePayload.GetData(), FramePayload.Num()) == 0;
+            }));
+
+    const FIPv4Endpoint Sender(FIPv4Address(127, 0, 0, 1), 7000);
+    Message.SetProjectId(Manager.GetProjectId());
+    Message.SetSequenceNumber(1);
+    Manager.ProcessReceivedData(Message.Serialize(), Sender);
+    TestEqual(TEXT("Subscriber should receive the message"), ReceivedCount, 1);
+    TestTrue(TEXT("Subscriber should not see the ACK blocks"), bPayloadMatches);
+    TestEqual(TEXT("Piggybacked ACK should be counted"), Manager.GetAckStats().PiggybackedAcksReceived, uint64(1));
+
+    FNetworkMessage Broken(ENetworkMessageType::FrameSync, TArray<uint8>({ 1, 2, 3, 200 }));
+    Broken.SetProjectId(Manager.GetProjectId());
+    Broken.SetSequenceNumber(2);
+    Broken.SetFlags(FNetworkMessage::FLAG_HAS_ACK);
+    Manager.ProcessReceivedData(Broken.Serialize(), Sender);
+    TestEqual(TEXT("Message with a truncated ACK trailer should be dropped"), ReceivedCount, 1);
+
+    // 보내는 쪽: 탐색으로 v2 이상을 합의한 서버에만 ACK를 실음
+    const FIPv4Endpoint PeerEndpoint(FIPv4Address(10, 20, 30, 60), FNetworkManager::DEFAULT_PORT);
+    TestFalse(TEXT("Undiscovered peer should not get piggybacked ACKs"), Manager.IsPiggybackAckPeer(PeerEndpoint));
+
+    FServerEndpoint Server;
+    Server.Id = TEXT("render-node-06");
+    Server.IPAddress = PeerEndpoint.Address;
+    Server.Port = PeerEndpoint.Port;
+    Server.ProtocolVersion = 1;
+    Manager.AddOrUpdateServer(Server);
+    TestFalse(TEXT("v1 peer should not get piggybacked ACKs"), Manager.IsPiggybackAckPeer(PeerEndpoint));
+
+    Server.ProtocolVersion = FNetworkMessage::PIGGYBACK_ACK_VERSION;
+    Manager.AddOrUpdateServer(Server);
+    TestTrue(TEXT("Peer that negotiated the piggyback version should get piggybacked ACKs"), Manager.IsPiggybackAckPeer(PeerEndpoint));
+
+    Manager.SetPiggybackAcksEnabled(false);
+    TestFalse(TEXT("Disabled piggybacking should not be negotiated"), Manager.IsPiggybackAckPeer(PeerEndpoint));
+
+    return true;
+}
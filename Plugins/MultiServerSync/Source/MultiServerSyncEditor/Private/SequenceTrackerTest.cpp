@@ -0,0 +1,275 @@
+﻿// SequenceTrackerTest.cpp
+#include "Misc/AutomationTest.h"
+#include "FNetworkManager.h"
+#include "HAL/PlatformTime.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNetworkSequenceTrackerTest, "MultiServerSync.NetworkManager.SequenceTracker", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+bool FNetworkSequenceTrackerTest::RunTest(const FString& Parameters)
+{
+    constexpr ESequenceAddResult InOrder = ESequenceAddResult::InOrder;
+    constexpr ESequenceAddResult OutOfOrder = ESequenceAddResult::OutOfOrder;
+    constexpr ESequenceAddResult Duplicate = ESequenceAddResult::Duplicate;
+
+    // 순서를 앞질러 받은 번호는 보관되고, 그 앞의 빈 번호는 범위로 조회됨
+    FMessageSequenceTracker Tracker;
+    TestTrue(TEXT("First sequences should be in order"), Tracker.AddSequence(1) == InOrder && Tracker.AddSequence(2) == InOrder);
+    TestTrue(TEXT("Processed sequence should be a duplicate"), Tracker.AddSequence(1) == Duplicate);
+    TestTrue(TEXT("Sequences after a gap should be out of order"),
+        Tracker.AddSequence(5) == OutOfOrder && Tracker.AddSequence(6) == OutOfOrder && Tracker.AddSequence(9) == OutOfOrder);
+    TestTrue(TEXT("Buffered sequence should be a duplicate"), Tracker.AddSequence(5) == Duplicate);
+    TestTrue(TEXT("Buffered sequence should be reported"), Tracker.IsSequenceBuffered(6) && !Tracker.IsSequenceBuffered(7));
+
+    TArray<uint32> Ranges;
+    Tracker.ForEachMissingRange([&Ranges](uint32 FirstSequence, uint32 Count) { Ranges.Add(FirstSequence); Ranges.Add(Count); });
+    TestTrue(TEXT("Missing ranges should be 3-4 and 7-8"), Ranges == TArray<uint32>({ 3, 2, 7, 2 }));
+    TestEqual(TEXT("Missing count"), Tracker.GetMissingCount(), 4);
+    TestEqual(TEXT("Missing sequences should be capped"), Tracker.GetMissingSequences(3).Num(), 3);
+
+    TestTrue(TEXT("Filling the first gap should advance"), Tracker.AddSequence(4) == OutOfOrder && Tracker.AddSequence(3) == InOrder);
+    TestEqual(TEXT("Contiguous buffered sequences should be consumed"), Tracker.LastProcessedSequence, 6u);
+    TestTrue(TEXT("Filling the last gap should advance"), Tracker.AddSequence(7) == InOrder && Tracker.AddSequence(8) == InOrder);
+    TestEqual(TEXT("Every buffered sequence should be consumed"), Tracker.LastProcessedSequence, 9u);
+    TestFalse(TEXT("No retransmission should be needed"), Tracker.NeedsRetransmissionRequest());
+
+    // 보관 중인 메시지가 없으면 멀리 앞선 번호부터 다시 시작
+    TestTrue(TEXT("Far jump should restart the window"), Tracker.AddSequence(10000) == InOrder);
+    TestEqual(TEXT("Far jump should not report the skipped sequences"), Tracker.GetMissingCount(), 0);
+
+    // 32비트 랩어라운드와 순서 보장: 순서 어긋난 메시지가 너무 많으면 누락된 번호를 포기
+    FMessageSequenceTracker Ordered;
+    Ordered.bOrderGuaranteed = true;
+    const uint32 Start = 0xFFFFFFF8u;
+    TestTrue(TEXT("First message should start the stream"), Ordered.AddSequence(Start) == InOrder);
+    for (uint32 Offset = 2; Offset <= static_cast<uint32>(Ordered.MaxOutOfOrderMessages) + 1; ++Offset)
+    {
+        TestTrue(TEXT("Out-of-order message should be deferred"), Ordered.AddSequence(Start + Offset) == OutOfOrder);
+    }
+    TestEqual(TEXT("Nothing should be skipped within the limit"), Ordered.LastProcessedSequence, Start);
+    TestTrue(TEXT("Message over the limit should be deferred"), Ordered.AddSequence(Start + Ordered.MaxOutOfOrderMessages + 2) == OutOfOrder);
+    TestEqual(TEXT("Missing message should be given up across the wrap"), Ordered.LastProcessedSequence, Start + Ordered.MaxOutOfOrderMessages + 2);
+    TestTrue(TEXT("Next message should be in order"), Ordered.AddSequence(Start + Ordered.MaxOutOfOrderMessages + 3) == InOrder);
+    TestTrue(TEXT("Given-up message should be a duplicate"), Ordered.AddSequence(Start + 1) == Duplicate);
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNetworkSequenceTrackerPermanentHoleTest, "MultiServerSync.NetworkManager.SequenceTrackerPermanentHole", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+bool FNetworkSequenceTrackerPermanentHoleTest::RunTest(const FString& Parameters)
+{
+    const uint32 Window = FMessageSequenceTracker::WINDOW_CAPACITY;
+
+    // 영구히 유실된 번호 뒤로 윈도우보다 많은 메시지가 와도 순서 보장 여부와 관계없이 계속 받아야 함
+    for (const bool bOrdered : { false, true })
+    {
+        FMessageSequenceTracker Tracker;
+        Tracker.bOrderGuaranteed = bOrdered;
+        TestTrue(TEXT("First message should start the stream"), Tracker.AddSequence(1) == ESequenceAddResult::InOrder);
+
+        // 2는 영구 유실
+        const uint32 Last = Window * 3;
+        int32 Rejected = 0;
+        for (uint32 Sequence = 3; Sequence <= Last; ++Sequence)
+        {
+            if (Tracker.AddSequence(Sequence) == ESequenceAddResult::Duplicate)
+            {
+                ++Rejected;
+            }
+        }
+        TestEqual(TEXT("Every message after the hole should be accepted"), Rejected, 0);
+        TestEqual(TEXT("Processing should advance past the hole"), Tracker.LastProcessedSequence, Last);
+        TestFalse(TEXT("Given-up hole should not need retransmission"), Tracker.NeedsRetransmissionRequest());
+        TestTrue(TEXT("Messages behind the window edge should still be duplicates"),
+            Tracker.AddSequence(3) == ESequenceAddResult::Duplicate && Tracker.AddSequence(Last) == ESequenceAddResult::Duplicate);
+    }
+
+    // 윈도우 끝을 넘는 번호가 오면 그 번호가 들어갈 만큼만 밀고 나머지 빈 번호는 계속 추적
+    FMessageSequenceTracker Tracker;
+    Tracker.AddSequence(1);
+    Tracker.AddSequence(3);
+    Tracker.AddSequence(5);
+    Tracker.AddSequence(10);
+    const uint32 BeyondWindow = 4 + Window;
+    TestTrue(TEXT("Sequence beyond the window should be tracked"),
+        Tracker.AddSequence(BeyondWindow) == ESequenceAddResult::OutOfOrder && Tracker.IsSequenceBuffered(BeyondWindow));
+    TestEqual(TEXT("Window should slide over the oldest gaps only"), Tracker.LastProcessedSequence, 5u);
+    TestTrue(TEXT("Later buffered sequence should be kept"), Tracker.IsSequenceBuffered(10));
+    TestTrue(TEXT("Given-up sequence should be a duplicate"), Tracker.AddSequence(4) == ESequenceAddResult::Duplicate);
+    TestTrue(TEXT("Gap inside the window should still be accepted"), Tracker.AddSequence(6) == ESequenceAddResult::InOrder);
+
+    return true;
+}
+
+namespace NetworkManagerTestUtils
+{
+    /** 비트맵 이전의 배열 기반 시퀀스 추적기 (벤치마크 비교용) */
+    struct FArraySequenceTracker
+    {
+        uint32 LastProcessedSequence = 0;
+        uint32 NextExpectedSequence = 1;
+        TArray<uint32> ReceivedSequences;
+        TSet<uint32> MissingSequences;
+        int32 SequenceWindowSize = 100;
+
+        bool AddSequence(uint32 Sequence)
+        {
+            if (ReceivedSequences.Num() > 0 && !FSequenceNumber::IsAfter(Sequence, LastProcessedSequence))
+                return false;
+
+            const int32 Offset = FSequenceNumber::Diff(Sequence, LastProcessedSequence);
+            if (ReceivedSequences.Num() > 0 && (Offset < 0 || Offset > SequenceWindowSize))
+                return false;
+
+            if (ReceivedSequences.Contains(Sequence))
+                return false;
+
+            ReceivedSequences.Add(Sequence);
+            if (Sequence != NextExpectedSequence && FSequenceNumber::IsAfter(Sequence, NextExpectedSequence))
+            {
+                for (uint32 Missing = NextExpectedSequence; Missing != Sequence; Missing++)
+                {
+                    if (!ReceivedSequences.Contains(Missing))
+                    {
+                        MissingSequences.Add(Missing);
+                    }
+                }
+            }
+
+            ReceivedSequences.Sort([](uint32 A, uint32 B) { return FSequenceNumber::IsAfter(B, A); });
+            uint32 LastSequential = LastProcessedSequence;
+            for (uint32 Current : ReceivedSequences)
+            {
+                if (Current != LastSequential + 1)
+                    break;
+                LastSequential = Current;
+                MissingSequences.Remove(Current);
+            }
+
+            if (LastSequential != LastProcessedSequence)
+            {
+                LastProcessedSequence = LastSequential;
+                NextExpectedSequence = LastProcessedSequence + 1;
+                ReceivedSequences.RemoveAll([this](uint32 Seq) { return !FSequenceNumber::IsAfter(Seq, LastProcessedSequence); });
+            }
+            return true;
+        }
+    };
+
+    /**
+     * 수신 순서 생성: 이웃과 자리를 바꾸고, 손실된 번호는 재전송 요청을 받은 것처럼 LossDelay개 뒤에 다시 도착하며, 일부는 두 번 도착
+     */
+    static TArray<uint32> BuildArrivalOrder(uint32 FirstSequence, int32 Count, float ReorderChance, float LossChance, float DuplicateChance, int32 LossDelay, FRandomStream& Random)
+    {
+        TArray<uint32> Arrivals;
+        TArray<TPair<int32, uint32>> Resends;
+        int32 ResendHead = 0;
+        for (int32 Index = 0; Index < Count; ++Index)
+        {
+            const uint32 Sequence = FirstSequence + Index;
+            if (Random.FRand() < LossChance)
+            {
+                Resends.Emplace(Index + LossDelay, Sequence);
+            }
+            else
+            {
+                Arrivals.Add(Sequence);
+                if (Random.FRand() < DuplicateChance)
+                {
+                    Arrivals.Add(Sequence);
+                }
+            }
+
+            while (ResendHead < Resends.Num() && Resends[ResendHead].Key <= Index)
+            {
+                Arrivals.Add(Resends[ResendHead++].Value);
+            }
+        }
+        while (ResendHead < Resends.Num())
+        {
+            Arrivals.Add(Resends[ResendHead++].Value);
+        }
+
+        for (int32 Index = 0; Index + 1 < Arrivals.Num(); ++Index)
+        {
+            if (Random.FRand() < ReorderChance)
+            {
+                Arrivals.Swap(Index, Index + 1);
+            }
+        }
+        return Arrivals;
+    }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNetworkSequenceTrackerBenchmark, "MultiServerSync.NetworkManager.Benchmark.SequenceTracker", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+bool FNetworkSequenceTrackerBenchmark::RunTest(const FString& Parameters)
+{
+    using namespace NetworkManagerTestUtils;
+
+    struct FScenario
+    {
+        const TCHAR* Name;
+        float ReorderChance;
+        float LossChance;
+        float DuplicateChance;
+    };
+    const FScenario Scenarios[] =
+    {
+        { TEXT("in order"), 0.0f, 0.0f, 0.0f },
+        { TEXT("10% reorder"), 0.1f, 0.0f, 0.0f },
+        { TEXT("10% reorder, 1% loss, 1% duplicates"), 0.1f, 0.01f, 0.01f },
+        { TEXT("10% reorder, 5% loss, 1% duplicates"), 0.1f, 0.05f, 0.01f },
+    };
+
+    // 32비트 랩어라운드를 지나도록 시작 번호를 잡음
+    const int32 PacketCount = 500000;
+    const int32 LossDelay = 64;
+    const uint32 FirstSequence = 0xFFFFFFFFu - PacketCount / 2;
+
+    for (const FScenario& Scenario : Scenarios)
+    {
+        FRandomStream Random(20240625);
+        const TArray<uint32> Arrivals = BuildArrivalOrder(FirstSequence, PacketCount, Scenario.ReorderChance, Scenario.LossChance, Scenario.DuplicateChance, LossDelay, Random);
+
+        // 비트맵 추적기: 16비트 번호를 복원해 추가 (매니저 수신 경로와 같음)
+        FMessageSequenceTracker Tracker;
+        Tracker.LastProcessedSequence = FirstSequence - 1;
+        Tracker.NextExpectedSequence = FirstSequence;
+        Tracker.HighestReceivedSequence = FirstSequence - 1;
+        Tracker.bSynchronized = true;
+
+        int32 Accepted = 0;
+        int32 MaxMissing = 0;
+        double StartTime = FPlatformTime::Seconds();
+        for (int32 Index = 0; Index < Arrivals.Num(); ++Index)
+        {
+            Accepted += Tracker.AddSequence(Tracker.ExtendSequence(FSequenceNumber::Truncate(Arrivals[Index]))) != ESequenceAddResult::Duplicate ? 1 : 0;
+
+            // 재전송 요청 주기마다 누락 범위 조회
+            if ((Index & 1023) == 0)
+            {
+                MaxMissing = FMath::Max(MaxMissing, Tracker.GetMissingCount());
+            }
+        }
+        const double BitmapNs = (FPlatformTime::Seconds() - StartTime) * 1e9 / Arrivals.Num();
+
+        FArraySequenceTracker ArrayTracker;
+        ArrayTracker.LastProcessedSequence = FirstSequence - 1;
+        ArrayTracker.NextExpectedSequence = FirstSequence;
+
+        StartTime = FPlatformTime::Seconds();
+        for (int32 Index = 0; Index < Arrivals.Num(); ++Index)
+        {
+            ArrayTracker.AddSequence(Arrivals[Index]);
+        }
+        const double ArrayNs = (FPlatformTime::Seconds() - StartTime) * 1e9 / Arrivals.Num();
+
+        AddInfo(FString::Printf(TEXT("%s: %d arrivals, bitmap %.1f ns/packet (peak %d missing), array %.1f ns/packet (%.1fx)"),
+            Scenario.Name, Arrivals.Num(), BitmapNs, MaxMissing, ArrayNs, BitmapNs > 0.0 ? ArrayNs / BitmapNs : 0.0));
+
+        TestEqual(FString::Printf(TEXT("%s: every sequence should be accepted once"), Scenario.Name), Accepted, PacketCount);
+        TestEqual(FString::Printf(TEXT("%s: stream should be fully processed across the wrap"), Scenario.Name),
+            Tracker.LastProcessedSequence, FirstSequence + PacketCount - 1);
+        TestFalse(FString::Printf(TEXT("%s: no gaps should remain"), Scenario.Name), Tracker.NeedsRetransmissionRequest());
+    }
+
+    return true;
+}
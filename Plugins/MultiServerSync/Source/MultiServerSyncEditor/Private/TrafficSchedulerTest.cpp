@@ -0,0 +1,113 @@
+﻿// TrafficSchedulerTest.cpp
+#include "Misc/AutomationTest.h"
+#include "FNetworkManager.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNetworkTrafficSchedulerTest, "MultiServerSync.NetworkManager.TrafficScheduler", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+bool FNetworkTrafficSchedulerTest::RunTest(const FString& Parameters)
+{
+    TestTrue(TEXT("PTP should use the clock class"), FNetworkManager::GetTrafficClassForMessageType(ENetworkMessageType::TimeSync) == ETrafficClass::Clock);
+    TestTrue(TEXT("Pings should use the clock class"), FNetworkManager::GetTrafficClassForMessageType(ENetworkMessageType::PingResponse) == ETrafficClass::Clock);
+    TestTrue(TEXT("Frame sync should use the frame class"), FNetworkManager::GetTrafficClassForMessageType(ENetworkMessageType::FrameSync) == ETrafficClass::Frame);
+    TestTrue(TEXT("ACKs should use the control class"), FNetworkManager::GetTrafficClassForMessageType(ENetworkMessageType::MessageAck) == ETrafficClass::Control);
+    TestTrue(TEXT("Fragments should use the bulk class"), FNetworkManager::GetTrafficClassForMessageType(ENetworkMessageType::Fragment) == ETrafficClass::Bulk);
+
+    const FIPv4Address Loopback(127, 0, 0, 1);
+    TUniquePtr<INetworkTransport> Sender = INetworkTransport::Create(EReceiveBackend::SingleRead, Loopback, 0, TEXT("MultiServerSyncTest_SchedulerSender"));
+    TUniquePtr<INetworkTransport> Receiver = INetworkTransport::Create(EReceiveBackend::BatchRecvMmsg, Loopback, 0, TEXT("MultiServerSyncTest_SchedulerReceiver"));
+    if (!TestNotNull(TEXT("Sender socket should be created"), Sender.Get()) || !TestNotNull(TEXT("Receiver socket should be created"), Receiver.Get()))
+    {
+        return false;
+    }
+
+    const FIPv4Endpoint Target(Loopback, Receiver->GetLocalPort());
+
+    // 받은 순서대로 각 데이터그램의 첫 바이트(클래스 표식)를 모음
+    auto ReceiveMarkers = [&Receiver]()
+    {
+        TArray<uint8> Markers;
+        FReceivedDatagram Batch[INetworkTransport::MAX_RECEIVE_BATCH];
+        while (Receiver->WaitForRead(FTimespan::FromMilliseconds(100)))
+        {
+            const int32 Received = Receiver->ReceiveBatch(Batch, INetworkTransport::MAX_RECEIVE_BATCH);
+            if (Received == 0)
+            {
+                break;
+            }
+
+            for (int32 Index = 0; Index < Received; ++Index)
+            {
+                Markers.Add(Batch[Index].Size > 0 ? Batch[Index].Data[0] : 0);
+                Batch[Index].Buffer.SafeRelease();
+            }
+        }
+        return Markers;
+    };
+
+    const int32 BulkSize = 1200;
+    const int32 FloodCount = 100;
+    uint8 BulkData[BulkSize];
+    FMemory::Memset(BulkData, 'B', BulkSize);
+    uint8 ClockData[64];
+    FMemory::Memset(ClockData, 'C', sizeof(ClockData));
+
+    // 페이싱하지 않으면 대량 전송 뒤에 보낸 시간 메시지는 대량 전송이 모두 도착한 뒤에 도착
+    for (int32 Index = 0; Index < FloodCount; ++Index)
+    {
+        Sender->SendTo(BulkData, BulkSize, Target);
+    }
+    Sender->SendTo(ClockData, sizeof(ClockData), Target);
+    const int32 UnpacedPosition = ReceiveMarkers().Find('C');
+
+    // 버킷 16KB(데이터그램 13개), 대기열 64개로 제한
+    FTrafficScheduler Scheduler;
+    Scheduler.SetClassConfig(ETrafficClass::Bulk, FTrafficClassConfig(1024 * 1024, 16 * 1024, 64, 0));
+
+    for (int32 Index = 0; Index < FloodCount; ++Index)
+    {
+        Scheduler.Send(ETrafficClass::Bulk, Sender.Get(), BulkData, BulkSize, Target, 0.0);
+    }
+    TestTrue(TEXT("Clock datagram should be sent immediately"), Scheduler.Send(ETrafficClass::Clock, Sender.Get(), ClockData, sizeof(ClockData), Target, 0.0));
+
+    const FTrafficClassStats& BulkStats = Scheduler.GetStats(ETrafficClass::Bulk);
+    TestEqual(TEXT("Only the burst should leave before pacing"), BulkStats.SentDatagrams, uint64(13));
+    TestEqual(TEXT("Queue depth"), BulkStats.QueueDepth, 64);
+    TestEqual(TEXT("Datagrams beyond the queue limit should be dropped"), BulkStats.DroppedDatagrams, uint64(FloodCount - 13 - 64));
+    TestEqual(TEXT("Clock class should never queue"), Scheduler.GetStats(ETrafficClass::Clock).QueueDepth, 0);
+
+    const int32 PacedPosition = ReceiveMarkers().Find('C');
+    AddInfo(FString::Printf(TEXT("Clock datagram arrived behind %d bulk datagrams unpaced, %d with bulk pacing"), UnpacedPosition, PacedPosition));
+    TestEqual(TEXT("Clock datagram should only wait behind the bulk burst"), PacedPosition, 13);
+
+    // 토큰이 충전되는 만큼 대기열을 보내고, 다 보내면 대기열이 비어야 함
+    double Now = 0.0;
+    while (Scheduler.GetTotalQueueDepth() > 0 && Now < 1.0)
+    {
+        Now += 0.005;
+        Scheduler.Pump(Now);
+    }
+
+    TestEqual(TEXT("Queue should drain"), BulkStats.QueueDepth, 0);
+    TestEqual(TEXT("Peak queue depth"), BulkStats.PeakQueueDepth, 64);
+    TestEqual(TEXT("Every queued datagram should be paced out"), BulkStats.PacedDatagrams, uint64(64));
+    TestTrue(TEXT("Draining 64 datagrams at 1 MB/s should take about 60 ms"), Now > 0.05 && Now < 0.1);
+
+    // 엄격한 우선순위: 같은 피어의 제어 대기열이 밀려 있으면 대량 전송은 앞지르지 않음
+    Scheduler.SetClassConfig(ETrafficClass::Control, FTrafficClassConfig(1000, 100, 16, 0));
+    Scheduler.ResetStats();
+    ReceiveMarkers();
+
+    uint8 ControlData[64];
+    FMemory::Memset(ControlData, 'R', sizeof(ControlData));
+    const double Later = Now + 1.0;
+    Scheduler.Send(ETrafficClass::Control, Sender.Get(), ControlData, sizeof(ControlData), Target, Later);
+    Scheduler.Send(ETrafficClass::Control, Sender.Get(), ControlData, sizeof(ControlData), Target, Later);
+    Scheduler.Send(ETrafficClass::Bulk, Sender.Get(), BulkData, BulkSize, Target, Later);
+    TestEqual(TEXT("Bulk should wait behind the control backlog"), Scheduler.GetStats(ETrafficClass::Bulk).QueueDepth, 1);
+
+    Scheduler.Pump(Later + 0.1);
+    TestTrue(TEXT("Control backlog should leave before bulk"), ReceiveMarkers() == TArray<uint8>({ 'R', 'R', 'B' }));
+
+    Sender->Close();
+    Receiver->Close();
+    return true;
+}
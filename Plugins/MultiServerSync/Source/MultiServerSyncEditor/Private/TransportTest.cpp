@@ -0,0 +1,591 @@
+﻿// TransportTest.cpp
+#include "Misc/AutomationTest.h"
+#include "FNetworkManager.h"
+#include "NetworkTestUtils.h"
+#include "HAL/RunnableThread.h"
+#include "HAL/PlatformTime.h"
+#include "Serialization/MemoryWriter.h"
+
+#if PLATFORM_LINUX
+#include <time.h>
+#endif
+
+namespace NetworkManagerTestUtils
+{
+    /** 현재 스레드가 사용한 CPU 시간 (초, 지원하지 않는 플랫폼에서는 0) */
+    static double GetThreadCpuSeconds()
+    {
+#if PLATFORM_LINUX
+        timespec CpuTime;
+        if (clock_gettime(CLOCK_THREAD_CPUTIME_ID, &CpuTime) == 0)
+        {
+            return CpuTime.tv_sec + CpuTime.tv_nsec * 1e-9;
+        }
+#endif
+        return 0.0;
+    }
+
+    /** 루프백 폭주 수신 결과 */
+    struct FFloodResult
+    {
+        int64 ReceivedPackets = 0;
+        double PacketsPerSecond = 0.0;
+        double SyscallsPerPacket = 0.0;
+        double CpuMsPer100kPackets = 0.0; // 수신 스레드 CPU 시간 (10으로 나누면 100k pps에서 필요한 코어 비율 %)
+        FString BackendName;
+    };
+
+    /**
+     * 지정한 수신 백엔드로 루프백 폭주 트래픽을 받아 처리량과 패킷당 시스템 콜 수 측정
+     */
+    static bool MeasureLoopbackFlood(EReceiveBackend Backend, int32 PacketCount, FFloodResult& OutResult)
+    {
+        TUniquePtr<INetworkTransport> Receiver = INetworkTransport::Create(Backend, FIPv4Address(127, 0, 0, 1), 0, TEXT("MultiServerSyncTest_FloodReceiver"));
+        FSocket* SenderSocket = CreateLoopbackSocket(TEXT("MultiServerSyncTest_FloodSender"));
+        if (!Receiver || !SenderSocket)
+        {
+            DestroySocket(SenderSocket);
+            return false;
+        }
+
+        TAtomic<int64> ReceivedPackets(0);
+        TAtomic<double> FirstReceiveTime(0.0);
+        TAtomic<double> LastReceiveTime(0.0);
+        TAtomic<double> FirstCpuTime(0.0);
+        TAtomic<double> LastCpuTime(0.0);
+
+        FNetworkReceiverWorker* Worker = new FNetworkReceiverWorker(Receiver.Get(),
+            [&](const FReceivedDatagram* Datagrams, int32 Count)
+            {
+                const double Now = FPlatformTime::Seconds();
+                const double CpuNow = GetThreadCpuSeconds();
+                if (ReceivedPackets.Load() == 0)
+                {
+                    FirstReceiveTime = Now;
+                    FirstCpuTime = CpuNow;
+                }
+                LastReceiveTime = Now;
+                LastCpuTime = CpuNow;
+                ReceivedPackets += Count;
+            }, EReceiverWaitMode::EventDriven);
+
+        FRunnableThread* Thread = FRunnableThread::Create(Worker, TEXT("MultiServerSyncTest_FloodThread"));
+
+        TSharedRef<FInternetAddr> TargetAddr = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->CreateInternetAddr();
+        TargetAddr->SetIp(FIPv4Address(127, 0, 0, 1).Value);
+        TargetAddr->SetPort(Receiver->GetLocalPort());
+
+        // ACK/핑 응답 크기의 작은 패킷을 연속 전송
+        TArray<uint8> Payload;
+        Payload.SetNumZeroed(sizeof(FNetworkMessageHeader) + 8);
+        for (int32 Index = 0; Index < PacketCount; ++Index)
+        {
+            int32 BytesSent = 0;
+            SenderSocket->SendTo(Payload.GetData(), Payload.Num(), BytesSent, *TargetAddr);
+        }
+
+        // 수신이 멈출 때까지 대기
+        int64 LastCount = -1;
+        while (LastCount != ReceivedPackets.Load())
+        {
+            LastCount = ReceivedPackets.Load();
+            FPlatformProcess::Sleep(0.2f);
+        }
+
+        Thread->Kill(true);
+        delete Thread;
+        delete Worker;
+
+        const FTransportStats Stats = Receiver->GetStats();
+        const double Elapsed = LastReceiveTime.Load() - FirstReceiveTime.Load();
+
+        OutResult.ReceivedPackets = ReceivedPackets.Load();
+        OutResult.PacketsPerSecond = Elapsed > 0.0 ? OutResult.ReceivedPackets / Elapsed : 0.0;
+        OutResult.SyscallsPerPacket = Stats.ReceivedDatagrams > 0 ? double(Stats.ReceiveSyscalls) / double(Stats.ReceivedDatagrams) : 0.0;
+        OutResult.CpuMsPer100kPackets = OutResult.ReceivedPackets > 0 ? (LastCpuTime.Load() - FirstCpuTime.Load()) * 1000.0 * 100000.0 / OutResult.ReceivedPackets : 0.0;
+        OutResult.BackendName = Receiver->GetBackendName();
+
+        Receiver->Close();
+        DestroySocket(SenderSocket);
+
+        return OutResult.ReceivedPackets > 0;
+    }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNetworkReceiveBackendBenchmark, "MultiServerSync.NetworkManager.Benchmark.ReceiveBackend", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+bool FNetworkReceiveBackendBenchmark::RunTest(const FString& Parameters)
+{
+    using namespace NetworkManagerTestUtils;
+
+    const int32 PacketCount = 200000;
+
+    FFloodResult SingleReadResult;
+    FFloodResult BatchResult;
+
+    TestTrue(TEXT("SingleRead flood should receive packets"),
+        MeasureLoopbackFlood(EReceiveBackend::SingleRead, PacketCount, SingleReadResult));
+    TestTrue(TEXT("BatchRecvMmsg flood should receive packets"),
+        MeasureLoopbackFlood(EReceiveBackend::BatchRecvMmsg, PacketCount, BatchResult));
+
+    AddInfo(FString::Printf(TEXT("SingleRead:    %lld packets, %.0f pps, %.3f syscalls/packet"),
+        SingleReadResult.ReceivedPackets, SingleReadResult.PacketsPerSecond, SingleReadResult.SyscallsPerPacket));
+    AddInfo(FString::Printf(TEXT("BatchRecvMmsg: %lld packets, %.0f pps, %.3f syscalls/packet"),
+        BatchResult.ReceivedPackets, BatchResult.PacketsPerSecond, BatchResult.SyscallsPerPacket));
+
+#if PLATFORM_LINUX
+    TestTrue(TEXT("recvmmsg should need fewer syscalls per packet than single reads"),
+        BatchResult.SyscallsPerPacket <= SingleReadResult.SyscallsPerPacket);
+#endif
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNetworkFanOutBenchmark, "MultiServerSync.NetworkManager.Benchmark.FanOut", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+bool FNetworkFanOutBenchmark::RunTest(const FString& Parameters)
+{
+    using namespace NetworkManagerTestUtils;
+
+    const int32 Rounds = 200;
+    const int32 ClusterSizes[] = { 4, 16, 64 };
+
+    // 모든 127.0.0.x 주소로 오는 패킷을 받는 싱크 소켓
+    TUniquePtr<INetworkTransport> Sink = INetworkTransport::Create(EReceiveBackend::SingleRead, FIPv4Address::Any, 0, TEXT("MultiServerSyncTest_FanOutSink"));
+    TestNotNull(TEXT("Sink socket should be created"), Sink.Get());
+    if (!Sink)
+    {
+        return false;
+    }
+
+    // 프레임 동기화 메시지 크기의 페이로드
+    TArray<uint8> FramePayload;
+    FramePayload.SetNumZeroed(sizeof(int64));
+    FNetworkMessage Message(ENetworkMessageType::FrameSync, FramePayload);
+
+    const EReceiveBackend Backends[] = { EReceiveBackend::SingleRead, EReceiveBackend::BatchRecvMmsg };
+    for (EReceiveBackend Backend : Backends)
+    {
+        TUniquePtr<INetworkTransport> Sender = INetworkTransport::Create(Backend, FIPv4Address(127, 0, 0, 1), 0, TEXT("MultiServerSyncTest_FanOutSender"));
+        if (!Sender)
+        {
+            continue;
+        }
+
+        for (int32 ClusterSize : ClusterSizes)
+        {
+            TArray<FIPv4Endpoint> Targets;
+            for (int32 Index = 0; Index < ClusterSize; ++Index)
+            {
+                Targets.Add(FIPv4Endpoint(FIPv4Address(127, 0, 0, 1 + Index), Sink->GetLocalPort()));
+            }
+
+            // 이전 방식: 대상마다 직렬화 후 개별 전송
+            const double PerTargetStart = FPlatformTime::Seconds();
+            for (int32 Round = 0; Round < Rounds; ++Round)
+            {
+                for (const FIPv4Endpoint& Target : Targets)
+                {
+                    TArray<uint8> Data = Message.Serialize();
+                    Sender->SendTo(Data.GetData(), Data.Num(), Target);
+                }
+            }
+            const double PerTargetSeconds = FPlatformTime::Seconds() - PerTargetStart;
+
+            // 팬아웃 방식: 한 번 직렬화 후 모든 대상에 제출
+            Sender->ResetStats();
+            const double FanOutStart = FPlatformTime::Seconds();
+            for (int32 Round = 0; Round < Rounds; ++Round)
+            {
+                TArray<uint8> Data = Message.Serialize();
+                Sender->SendToMany(Data.GetData(), Data.Num(), Targets.GetData(), Targets.Num());
+            }
+            const double FanOutSeconds = FPlatformTime::Seconds() - FanOutStart;
+            const FTransportStats Stats = Sender->GetStats();
+
+            AddInfo(FString::Printf(TEXT("%s, %2d nodes: per-target %.2f us/broadcast, fan-out %.2f us/broadcast, %.2f syscalls/broadcast"),
+                Sender->GetBackendName(), ClusterSize,
+                PerTargetSeconds * 1000000.0 / Rounds, FanOutSeconds * 1000000.0 / Rounds,
+                double(Stats.SendSyscalls) / Rounds));
+
+            TestEqual(TEXT("Fan-out should reach every target"), Stats.SentDatagrams, uint64(Rounds * ClusterSize));
+        }
+    }
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNetworkZeroCopyReceiveTest, "MultiServerSync.NetworkManager.ZeroCopyReceive", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+bool FNetworkZeroCopyReceiveTest::RunTest(const FString& Parameters)
+{
+    using namespace NetworkManagerTestUtils;
+
+    const int32 WarmUpPackets = 2000;
+    const int32 MeasuredPackets = 20000;
+
+    // 핑 요청 패킷 준비
+    FPingMessage Ping;
+    Ping.Type = EPingMessageType::Request;
+    Ping.Timestamp = 123456789;
+    Ping.SequenceNumber = 1;
+
+    TArray<uint8> PingBytes;
+    FMemoryWriter Writer(PingBytes);
+    Ping.Serialize(Writer);
+    const TArray<uint8> Packet = FNetworkMessage(ENetworkMessageType::PingRequest, PingBytes).Serialize();
+
+    const EReceiveBackend Backends[] = { EReceiveBackend::SingleRead, EReceiveBackend::BatchRecvMmsg };
+    for (EReceiveBackend Backend : Backends)
+    {
+        TUniquePtr<INetworkTransport> Receiver = INetworkTransport::Create(Backend, FIPv4Address(127, 0, 0, 1), 0, TEXT("MultiServerSyncTest_ZeroCopyReceiver"));
+        FSocket* SenderSocket = CreateLoopbackSocket(TEXT("MultiServerSyncTest_ZeroCopySender"));
+        if (!Receiver || !SenderSocket)
+        {
+            DestroySocket(SenderSocket);
+            AddError(TEXT("Failed to create loopback sockets"));
+            return false;
+        }
+
+        TAtomic<int64> ParsedPackets(0);
+
+        // 수신 버퍼를 직접 가리키는 뷰로 파싱 (FNetworkManager::ProcessReceivedBatch와 같은 경로)
+        FNetworkReceiverWorker* Worker = new FNetworkReceiverWorker(Receiver.Get(),
+            [&ParsedPackets](const FReceivedDatagram* Datagrams, int32 Count)
+            {
+                for (int32 Index = 0; Index < Count; ++Index)
+                {
+                    FNetworkMessageView View;
+                    FPingMessage Parsed;
+                    if (View.Parse(TArrayView<const uint8>(Datagrams[Index].Data, Datagrams[Index].Size)) &&
+                        Parsed.Deserialize(View.GetData()))
+                    {
+                        ParsedPackets++;
+                    }
+                }
+            }, EReceiverWaitMode::EventDriven);
+
+        FRunnableThread* Thread = FRunnableThread::Create(Worker, TEXT("MultiServerSyncTest_ZeroCopyThread"));
+
+        TSharedRef<FInternetAddr> TargetAddr = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->CreateInternetAddr();
+        TargetAddr->SetIp(FIPv4Address(127, 0, 0, 1).Value);
+        TargetAddr->SetPort(Receiver->GetLocalPort());
+
+        auto SendPackets = [&](int32 Count)
+        {
+            for (int32 Index = 0; Index < Count; ++Index)
+            {
+                int32 BytesSent = 0;
+                SenderSocket->SendTo(Packet.GetData(), Packet.Num(), BytesSent, *TargetAddr);
+            }
+
+            // 수신이 멈출 때까지 대기
+            int64 LastCount = -1;
+            while (LastCount != ParsedPackets.Load())
+            {
+                LastCount = ParsedPackets.Load();
+                FPlatformProcess::Sleep(0.1f);
+            }
+        };
+
+        // 워밍업으로 풀을 정상 상태까지 채움
+        SendPackets(WarmUpPackets);
+        const uint64 AllocationsAfterWarmUp = Receiver->GetPacketPool().GetAllocationCount();
+        const int64 ParsedAfterWarmUp = ParsedPackets.Load();
+
+        SendPackets(MeasuredPackets);
+        const uint64 AllocationsAfterRun = Receiver->GetPacketPool().GetAllocationCount();
+        const int64 ParsedDuringRun = ParsedPackets.Load() - ParsedAfterWarmUp;
+
+        Thread->Kill(true);
+        delete Thread;
+        delete Worker;
+
+        AddInfo(FString::Printf(TEXT("%s: %lld packets parsed, %llu pool allocations during warm-up, %llu during run"),
+            Receiver->GetBackendName(), ParsedDuringRun, AllocationsAfterWarmUp, AllocationsAfterRun - AllocationsAfterWarmUp));
+
+        TestTrue(TEXT("Packets should be parsed from pooled buffers"), ParsedDuringRun > 0);
+        TestEqual(TEXT("Steady-state receive should not allocate packet buffers"), AllocationsAfterRun, AllocationsAfterWarmUp);
+
+        Receiver->Close();
+        DestroySocket(SenderSocket);
+    }
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNetworkMaxSizeDatagramTest, "MultiServerSync.NetworkManager.MaxSizeDatagram", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+bool FNetworkMaxSizeDatagramTest::RunTest(const FString& Parameters)
+{
+    using namespace NetworkManagerTestUtils;
+
+    // 최대 크기 데이터그램이 모든 수신 백엔드에서 잘리지 않고 도착해야 함
+    // (io_uring 제공 버퍼는 데이터그램 앞에 수신 결과 헤더와 발신자 주소를 함께 받음)
+    TArray<uint8> Packet;
+    Packet.SetNumUninitialized(INetworkTransport::MAX_DATAGRAM_SIZE);
+    for (int32 Index = 0; Index < Packet.Num(); ++Index)
+    {
+        Packet[Index] = static_cast<uint8>(Index * 31 + 7);
+    }
+
+    const EReceiveBackend Backends[] = { EReceiveBackend::SingleRead, EReceiveBackend::BatchRecvMmsg, EReceiveBackend::IoUring };
+    for (EReceiveBackend Backend : Backends)
+    {
+        TUniquePtr<INetworkTransport> Receiver = INetworkTransport::Create(Backend, FIPv4Address(127, 0, 0, 1), 0, TEXT("MultiServerSyncTest_MaxSizeReceiver"));
+        FSocket* SenderSocket = CreateLoopbackSocket(TEXT("MultiServerSyncTest_MaxSizeSender"));
+        if (!Receiver || !SenderSocket)
+        {
+            DestroySocket(SenderSocket);
+            AddError(TEXT("Failed to create loopback sockets"));
+            return false;
+        }
+
+        TSharedRef<FInternetAddr> TargetAddr = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->CreateInternetAddr();
+        TargetAddr->SetIp(FIPv4Address(127, 0, 0, 1).Value);
+        TargetAddr->SetPort(Receiver->GetLocalPort());
+
+        int32 BytesSent = 0;
+        TestTrue(TEXT("Max-size datagram should be sent"),
+            SenderSocket->SendTo(Packet.GetData(), Packet.Num(), BytesSent, *TargetAddr) && BytesSent == Packet.Num());
+
+        FReceivedDatagram Datagrams[INetworkTransport::MAX_RECEIVE_BATCH];
+        int32 ReceivedCount = 0;
+        const double Deadline = FPlatformTime::Seconds() + 1.0;
+        while (ReceivedCount == 0 && FPlatformTime::Seconds() < Deadline)
+        {
+            ReceivedCount = Receiver->ReceiveBatch(Datagrams, INetworkTransport::MAX_RECEIVE_BATCH);
+            if (ReceivedCount == 0)
+            {
+                FPlatformProcess::Sleep(0.001f);
+            }
+        }
+
+        const FString BackendName = Receiver->GetBackendName();
+        TestEqual(FString::Printf(TEXT("%s should receive the datagram"), *BackendName), ReceivedCount, 1);
+        if (ReceivedCount == 1)
+        {
+            TestTrue(FString::Printf(TEXT("%s should deliver the whole datagram"), *BackendName),
+                Datagrams[0].Size == Packet.Num() && FMemory::Memcmp(Datagrams[0].Data, Packet.GetData(), Packet.Num()) == 0);
+        }
+        TestEqual(FString::Printf(TEXT("%s should not truncate"), *BackendName), Receiver->GetStats().TruncatedDatagrams, uint64(0));
+
+        for (FReceivedDatagram& Datagram : Datagrams)
+        {
+            Datagram = FReceivedDatagram();
+        }
+        Receiver->Close();
+        DestroySocket(SenderSocket);
+    }
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNetworkMulticastTransportTest, "MultiServerSync.NetworkManager.MulticastTransport", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+bool FNetworkMulticastTransportTest::RunTest(const FString& Parameters)
+{
+    const FIPv4Address Loopback(127, 0, 0, 1);
+    const FMulticastSettings Defaults;
+    const int32 MemberCount = 3;
+
+    TestTrue(TEXT("Default group should be a multicast address"), Defaults.GroupAddress.IsMulticastAddress());
+    TestTrue(TEXT("Announcements should be cluster-wide"), FNetworkManager::IsClusterWideMessageType(ENetworkMessageType::MasterAnnouncement));
+    TestTrue(TEXT("PTP messages should be cluster-wide"), FNetworkManager::IsClusterWideMessageType(ENetworkMessageType::TimeSync));
+    TestTrue(TEXT("Frame sync should be cluster-wide"), FNetworkManager::IsClusterWideMessageType(ENetworkMessageType::FrameSync));
+    TestFalse(TEXT("Pings should stay unicast"), FNetworkManager::IsClusterWideMessageType(ENetworkMessageType::PingRequest));
+
+    // 같은 그룹 포트를 공유하는 가입 소켓 여러 개로 한 호스트에서 클러스터를 흉내 냄
+    TArray<TUniquePtr<INetworkTransport>> Members;
+    Members.Add(INetworkTransport::Create(EReceiveBackend::SingleRead, FIPv4Address::Any, 0, TEXT("MultiServerSyncTest_MulticastMember_0")));
+    if (!TestNotNull(TEXT("Member socket should be created"), Members[0].Get()))
+    {
+        return false;
+    }
+
+    const uint16 GroupPort = Members[0]->GetLocalPort();
+    for (int32 Index = 1; Index < MemberCount; ++Index)
+    {
+        Members.Add(INetworkTransport::Create(EReceiveBackend::SingleRead, FIPv4Address::Any, GroupPort, FString::Printf(TEXT("MultiServerSyncTest_MulticastMember_%d"), Index)));
+        if (!TestNotNull(TEXT("Member socket should share the group port"), Members.Last().Get()))
+        {
+            return false;
+        }
+    }
+
+    for (TUniquePtr<INetworkTransport>& Member : Members)
+    {
+        if (!Member->EnableMulticast(Defaults.GroupAddress, Loopback, 1, true))
+        {
+            AddWarning(TEXT("Multicast is not available on the loopback interface, skipping"));
+            return true;
+        }
+    }
+
+    TUniquePtr<INetworkTransport> Sender = INetworkTransport::Create(EReceiveBackend::SingleRead, FIPv4Address::Any, 0, TEXT("MultiServerSyncTest_MulticastSender"));
+    if (!TestNotNull(TEXT("Sender socket should be created"), Sender.Get()) || !Sender->EnableMulticast(Defaults.GroupAddress, Loopback, 1, true))
+    {
+        return false;
+    }
+
+    // 그룹으로 한 번 전송하면 모든 가입 소켓이 받아야 함
+    TArray<uint8> FramePayload;
+    FramePayload.SetNumZeroed(sizeof(int64));
+    TArray<uint8> Data = FNetworkMessage(ENetworkMessageType::FrameSync, FramePayload).Serialize();
+
+    TestTrue(TEXT("Multicast send should succeed"), Sender->SendTo(Data.GetData(), Data.Num(), FIPv4Endpoint(Defaults.GroupAddress, GroupPort)));
+    TestEqual(TEXT("One multicast send should cost one syscall regardless of member count"), Sender->GetStats().SendSyscalls, uint64(1));
+
+    FReceivedDatagram Batch[INetworkTransport::MAX_RECEIVE_BATCH];
+    for (int32 Index = 0; Index < MemberCount; ++Index)
+    {
+        int32 Received = 0;
+        if (Members[Index]->WaitForRead(FTimespan::FromMilliseconds(500)))
+        {
+            Received = Members[Index]->ReceiveBatch(Batch, INetworkTransport::MAX_RECEIVE_BATCH);
+        }
+
+        TestEqual(FString::Printf(TEXT("Member %d should receive the multicast datagram"), Index), Received, 1);
+        if (Received == 1)
+        {
+            TestEqual(TEXT("Received datagram should be the whole message"), Batch[0].Size, Data.Num());
+        }
+        Batch[0].Buffer.SafeRelease();
+    }
+
+    Sender->Close();
+    for (TUniquePtr<INetworkTransport>& Member : Members)
+    {
+        Member->Close();
+    }
+
+    return true;
+}
+
+namespace NetworkManagerTestUtils
+{
+    /** 표준 편차 */
+    static double GetStandardDeviation(const TArray<double>& Samples)
+    {
+        if (Samples.Num() < 2)
+        {
+            return 0.0;
+        }
+
+        double Mean = 0.0;
+        for (double Sample : Samples)
+        {
+            Mean += Sample;
+        }
+        Mean /= Samples.Num();
+
+        double SquaredSum = 0.0;
+        for (double Sample : Samples)
+        {
+            SquaredSum += (Sample - Mean) * (Sample - Mean);
+        }
+
+        return FMath::Sqrt(SquaredSum / (Samples.Num() - 1));
+    }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNetworkReceiveTimestampBenchmark, "MultiServerSync.NetworkManager.Benchmark.ReceiveTimestamps", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+bool FNetworkReceiveTimestampBenchmark::RunTest(const FString& Parameters)
+{
+    using namespace NetworkManagerTestUtils;
+
+    const int32 SampleCount = 300;
+
+    TUniquePtr<INetworkTransport> Receiver = INetworkTransport::Create(EReceiveBackend::BatchRecvMmsg, FIPv4Address(127, 0, 0, 1), 0, TEXT("MultiServerSyncTest_TimestampReceiver"));
+    TUniquePtr<INetworkTransport> Sender = INetworkTransport::Create(EReceiveBackend::SingleRead, FIPv4Address(127, 0, 0, 1), 0, TEXT("MultiServerSyncTest_TimestampSender"));
+    TestNotNull(TEXT("Receiver should be created"), Receiver.Get());
+    TestNotNull(TEXT("Sender should be created"), Sender.Get());
+    if (!Receiver || !Sender)
+    {
+        return false;
+    }
+
+    const FIPv4Endpoint Target(FIPv4Address(127, 0, 0, 1), Receiver->GetLocalPort());
+    const double MicrosecondsPerCycle = FPlatformTime::GetSecondsPerCycle64() * 1000000.0;
+    FRandomStream Random(1234);
+    uint8 Payload[32] = { 0 };
+
+    // 송신자와 수신자가 같은 시계를 쓰므로 참 오프셋은 0이고, 측정한 오프셋(T2 - T1)의 흔들림이 곧 타임스탬프 잡음
+    TArray<double> HandlingOffsets;
+    TArray<double> ArrivalOffsets;
+    FReceivedDatagram Datagrams[INetworkTransport::MAX_RECEIVE_BATCH];
+
+    for (int32 Sample = 0; Sample < SampleCount; ++Sample)
+    {
+        const uint64 SendCycles = FPlatformTime::Cycles64();
+        if (!Sender->SendTo(Payload, sizeof(Payload), Target))
+        {
+            continue;
+        }
+
+        // 수신 스레드 깨어남, 스레드 전환, 인박스 대기를 흉내낸 처리 지연 (0~2ms)
+        FPlatformProcess::Sleep(Random.FRandRange(0.0f, 0.002f));
+
+        int32 Count = 0;
+        for (int32 Attempt = 0; Attempt < 10 && Count == 0; ++Attempt)
+        {
+            Receiver->WaitForRead(FTimespan::FromMilliseconds(100));
+            Count = Receiver->ReceiveBatch(Datagrams, UE_ARRAY_COUNT(Datagrams));
+        }
+        const uint64 HandleCycles = FPlatformTime::Cycles64();
+
+        if (Count > 0)
+        {
+            HandlingOffsets.Add((double(HandleCycles) - double(SendCycles)) * MicrosecondsPerCycle);
+            ArrivalOffsets.Add((double(Datagrams[0].ReceiveCycles) - double(SendCycles)) * MicrosecondsPerCycle);
+        }
+
+        for (int32 Index = 0; Index < Count; ++Index)
+        {
+            Datagrams[Index].Buffer.SafeRelease();
+        }
+    }
+
+    const double HandlingJitter = GetStandardDeviation(HandlingOffsets);
+    const double ArrivalJitter = GetStandardDeviation(ArrivalOffsets);
+    const uint64 KernelTimestamped = Receiver->GetStats().KernelTimestampedDatagrams;
+
+    AddInfo(FString::Printf(TEXT("Handling time: offset median %.1f us, stddev %.1f us (%d samples)"),
+        GetPercentile(HandlingOffsets, 0.5), HandlingJitter, HandlingOffsets.Num()));
+    AddInfo(FString::Printf(TEXT("Arrival time:  offset median %.1f us, stddev %.1f us (%s, %llu kernel timestamps)"),
+        GetPercentile(ArrivalOffsets, 0.5), ArrivalJitter, Receiver->GetBackendName(), KernelTimestamped));
+
+    TestTrue(TEXT("Loopback samples should be received"), ArrivalOffsets.Num() > SampleCount / 2);
+
+#if PLATFORM_LINUX
+    TestTrue(TEXT("Datagrams should carry kernel receive timestamps"), KernelTimestamped > 0);
+    TestTrue(TEXT("Kernel arrival timestamps should have less offset jitter than handling time"), ArrivalJitter < HandlingJitter);
+#endif
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNetworkIoUringBenchmark, "MultiServerSync.NetworkManager.Benchmark.IoUringBackend", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+bool FNetworkIoUringBenchmark::RunTest(const FString& Parameters)
+{
+    using namespace NetworkManagerTestUtils;
+
+    const int32 PacketCount = 200000;
+
+    FFloodResult BatchResult;
+    FFloodResult RingResult;
+
+    TestTrue(TEXT("BatchRecvMmsg flood should receive packets"),
+        MeasureLoopbackFlood(EReceiveBackend::BatchRecvMmsg, PacketCount, BatchResult));
+    TestTrue(TEXT("IoUring flood should receive packets"),
+        MeasureLoopbackFlood(EReceiveBackend::IoUring, PacketCount, RingResult));
+
+    AddInfo(FString::Printf(TEXT("epoll + recvmmsg: %lld packets, %.0f pps, %.3f syscalls/packet, %.1f CPU ms per 100k packets"),
+        BatchResult.ReceivedPackets, BatchResult.PacketsPerSecond, BatchResult.SyscallsPerPacket, BatchResult.CpuMsPer100kPackets));
+    AddInfo(FString::Printf(TEXT("%s: %lld packets, %.0f pps, %.3f syscalls/packet, %.1f CPU ms per 100k packets"),
+        *RingResult.BackendName, RingResult.ReceivedPackets, RingResult.PacketsPerSecond, RingResult.SyscallsPerPacket, RingResult.CpuMsPer100kPackets));
+
+    // 커널이나 빌드가 io_uring을 지원하지 않으면 recvmmsg로 대체되므로 비교하지 않음
+    if (RingResult.BackendName == TEXT("io_uring"))
+    {
+        TestTrue(TEXT("io_uring should need fewer syscalls per packet than recvmmsg"),
+            RingResult.SyscallsPerPacket <= BatchResult.SyscallsPerPacket);
+    }
+
+    return true;
+}